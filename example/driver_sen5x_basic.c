@@ -58,6 +58,7 @@ uint8_t sen5x_basic_init(sen5x_type_t type)
     DRIVER_SEN5X_LINK_IIC_READ_COMMAND(&gs_handle, sen5x_interface_iic_read_cmd);
     DRIVER_SEN5X_LINK_DELAY_MS(&gs_handle, sen5x_interface_delay_ms);
     DRIVER_SEN5X_LINK_DEBUG_PRINT(&gs_handle, sen5x_interface_debug_print);
+    DRIVER_SEN5X_LINK_TIMESTAMP_US(&gs_handle, sen5x_interface_timestamp_us);
     
     /* set the type */
     res = sen5x_set_type(&gs_handle, type);
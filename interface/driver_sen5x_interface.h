@@ -99,6 +99,13 @@ uint8_t sen5x_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
  */
 void sen5x_interface_delay_ms(uint32_t ms);
 
+/**
+ * @brief  interface timestamp
+ * @return monotonic time in us
+ * @note   return 0 without a clock, sen5x_init ignores a clock that doesn't move
+ */
+uint64_t sen5x_interface_timestamp_us(void);
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
@@ -37,6 +37,7 @@
 #include "driver_sen5x_interface.h"
 #include "iic.h"
 #include <stdarg.h>
+#include <time.h>
 
 /**
  * @brief iic device name definition
@@ -112,6 +113,20 @@ void sen5x_interface_delay_ms(uint32_t ms)
     usleep(1000 * ms);
 }
 
+/**
+ * @brief  interface timestamp
+ * @return monotonic time in us
+ * @note   none
+ */
+uint64_t sen5x_interface_timestamp_us(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000;
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
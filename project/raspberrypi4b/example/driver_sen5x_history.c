@@ -0,0 +1,405 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_history.c
+ * @brief     driver sen5x history source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_history.h"
+#include "file.h"
+#include <stdlib.h>
+#include <time.h>
+
+static int gs_history_fd;               /**< archive file handle */
+static uint32_t gs_history_seed;        /**< random seed */
+
+/**
+ * @brief     history example emit block
+ * @param[in] *block pointer to a block buffer
+ * @param[in] len block length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_history_emit(const uint8_t *block, uint32_t len)
+{
+    return file_write(gs_history_fd, block, len);
+}
+
+/**
+ * @brief  history example random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_history_random(void)
+{
+    gs_history_seed = gs_history_seed * 1664525U + 1013904223U;
+    
+    return gs_history_seed >> 8;
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in seconds
+ * @note   none
+ */
+static double a_history_now(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief     history example generate a synthetic 1 Hz measured values archive
+ * @param[in] *name pointer to a file name buffer
+ * @param[in] days archive days
+ * @return    status code
+ *            - 0 success
+ *            - 1 generate failed
+ * @note      pm2.5 has rare multi hour episodes so threshold queries hit few blocks,
+ *            the file functions come from the host project
+ */
+uint8_t sen5x_history_generate(char *name, uint32_t days)
+{
+    static uint8_t block[SEN5X_ARCHIVE_BLOCK_SIZE];
+    uint8_t res;
+    uint32_t i;
+    uint32_t d;
+    uint32_t episode;
+    int32_t pm;
+    int32_t humidity;
+    int32_t temperature;
+    int32_t voc;
+    int32_t nox;
+    int32_t level;
+    uint64_t ms;
+    uint16_t word[SEN5X_ARCHIVE_MAX_CHANNELS];
+    sen5x_archive_encoder_t encoder;
+    
+    /* create the file */
+    if (file_open_write(name, &gs_history_fd) != 0)
+    {
+        return 1;
+    }
+    res = sen5x_archive_encoder_init(&encoder, SEN5X_ARCHIVE_LAYOUT_MEASURED, block, SEN5X_ARCHIVE_BLOCK_SIZE, a_history_emit);
+    if (res != 0)
+    {
+        (void)file_close(gs_history_fd);
+        
+        return 1;
+    }
+    
+    /* 1 Hz random walks */
+    gs_history_seed = 0x5EA5;
+    pm = 80;
+    humidity = 4500;
+    temperature = 4600;
+    voc = 1000;
+    nox = 10;
+    ms = 1760000000000ULL;
+    for (d = 0; d < days; d++)
+    {
+        /* one day in twenty has a three hour episode */
+        episode = ((a_history_random() % 20) == 0) ? (a_history_random() % 21) * 3600 : 0xFFFFFFFFU;
+        for (i = 0; i < 86400; i++)
+        {
+            ms += 1000;
+            pm += (int32_t)(a_history_random() % 7) - 3;
+            pm = (pm < 20) ? 20 : ((pm > 400) ? 400 : pm);
+            humidity += (int32_t)(a_history_random() % 9) - 4;
+            humidity = (humidity < 1000) ? 1000 : ((humidity > 9000) ? 9000 : humidity);
+            temperature += (int32_t)(a_history_random() % 5) - 2;
+            temperature = (temperature < -2000) ? -2000 : ((temperature > 10000) ? 10000 : temperature);
+            voc += (int32_t)(a_history_random() % 7) - 3;
+            voc = (voc < 10) ? 10 : ((voc > 5000) ? 5000 : voc);
+            nox += (int32_t)(a_history_random() % 3) - 1;
+            nox = (nox < 10) ? 10 : ((nox > 5000) ? 5000 : nox);
+            level = pm;
+            if ((i >= episode) && (i < episode + 3 * 3600))
+            {
+                level += 3000 - (int32_t)((i - episode) * 3000 / (3 * 3600));
+            }
+            word[0] = (uint16_t)(level * 8 / 10);
+            word[1] = (uint16_t)level;
+            word[2] = (uint16_t)(level + level / 10);
+            word[3] = (uint16_t)(level + level / 8);
+            word[4] = (uint16_t)humidity;
+            word[5] = (uint16_t)temperature;
+            word[6] = (uint16_t)voc;
+            word[7] = (uint16_t)nox;
+            res = sen5x_archive_encode(&encoder, ms, word);
+            if (res != 0)
+            {
+                (void)file_close(gs_history_fd);
+                
+                return 1;
+            }
+        }
+    }
+    res = sen5x_archive_flush(&encoder);
+    if (file_close(gs_history_fd) != 0)
+    {
+        return 1;
+    }
+    
+    return (res == 0) ? 0 : 1;
+}
+
+/**
+ * @brief      scan a whole archive file without the index
+ * @param[in]  *name pointer to a file name buffer
+ * @param[in]  start_ms first timestamp
+ * @param[in]  end_ms last timestamp
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  filter_enable filter enable flag
+ * @param[out] *count pointer to a sample count buffer
+ * @param[out] *sum pointer to a value sum buffer
+ * @param[out] *blocks pointer to a block count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ * @note       every block is read and decoded, as parsing a plain log file does
+ */
+static uint8_t a_history_scan(char *name, uint64_t start_ms, uint64_t end_ms, sen5x_query_filter_t *filter,
+                            uint8_t filter_enable, uint64_t *count, double *sum, uint32_t *blocks)
+{
+    static uint8_t buf[256 * SEN5X_ARCHIVE_BLOCK_SIZE];
+    int fd;
+    uint32_t len;
+    uint32_t i;
+    int32_t value;
+    uint64_t ms;
+    uint16_t word[SEN5X_ARCHIVE_MAX_CHANNELS];
+    sen5x_archive_decoder_t decoder;
+    
+    /* open the file */
+    if (file_open_read(name, &fd) != 0)
+    {
+        return 1;
+    }
+    *count = 0;
+    *sum = 0.0;
+    *blocks = 0;
+    while (1)
+    {
+        /* read a chunk */
+        if (file_read(fd, buf, sizeof(buf), &len) != 0)
+        {
+            (void)file_close(fd);
+            
+            return 1;
+        }
+        if (len == 0)
+        {
+            break;
+        }
+        
+        /* decode every block */
+        for (i = 0; (i + SEN5X_ARCHIVE_BLOCK_SIZE) <= len; i += SEN5X_ARCHIVE_BLOCK_SIZE)
+        {
+            (*blocks)++;
+            if (sen5x_archive_decoder_init(&decoder, &buf[i], SEN5X_ARCHIVE_BLOCK_SIZE) != 0)
+            {
+                continue;
+            }
+            while (sen5x_archive_decode(&decoder, &ms, word) == 0)
+            {
+                if ((ms < start_ms) || (ms > end_ms) ||
+                    (sen5x_archive_get_value((sen5x_archive_layout_t)decoder.header.layout, filter->channel,
+                                             word[filter->channel], &value) != 0))
+                {
+                    continue;
+                }
+                if ((filter_enable != 0) && ((value < filter->min) || (value > filter->max)))
+                {
+                    continue;
+                }
+                (*count)++;
+                *sum += value;
+            }
+        }
+    }
+    
+    return file_close(fd);
+}
+
+/**
+ * @brief     history example run an archive query
+ * @param[in] *name pointer to a file name buffer
+ * @param[in] start_ms first timestamp
+ * @param[in] end_ms last timestamp
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] filter_enable filter enable flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the index is kept next to the archive as <name>.idx, the result is checked against a full scan
+ */
+uint8_t sen5x_history_query(char *name, uint64_t start_ms, uint64_t end_ms, sen5x_query_filter_t *filter,
+                            uint8_t filter_enable)
+{
+    uint8_t res;
+    int fd;
+    char index_name[272];
+    const uint8_t *archive;
+    const uint8_t *index;
+    uint8_t *buf;
+    uint64_t archive_size;
+    uint64_t index_size;
+    uint64_t count;
+    uint64_t scan_count;
+    uint64_t ms;
+    uint32_t scan_blocks;
+    int32_t value;
+    double sum;
+    double scan_sum;
+    double t;
+    double query_s;
+    double scan_s;
+    uint16_t word[SEN5X_ARCHIVE_MAX_CHANNELS];
+    sen5x_query_t query;
+    sen5x_query_iterator_t iterator;
+    
+    /* map the archive */
+    if (file_map(name, &archive, &archive_size) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: map %s failed.\n", name);
+        
+        return 1;
+    }
+    
+    /* map the index or build it once */
+    snprintf(index_name, sizeof(index_name), "%s.idx", name);
+    index = NULL;
+    index_size = 0;
+    if ((file_map(index_name, &index, &index_size) != 0) ||
+        (sen5x_query_init(&query, archive, archive_size, SEN5X_ARCHIVE_BLOCK_SIZE, index, index_size) != 0))
+    {
+        if (index != NULL)
+        {
+            (void)file_unmap(index, index_size);
+        }
+        index_size = SEN5X_QUERY_INDEX_SIZE(archive_size / SEN5X_ARCHIVE_BLOCK_SIZE);
+        buf = (uint8_t *)malloc((size_t)index_size);
+        if (buf == NULL)
+        {
+            (void)file_unmap(archive, archive_size);
+            
+            return 1;
+        }
+        t = a_history_now();
+        res = sen5x_query_build_index(archive, archive_size, SEN5X_ARCHIVE_BLOCK_SIZE, buf, index_size);
+        if ((res != 0) || (file_open_write(index_name, &fd) != 0))
+        {
+            free(buf);
+            (void)file_unmap(archive, archive_size);
+            
+            return 1;
+        }
+        res = file_write(fd, buf, index_size);
+        res |= file_close(fd);
+        free(buf);
+        if ((res != 0) || (file_map(index_name, &index, &index_size) != 0))
+        {
+            (void)file_unmap(archive, archive_size);
+            
+            return 1;
+        }
+        sen5x_interface_debug_print("sen5x: build index %s in %0.3fs.\n", index_name, a_history_now() - t);
+        res = sen5x_query_init(&query, archive, archive_size, SEN5X_ARCHIVE_BLOCK_SIZE, index, index_size);
+        if (res != 0)
+        {
+            (void)file_unmap(index, index_size);
+            (void)file_unmap(archive, archive_size);
+            
+            return 1;
+        }
+    }
+    sen5x_interface_debug_print("sen5x: archive is %0.1fMB in %d blocks, index is %0.1fMB.\n",
+                                archive_size / 1048576.0, query.blocks, index_size / 1048576.0);
+    
+    /* indexed query over the cold mapped files */
+    (void)file_drop_cache(name);
+    (void)file_drop_cache(index_name);
+    count = 0;
+    sum = 0.0;
+    t = a_history_now();
+    res = sen5x_query_begin(&query, start_ms, end_ms, (filter_enable != 0) ? filter : NULL, &iterator);
+    if (res != 0)
+    {
+        (void)file_unmap(index, index_size);
+        (void)file_unmap(archive, archive_size);
+        
+        return 1;
+    }
+    while (sen5x_query_next(&query, &iterator, &ms, word) == 0)
+    {
+        if (sen5x_archive_get_value((sen5x_archive_layout_t)iterator.decoder.header.layout, filter->channel,
+                                    word[filter->channel], &value) == 0)
+        {
+            count++;
+            sum += value;
+        }
+    }
+    query_s = a_history_now() - t;
+    (void)file_unmap(index, index_size);
+    (void)file_unmap(archive, archive_size);
+    
+    /* full scan of the cold file */
+    (void)file_drop_cache(name);
+    t = a_history_now();
+    if (a_history_scan(name, start_ms, end_ms, filter, filter_enable, &scan_count, &scan_sum, &scan_blocks) != 0)
+    {
+        return 1;
+    }
+    scan_s = a_history_now() - t;
+    
+    /* print the result */
+    sen5x_interface_debug_print("sen5x: channel %d matched %lld samples, mean value %0.2f.\n",
+                                filter->channel, (long long)count, (count != 0) ? sum / count : 0.0);
+    sen5x_interface_debug_print("sen5x: index query decoded %d blocks, skipped %d blocks, %d corrupt in %0.4fs.\n",
+                                iterator.blocks_read, iterator.blocks_skipped, iterator.blocks_corrupt, query_s);
+    sen5x_interface_debug_print("sen5x: full scan decoded %d blocks in %0.4fs.\n", scan_blocks, scan_s);
+    sen5x_interface_debug_print("sen5x: speedup is %0.1fx.\n", (query_s > 0.0) ? scan_s / query_s : 0.0);
+    if ((scan_count != count) || (scan_sum != sum))
+    {
+        sen5x_interface_debug_print("sen5x: index query and full scan don't match.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
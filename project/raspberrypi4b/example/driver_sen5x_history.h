@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_history.h
+ * @brief     driver sen5x history header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_HISTORY_H
+#define DRIVER_SEN5X_HISTORY_H
+
+#include "driver_sen5x_interface.h"
+#include "driver_sen5x_query.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup sen5x_example_driver
+ * @{
+ */
+
+/**
+ * @brief     history example generate a synthetic 1 Hz measured values archive
+ * @param[in] *name pointer to a file name buffer
+ * @param[in] days archive days
+ * @return    status code
+ *            - 0 success
+ *            - 1 generate failed
+ * @note      pm2.5 has rare multi hour episodes so threshold queries hit few blocks,
+ *            the file functions come from the host project
+ */
+uint8_t sen5x_history_generate(char *name, uint32_t days);
+
+/**
+ * @brief     history example run an archive query
+ * @param[in] *name pointer to a file name buffer
+ * @param[in] start_ms first timestamp
+ * @param[in] end_ms last timestamp
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] filter_enable filter enable flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the index is kept next to the archive as <name>.idx, the result is checked against a full scan
+ */
+uint8_t sen5x_history_query(char *name, uint64_t start_ms, uint64_t end_ms, sen5x_query_filter_t *filter,
+                            uint8_t filter_enable);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
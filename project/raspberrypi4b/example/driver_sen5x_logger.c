@@ -0,0 +1,315 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_logger.c
+ * @brief     driver sen5x logger source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_logger.h"
+#include "file.h"
+#include <time.h>
+
+static int gs_logger_fd;        /**< log file handle */
+
+/**
+ * @brief      log file read
+ * @param[in]  offset file offset
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len buffer length
+ * @param[out] *read_len pointer to a read length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_logger_file_read(uint64_t offset, uint8_t *buf, uint32_t len, uint32_t *read_len)
+{
+    return file_read_at(gs_logger_fd, offset, buf, len, read_len);
+}
+
+/**
+ * @brief     log file write
+ * @param[in] offset file offset
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_logger_file_write(uint64_t offset, const uint8_t *buf, uint32_t len)
+{
+    return file_write_at(gs_logger_fd, offset, buf, len);
+}
+
+/**
+ * @brief  log file sync
+ * @return status code
+ *         - 0 success
+ *         - 1 sync failed
+ * @note   none
+ */
+static uint8_t a_logger_file_sync(void)
+{
+    return file_sync(gs_logger_fd);
+}
+
+/**
+ * @brief     log file truncate
+ * @param[in] len file length
+ * @return    status code
+ *            - 0 success
+ *            - 1 truncate failed
+ * @note      none
+ */
+static uint8_t a_logger_file_truncate(uint64_t len)
+{
+    return file_truncate(gs_logger_fd, len);
+}
+
+/**
+ * @brief      log file size
+ * @param[out] *size pointer to a size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+static uint8_t a_logger_file_size(uint64_t *size)
+{
+    return file_size(gs_logger_fd, size);
+}
+
+/**
+ * @brief  log timestamp
+ * @return timestamp in us
+ * @note   none
+ */
+static uint64_t a_logger_timestamp_us(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief  get the monotonic time
+ * @return time in seconds
+ * @note   none
+ */
+static double a_logger_now(void)
+{
+    return (double)a_logger_timestamp_us() / 1e6;
+}
+
+/**
+ * @brief     open and recover the log
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] *name pointer to a file name buffer
+ * @param[in] *buf pointer to a group commit buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      none
+ */
+static uint8_t a_logger_open(sen5x_log_handle_t *handle, char *name, uint8_t *buf, uint32_t len)
+{
+    if (file_open_rw(name, &gs_logger_fd) != 0)
+    {
+        return 1;
+    }
+    DRIVER_SEN5X_LOG_LINK_INIT(handle, sen5x_log_handle_t);
+    DRIVER_SEN5X_LOG_LINK_FILE_READ(handle, a_logger_file_read);
+    DRIVER_SEN5X_LOG_LINK_FILE_WRITE(handle, a_logger_file_write);
+    DRIVER_SEN5X_LOG_LINK_FILE_SYNC(handle, a_logger_file_sync);
+    DRIVER_SEN5X_LOG_LINK_FILE_TRUNCATE(handle, a_logger_file_truncate);
+    DRIVER_SEN5X_LOG_LINK_FILE_SIZE(handle, a_logger_file_size);
+    DRIVER_SEN5X_LOG_LINK_TIMESTAMP_US(handle, a_logger_timestamp_us);
+    DRIVER_SEN5X_LOG_LINK_DEBUG_PRINT(handle, sen5x_interface_debug_print);
+    if (sen5x_log_init(handle, buf, len) != 0)
+    {
+        (void)file_close(gs_logger_fd);
+        
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: recovered %lld samples, truncated %lld torn bytes.\n",
+                                (long long)handle->report.recovered_samples, (long long)handle->report.truncated_bytes);
+    
+    return 0;
+}
+
+/**
+ * @brief     get a sync latency percentile from the histogram
+ * @param[in] *report pointer to a report structure
+ * @param[in] percent percentile
+ * @return    latency upper bound in us
+ * @note      none
+ */
+static uint32_t a_logger_percentile(sen5x_log_report_t *report, double percent)
+{
+    uint32_t i;
+    uint64_t sum;
+    
+    sum = 0;
+    for (i = 0; i < SEN5X_LOG_HISTOGRAM_BUCKETS; i++)
+    {
+        sum += report->sync_us_histogram[i];
+        if ((double)sum >= (double)report->commits * percent / 100.0)
+        {
+            return 2U << i;
+        }
+    }
+    
+    return 2U << (SEN5X_LOG_HISTOGRAM_BUCKETS - 1);
+}
+
+/**
+ * @brief     logger example run the log
+ * @param[in] *name pointer to a file name buffer
+ * @param[in] samples appended samples
+ * @param[in] commit_samples group commit samples
+ * @param[in] commit_ms group commit time span
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 group commit policy is invalid
+ * @note      a torn record is appended at the end to show the recovery, the file functions come from the host
+ *            project
+ */
+uint8_t sen5x_logger_run(char *name, uint32_t samples, uint32_t commit_samples, uint32_t commit_ms)
+{
+    static uint8_t buf[4096 * SEN5X_LOG_RECORD_LENGTH];
+    const uint8_t torn[13] = {0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5};
+    uint32_t i;
+    uint64_t count;
+    double t;
+    sen5x_store_sample_t sample;
+    sen5x_log_handle_t handle;
+    sen5x_log_report_t report;
+    
+    /* open and recover */
+    if (a_logger_open(&handle, name, buf, sizeof(buf)) != 0)
+    {
+        return 1;
+    }
+    if (sen5x_log_set_group_commit(&handle, commit_samples, commit_ms) != 0)
+    {
+        (void)sen5x_log_deinit(&handle);
+        (void)file_close(gs_logger_fd);
+        
+        return 5;
+    }
+    
+    /* continue after the last sample */
+    memset(&sample, 0, sizeof(sen5x_store_sample_t));
+    sample.timestamp_ms = 1760000000000ULL;
+    (void)sen5x_log_get_count(&handle, &count);
+    if (count != 0)
+    {
+        if (sen5x_log_read(&handle, count - 1, &sample) != 0)
+        {
+            (void)sen5x_log_deinit(&handle);
+            (void)file_close(gs_logger_fd);
+            
+            return 1;
+        }
+    }
+    
+    /* append 1 Hz samples */
+    t = a_logger_now();
+    for (i = 0; i < samples; i++)
+    {
+        sample.timestamp_ms += 1000;
+        sample.word[0] = (uint16_t)(80 + i % 7);
+        sample.word[1] = (uint16_t)(100 + i % 11);
+        sample.word[2] = (uint16_t)(110 + i % 13);
+        sample.word[3] = (uint16_t)(120 + i % 17);
+        sample.word[4] = (uint16_t)(4500 + i % 19);
+        sample.word[5] = (uint16_t)(4600 + i % 23);
+        sample.word[6] = (uint16_t)(1000 + i % 29);
+        sample.word[7] = (uint16_t)(10 + i % 3);
+        if (sen5x_log_append(&handle, &sample) != 0)
+        {
+            (void)sen5x_log_deinit(&handle);
+            (void)file_close(gs_logger_fd);
+            
+            return 1;
+        }
+    }
+    if (sen5x_log_commit(&handle) != 0)
+    {
+        (void)sen5x_log_deinit(&handle);
+        (void)file_close(gs_logger_fd);
+        
+        return 1;
+    }
+    t = a_logger_now() - t;
+    (void)sen5x_log_get_report(&handle, &report);
+    (void)sen5x_log_get_count(&handle, &count);
+    (void)sen5x_log_deinit(&handle);
+    
+    /* print the report */
+    sen5x_interface_debug_print("sen5x: appended %lld samples in %lld commits, %0.0f samples/s, log has %lld samples.\n",
+                                (long long)report.samples, (long long)report.commits, report.samples / t, (long long)count);
+    sen5x_interface_debug_print("sen5x: payload %lld bytes, written %lld bytes, flash pages %lld bytes.\n",
+                                (long long)report.payload_bytes, (long long)report.written_bytes, (long long)report.page_bytes);
+    sen5x_interface_debug_print("sen5x: write amplification is %0.2f framed, %0.2f with 4096 byte pages.\n",
+                                (double)report.written_bytes / report.payload_bytes, (double)report.page_bytes / report.payload_bytes);
+    sen5x_interface_debug_print("sen5x: sync latency mean %0.0fus, p50 < %dus, p99 < %dus, max %dus.\n",
+                                (double)report.sync_us_total / report.commits, a_logger_percentile(&report, 50.0),
+                                a_logger_percentile(&report, 99.0), report.sync_us_max);
+    sen5x_interface_debug_print("sen5x: data loss window is %d samples, %dms.\n",
+                                report.max_pending_samples, report.max_pending_ms);
+    
+    /* simulate a power loss in the middle of a record */
+    sen5x_interface_debug_print("sen5x: append a torn record and recover.\n");
+    if ((file_write_at(gs_logger_fd, count * SEN5X_LOG_RECORD_LENGTH, torn, sizeof(torn)) != 0) ||
+        (file_close(gs_logger_fd) != 0))
+    {
+        return 1;
+    }
+    if (a_logger_open(&handle, name, buf, sizeof(buf)) != 0)
+    {
+        return 1;
+    }
+    (void)sen5x_log_deinit(&handle);
+    if ((file_close(gs_logger_fd) != 0) || (handle.report.recovered_samples != count) ||
+        (handle.report.truncated_bytes != sizeof(torn)))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
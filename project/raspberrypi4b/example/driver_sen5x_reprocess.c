@@ -0,0 +1,779 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_reprocess.c
+ * @brief     driver sen5x reprocess source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_reprocess.h"
+#include "file.h"
+#include "pool.h"
+#include <math.h>
+#include <time.h>
+
+/**
+ * @brief reprocess definition
+ */
+#define REPROCESS_VOC_ALERT               250        /**< voc index alert level */
+#define REPROCESS_NOX_ALERT               20         /**< nox index alert level */
+
+/**
+ * @brief reprocess tuning structure definition
+ */
+typedef struct reprocess_tuning_s
+{
+    sen5x_gas_type_t type;        /**< gas type */
+    int16_t param[6];             /**< index offset, offset hours, gain hours, gating minutes, std initial, gain factor */
+} reprocess_tuning_t;
+
+/**
+ * @brief reprocess result structure definition
+ */
+typedef struct reprocess_result_s
+{
+    uint64_t samples;             /**< indexed samples */
+    uint64_t alerts;              /**< samples above the alert level */
+    double sum;                   /**< index sum */
+    double diff_sum;              /**< absolute difference sum to the default tuning */
+    int32_t max;                  /**< max index */
+} reprocess_result_t;
+
+/**
+ * @brief reprocess hour structure definition
+ */
+typedef struct reprocess_hour_s
+{
+    uint32_t samples;                                       /**< decoded samples */
+    uint32_t count[SEN5X_REPROCESS_MAX_TUNINGS];            /**< index counts per tuning */
+    double sum[SEN5X_REPROCESS_MAX_TUNINGS];                /**< index sums per tuning */
+} reprocess_hour_t;
+
+/**
+ * @brief reprocess sensor structure definition
+ */
+typedef struct reprocess_sensor_s
+{
+    char name[256];                                               /**< archive file */
+    char output[272];                                             /**< hourly csv file */
+    const uint8_t *archive;                                       /**< mapped archive */
+    uint64_t size;                                                /**< archive size */
+    uint32_t corrupt;                                             /**< skipped blocks */
+    uint64_t first_hour;                                          /**< first archive hour */
+    uint32_t hours;                                               /**< archive hours */
+    uint32_t hour;                                                /**< first entry in the hour table */
+    uint64_t samples;                                             /**< decoded samples */
+    reprocess_result_t result[SEN5X_REPROCESS_MAX_TUNINGS];       /**< results per tuning */
+} reprocess_sensor_t;
+
+/**
+ * @brief reprocess task structure definition
+ */
+typedef struct reprocess_task_s
+{
+    uint32_t sensor;              /**< sensor index */
+    sen5x_gas_type_t type;        /**< gas of the tuning set */
+} reprocess_task_t;
+
+static int gs_reprocess_fd;                                                            /**< archive file handle */
+static uint32_t gs_reprocess_seed;                                                     /**< random seed */
+static reprocess_tuning_t gs_reprocess_tuning[SEN5X_REPROCESS_MAX_TUNINGS] =           /**< candidate tunings */
+{
+    {SEN5X_GAS_TYPE_VOC, {100, 12, 12, 180, 50, 230}},
+    {SEN5X_GAS_TYPE_NOX, {1, 12, 12, 720, 50, 230}},
+};
+static uint32_t gs_reprocess_tunings = 2;                                              /**< candidate tuning count */
+static reprocess_sensor_t gs_reprocess_sensor[SEN5X_REPROCESS_MAX_SENSORS];            /**< sensors */
+static reprocess_task_t gs_reprocess_task[SEN5X_REPROCESS_MAX_SENSORS * 2];          /**< one task per sensor and gas */
+static reprocess_hour_t gs_reprocess_hour[SEN5X_REPROCESS_MAX_HOURS];                  /**< hour table of all sensors */
+
+/**
+ * @brief  get the monotonic time
+ * @return time in seconds
+ * @note   none
+ */
+static double a_reprocess_now(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief     reprocess archive emit block
+ * @param[in] *block pointer to a block buffer
+ * @param[in] len block length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_reprocess_emit(const uint8_t *block, uint32_t len)
+{
+    return file_write(gs_reprocess_fd, block, len);
+}
+
+/**
+ * @brief  reprocess random number
+ * @return random number
+ * @note   none
+ */
+static uint32_t a_reprocess_random(void)
+{
+    gs_reprocess_seed = gs_reprocess_seed * 1664525U + 1013904223U;
+    
+    return gs_reprocess_seed >> 8;
+}
+
+/**
+ * @brief     add the built in alternative tunings
+ * @note      longer learning, lower gain and shorter gating for voc, faster learning and higher gain for nox
+ */
+static void a_reprocess_default_tunings(void)
+{
+    char alternative[][40] =
+    {
+        "voc:100,24,24,180,50,230",
+        "voc:100,12,12,180,50,150",
+        "voc:100,12,12,60,50,230",
+        "nox:1,4,12,720,50,230",
+        "nox:1,12,12,720,50,320",
+    };
+    uint32_t i;
+    
+    for (i = 0; i < sizeof(alternative) / sizeof(alternative[0]); i++)
+    {
+        (void)sen5x_reprocess_add_tuning(alternative[i]);
+    }
+}
+
+/**
+ * @brief     generate a synthetic 1 Hz raw values archive of one sensor
+ * @param[in] *name pointer to a file name buffer
+ * @param[in] sensor sensor index
+ * @param[in] days archive days
+ * @return    status code
+ *            - 0 success
+ *            - 1 generate failed
+ * @note      voc sraw drifts with the day and drops on a few indoor events a day,
+ *            nox sraw rises in the two traffic peaks
+ */
+static uint8_t a_reprocess_generate(char *name, uint32_t sensor, uint32_t days)
+{
+    static uint8_t block[SEN5X_ARCHIVE_BLOCK_SIZE];
+    uint8_t res;
+    uint32_t i;
+    uint32_t d;
+    uint32_t k;
+    uint32_t start[4];
+    double voc;
+    double nox;
+    double event;
+    double traffic;
+    double phase;
+    uint64_t ms;
+    uint16_t word[SEN5X_ARCHIVE_MAX_CHANNELS];
+    sen5x_archive_encoder_t encoder;
+    
+    /* create the file */
+    if (file_open_write(name, &gs_reprocess_fd) != 0)
+    {
+        return 1;
+    }
+    res = sen5x_archive_encoder_init(&encoder, SEN5X_ARCHIVE_LAYOUT_RAW, block, SEN5X_ARCHIVE_BLOCK_SIZE, a_reprocess_emit);
+    if (res != 0)
+    {
+        (void)file_close(gs_reprocess_fd);
+    
+        return 1;
+    }
+    
+    /* 1 Hz raw signals */
+    gs_reprocess_seed = 0x7E57 + sensor * 7919;
+    ms = 1760000000000ULL;
+    for (d = 0; d < days; d++)
+    {
+        /* up to four indoor events a day */
+        for (i = 0; i < 4; i++)
+        {
+            start[i] = ((a_reprocess_random() % 2) == 0) ? (a_reprocess_random() % 82800) : 0xFFFFFFFFU;
+        }
+        for (i = 0; i < 86400; i++)
+        {
+            ms += 1000;
+            phase = 2.0 * 3.14159265358979 * (double)i / 86400.0;
+            event = 0.0;
+            for (k = 0; k < 4; k++)
+            {
+                if ((i >= start[k]) && (i < start[k] + 3600))
+                {
+                    event += exp(-(double)(i - start[k]) / 900.0);
+                }
+            }
+            traffic = exp(-pow(((double)i - 8.0 * 3600.0) / 3600.0, 2.0)) + exp(-pow(((double)i - 18.0 * 3600.0) / 3600.0, 2.0));
+            voc = 29000.0 + (double)sensor * 300.0 + 400.0 * sin(phase) - 2500.0 * event +
+                  (double)(a_reprocess_random() % 31) - 15.0;
+            nox = 15500.0 + 80.0 * sin(phase) + 2500.0 * traffic + (double)(a_reprocess_random() % 21) - 10.0;
+            word[0] = (uint16_t)(int16_t)(4500 + (int32_t)(1000.0 * sin(phase)));
+            word[1] = (uint16_t)(int16_t)(4600 - (int32_t)(600.0 * sin(phase)));
+            word[2] = (uint16_t)voc;
+            word[3] = (uint16_t)nox;
+            res = sen5x_archive_encode(&encoder, ms, word);
+            if (res != 0)
+            {
+                (void)file_close(gs_reprocess_fd);
+    
+                return 1;
+            }
+        }
+    }
+    res = sen5x_archive_flush(&encoder);
+    if (file_close(gs_reprocess_fd) != 0)
+    {
+        return 1;
+    }
+    
+    return (res == 0) ? 0 : 1;
+}
+
+/**
+ * @brief      get a valid raw block header
+ * @param[in]  *sensor pointer to a sensor structure
+ * @param[in]  offset block offset
+ * @param[out] *header pointer to a header structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 block is corrupt or not raw values
+ * @note       none
+ */
+static uint8_t a_reprocess_header(reprocess_sensor_t *sensor, uint64_t offset, sen5x_archive_header_t *header)
+{
+    if ((sen5x_archive_check_block(&sensor->archive[offset], SEN5X_ARCHIVE_BLOCK_SIZE) != 0) ||
+        (sen5x_archive_parse_header(&sensor->archive[offset], SEN5X_ARCHIVE_BLOCK_SIZE, header) != 0) ||
+        (header->layout != SEN5X_ARCHIVE_LAYOUT_RAW))
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief         map one sensor archive and take its hours from the block headers
+ * @param[in]     sensor sensor index
+ * @param[in,out] *hours pointer to a used hour table count
+ * @return        status code
+ *                - 0 success
+ *                - 1 map failed
+ *                - 4 hour table is full
+ * @note          none
+ */
+static uint8_t a_reprocess_scan(uint32_t sensor, uint32_t *hours)
+{
+    reprocess_sensor_t *s = &gs_reprocess_sensor[sensor];
+    sen5x_archive_header_t header;
+    uint64_t offset;
+    uint64_t last_hour;
+    
+    /* map the archive */
+    if (file_map(s->name, &s->archive, &s->size) != 0)
+    {
+        s->archive = NULL;
+        
+        return 1;
+    }
+    
+    /* walk the block headers */
+    last_hour = 0;
+    for (offset = 0; (offset + SEN5X_ARCHIVE_BLOCK_SIZE) <= s->size; offset += SEN5X_ARCHIVE_BLOCK_SIZE)
+    {
+        if (a_reprocess_header(s, offset, &header) != 0)
+        {
+            s->corrupt++;
+            
+            continue;
+        }
+        if (s->hours == 0)
+        {
+            s->first_hour = header.first_ms / 3600000ULL;
+        }
+        last_hour = header.last_ms / 3600000ULL;
+        if (last_hour - s->first_hour + 1 > SEN5X_REPROCESS_MAX_HOURS - (*hours))
+        {
+            return 4;
+        }
+        s->hours = (uint32_t)(last_hour - s->first_hour + 1);
+    }
+    s->hour = *hours;
+    *hours += s->hours;
+    
+    return 0;
+}
+
+/**
+ * @brief     reprocess one sensor archive with the candidate tunings of one gas
+ * @param[in] *arg unused
+ * @param[in] task task index
+ * @param[in] worker worker index
+ * @note      every block is decoded once and each sample feeds all tunings of the gas, the default tunings
+ *            are the first voc and nox entries and every tuning is compared to the one of its gas, the
+ *            blackout samples with index 0 are not counted, the voc task counts the samples, the two tasks
+ *            of a sensor write different tunings of its hour table
+ */
+static void a_reprocess_task(void *arg, uint32_t task, uint32_t worker)
+{
+    reprocess_sensor_t *sensor = &gs_reprocess_sensor[gs_reprocess_task[task].sensor];
+    sen5x_gas_type_t type = gs_reprocess_task[task].type;
+    sen5x_gas_t gas[SEN5X_REPROCESS_MAX_TUNINGS];
+    int32_t index[SEN5X_REPROCESS_MAX_TUNINGS];
+    uint32_t base;
+    uint32_t t;
+    uint64_t h;
+    int32_t diff;
+    uint64_t offset;
+    uint64_t ms;
+    uint16_t word[SEN5X_ARCHIVE_MAX_CHANNELS];
+    reprocess_hour_t *hour;
+    reprocess_result_t *result;
+    reprocess_tuning_t *tuning;
+    sen5x_archive_decoder_t decoder;
+    
+    (void)arg;
+    (void)worker;
+    
+    /* init one algorithm per tuning of the gas */
+    base = (type == SEN5X_GAS_TYPE_NOX) ? 1 : 0;
+    for (t = 0; t < gs_reprocess_tunings; t++)
+    {
+        tuning = &gs_reprocess_tuning[t];
+        if (tuning->type != type)
+        {
+            continue;
+        }
+        (void)sen5x_gas_init(&gas[t], tuning->type, SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL);
+        (void)sen5x_gas_set_tuning(&gas[t], tuning->param[0], tuning->param[1], tuning->param[2],
+                                   tuning->param[3], tuning->param[4], tuning->param[5]);
+    }
+    
+    /* decode the whole archive in order */
+    for (offset = 0; (offset + SEN5X_ARCHIVE_BLOCK_SIZE) <= sensor->size; offset += SEN5X_ARCHIVE_BLOCK_SIZE)
+    {
+        if ((sen5x_archive_decoder_init(&decoder, &sensor->archive[offset], SEN5X_ARCHIVE_BLOCK_SIZE) != 0) ||
+            (decoder.header.layout != SEN5X_ARCHIVE_LAYOUT_RAW))
+        {
+            continue;
+        }
+        while (sen5x_archive_decode(&decoder, &ms, word) == 0)
+        {
+            /* run all tunings of the gas */
+            for (t = 0; t < gs_reprocess_tunings; t++)
+            {
+                if (gs_reprocess_tuning[t].type == type)
+                {
+                    (void)sen5x_gas_process(&gas[t], (type == SEN5X_GAS_TYPE_NOX) ? word[3] : word[2], &index[t]);
+                }
+            }
+            
+            /* count the hour */
+            h = ms / 3600000ULL - sensor->first_hour;
+            if (h >= sensor->hours)
+            {
+                continue;
+            }
+            hour = &gs_reprocess_hour[sensor->hour + h];
+            if (type == SEN5X_GAS_TYPE_VOC)
+            {
+                sensor->samples++;
+                hour->samples++;
+            }
+            for (t = 0; t < gs_reprocess_tunings; t++)
+            {
+                if ((gs_reprocess_tuning[t].type != type) || (index[t] == 0))
+                {
+                    continue;
+                }
+                result = &sensor->result[t];
+                diff = index[t] - index[base];
+                result->samples++;
+                result->sum += index[t];
+                result->diff_sum += (diff < 0) ? -diff : diff;
+                result->max = (index[t] > result->max) ? index[t] : result->max;
+                result->alerts += (index[t] > ((type == SEN5X_GAS_TYPE_NOX) ? REPROCESS_NOX_ALERT : REPROCESS_VOC_ALERT)) ? 1 : 0;
+                hour->sum[t] += index[t];
+                hour->count[t]++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief     write the hourly means of a sensor
+ * @param[in] sensor sensor index
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      every tuning of a sensor runs the whole archive in one task, so the output doesn't depend on
+ *            the worker threads
+ */
+static uint8_t a_reprocess_merge(uint32_t sensor)
+{
+    reprocess_sensor_t *s = &gs_reprocess_sensor[sensor];
+    reprocess_tuning_t *tuning;
+    reprocess_hour_t *hour;
+    char line[8192];
+    uint32_t pos;
+    uint32_t h;
+    uint32_t t;
+    int fd;
+    
+    /* one row per hour with samples */
+    if (file_open_write(s->output, &fd) != 0)
+    {
+        return 1;
+    }
+    pos = (uint32_t)snprintf(line, sizeof(line), "hour_ms");
+    for (t = 0; t < gs_reprocess_tunings; t++)
+    {
+        tuning = &gs_reprocess_tuning[t];
+        pos += snprintf(&line[pos], sizeof(line) - pos, ",%s_%d_%d_%d_%d_%d_%d",
+                        (tuning->type == SEN5X_GAS_TYPE_NOX) ? "nox" : "voc", tuning->param[0], tuning->param[1],
+                        tuning->param[2], tuning->param[3], tuning->param[4], tuning->param[5]);
+    }
+    pos += snprintf(&line[pos], sizeof(line) - pos, "\n");
+    for (h = 0; h < s->hours; h++)
+    {
+        hour = &gs_reprocess_hour[s->hour + h];
+        if (hour->samples == 0)
+        {
+            continue;
+        }
+        if (pos + 32 * (SEN5X_REPROCESS_MAX_TUNINGS + 1) > sizeof(line))
+        {
+            if (file_write(fd, (uint8_t *)line, pos) != 0)
+            {
+                (void)file_close(fd);
+                
+                return 1;
+            }
+            pos = 0;
+        }
+        pos += snprintf(&line[pos], sizeof(line) - pos, "%llu", (unsigned long long)((s->first_hour + h) * 3600000ULL));
+        for (t = 0; t < gs_reprocess_tunings; t++)
+        {
+            pos += snprintf(&line[pos], sizeof(line) - pos, ",%0.1f", (hour->count[t] != 0) ? (hour->sum[t] / hour->count[t]) : 0.0);
+        }
+        pos += snprintf(&line[pos], sizeof(line) - pos, "\n");
+    }
+    if (file_write(fd, (uint8_t *)line, pos) != 0)
+    {
+        (void)file_close(fd);
+        
+        return 1;
+    }
+    
+    return file_close(fd);
+}
+
+/**
+ * @brief     unmap the sensor archives
+ * @param[in] sensors sensor count
+ * @note      none
+ */
+static void a_reprocess_unmap(uint32_t sensors)
+{
+    uint32_t s;
+    
+    for (s = 0; s < sensors; s++)
+    {
+        if (gs_reprocess_sensor[s].archive != NULL)
+        {
+            (void)file_unmap(gs_reprocess_sensor[s].archive, gs_reprocess_sensor[s].size);
+            gs_reprocess_sensor[s].archive = NULL;
+        }
+    }
+}
+
+/**
+ * @brief     reprocess example add a candidate tuning
+ * @param[in] *str pointer to a "voc|nox:offset,offset_hour,gain_hour,gating_minute,std,gain" string
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      the ranges are checked by sen5x_gas_set_tuning, the default voc and nox tunings are always
+ *            the first two entries
+ */
+uint8_t sen5x_reprocess_add_tuning(char *str)
+{
+    reprocess_tuning_t tuning;
+    int p[6];
+    char gas[4];
+    sen5x_gas_t check;
+    
+    /* parse the string */
+    if (sscanf(str, "%3[a-z]:%d,%d,%d,%d,%d,%d", gas, &p[0], &p[1], &p[2], &p[3], &p[4], &p[5]) != 7)
+    {
+        return 1;
+    }
+    if (strcmp(gas, "voc") == 0)
+    {
+        tuning.type = SEN5X_GAS_TYPE_VOC;
+    }
+    else if (strcmp(gas, "nox") == 0)
+    {
+        tuning.type = SEN5X_GAS_TYPE_NOX;
+    }
+    else
+    {
+        return 1;
+    }
+    
+    /* let the algorithm check the ranges */
+    (void)sen5x_gas_init(&check, tuning.type, SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL);
+    if (sen5x_gas_set_tuning(&check, (int16_t)p[0], (int16_t)p[1], (int16_t)p[2],
+                             (int16_t)p[3], (int16_t)p[4], (int16_t)p[5]) != 0)
+    {
+        return 1;
+    }
+    
+    /* append after the two defaults */
+    if (gs_reprocess_tunings >= SEN5X_REPROCESS_MAX_TUNINGS)
+    {
+        return 1;
+    }
+    tuning.param[0] = (int16_t)p[0];
+    tuning.param[1] = (int16_t)p[1];
+    tuning.param[2] = (int16_t)p[2];
+    tuning.param[3] = (int16_t)p[3];
+    tuning.param[4] = (int16_t)p[4];
+    tuning.param[5] = (int16_t)p[5];
+    gs_reprocess_tuning[gs_reprocess_tunings] = tuning;
+    gs_reprocess_tunings++;
+    
+    return 0;
+}
+
+/**
+ * @brief     reprocess example run the raw archives of several sensors
+ * @param[in] *prefix pointer to an archive prefix, the sensor archives are <prefix>.<n>
+ * @param[in] sensors sensor count
+ * @param[in] generate synthetic days to generate first, 0 to use existing archives
+ * @param[in] threads worker threads
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 sensors or threads is invalid
+ * @note      built in alternatives are added without a candidate tuning, every sensor archive runs the voc
+ *            and the nox tunings as two pool tasks, writes <prefix>.<n>.csv with hourly means per tuning
+ *            and <prefix>.summary.csv
+ */
+uint8_t sen5x_reprocess_run(char *prefix, uint32_t sensors, uint32_t generate, uint32_t threads)
+{
+    char name[288];
+    char line[256];
+    int fd;
+    uint8_t res;
+    uint32_t s;
+    uint32_t t;
+    uint32_t len;
+    uint32_t tasks;
+    uint32_t hours;
+    uint64_t samples;
+    double seconds;
+    reprocess_result_t total;
+    reprocess_result_t *result;
+    reprocess_tuning_t *tuning;
+    pool_report_t report;
+    
+    /* check the params */
+    if ((sensors == 0) || (sensors > SEN5X_REPROCESS_MAX_SENSORS) || (threads == 0) || (threads > POOL_MAX_THREADS))
+    {
+        return 5;
+    }
+    
+    /* use the built in alternatives without user tunings */
+    if (gs_reprocess_tunings == 2)
+    {
+        a_reprocess_default_tunings();
+    }
+    
+    /* name the files */
+    memset(gs_reprocess_sensor, 0, sizeof(gs_reprocess_sensor));
+    for (s = 0; s < sensors; s++)
+    {
+        snprintf(gs_reprocess_sensor[s].name, sizeof(gs_reprocess_sensor[s].name), "%s.%d", prefix, s);
+        snprintf(gs_reprocess_sensor[s].output, sizeof(gs_reprocess_sensor[s].output), "%s.%d.csv", prefix, s);
+    }
+    
+    /* generate archives of uneven length */
+    if (generate != 0)
+    {
+        seconds = a_reprocess_now();
+        for (s = 0; s < sensors; s++)
+        {
+            if (a_reprocess_generate(gs_reprocess_sensor[s].name, s, generate * (2 + s % 3) / 2) != 0)
+            {
+                sen5x_interface_debug_print("sen5x: generate %s failed.\n", gs_reprocess_sensor[s].name);
+    
+                return 1;
+            }
+        }
+        sen5x_interface_debug_print("sen5x: generated %d sensor archives of %d - %d days in %0.2fs.\n",
+                                    sensors, generate, generate * 2, a_reprocess_now() - seconds);
+    }
+    
+    /* take the archive hours */
+    seconds = a_reprocess_now();
+    hours = 0;
+    for (s = 0; s < sensors; s++)
+    {
+        res = a_reprocess_scan(s, &hours);
+        if (res != 0)
+        {
+            if (res == 4)
+            {
+                sen5x_interface_debug_print("sen5x: archives span more than %d hours.\n", SEN5X_REPROCESS_MAX_HOURS);
+            }
+            else
+            {
+                sen5x_interface_debug_print("sen5x: map %s failed.\n", gs_reprocess_sensor[s].name);
+            }
+            a_reprocess_unmap(sensors);
+            
+            return 1;
+        }
+        if (gs_reprocess_sensor[s].corrupt != 0)
+        {
+            sen5x_interface_debug_print("sen5x: %s skipped %d corrupt blocks.\n", gs_reprocess_sensor[s].name,
+                                        gs_reprocess_sensor[s].corrupt);
+        }
+    }
+    memset(gs_reprocess_hour, 0, sizeof(reprocess_hour_t) * hours);
+    
+    /* shard by sensor and gas */
+    tasks = 0;
+    for (s = 0; s < sensors; s++)
+    {
+        gs_reprocess_task[tasks].sensor = s;
+        gs_reprocess_task[tasks].type = SEN5X_GAS_TYPE_VOC;
+        tasks++;
+        gs_reprocess_task[tasks].sensor = s;
+        gs_reprocess_task[tasks].type = SEN5X_GAS_TYPE_NOX;
+        tasks++;
+    }
+    if (pool_run(threads, tasks, a_reprocess_task, NULL, &report) != 0)
+    {
+        a_reprocess_unmap(sensors);
+        
+        return 1;
+    }
+    seconds = a_reprocess_now() - seconds;
+    a_reprocess_unmap(sensors);
+    samples = 0;
+    for (s = 0; s < sensors; s++)
+    {
+        if (a_reprocess_merge(s) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: write %s failed.\n", gs_reprocess_sensor[s].output);
+    
+            return 1;
+        }
+        samples += gs_reprocess_sensor[s].samples;
+    }
+    sen5x_interface_debug_print("sen5x: %d sensors in %d tasks of one sensor and gas.\n", sensors, tasks);
+    sen5x_interface_debug_print("sen5x: %lld samples, %d tunings on %d threads in %0.2fs, %0.2f M sample tunings/s.\n",
+                                (long long)samples, gs_reprocess_tunings, threads, seconds,
+                                (double)samples * gs_reprocess_tunings / seconds / 1e6);
+    for (t = 0; t < report.threads; t++)
+    {
+        sen5x_interface_debug_print("sen5x: worker %d ran %d tasks, busy %0.2fs.\n", t, report.executed[t], report.busy_s[t]);
+    }
+    sen5x_interface_debug_print("sen5x: %d tasks were stolen.\n", report.stolen);
+    
+    /* compare the tunings */
+    snprintf(name, sizeof(name), "%s.summary.csv", prefix);
+    if (file_open_write(name, &fd) != 0)
+    {
+        return 1;
+    }
+    len = (uint32_t)snprintf(line, sizeof(line), "sensor,gas,index_offset,offset_hour,gain_hour,gating_minute,std_initial,gain,"
+                                                  "samples,mean,max,alert_percent,mean_abs_diff\n");
+    if (file_write(fd, (uint8_t *)line, len) != 0)
+    {
+        (void)file_close(fd);
+    
+        return 1;
+    }
+    for (t = 0; t < gs_reprocess_tunings; t++)
+    {
+        tuning = &gs_reprocess_tuning[t];
+        memset(&total, 0, sizeof(total));
+        for (s = 0; s < sensors; s++)
+        {
+            result = &gs_reprocess_sensor[s].result[t];
+            len = (uint32_t)snprintf(line, sizeof(line), "%d,%s,%d,%d,%d,%d,%d,%d,%llu,%0.2f,%d,%0.3f,%0.3f\n", s,
+                                     (tuning->type == SEN5X_GAS_TYPE_NOX) ? "nox" : "voc", tuning->param[0],
+                                     tuning->param[1], tuning->param[2], tuning->param[3], tuning->param[4],
+                                     tuning->param[5], (unsigned long long)result->samples,
+                                     (result->samples != 0) ? (result->sum / result->samples) : 0.0, result->max,
+                                     (result->samples != 0) ? (100.0 * result->alerts / result->samples) : 0.0,
+                                     (result->samples != 0) ? (result->diff_sum / result->samples) : 0.0);
+            if (file_write(fd, (uint8_t *)line, len) != 0)
+            {
+                (void)file_close(fd);
+    
+                return 1;
+            }
+            total.samples += result->samples;
+            total.alerts += result->alerts;
+            total.sum += result->sum;
+            total.diff_sum += result->diff_sum;
+            total.max = (result->max > total.max) ? result->max : total.max;
+        }
+        if (total.samples == 0)
+        {
+            continue;
+        }
+        sen5x_interface_debug_print("sen5x: %s %d, %d, %d, %d, %d, %d: mean %0.1f, max %d, alert %0.2f percent, mean difference %0.2f.\n",
+                                    (tuning->type == SEN5X_GAS_TYPE_NOX) ? "nox" : "voc", tuning->param[0], tuning->param[1],
+                                    tuning->param[2], tuning->param[3], tuning->param[4], tuning->param[5],
+                                    total.sum / total.samples, total.max, 100.0 * total.alerts / total.samples,
+                                    total.diff_sum / total.samples);
+    }
+    if (file_close(fd) != 0)
+    {
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: hourly means in %s.<n>.csv, summary in %s.\n", prefix, name);
+    
+    return 0;
+}
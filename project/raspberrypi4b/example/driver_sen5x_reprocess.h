@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_reprocess.h
+ * @brief     driver sen5x reprocess header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_REPROCESS_H
+#define DRIVER_SEN5X_REPROCESS_H
+
+#include "driver_sen5x_interface.h"
+#include "driver_sen5x_archive.h"
+#include "driver_sen5x_gas.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @addtogroup sen5x_example_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x reprocess example default definition
+ */
+#define SEN5X_REPROCESS_MAX_SENSORS        64           /**< max sensor archives */
+#define SEN5X_REPROCESS_MAX_TUNINGS        8            /**< max candidate tunings with the two defaults */
+#define SEN5X_REPROCESS_MAX_HOURS          65536        /**< max archive hours of all sensors */
+
+/**
+ * @brief     reprocess example add a candidate tuning
+ * @param[in] *str pointer to a "voc|nox:offset,offset_hour,gain_hour,gating_minute,std,gain" string
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      the ranges are checked by sen5x_gas_set_tuning, the default voc and nox tunings are always
+ *            the first two entries
+ */
+uint8_t sen5x_reprocess_add_tuning(char *str);
+
+/**
+ * @brief     reprocess example run the raw archives of several sensors
+ * @param[in] *prefix pointer to an archive prefix, the sensor archives are <prefix>.<n>
+ * @param[in] sensors sensor count
+ * @param[in] generate synthetic days to generate first, 0 to use existing archives
+ * @param[in] threads worker threads
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ *            - 5 sensors or threads is invalid
+ * @note      built in alternatives are added without a candidate tuning, every sensor archive runs the voc
+ *            and the nox tunings as two pool tasks, so the output doesn't depend on the threads, writes
+ *            <prefix>.<n>.csv with hourly means per tuning and <prefix>.summary.csv
+ */
+uint8_t sen5x_reprocess_run(char *prefix, uint32_t sensors, uint32_t generate, uint32_t threads);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
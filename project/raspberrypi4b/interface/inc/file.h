@@ -0,0 +1,225 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      file.h
+ * @brief     file header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef FILE_H
+#define FILE_H
+
+#include <unistd.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup file file function
+ * @brief    file function modules
+ * @{
+ */
+
+/**
+ * @brief      open a file for reading
+ * @param[in]  *name pointer to a file name buffer
+ * @param[out] *fd pointer to a file handle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       none
+ */
+uint8_t file_open_read(char *name, int *fd);
+
+/**
+ * @brief      create or truncate a file for writing
+ * @param[in]  *name pointer to a file name buffer
+ * @param[out] *fd pointer to a file handle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the directory is synced so that the new file survives a power loss
+ */
+uint8_t file_open_write(char *name, int *fd);
+
+/**
+ * @brief      open or create a file for reading and writing
+ * @param[in]  *name pointer to a file name buffer
+ * @param[out] *fd pointer to a file handle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the content is kept, the directory is synced when the file is created
+ */
+uint8_t file_open_rw(char *name, int *fd);
+
+/**
+ * @brief     close a file
+ * @param[in] fd file handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t file_close(int fd);
+
+/**
+ * @brief      read a file
+ * @param[in]  fd file handle
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[out] *read_len pointer to a read length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       read_len is 0 at the end of the file
+ */
+uint8_t file_read(int fd, uint8_t *buf, uint32_t len, uint32_t *read_len);
+
+/**
+ * @brief     write a file
+ * @param[in] fd file handle
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t file_write(int fd, const uint8_t *buf, uint64_t len);
+
+/**
+ * @brief      read a file at an offset
+ * @param[in]  fd file handle
+ * @param[in]  offset file offset
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[out] *read_len pointer to a read length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t file_read_at(int fd, uint64_t offset, uint8_t *buf, uint32_t len, uint32_t *read_len);
+
+/**
+ * @brief     write a file at an offset
+ * @param[in] fd file handle
+ * @param[in] offset file offset
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t file_write_at(int fd, uint64_t offset, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief     flush a file to the storage
+ * @param[in] fd file handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 sync failed
+ * @note      none
+ */
+uint8_t file_sync(int fd);
+
+/**
+ * @brief     truncate a file
+ * @param[in] fd file handle
+ * @param[in] len file length
+ * @return    status code
+ *            - 0 success
+ *            - 1 truncate failed
+ * @note      none
+ */
+uint8_t file_truncate(int fd, uint64_t len);
+
+/**
+ * @brief      get the file size
+ * @param[in]  fd file handle
+ * @param[out] *size pointer to a size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t file_size(int fd, uint64_t *size);
+
+/**
+ * @brief      map a whole file read only
+ * @param[in]  *name pointer to a file name buffer
+ * @param[out] **buf pointer to a mapped address buffer
+ * @param[out] *size pointer to a file size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 map failed
+ * @note       an empty file can't be mapped, a file larger than the address space is refused, build with
+ *             _FILE_OFFSET_BITS=64 on the 32 bits targets
+ */
+uint8_t file_map(char *name, const uint8_t **buf, uint64_t *size);
+
+/**
+ * @brief     unmap a mapped file
+ * @param[in] *buf pointer to a mapped address
+ * @param[in] size mapped size
+ * @return    status code
+ *            - 0 success
+ *            - 1 unmap failed
+ * @note      none
+ */
+uint8_t file_unmap(const uint8_t *buf, uint64_t size);
+
+/**
+ * @brief     drop the cached pages of a file
+ * @param[in] *name pointer to a file name buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 drop failed
+ * @note      only clean pages are dropped, it's a hint to the kernel
+ */
+uint8_t file_drop_cache(char *name);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
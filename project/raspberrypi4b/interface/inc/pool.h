@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      pool.h
+ * @brief     pool header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup pool pool function
+ * @brief    pool function modules
+ * @{
+ */
+
+/**
+ * @brief pool definition
+ */
+#define POOL_MAX_THREADS        64        /**< max worker threads */
+
+/**
+ * @brief pool report structure definition
+ */
+typedef struct pool_report_s
+{
+    uint32_t threads;                             /**< worker threads */
+    uint32_t tasks;                               /**< executed tasks */
+    uint32_t stolen;                              /**< tasks run by a worker that didn't own them */
+    uint32_t executed[POOL_MAX_THREADS];          /**< executed tasks per worker */
+    double busy_s[POOL_MAX_THREADS];              /**< task time per worker in seconds */
+} pool_report_t;
+
+/**
+ * @brief  get the online cpu count
+ * @return cpu count, at least 1
+ * @note   none
+ */
+uint32_t pool_cpus(void);
+
+/**
+ * @brief      run tasks on a work stealing thread pool
+ * @param[in]  threads worker threads
+ * @param[in]  tasks task count
+ * @param[in]  *run pointer to a task function, called with the arg, the task index and the worker index
+ * @param[in]  *arg pointer to a task argument
+ * @param[out] *report pointer to a report structure, NULL to skip it
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       1 <= threads <= POOL_MAX_THREADS, the tasks are dealt to the workers in contiguous slices,
+ *             every worker runs its own slice from the back and steals from the front of the others
+ *             when it runs dry, the calling thread is worker 0 and the function returns after all tasks
+ */
+uint8_t pool_run(uint32_t threads, uint32_t tasks, void (*run)(void *arg, uint32_t task, uint32_t worker),
+                 void *arg, pool_report_t *report);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
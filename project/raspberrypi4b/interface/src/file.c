@@ -0,0 +1,541 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      file.c
+ * @brief     file source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "file.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <errno.h>
+
+/**
+ * @brief     sync the directory holding a file
+ * @param[in] *name pointer to a file name buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 sync failed
+ * @note      makes a new directory entry durable
+ */
+static uint8_t a_file_sync_dir(char *name)
+{
+    char dir[4096];
+    char *slash;
+    int fd;
+    int res;
+    
+    /* get the directory */
+    if (strlen(name) >= sizeof(dir))
+    {
+        return 1;
+    }
+    strcpy(dir, name);
+    slash = strrchr(dir, '/');
+    if (slash == NULL)
+    {
+        strcpy(dir, ".");
+    }
+    else if (slash == dir)
+    {
+        dir[1] = 0;
+    }
+    else
+    {
+        *slash = 0;
+    }
+    
+    /* sync the directory */
+    fd = open(dir, O_RDONLY | O_DIRECTORY);
+    if (fd < 0)
+    {
+        perror("file: open directory failed.\n");
+        
+        return 1;
+    }
+    res = fsync(fd);
+    (void)close(fd);
+    if (res < 0)
+    {
+        perror("file: directory fsync failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      open a file for reading
+ * @param[in]  *name pointer to a file name buffer
+ * @param[out] *fd pointer to a file handle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       none
+ */
+uint8_t file_open_read(char *name, int *fd)
+{
+    /* open the file */
+    *fd = open(name, O_RDONLY);
+    
+    /* check the fd */
+    if ((*fd) < 0)
+    {
+        perror("file: open failed.\n");
+        
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      create or truncate a file for writing
+ * @param[in]  *name pointer to a file name buffer
+ * @param[out] *fd pointer to a file handle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the directory is synced so that the new file survives a power loss
+ */
+uint8_t file_open_write(char *name, int *fd)
+{
+    /* open the file */
+    *fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    
+    /* check the fd */
+    if ((*fd) < 0)
+    {
+        perror("file: open failed.\n");
+        
+        return 1;
+    }
+    
+    /* keep the directory entry */
+    if (a_file_sync_dir(name) != 0)
+    {
+        (void)close(*fd);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      open or create a file for reading and writing
+ * @param[in]  *name pointer to a file name buffer
+ * @param[out] *fd pointer to a file handle buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       the content is kept, the directory is synced when the file is created
+ */
+uint8_t file_open_rw(char *name, int *fd)
+{
+    /* open an existing file */
+    *fd = open(name, O_RDWR);
+    if (((*fd) < 0) && (errno == ENOENT))
+    {
+        /* create the file */
+        *fd = open(name, O_RDWR | O_CREAT, 0644);
+        if ((*fd) >= 0)
+        {
+            /* keep the directory entry */
+            if (a_file_sync_dir(name) != 0)
+            {
+                (void)close(*fd);
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* check the fd */
+    if ((*fd) < 0)
+    {
+        perror("file: open failed.\n");
+        
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     close a file
+ * @param[in] fd file handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t file_close(int fd)
+{
+    /* close the file */
+    if (close(fd) < 0)
+    {
+        perror("file: close failed.\n");
+        
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      read a file
+ * @param[in]  fd file handle
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[out] *read_len pointer to a read length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       read_len is 0 at the end of the file
+ */
+uint8_t file_read(int fd, uint8_t *buf, uint32_t len, uint32_t *read_len)
+{
+    ssize_t res;
+    uint32_t total;
+    
+    /* read until full or the end of the file */
+    total = 0;
+    while (total < len)
+    {
+        res = read(fd, buf + total, len - total);
+        if (res < 0)
+        {
+            perror("file: read failed.\n");
+            
+            return 1;
+        }
+        if (res == 0)
+        {
+            break;
+        }
+        total += (uint32_t)res;
+    }
+    *read_len = total;
+    
+    return 0;
+}
+
+/**
+ * @brief     write a file
+ * @param[in] fd file handle
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t file_write(int fd, const uint8_t *buf, uint64_t len)
+{
+    ssize_t res;
+    
+    /* write until done */
+    while (len > 0)
+    {
+        res = write(fd, buf, (len > 0x40000000ULL) ? 0x40000000U : (size_t)len);
+        if (res <= 0)
+        {
+            perror("file: write failed.\n");
+            
+            return 1;
+        }
+        buf += res;
+        len -= (uint64_t)res;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      read a file at an offset
+ * @param[in]  fd file handle
+ * @param[in]  offset file offset
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @param[out] *read_len pointer to a read length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t file_read_at(int fd, uint64_t offset, uint8_t *buf, uint32_t len, uint32_t *read_len)
+{
+    ssize_t res;
+    uint32_t total;
+    
+    /* read until full or the end of the file */
+    total = 0;
+    while (total < len)
+    {
+        res = pread(fd, buf + total, len - total, (off_t)(offset + total));
+        if (res < 0)
+        {
+            perror("file: pread failed.\n");
+            
+            return 1;
+        }
+        if (res == 0)
+        {
+            break;
+        }
+        total += (uint32_t)res;
+    }
+    *read_len = total;
+    
+    return 0;
+}
+
+/**
+ * @brief     write a file at an offset
+ * @param[in] fd file handle
+ * @param[in] offset file offset
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t file_write_at(int fd, uint64_t offset, const uint8_t *buf, uint32_t len)
+{
+    ssize_t res;
+    
+    /* write until done */
+    while (len > 0)
+    {
+        res = pwrite(fd, buf, len, (off_t)offset);
+        if (res <= 0)
+        {
+            perror("file: pwrite failed.\n");
+            
+            return 1;
+        }
+        buf += res;
+        offset += (uint64_t)res;
+        len -= (uint32_t)res;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     flush a file to the storage
+ * @param[in] fd file handle
+ * @return    status code
+ *            - 0 success
+ *            - 1 sync failed
+ * @note      none
+ */
+uint8_t file_sync(int fd)
+{
+    /* sync the data */
+    if (fdatasync(fd) < 0)
+    {
+        perror("file: fdatasync failed.\n");
+        
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     truncate a file
+ * @param[in] fd file handle
+ * @param[in] len file length
+ * @return    status code
+ *            - 0 success
+ *            - 1 truncate failed
+ * @note      none
+ */
+uint8_t file_truncate(int fd, uint64_t len)
+{
+    /* truncate the file */
+    if (ftruncate(fd, (off_t)len) < 0)
+    {
+        perror("file: ftruncate failed.\n");
+        
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief      get the file size
+ * @param[in]  fd file handle
+ * @param[out] *size pointer to a size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t file_size(int fd, uint64_t *size)
+{
+    struct stat st;
+    
+    /* get the status */
+    if (fstat(fd, &st) < 0)
+    {
+        perror("file: fstat failed.\n");
+        
+        return 1;
+    }
+    *size = (uint64_t)st.st_size;
+    
+    return 0;
+}
+
+/**
+ * @brief      map a whole file read only
+ * @param[in]  *name pointer to a file name buffer
+ * @param[out] **buf pointer to a mapped address buffer
+ * @param[out] *size pointer to a file size buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 map failed
+ * @note       an empty file can't be mapped, a file larger than the address space is refused, build with
+ *             _FILE_OFFSET_BITS=64 on the 32 bits targets
+ */
+uint8_t file_map(char *name, const uint8_t **buf, uint64_t *size)
+{
+    int fd;
+    void *addr;
+    struct stat st;
+    
+    /* open the file */
+    fd = open(name, O_RDONLY);
+    if (fd < 0)
+    {
+        return 1;
+    }
+    
+    /* get the size */
+    if ((fstat(fd, &st) < 0) || (st.st_size <= 0))
+    {
+        (void)close(fd);
+        
+        return 1;
+    }
+    
+    /* check the address space */
+    if ((uint64_t)st.st_size > (uint64_t)SIZE_MAX)
+    {
+        (void)close(fd);
+        fprintf(stderr, "file: %s is too large to map.\n", name);
+        
+        return 1;
+    }
+    
+    /* map the file, the mapping keeps the file open */
+    addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    (void)close(fd);
+    if (addr == MAP_FAILED)
+    {
+        perror("file: mmap failed.\n");
+        
+        return 1;
+    }
+    *buf = (const uint8_t *)addr;
+    *size = (uint64_t)st.st_size;
+    
+    return 0;
+}
+
+/**
+ * @brief     unmap a mapped file
+ * @param[in] *buf pointer to a mapped address
+ * @param[in] size mapped size
+ * @return    status code
+ *            - 0 success
+ *            - 1 unmap failed
+ * @note      none
+ */
+uint8_t file_unmap(const uint8_t *buf, uint64_t size)
+{
+    /* unmap the file */
+    if (munmap((void *)buf, (size_t)size) < 0)
+    {
+        perror("file: munmap failed.\n");
+        
+        return 1;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief     drop the cached pages of a file
+ * @param[in] *name pointer to a file name buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 drop failed
+ * @note      only clean pages are dropped, it's a hint to the kernel
+ */
+uint8_t file_drop_cache(char *name)
+{
+    int fd;
+    int res;
+    
+    /* open the file */
+    fd = open(name, O_RDONLY);
+    if (fd < 0)
+    {
+        return 1;
+    }
+    
+    /* drop the pages */
+    res = posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    (void)close(fd);
+    
+    return (res == 0) ? 0 : 1;
+}
@@ -0,0 +1,290 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      pool.c
+ * @brief     pool source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "pool.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief pool deque structure definition
+ */
+typedef struct pool_deque_s
+{
+    pthread_mutex_t mutex;        /**< deque lock */
+    uint32_t top;                 /**< next task to steal */
+    uint32_t bottom;              /**< one past the next own task */
+    uint32_t first;               /**< first task of the own slice */
+    uint32_t last;                /**< one past the last task of the own slice */
+} pool_deque_t;
+
+/**
+ * @brief pool structure definition
+ */
+typedef struct pool_s
+{
+    pool_deque_t deque[POOL_MAX_THREADS];                            /**< worker deques */
+    uint32_t threads;                                                /**< worker threads */
+    void (*run)(void *arg, uint32_t task, uint32_t worker);          /**< task function */
+    void *arg;                                                       /**< task argument */
+    uint32_t executed[POOL_MAX_THREADS];                             /**< executed tasks per worker */
+    uint32_t stolen[POOL_MAX_THREADS];                               /**< stolen tasks per worker */
+    double busy_s[POOL_MAX_THREADS];                                 /**< task time per worker */
+} pool_t;
+
+/**
+ * @brief pool worker structure definition
+ */
+typedef struct pool_worker_s
+{
+    pool_t *pool;            /**< pool */
+    uint32_t index;          /**< worker index */
+} pool_worker_t;
+
+/**
+ * @brief  get the monotonic time
+ * @return time in seconds
+ * @note   none
+ */
+static double a_pool_now(void)
+{
+    struct timespec ts;
+    
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief      take the next own task from the back
+ * @param[in]  *deque pointer to a deque structure
+ * @param[out] *task pointer to a task buffer
+ * @return     1 if a task was taken, else 0
+ * @note       none
+ */
+static uint8_t a_pool_pop(pool_deque_t *deque, uint32_t *task)
+{
+    uint8_t res;
+    
+    /* take the last task */
+    (void)pthread_mutex_lock(&deque->mutex);
+    res = 0;
+    if (deque->bottom > deque->top)
+    {
+        deque->bottom--;
+        *task = deque->bottom;
+        res = 1;
+    }
+    (void)pthread_mutex_unlock(&deque->mutex);
+    
+    return res;
+}
+
+/**
+ * @brief      steal a task from the front
+ * @param[in]  *deque pointer to a victim deque structure
+ * @param[out] *task pointer to a task buffer
+ * @return     1 if a task was stolen, else 0
+ * @note       the front holds the tasks the owner reaches last
+ */
+static uint8_t a_pool_steal(pool_deque_t *deque, uint32_t *task)
+{
+    uint8_t res;
+    
+    /* take the first task */
+    (void)pthread_mutex_lock(&deque->mutex);
+    res = 0;
+    if (deque->bottom > deque->top)
+    {
+        *task = deque->top;
+        deque->top++;
+        res = 1;
+    }
+    (void)pthread_mutex_unlock(&deque->mutex);
+    
+    return res;
+}
+
+/**
+ * @brief     worker thread
+ * @param[in] *arg pointer to a worker structure
+ * @return    NULL
+ * @note      tasks never spawn tasks, so one sweep over empty deques means the pool is drained
+ */
+static void *a_pool_worker(void *arg)
+{
+    pool_worker_t *worker = (pool_worker_t *)arg;
+    pool_t *pool = worker->pool;
+    uint32_t me = worker->index;
+    uint32_t task;
+    uint32_t i;
+    uint8_t found;
+    double t;
+    
+    while (1)
+    {
+        /* own tasks first */
+        found = a_pool_pop(&pool->deque[me], &task);
+    
+        /* then steal, starting at the next worker */
+        for (i = 1; (found == 0) && (i < pool->threads); i++)
+        {
+            found = a_pool_steal(&pool->deque[(me + i) % pool->threads], &task);
+        }
+        if (found == 0)
+        {
+            break;
+        }
+    
+        /* run the task */
+        if ((task < pool->deque[me].first) || (task >= pool->deque[me].last))
+        {
+            pool->stolen[me]++;
+        }
+        t = a_pool_now();
+        pool->run(pool->arg, task, me);
+        pool->busy_s[me] += a_pool_now() - t;
+        pool->executed[me]++;
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief  get the online cpu count
+ * @return cpu count, at least 1
+ * @note   none
+ */
+uint32_t pool_cpus(void)
+{
+    long n;
+    
+    /* get the online cpus */
+    n = sysconf(_SC_NPROCESSORS_ONLN);
+    
+    return (n < 1) ? 1 : (uint32_t)n;
+}
+
+/**
+ * @brief      run tasks on a work stealing thread pool
+ * @param[in]  threads worker threads
+ * @param[in]  tasks task count
+ * @param[in]  *run pointer to a task function, called with the arg, the task index and the worker index
+ * @param[in]  *arg pointer to a task argument
+ * @param[out] *report pointer to a report structure, NULL to skip it
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       1 <= threads <= POOL_MAX_THREADS, the tasks are dealt to the workers in contiguous slices,
+ *             every worker runs its own slice from the back and steals from the front of the others
+ *             when it runs dry, the calling thread is worker 0 and the function returns after all tasks
+ */
+uint8_t pool_run(uint32_t threads, uint32_t tasks, void (*run)(void *arg, uint32_t task, uint32_t worker),
+                 void *arg, pool_report_t *report)
+{
+    pool_t *pool;
+    pool_worker_t worker[POOL_MAX_THREADS];
+    pthread_t thread[POOL_MAX_THREADS];
+    uint32_t started;
+    uint32_t i;
+    
+    /* check the params */
+    if ((run == NULL) || (threads == 0) || (threads > POOL_MAX_THREADS))
+    {
+        return 1;
+    }
+    
+    /* deal the tasks */
+    pool = (pool_t *)calloc(1, sizeof(pool_t));
+    if (pool == NULL)
+    {
+        return 1;
+    }
+    pool->threads = threads;
+    pool->run = run;
+    pool->arg = arg;
+    for (i = 0; i < threads; i++)
+    {
+        (void)pthread_mutex_init(&pool->deque[i].mutex, NULL);
+        pool->deque[i].first = (uint32_t)((uint64_t)tasks * i / threads);
+        pool->deque[i].last = (uint32_t)((uint64_t)tasks * (i + 1) / threads);
+        pool->deque[i].top = pool->deque[i].first;
+        pool->deque[i].bottom = pool->deque[i].last;
+        worker[i].pool = pool;
+        worker[i].index = i;
+    }
+    
+    /* start the workers, a failed start leaves its slice to the thieves */
+    started = 1;
+    for (i = 1; i < threads; i++)
+    {
+        if (pthread_create(&thread[started], NULL, a_pool_worker, &worker[i]) != 0)
+        {
+            break;
+        }
+        started++;
+    }
+    
+    /* the caller is worker 0 */
+    (void)a_pool_worker(&worker[0]);
+    for (i = 1; i < started; i++)
+    {
+        (void)pthread_join(thread[i], NULL);
+    }
+    
+    /* fill the report */
+    if (report != NULL)
+    {
+        memset(report, 0, sizeof(pool_report_t));
+        report->threads = threads;
+        for (i = 0; i < threads; i++)
+        {
+            report->tasks += pool->executed[i];
+            report->stolen += pool->stolen[i];
+            report->executed[i] = pool->executed[i];
+            report->busy_s[i] = pool->busy_s[i];
+        }
+    }
+    for (i = 0; i < threads; i++)
+    {
+        (void)pthread_mutex_destroy(&pool->deque[i].mutex);
+    }
+    free(pool);
+    
+    return 0;
+}
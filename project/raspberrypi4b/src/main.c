@@ -36,7 +36,37 @@
 
 #include "driver_sen5x_register_test.h"
 #include "driver_sen5x_read_test.h"
+#include "driver_sen5x_batch_test.h"
+#include "driver_sen5x_archive_test.h"
+#include "driver_sen5x_rollup_test.h"
+#include "driver_sen5x_stats_test.h"
+#include "driver_sen5x_aqi_test.h"
+#include "driver_sen5x_filter_test.h"
+#include "driver_sen5x_psychro_test.h"
+#include "driver_sen5x_hygro_test.h"
+#include "driver_sen5x_psd_test.h"
+#include "driver_sen5x_gas_test.h"
+#include "driver_sen5x_calib_test.h"
+#include "driver_sen5x_phase_test.h"
+#include "driver_sen5x_stamp_test.h"
+#include "driver_sen5x_resample_test.h"
+#include "driver_sen5x_fuse_test.h"
+#include "driver_sen5x_sequence_test.h"
+#include "driver_sen5x_health_test.h"
+#include "driver_sen5x_cleaning_test.h"
+#include "driver_sen5x_fleet_test.h"
+#include "driver_sen5x_duty_test.h"
+#include "driver_sen5x_energy_test.h"
+#include "driver_sen5x_query_test.h"
+#include "driver_sen5x_store_test.h"
+#include "driver_sen5x_log_test.h"
+#include "driver_sen5x_query.h"
+#include "driver_sen5x_log.h"
 #include "driver_sen5x_basic.h"
+#include "driver_sen5x_history.h"
+#include "driver_sen5x_logger.h"
+#include "driver_sen5x_reprocess.h"
+#include "pool.h"
 #include <getopt.h>
 #include <stdlib.h>
 
@@ -64,11 +94,33 @@ uint8_t sen5x(uint8_t argc, char **argv)
         {"test", required_argument, NULL, 't'},
         {"type", required_argument, NULL, 1},
         {"times", required_argument, NULL, 2},
+        {"file", required_argument, NULL, 3},
+        {"start", required_argument, NULL, 4},
+        {"end", required_argument, NULL, 5},
+        {"channel", required_argument, NULL, 6},
+        {"min", required_argument, NULL, 7},
+        {"max", required_argument, NULL, 8},
+        {"generate", required_argument, NULL, 9},
+        {"commit", required_argument, NULL, 10},
+        {"interval", required_argument, NULL, 11},
+        {"sensors", required_argument, NULL, 12},
+        {"threads", required_argument, NULL, 13},
+        {"tuning", required_argument, NULL, 14},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     uint32_t times = 3;
     sen5x_type_t chip_type = SEN55;
+    char file[256] = {0};
+    uint64_t start_ms = 0;
+    uint64_t end_ms = 0xFFFFFFFFFFFFFFFFULL;
+    uint32_t generate = 0;
+    uint8_t filter_enable = 0;
+    uint32_t commit_samples = 60;
+    uint32_t commit_ms = 0;
+    uint32_t sensors = 8;
+    uint32_t threads = pool_cpus();
+    sen5x_query_filter_t filter = {1, -2147483647 - 1, 2147483647};
     
     /* if no params */
     if (argc == 1)
@@ -172,6 +224,120 @@ uint8_t sen5x(uint8_t argc, char **argv)
                 break;
             } 
             
+            /* archive file */
+            case 3 :
+            {
+                /* set the file */
+                memset(file, 0, sizeof(char) * 256);
+                snprintf(file, 255, "%s", optarg);
+                
+                break;
+            }
+            
+            /* start timestamp */
+            case 4 :
+            {
+                /* set the start */
+                start_ms = strtoull(optarg, NULL, 10);
+                
+                break;
+            }
+            
+            /* end timestamp */
+            case 5 :
+            {
+                /* set the end */
+                end_ms = strtoull(optarg, NULL, 10);
+                
+                break;
+            }
+            
+            /* channel */
+            case 6 :
+            {
+                /* set the channel */
+                filter.channel = (uint8_t)atol(optarg);
+                
+                break;
+            }
+            
+            /* min value */
+            case 7 :
+            {
+                /* set the min */
+                filter.min = atol(optarg);
+                filter_enable = 1;
+                
+                break;
+            }
+            
+            /* max value */
+            case 8 :
+            {
+                /* set the max */
+                filter.max = atol(optarg);
+                filter_enable = 1;
+                
+                break;
+            }
+            
+            /* generate days */
+            case 9 :
+            {
+                /* set the days */
+                generate = atol(optarg);
+                
+                break;
+            }
+            
+            /* group commit samples */
+            case 10 :
+            {
+                /* set the samples */
+                commit_samples = atol(optarg);
+                
+                break;
+            }
+            
+            /* group commit interval */
+            case 11 :
+            {
+                /* set the interval */
+                commit_ms = atol(optarg);
+                
+                break;
+            }
+            
+            /* sensor archives */
+            case 12 :
+            {
+                /* set the sensors */
+                sensors = atol(optarg);
+                
+                break;
+            }
+            
+            /* worker threads */
+            case 13 :
+            {
+                /* set the threads */
+                threads = atol(optarg);
+                
+                break;
+            }
+            
+            /* candidate tuning */
+            case 14 :
+            {
+                /* add the tuning */
+                if (sen5x_reprocess_add_tuning(optarg) != 0)
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
             /* the end */
             case -1 :
             {
@@ -207,6 +373,316 @@ uint8_t sen5x(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("t_batch", type) == 0)
+    {
+        /* batch test */
+        if (sen5x_batch_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_archive", type) == 0)
+    {
+        /* archive test */
+        if (sen5x_archive_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_rollup", type) == 0)
+    {
+        /* rollup test */
+        if (sen5x_rollup_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_stats", type) == 0)
+    {
+        /* stats test */
+        if (sen5x_stats_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_aqi", type) == 0)
+    {
+        /* aqi test */
+        if (sen5x_aqi_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_filter", type) == 0)
+    {
+        /* filter test */
+        if (sen5x_filter_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_psychro", type) == 0)
+    {
+        /* psychro test */
+        if (sen5x_psychro_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_hygro", type) == 0)
+    {
+        /* hygro test */
+        if (sen5x_hygro_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_psd", type) == 0)
+    {
+        /* psd test */
+        if (sen5x_psd_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_gas", type) == 0)
+    {
+        /* gas test */
+        if (sen5x_gas_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_calib", type) == 0)
+    {
+        /* calib test */
+        if (sen5x_calib_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_phase", type) == 0)
+    {
+        /* phase test */
+        if (sen5x_phase_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_stamp", type) == 0)
+    {
+        /* stamp test */
+        if (sen5x_stamp_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_resample", type) == 0)
+    {
+        /* resample test */
+        if (sen5x_resample_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_fuse", type) == 0)
+    {
+        /* fuse test */
+        if (sen5x_fuse_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_sequence", type) == 0)
+    {
+        /* sequence test */
+        if (sen5x_sequence_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_health", type) == 0)
+    {
+        /* health test */
+        if (sen5x_health_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_cleaning", type) == 0)
+    {
+        /* cleaning test */
+        if (sen5x_cleaning_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_fleet", type) == 0)
+    {
+        /* fleet test */
+        if (sen5x_fleet_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_duty", type) == 0)
+    {
+        /* duty test */
+        if (sen5x_duty_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_energy", type) == 0)
+    {
+        /* energy test */
+        if (sen5x_energy_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_query", type) == 0)
+    {
+        /* query test */
+        if (sen5x_query_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_store", type) == 0)
+    {
+        /* store test */
+        if (sen5x_store_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("t_log", type) == 0)
+    {
+        /* log test */
+        if (sen5x_log_test(times) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("e_query", type) == 0)
+    {
+        /* default archive file */
+        if (file[0] == 0)
+        {
+            snprintf(file, 255, "sen5x.archive");
+        }
+        
+        /* generate a synthetic archive */
+        if (generate != 0)
+        {
+            sen5x_interface_debug_print("sen5x: generate %d days to %s.\n", generate, file);
+            if (sen5x_history_generate(file, generate) != 0)
+            {
+                return 1;
+            }
+        }
+        
+        /* check the channel */
+        if (filter.channel >= sen5x_archive_layout_channels(SEN5X_ARCHIVE_LAYOUT_MEASURED))
+        {
+            return 5;
+        }
+        
+        /* run the query */
+        if (sen5x_history_query(file, start_ms, end_ms, &filter, filter_enable) != 0)
+        {
+            return 1;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("e_log", type) == 0)
+    {
+        uint8_t res;
+        
+        /* default log file */
+        if (file[0] == 0)
+        {
+            snprintf(file, 255, "sen5x.log");
+        }
+        
+        /* run the log */
+        res = sen5x_logger_run(file, times, commit_samples, commit_ms);
+        if (res != 0)
+        {
+            return res;
+        }
+        
+        return 0;
+    }
+    else if (strcmp("e_reprocess", type) == 0)
+    {
+        uint8_t res;
+        
+        /* default archive prefix */
+        if (file[0] == 0)
+        {
+            snprintf(file, 255, "sen5x.raw");
+        }
+        
+        /* run the reprocess */
+        res = sen5x_reprocess_run(file, sensors, generate, threads);
+        if (res != 0)
+        {
+            return res;
+        }
+        
+        return 0;
+    }
     else if (strcmp("e_read", type) == 0)
     {
         uint8_t res;
@@ -589,6 +1065,30 @@ uint8_t sen5x(uint8_t argc, char **argv)
         sen5x_interface_debug_print("  sen5x (-p | --port)\n");
         sen5x_interface_debug_print("  sen5x (-t reg | --test=reg) [--type=<sen50 | sen54 | sen55>]\n");
         sen5x_interface_debug_print("  sen5x (-t read | --test=read) [--type=<sen50 | sen54 | sen55>] [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t batch | --test=batch) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t archive | --test=archive) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t rollup | --test=rollup) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t stats | --test=stats) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t aqi | --test=aqi) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t filter | --test=filter) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t psychro | --test=psychro) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t hygro | --test=hygro) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t psd | --test=psd) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t gas | --test=gas) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t calib | --test=calib) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t phase | --test=phase) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t stamp | --test=stamp) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t resample | --test=resample) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t fuse | --test=fuse) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t sequence | --test=sequence) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t health | --test=health) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t cleaning | --test=cleaning) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t fleet | --test=fleet) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t duty | --test=duty) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t energy | --test=energy) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t query | --test=query) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t store | --test=store) [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-t log | --test=log) [--times=<num>]\n");
         sen5x_interface_debug_print("  sen5x (-e read | --example=read) [--type=<sen50 | sen54 | sen55>] [--times=<num>]\n");
         sen5x_interface_debug_print("  sen5x (-e pm | --example=pm) [--type=<sen50 | sen54 | sen55>] [--times=<num>]\n");
         sen5x_interface_debug_print("  sen5x (-e raw | --example=raw) [--type=<sen50 | sen54 | sen55>] [--times=<num>]\n");
@@ -597,17 +1097,35 @@ uint8_t sen5x(uint8_t argc, char **argv)
         sen5x_interface_debug_print("  sen5x (-e clean | --example=clean) [--type=<sen50 | sen54 | sen55>]\n");
         sen5x_interface_debug_print("  sen5x (-e version | --example=version) [--type=<sen50 | sen54 | sen55>]\n");
         sen5x_interface_debug_print("  sen5x (-e status | --example=status) [--type=<sen50 | sen54 | sen55>]\n");
+        sen5x_interface_debug_print("  sen5x (-e query | --example=query) [--file=<path>] [--generate=<days>] [--start=<ms>] [--end=<ms>]\n");
+        sen5x_interface_debug_print("        [--channel=<ch>] [--min=<value>] [--max=<value>]\n");
+        sen5x_interface_debug_print("  sen5x (-e log | --example=log) [--file=<path>] [--commit=<samples>] [--interval=<ms>] [--times=<num>]\n");
+        sen5x_interface_debug_print("  sen5x (-e reprocess | --example=reprocess) [--file=<prefix>] [--generate=<days>] [--sensors=<num>]\n");
+        sen5x_interface_debug_print("        [--threads=<num>] [--tuning=<voc | nox>:<offset>,<offset_hour>,<gain_hour>,<gating_minute>,<std>,<gain>]\n");
         sen5x_interface_debug_print("\n");
         sen5x_interface_debug_print("Options:\n");
-        sen5x_interface_debug_print("  -e <read | pm | raw | name | sn | clean | version | status>,\n");
-        sen5x_interface_debug_print("      --example=<read | pm | raw | name | sn | clean | version | status>\n");
+        sen5x_interface_debug_print("  -e <read | pm | raw | name | sn | clean | version | status | query | log | reprocess>,\n");
+        sen5x_interface_debug_print("      --example=<read | pm | raw | name | sn | clean | version | status | query | log | reprocess>\n");
         sen5x_interface_debug_print("                                          Run the driver example.\n");
+        sen5x_interface_debug_print("      --channel=<ch>                      Set the measured values channel of the query, 0 - 7.([default: 1])\n");
+        sen5x_interface_debug_print("      --commit=<samples>                  Set the group commit samples of the log, 1 - 4096.([default: 60])\n");
+        sen5x_interface_debug_print("      --end=<ms>                          Set the last timestamp of the query.\n");
+        sen5x_interface_debug_print("      --file=<path>                       Set the archive, log file or raw archive prefix.([default: sen5x.archive | sen5x.log | sen5x.raw])\n");
+        sen5x_interface_debug_print("      --generate=<days>                   Generate synthetic 1 Hz archives before the query or the reprocess.\n");
         sen5x_interface_debug_print("  -h, --help                              Show the help.\n");
         sen5x_interface_debug_print("  -i, --information                       Show the chip information.\n");
+        sen5x_interface_debug_print("      --interval=<ms>                     Set the group commit interval of the log, 0 disables it.([default: 0])\n");
+        sen5x_interface_debug_print("      --max=<value>                       Set the max raw value of the query filter.\n");
+        sen5x_interface_debug_print("      --min=<value>                       Set the min raw value of the query filter.\n");
         sen5x_interface_debug_print("  -p, --port                              Display the pin connections of the current board.\n");
-        sen5x_interface_debug_print("  -t <reg | read>, --test=<reg | read>    Run the driver test.\n");
+        sen5x_interface_debug_print("      --sensors=<num>                     Set the sensor archives of the reprocess, 1 - 64.([default: 8])\n");
+        sen5x_interface_debug_print("      --start=<ms>                        Set the first timestamp of the query.\n");
+        sen5x_interface_debug_print("  -t <reg | read | batch | archive | rollup | stats | aqi | filter | psychro | hygro | psd | gas | calib | phase | stamp | resample | fuse | sequence | health | cleaning | fleet | duty | energy | query | store | log>, --test=<reg | read | batch | archive | rollup | stats | aqi | filter | psychro | hygro | psd | gas | calib | phase | stamp | resample | fuse | sequence | health | cleaning | fleet | duty | energy | query | store | log>\n");
+        sen5x_interface_debug_print("                                          Run the driver test.\n");
         sen5x_interface_debug_print("      --type=<sen50 | sen54 | sen55>      Set the sensor type.([default: sen55])\n");
+        sen5x_interface_debug_print("      --threads=<num>                     Set the worker threads of the reprocess, 1 - 64.([default: cpus])\n");
         sen5x_interface_debug_print("      --times=<num>                       Set the running times.([default: 3])\n");
+        sen5x_interface_debug_print("      --tuning=<gas>:<params>             Add a candidate tuning of the reprocess, up to 6.([default: built in])\n");
         
         return 0;
     }
@@ -104,6 +104,27 @@ void sen5x_interface_delay_ms(uint32_t ms)
     delay_ms(ms);
 }
 
+/**
+ * @brief  interface timestamp
+ * @return monotonic time in us
+ * @note   none
+ */
+uint64_t sen5x_interface_timestamp_us(void)
+{
+    static uint32_t last = 0;
+    static uint64_t high = 0;
+    uint32_t tick;
+    
+    tick = HAL_GetTick();
+    if (tick < last)
+    {
+        high += 0x100000000ULL;
+    }
+    last = tick;
+    
+    return (high + tick) * 1000ULL;
+}
+
 /**
  * @brief     interface print format data
  * @param[in] fmt format data
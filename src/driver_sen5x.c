@@ -78,6 +78,16 @@
 #define SEN5X_IIC_COMMAND_READ_MEASURED_PM_VALUES                  0x0413U        /**< read measured pm values command */
 #define SEN5X_IIC_COMMAND_READ_MEASURED_RAW_VALUES                 0x03D2U        /**< read measured raw values command */
 
+/**
+ * @brief chip sample definition
+ */
+#define SEN5X_SAMPLE_PERIOD_US          1000000ULL        /**< measurement sample period */
+
+/**
+ * @brief chip energy definition
+ */
+#define SEN5X_ENERGY_CLEANING_US        10000000ULL       /**< fan cleaning duration */
+
 /**
  * @brief     generate the crc
  * @param[in] *handle pointer to a sen5x handle structure
@@ -176,6 +186,132 @@ static uint8_t a_sen5x_iic_write(sen5x_handle_t *handle, uint8_t addr, uint16_t
     return 0;                                                        /* success return 0 */
 }
 
+/**
+ * @brief     count a gap before the last read
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @param[in] gap missed samples
+ * @note      the last read must be counted as fresh
+ */
+static void a_sen5x_sequence_gap(sen5x_handle_t *handle, uint32_t gap)
+{
+    handle->sequence.fresh--;                                                          /* not in sequence */
+    handle->sequence.gap++;                                                            /* count the sample */
+    handle->sequence.missed += gap;                                                    /* count the missed samples */
+    handle->sequence.last_tag = (uint8_t)SEN5X_SAMPLE_TAG_GAP;                         /* set the tag */
+    handle->sequence.last_gap = gap;                                                   /* set the gap */
+    if (gap > handle->sequence.max_gap)                                                /* check the max */
+    {
+        handle->sequence.max_gap = gap;                                                /* set the max */
+    }
+}
+
+/**
+ * @brief     tag a read
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @param[in] ready 1 when a sample was read, 0 when no new sample was ready
+ * @note      the time since the last fresh read in sample periods, rounded, less one is the gap
+ */
+static void a_sen5x_sequence_tag(sen5x_handle_t *handle, uint8_t ready)
+{
+    uint64_t now_us;
+    uint64_t gap;
+    
+    handle->sequence.last_gap = 0;                                                     /* no gap */
+    if (ready == 0)                                                                    /* check the flag */
+    {
+        handle->sequence.duplicate++;                                                  /* count the duplicate */
+        handle->sequence.last_tag = (uint8_t)SEN5X_SAMPLE_TAG_DUPLICATE;               /* set the tag */
+        
+        return;                                                                        /* return */
+    }
+    
+    gap = 0;                                                                           /* no gap */
+    if (handle->timestamp_us != NULL)                                                  /* check the timestamp */
+    {
+        now_us = handle->timestamp_us();                                               /* get the time */
+        if ((handle->sequence_timed != 0) && (now_us > handle->sequence_last_us))      /* check the last fresh read */
+        {
+            gap = (now_us - handle->sequence_last_us + SEN5X_SAMPLE_PERIOD_US / 2) /
+                  SEN5X_SAMPLE_PERIOD_US;                                              /* samples since the last fresh read */
+            gap = (gap > 1) ? (gap - 1) : 0;                                           /* samples between */
+            gap = (gap > 0xFFFFFFFFULL) ? 0xFFFFFFFFULL : gap;                         /* limit the gap */
+        }
+        handle->sequence_last_us = now_us;                                             /* save the time */
+        handle->sequence_timed = 1;                                                    /* timed */
+    }
+    handle->sequence.fresh++;                                                          /* count the sample */
+    handle->sequence.last_tag = (uint8_t)SEN5X_SAMPLE_TAG_FRESH;                       /* set the tag */
+    handle->sequence_max_gap = handle->sequence.max_gap;                               /* save the max for an override */
+    if (gap != 0)                                                                      /* missed samples */
+    {
+        a_sen5x_sequence_gap(handle, (uint32_t)gap);                                   /* count the gap */
+    }
+}
+
+/**
+ * @brief     account the power mode time
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @param[in] now_us current time in us
+ * @note      a finished fan cleaning returns to the measurement mode
+ */
+static void a_sen5x_energy_account(sen5x_handle_t *handle, uint64_t now_us)
+{
+    if (now_us <= handle->energy_last_us)                                              /* nothing passed */
+    {
+        return;                                                                        /* return */
+    }
+    if ((handle->energy_mode == (uint8_t)SEN5X_POWER_MODE_FAN_CLEANING) &&
+        (now_us >= handle->energy_cleaning_us))                                        /* cleaning finished */
+    {
+        if (handle->energy_cleaning_us > handle->energy_last_us)                       /* cleaning time left */
+        {
+            handle->energy_time_us[SEN5X_POWER_MODE_FAN_CLEANING] +=
+                handle->energy_cleaning_us - handle->energy_last_us;                   /* add the cleaning time */
+            handle->energy_last_us = handle->energy_cleaning_us;                       /* account to the end */
+        }
+        handle->energy_mode = (uint8_t)SEN5X_POWER_MODE_MEASUREMENT;                   /* back to the measurement */
+        handle->energy_transitions++;                                                  /* count it */
+    }
+    handle->energy_time_us[handle->energy_mode] += now_us - handle->energy_last_us;    /* add the time */
+    handle->energy_last_us = now_us;                                                   /* save the time */
+}
+
+/**
+ * @brief     switch the power mode
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @param[in] mode new power mode
+ * @note      called after the command succeeded
+ */
+static void a_sen5x_energy_switch(sen5x_handle_t *handle, sen5x_power_mode_t mode)
+{
+    uint64_t now_us;
+    
+    if (handle->timestamp_us != NULL)                                                  /* check the timestamp */
+    {
+        now_us = handle->timestamp_us();                                               /* get the time */
+        a_sen5x_energy_account(handle, now_us);                                        /* account the time */
+    }
+    else if (handle->energy_mode == (uint8_t)SEN5X_POWER_MODE_FAN_CLEANING)            /* no timing */
+    {
+        handle->energy_mode = (uint8_t)SEN5X_POWER_MODE_MEASUREMENT;                   /* cleaning assumed over */
+    }
+    if ((mode == SEN5X_POWER_MODE_FAN_CLEANING) &&
+        (handle->energy_mode != (uint8_t)SEN5X_POWER_MODE_MEASUREMENT))                /* the chip cleans only while it measures */
+    {
+        return;                                                                        /* ignored */
+    }
+    if (handle->energy_mode != (uint8_t)mode)                                          /* mode changed */
+    {
+        handle->energy_transitions++;                                                  /* count it */
+    }
+    handle->energy_mode = (uint8_t)mode;                                               /* set the mode */
+    handle->sequence_timed = 0;                                                        /* a new sample grid */
+    if (handle->timestamp_us != NULL)                                                  /* check the timestamp */
+    {
+        handle->energy_cleaning_us = handle->energy_last_us + SEN5X_ENERGY_CLEANING_US;   /* end of a cleaning */
+    }
+}
+
 /**
  * @brief     start the measurement
  * @param[in] *handle pointer to a sen5x handle structure
@@ -206,6 +342,7 @@ uint8_t sen5x_start_measurement(sen5x_handle_t *handle)
        
         return 1;                                                                                           /* return error */
     }
+    a_sen5x_energy_switch(handle, SEN5X_POWER_MODE_MEASUREMENT);                                            /* measurement mode */
     
     return 0;                                                                                               /* success return 0 */
 }
@@ -248,6 +385,7 @@ uint8_t sen5x_start_measurement_without_pm(sen5x_handle_t *handle)
        
         return 1;                                                                                     /* return error */
     }
+    a_sen5x_energy_switch(handle, SEN5X_POWER_MODE_RHT_GAS);                                          /* rht/gas-only mode */
     
     return 0;                                                                                         /* success return 0 */
 }
@@ -282,7 +420,8 @@ uint8_t sen5x_stop_measurement(sen5x_handle_t *handle)
        
         return 1;                                                                                          /* return error */
     }
-        
+    a_sen5x_energy_switch(handle, SEN5X_POWER_MODE_IDLE);                                                  /* idle mode */
+    
     return 0;                                                                                              /* success return 0 */
 }
 
@@ -380,6 +519,7 @@ uint8_t sen55_read(sen5x_handle_t *handle, sen55_data_t *output)
     }
     if ((check[1] & 0x01) == 0)                                                                                             /* check flag */
     {
+        a_sen5x_sequence_tag(handle, 0);                                                                                    /* tag a duplicate */
         handle->debug_print("sen5x: data not ready.\n");                                                                    /* data not ready */
        
         return 1;                                                                                                           /* return error */
@@ -402,6 +542,7 @@ uint8_t sen55_read(sen5x_handle_t *handle, sen55_data_t *output)
             return 1;                                                                                                       /* return error */
         }
     }
+    a_sen5x_sequence_tag(handle, 1);                                                                                        /* tag the sample */
     output->pm1p0_raw = (uint16_t)(((uint16_t)(buf[0]) << 8) | ((uint16_t)(buf[1]) << 0));                                  /* copy pm1.0 */
     output->pm2p5_raw = (uint16_t)(((uint16_t)(buf[3]) << 8) | ((uint16_t)(buf[4]) << 0));                                  /* copy pm2.5 */
     output->pm4p0_raw = (uint16_t)(((uint16_t)(buf[6]) << 8) | ((uint16_t)(buf[7]) << 0));                                  /* copy pm4.0 */
@@ -413,10 +554,10 @@ uint8_t sen55_read(sen5x_handle_t *handle, sen55_data_t *output)
     if ((output->pm1p0_raw == 0xFFFFU) || (output->pm2p5_raw == 0xFFFFU) || 
         (output->pm4p0_raw == 0xFFFFU) || (output->pm10_raw == 0xFFFFU))                                                    /* check invalid */
     {
-        output->pm1p0_ug_m3 = FP_NAN;                                                                                       /* set nan */
-        output->pm2p5_ug_m3 = FP_NAN;                                                                                       /* set nan */
-        output->pm4p0_ug_m3 = FP_NAN;                                                                                       /* set nan */
-        output->pm10_ug_m3 = FP_NAN;                                                                                        /* set nan */
+        output->pm1p0_ug_m3 = NAN;                                                                                          /* set nan */
+        output->pm2p5_ug_m3 = NAN;                                                                                          /* set nan */
+        output->pm4p0_ug_m3 = NAN;                                                                                          /* set nan */
+        output->pm10_ug_m3 = NAN;                                                                                           /* set nan */
         output->pm_valid = 0;                                                                                               /* set invalid */
     }
     else
@@ -429,7 +570,7 @@ uint8_t sen55_read(sen5x_handle_t *handle, sen55_data_t *output)
     }
     if (output->compensated_ambient_humidity_raw == 0x7FFF)                                                                 /* check humidity raw */
     {
-        output->compensated_ambient_humidity_percentage = FP_NAN;                                                           /* set nan */
+        output->compensated_ambient_humidity_percentage = NAN;                                                              /* set nan */
     }
     else                                                                                                                    /* convert */
     {
@@ -437,7 +578,7 @@ uint8_t sen55_read(sen5x_handle_t *handle, sen55_data_t *output)
     }
     if (output->compensated_ambient_temperature_raw == 0x7FFF)                                                              /* check temperature raw */
     {
-        output->compensated_ambient_temperature_degree = FP_NAN;                                                            /* set nan */
+        output->compensated_ambient_temperature_degree = NAN;                                                               /* set nan */
     }
     else
     {
@@ -445,7 +586,7 @@ uint8_t sen55_read(sen5x_handle_t *handle, sen55_data_t *output)
     }
     if (output->voc_raw == 0x7FFF)                                                                                          /* check voc raw */
     {
-        output->voc_index = FP_NAN;                                                                                         /* set nan */
+        output->voc_index = NAN;                                                                                            /* set nan */
     }
     else
     {
@@ -453,7 +594,7 @@ uint8_t sen55_read(sen5x_handle_t *handle, sen55_data_t *output)
     }
     if (output->nox_raw == 0x7FFF)                                                                                          /* check nox raw */
     {
-        output->nox_index = FP_NAN;                                                                                         /* set nan */
+        output->nox_index = NAN;                                                                                            /* set nan */
     }
     else
     {
@@ -513,6 +654,7 @@ uint8_t sen54_read(sen5x_handle_t *handle, sen54_data_t *output)
     }
     if ((check[1] & 0x01) == 0)                                                                                             /* check flag */
     {
+        a_sen5x_sequence_tag(handle, 0);                                                                                    /* tag a duplicate */
         handle->debug_print("sen5x: data not ready.\n");                                                                    /* data not ready */
        
         return 1;                                                                                                           /* return error */
@@ -535,6 +677,7 @@ uint8_t sen54_read(sen5x_handle_t *handle, sen54_data_t *output)
             return 1;                                                                                                       /* return error */
         }
     }
+    a_sen5x_sequence_tag(handle, 1);                                                                                        /* tag the sample */
     output->pm1p0_raw = (uint16_t)(((uint16_t)(buf[0]) << 8) | ((uint16_t)(buf[1]) << 0));                                  /* copy pm1.0 */
     output->pm2p5_raw = (uint16_t)(((uint16_t)(buf[3]) << 8) | ((uint16_t)(buf[4]) << 0));                                  /* copy pm2.5 */
     output->pm4p0_raw = (uint16_t)(((uint16_t)(buf[6]) << 8) | ((uint16_t)(buf[7]) << 0));                                  /* copy pm4.0 */
@@ -545,10 +688,10 @@ uint8_t sen54_read(sen5x_handle_t *handle, sen54_data_t *output)
     if ((output->pm1p0_raw == 0xFFFFU) || (output->pm2p5_raw == 0xFFFFU) || 
         (output->pm4p0_raw == 0xFFFFU) || (output->pm10_raw == 0xFFFFU))                                                    /* check invalid */
     {
-        output->pm1p0_ug_m3 = FP_NAN;                                                                                       /* set nan */
-        output->pm2p5_ug_m3 = FP_NAN;                                                                                       /* set nan */
-        output->pm4p0_ug_m3 = FP_NAN;                                                                                       /* set nan */
-        output->pm10_ug_m3 = FP_NAN;                                                                                        /* set nan */
+        output->pm1p0_ug_m3 = NAN;                                                                                          /* set nan */
+        output->pm2p5_ug_m3 = NAN;                                                                                          /* set nan */
+        output->pm4p0_ug_m3 = NAN;                                                                                          /* set nan */
+        output->pm10_ug_m3 = NAN;                                                                                           /* set nan */
         output->pm_valid = 0;                                                                                               /* set invalid */
     }
     else
@@ -561,7 +704,7 @@ uint8_t sen54_read(sen5x_handle_t *handle, sen54_data_t *output)
     }
     if (output->compensated_ambient_humidity_raw == 0x7FFF)                                                                 /* check humidity raw */
     {
-        output->compensated_ambient_humidity_percentage = FP_NAN;                                                           /* set nan */
+        output->compensated_ambient_humidity_percentage = NAN;                                                              /* set nan */
     }
     else                                                                                                                    /* convert */
     {
@@ -569,7 +712,7 @@ uint8_t sen54_read(sen5x_handle_t *handle, sen54_data_t *output)
     }
     if (output->compensated_ambient_temperature_raw == 0x7FFF)                                                              /* check temperature raw */
     {
-        output->compensated_ambient_temperature_degree = FP_NAN;                                                            /* set nan */
+        output->compensated_ambient_temperature_degree = NAN;                                                               /* set nan */
     }
     else
     {
@@ -577,7 +720,7 @@ uint8_t sen54_read(sen5x_handle_t *handle, sen54_data_t *output)
     }
     if (output->voc_raw == 0x7FFF)                                                                                          /* check voc raw */
     {
-        output->voc_index = FP_NAN;                                                                                         /* set nan */
+        output->voc_index = NAN;                                                                                            /* set nan */
     }
     else
     {
@@ -637,6 +780,7 @@ uint8_t sen50_read(sen5x_handle_t *handle, sen50_data_t *output)
     }
     if ((check[1] & 0x01) == 0)                                                                                             /* check flag */
     {
+        a_sen5x_sequence_tag(handle, 0);                                                                                    /* tag a duplicate */
         handle->debug_print("sen5x: data not ready.\n");                                                                    /* data not ready */
        
         return 1;                                                                                                           /* return error */
@@ -659,6 +803,7 @@ uint8_t sen50_read(sen5x_handle_t *handle, sen50_data_t *output)
             return 1;                                                                                                       /* return error */
         }
     }
+    a_sen5x_sequence_tag(handle, 1);                                                                                        /* tag the sample */
     output->pm1p0_raw = (uint16_t)(((uint16_t)(buf[0]) << 8) | ((uint16_t)(buf[1]) << 0));                                  /* copy pm1.0 */
     output->pm2p5_raw = (uint16_t)(((uint16_t)(buf[3]) << 8) | ((uint16_t)(buf[4]) << 0));                                  /* copy pm2.5 */
     output->pm4p0_raw = (uint16_t)(((uint16_t)(buf[6]) << 8) | ((uint16_t)(buf[7]) << 0));                                  /* copy pm4.0 */
@@ -666,10 +811,10 @@ uint8_t sen50_read(sen5x_handle_t *handle, sen50_data_t *output)
     if ((output->pm1p0_raw == 0xFFFFU) || (output->pm2p5_raw == 0xFFFFU) || 
         (output->pm4p0_raw == 0xFFFFU) || (output->pm10_raw == 0xFFFFU))                                                    /* check invalid */
     {
-        output->pm1p0_ug_m3 = FP_NAN;                                                                                       /* set nan */
-        output->pm2p5_ug_m3 = FP_NAN;                                                                                       /* set nan */
-        output->pm4p0_ug_m3 = FP_NAN;                                                                                       /* set nan */
-        output->pm10_ug_m3 = FP_NAN;                                                                                        /* set nan */
+        output->pm1p0_ug_m3 = NAN;                                                                                          /* set nan */
+        output->pm2p5_ug_m3 = NAN;                                                                                          /* set nan */
+        output->pm4p0_ug_m3 = NAN;                                                                                          /* set nan */
+        output->pm10_ug_m3 = NAN;                                                                                           /* set nan */
         output->pm_valid = 0;                                                                                               /* set invalid */
     }
     else
@@ -726,6 +871,7 @@ uint8_t sen5x_read_pm_value(sen5x_handle_t *handle, sen5x_pm_t *pm)
     }
     if ((check[1] & 0x01) == 0)                                                                                             /* check flag */
     {
+        a_sen5x_sequence_tag(handle, 0);                                                                                    /* tag a duplicate */
         handle->debug_print("sen5x: data not ready.\n");                                                                    /* data not ready */
        
         return 1;                                                                                                           /* return error */
@@ -748,6 +894,7 @@ uint8_t sen5x_read_pm_value(sen5x_handle_t *handle, sen5x_pm_t *pm)
             return 1;                                                                                                       /* return error */
         }
     }
+    a_sen5x_sequence_tag(handle, 1);                                                                                        /* tag the sample */
     pm->mass_concentration_pm1p0_raw = (uint16_t)(((uint16_t)(buf[0]) << 8) | ((uint16_t)(buf[1]) << 0));                   /* copy pm1.0 raw */
     pm->mass_concentration_pm2p5_raw = (uint16_t)(((uint16_t)(buf[3]) << 8) | ((uint16_t)(buf[4]) << 0));                   /* copy pm2.5 raw */
     pm->mass_concentration_pm4p0_raw = (uint16_t)(((uint16_t)(buf[6]) << 8) | ((uint16_t)(buf[7]) << 0));                   /* copy pm4.0 raw */
@@ -765,16 +912,16 @@ uint8_t sen5x_read_pm_value(sen5x_handle_t *handle, sen5x_pm_t *pm)
         (pm->number_concentration_pm10_raw == 0xFFFFU) || (pm->typical_particle_raw == 0xFFFFU)
        )
     {
-        pm->pm1p0_ug_m3 = FP_NAN;                                                                                           /* set nan */
-        pm->pm2p5_ug_m3 = FP_NAN;                                                                                           /* set nan */
-        pm->pm4p0_ug_m3 = FP_NAN;                                                                                           /* set nan */
-        pm->pm10_ug_m3 = FP_NAN;                                                                                            /* set nan */
-        pm->pm0p5_cm3 = FP_NAN;                                                                                             /* set nan */
-        pm->pm1p0_cm3 = FP_NAN;                                                                                             /* set nan */
-        pm->pm2p5_cm3 = FP_NAN;                                                                                             /* set nan */
-        pm->pm4p0_cm3 = FP_NAN;                                                                                             /* set nan */
-        pm->pm10_cm3 = FP_NAN;                                                                                              /* set nan */
-        pm->typical_particle_um = FP_NAN;                                                                                   /* set nan */
+        pm->pm1p0_ug_m3 = NAN;                                                                                              /* set nan */
+        pm->pm2p5_ug_m3 = NAN;                                                                                              /* set nan */
+        pm->pm4p0_ug_m3 = NAN;                                                                                              /* set nan */
+        pm->pm10_ug_m3 = NAN;                                                                                               /* set nan */
+        pm->pm0p5_cm3 = NAN;                                                                                                /* set nan */
+        pm->pm1p0_cm3 = NAN;                                                                                                /* set nan */
+        pm->pm2p5_cm3 = NAN;                                                                                                /* set nan */
+        pm->pm4p0_cm3 = NAN;                                                                                                /* set nan */
+        pm->pm10_cm3 = NAN;                                                                                                 /* set nan */
+        pm->typical_particle_um = NAN;                                                                                      /* set nan */
         pm->pm_valid = 0;                                                                                                   /* set invalid */
     }
     else
@@ -844,6 +991,7 @@ uint8_t sen5x_read_raw_value(sen5x_handle_t *handle, sen5x_raw_t *raw)
     }
     if ((check[1] & 0x01) == 0)                                                                                             /* check flag */
     {
+        a_sen5x_sequence_tag(handle, 0);                                                                                    /* tag a duplicate */
         handle->debug_print("sen5x: data not ready.\n");                                                                    /* data not ready */
        
         return 1;                                                                                                           /* return error */
@@ -866,6 +1014,7 @@ uint8_t sen5x_read_raw_value(sen5x_handle_t *handle, sen5x_raw_t *raw)
             return 1;                                                                                                       /* return error */
         }
     }
+    a_sen5x_sequence_tag(handle, 1);                                                                                        /* tag the sample */
     raw->humidity_raw = (int16_t)(((uint16_t)(buf[0]) << 8) | ((uint16_t)(buf[1]) << 0));                                   /* set humidity raw */
     raw->temperature_raw = (int16_t)(((uint16_t)(buf[3]) << 8) | ((uint16_t)(buf[4]) << 0));                                /* set temperature raw */
     raw->voc_raw = (uint16_t)(((uint16_t)(buf[6]) << 8) | ((uint16_t)(buf[7]) << 0));                                       /* set voc raw */
@@ -876,7 +1025,7 @@ uint8_t sen5x_read_raw_value(sen5x_handle_t *handle, sen5x_raw_t *raw)
     }
     else
     {
-        raw->humidity_percentage = FP_NAN;                                                                                  /* set nan */
+        raw->humidity_percentage = NAN;                                                                                     /* set nan */
     }
     if (raw->temperature_raw != 0x7FFF)                                                                                     /* check valid */
     {
@@ -884,7 +1033,7 @@ uint8_t sen5x_read_raw_value(sen5x_handle_t *handle, sen5x_raw_t *raw)
     }
     else
     {
-        raw->temperature_degree = FP_NAN;                                                                                   /* set nan */
+        raw->temperature_degree = NAN;                                                                                      /* set nan */
     }
     if (raw->voc_raw != 0xFFFFU)                                                                                            /* check valid */
     {
@@ -892,7 +1041,7 @@ uint8_t sen5x_read_raw_value(sen5x_handle_t *handle, sen5x_raw_t *raw)
     }
     else
     {
-        raw->voc = FP_NAN;                                                                                                  /* set nan */
+        raw->voc = NAN;                                                                                                     /* set nan */
     }
     if (raw->nox_raw != 0xFFFFU)                                                                                            /* check valid */
     {
@@ -900,12 +1049,288 @@ uint8_t sen5x_read_raw_value(sen5x_handle_t *handle, sen5x_raw_t *raw)
     }
     else
     {
-        raw->nox = FP_NAN;                                                                                                  /* set nan */
+        raw->nox = NAN;                                                                                                     /* set nan */
     }
     
     return 0;                                                                                                               /* success return 0 */
 }
 
+/**
+ * @brief      get the tag of the last read
+ * @param[in]  *handle pointer to a sen5x handle structure
+ * @param[out] *tag pointer to a sample tag buffer
+ * @param[out] *gap pointer to a missed samples buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       a read finding the data ready flag off is a duplicate, a new sample is a gap when the
+ *             timestamp_us link saw more than one sample period since the last new sample, the gap can
+ *             be off by one when the reads drift more than half a period against the samples
+ */
+uint8_t sen5x_get_sample_tag(sen5x_handle_t *handle, sen5x_sample_tag_t *tag, uint32_t *gap)
+{
+    if ((handle == NULL) || (tag == NULL) || (gap == NULL))                            /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    *tag = (sen5x_sample_tag_t)(handle->sequence.last_tag);                            /* get the tag */
+    *gap = handle->sequence.last_gap;                                                  /* get the gap */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     set the missed samples before the last read
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @param[in] gap missed samples
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 the last read is not a new sample
+ * @note      optional, replaces the gap the read took from the timestamp_us link, for example with the
+ *            skipped field of sen5x_stamp_push
+ */
+uint8_t sen5x_set_sample_gap(sen5x_handle_t *handle, uint32_t gap)
+{
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if ((handle->sequence.last_tag == (uint8_t)SEN5X_SAMPLE_TAG_DUPLICATE) ||
+        ((handle->sequence.fresh == 0) && (handle->sequence.gap == 0)))                /* check the last read */
+    {
+        handle->debug_print("sen5x: the last read is not a new sample.\n");            /* the last read is not a new sample */
+        
+        return 4;                                                                      /* return error */
+    }
+    
+    if (handle->sequence.last_tag == (uint8_t)SEN5X_SAMPLE_TAG_GAP)                    /* undo the gap of the read */
+    {
+        handle->sequence.fresh++;                                                      /* in sequence */
+        handle->sequence.gap--;                                                        /* uncount the sample */
+        handle->sequence.missed -= handle->sequence.last_gap;                          /* uncount the missed samples */
+        handle->sequence.max_gap = handle->sequence_max_gap;                           /* restore the max */
+        handle->sequence.last_tag = (uint8_t)SEN5X_SAMPLE_TAG_FRESH;                   /* set the tag */
+        handle->sequence.last_gap = 0;                                                 /* no gap */
+    }
+    if (gap != 0)                                                                      /* missed samples */
+    {
+        a_sen5x_sequence_gap(handle, gap);                                             /* count the gap */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the sequence counters
+ * @param[in]  *handle pointer to a sen5x handle structure
+ * @param[out] *sequence pointer to a sen5x sequence structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       duplicates are counted from the data ready flag, gaps from the timestamp_us link or
+ *             sen5x_set_sample_gap, a read after sen5x_read_pm_value finds the flag still set and counts
+ *             as new, the first read after a power mode change is never a gap
+ */
+uint8_t sen5x_get_sequence(sen5x_handle_t *handle, sen5x_sequence_t *sequence)
+{
+    if ((handle == NULL) || (sequence == NULL))                                        /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    memcpy(sequence, &handle->sequence, sizeof(sen5x_sequence_t));                     /* copy the counters */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     clear the sequence counters
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t sen5x_clear_sequence(sen5x_handle_t *handle)
+{
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    memset(&handle->sequence, 0, sizeof(sen5x_sequence_t));                            /* clear the counters */
+    handle->sequence_max_gap = 0;                                                      /* clear the saved max */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     set the current of a power mode
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @param[in] mode power mode
+ * @param[in] current_ma current in mA
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 mode or current is invalid
+ * @note      sen5x_init sets the SEN5X_POWER_CURRENT_* datasheet figures
+ */
+uint8_t sen5x_set_power_current(sen5x_handle_t *handle, sen5x_power_mode_t mode, float current_ma)
+{
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (((uint32_t)mode > (uint32_t)SEN5X_POWER_MODE_FAN_CLEANING) || (!(current_ma >= 0.0f)))   /* check the params */
+    {
+        handle->debug_print("sen5x: mode or current is invalid.\n");                   /* mode or current is invalid */
+        
+        return 4;                                                                      /* return error */
+    }
+    
+    handle->energy_current_ma[mode] = current_ma;                                      /* set the current */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the current of a power mode
+ * @param[in]  *handle pointer to a sen5x handle structure
+ * @param[in]  mode power mode
+ * @param[out] *current_ma pointer to a current buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 mode is invalid
+ * @note       none
+ */
+uint8_t sen5x_get_power_current(sen5x_handle_t *handle, sen5x_power_mode_t mode, float *current_ma)
+{
+    if ((handle == NULL) || (current_ma == NULL))                                      /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if ((uint32_t)mode > (uint32_t)SEN5X_POWER_MODE_FAN_CLEANING)                      /* check the mode */
+    {
+        handle->debug_print("sen5x: mode is invalid.\n");                              /* mode is invalid */
+        
+        return 4;                                                                      /* return error */
+    }
+    
+    *current_ma = handle->energy_current_ma[mode];                                     /* get the current */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get a snapshot of the energy accounting
+ * @param[in]  *handle pointer to a sen5x handle structure
+ * @param[out] *energy pointer to a sen5x energy structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the mode follows the start measurement, start measurement without pm, stop measurement,
+ *             start fan cleaning and reset commands, a fan cleaning returns to the measurement mode after
+ *             10s, the time needs the timestamp_us link and the auto cleaning of the chip is not seen
+ */
+uint8_t sen5x_get_energy(sen5x_handle_t *handle, sen5x_energy_t *energy)
+{
+    uint8_t i;
+    uint64_t total;
+    
+    if ((handle == NULL) || (energy == NULL))                                          /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    if (handle->timestamp_us != NULL)                                                  /* check the timestamp */
+    {
+        a_sen5x_energy_account(handle, handle->timestamp_us());                        /* account up to now */
+    }
+    total = 0;                                                                         /* init the total time */
+    energy->total_mah = 0.0f;                                                          /* init the total charge */
+    for (i = 0; i < 4; i++)                                                            /* all modes */
+    {
+        energy->time_us[i] = handle->energy_time_us[i];                                /* copy the time */
+        energy->charge_mah[i] = (float)((double)handle->energy_time_us[i] *
+                                        handle->energy_current_ma[i] / 3600000000.0);   /* mode charge */
+        energy->total_mah += energy->charge_mah[i];                                    /* add the charge */
+        total += handle->energy_time_us[i];                                            /* add the time */
+    }
+    energy->average_ma = (total != 0) ? (float)((double)energy->total_mah * 3600000000.0 / (double)total) : 0.0f;   /* average current */
+    energy->transitions = handle->energy_transitions;                                  /* copy the transitions */
+    energy->mode = handle->energy_mode;                                                /* copy the mode */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     clear the energy accounting
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the power mode and the currents are kept
+ */
+uint8_t sen5x_clear_energy(sen5x_handle_t *handle)
+{
+    if (handle == NULL)                                                                /* check handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                           /* check handle initialization */
+    {
+        return 3;                                                                      /* return error */
+    }
+    
+    if (handle->timestamp_us != NULL)                                                  /* check the timestamp */
+    {
+        a_sen5x_energy_account(handle, handle->timestamp_us());                        /* finish the running cleaning */
+    }
+    memset(handle->energy_time_us, 0, sizeof(handle->energy_time_us));                 /* clear the time */
+    handle->energy_transitions = 0;                                                    /* clear the transitions */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
 /**
  * @brief     set temperature compensation
  * @param[in] *handle pointer to a sen5x handle structure
@@ -1800,6 +2225,7 @@ uint8_t sen5x_start_fan_cleaning(sen5x_handle_t *handle)
        
         return 1;                                                                                           /* return error */
     }
+    a_sen5x_energy_switch(handle, SEN5X_POWER_MODE_FAN_CLEANING);                                           /* fan cleaning */
     
     return 0;                                                                                               /* success return 0 */
 }
@@ -2218,6 +2644,7 @@ uint8_t sen5x_reset(sen5x_handle_t *handle)
        
         return 1;                                                                                /* return error */
     }
+    a_sen5x_energy_switch(handle, SEN5X_POWER_MODE_IDLE);                                        /* idle mode */
     
     return 0;                                                                                    /* success return 0 */
 }
@@ -2273,11 +2700,12 @@ uint8_t sen5x_get_type(sen5x_handle_t *handle, sen5x_type_t *type)
  *            - 2 handle is NULL
  *            - 3 linked functions is NULL
  *            - 4 reset failed
- * @note      none
+ * @note      a timestamp_us link that doesn't move over the 200ms reset delay is dropped
  */
 uint8_t sen5x_init(sen5x_handle_t *handle)
 {
     uint8_t res;
+    uint64_t start_us;
     
     if (handle == NULL)                                                                          /* check handle */
     {
@@ -2324,6 +2752,7 @@ uint8_t sen5x_init(sen5x_handle_t *handle)
         
         return 1;                                                                                /* return error */
     }
+    start_us = (handle->timestamp_us != NULL) ? handle->timestamp_us() : 0;                      /* time before the reset */
     res = a_sen5x_iic_write(handle, SEN5X_ADDRESS, SEN5X_IIC_COMMAND_RESET, NULL, 0, 200);       /* reset command */
     if (res != 0)                                                                                /* check result */
     {
@@ -2332,6 +2761,22 @@ uint8_t sen5x_init(sen5x_handle_t *handle)
         
         return 4;                                                                                /* return error */
     }
+    if ((handle->timestamp_us != NULL) && (handle->timestamp_us() == start_us))                  /* check the clock */
+    {
+        handle->debug_print("sen5x: timestamp_us doesn't move and is ignored.\n");               /* timestamp_us doesn't move */
+        handle->timestamp_us = NULL;                                                             /* drop the clock */
+    }
+    memset(&handle->sequence, 0, sizeof(sen5x_sequence_t));                                      /* clear the sequence */
+    handle->sequence_timed = 0;                                                                  /* no fresh read yet */
+    handle->sequence_max_gap = 0;                                                                /* clear the saved max */
+    handle->energy_mode = (uint8_t)SEN5X_POWER_MODE_IDLE;                                        /* idle after the reset */
+    handle->energy_transitions = 0;                                                              /* clear the transitions */
+    handle->energy_last_us = (handle->timestamp_us != NULL) ? handle->timestamp_us() : 0;        /* account from now */
+    memset(handle->energy_time_us, 0, sizeof(handle->energy_time_us));                           /* clear the time */
+    handle->energy_current_ma[SEN5X_POWER_MODE_IDLE] = SEN5X_POWER_CURRENT_IDLE_MA;                   /* set the idle current */
+    handle->energy_current_ma[SEN5X_POWER_MODE_RHT_GAS] = SEN5X_POWER_CURRENT_RHT_GAS_MA;             /* set the rht/gas current */
+    handle->energy_current_ma[SEN5X_POWER_MODE_MEASUREMENT] = SEN5X_POWER_CURRENT_MEASUREMENT_MA;     /* set the measurement current */
+    handle->energy_current_ma[SEN5X_POWER_MODE_FAN_CLEANING] = SEN5X_POWER_CURRENT_FAN_CLEANING_MA;   /* set the cleaning current */
     handle->inited = 1;                                                                          /* flag finish initialization */
   
     return 0;                                                                                    /* success return 0 */
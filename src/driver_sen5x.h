@@ -99,6 +99,35 @@ typedef enum
     SEN5X_RHT_ACCELERATION_MEDIUM = 2,       /**< medium acceleration */
 } sen5x_rht_acceleration_mode_t;
 
+/**
+ * @brief sen5x sample tag enumeration definition
+ */
+typedef enum
+{
+    SEN5X_SAMPLE_TAG_FRESH     = 0x00,        /**< next sample in sequence */
+    SEN5X_SAMPLE_TAG_DUPLICATE = 0x01,        /**< no new sample since the last read */
+    SEN5X_SAMPLE_TAG_GAP       = 0x02,        /**< new sample after missed samples */
+} sen5x_sample_tag_t;
+
+/**
+ * @brief sen5x power mode enumeration definition
+ */
+typedef enum
+{
+    SEN5X_POWER_MODE_IDLE         = 0x00,        /**< idle mode */
+    SEN5X_POWER_MODE_RHT_GAS      = 0x01,        /**< rht/gas-only measurement mode */
+    SEN5X_POWER_MODE_MEASUREMENT  = 0x02,        /**< measurement mode */
+    SEN5X_POWER_MODE_FAN_CLEANING = 0x03,        /**< fan cleaning */
+} sen5x_power_mode_t;
+
+/**
+ * @brief sen5x power current definition, the datasheet typical figures sen5x_init sets
+ */
+#define SEN5X_POWER_CURRENT_IDLE_MA                2.6f          /**< idle current in mA */
+#define SEN5X_POWER_CURRENT_RHT_GAS_MA             6.8f          /**< rht/gas-only measurement current in mA */
+#define SEN5X_POWER_CURRENT_MEASUREMENT_MA         63.0f         /**< measurement current in mA */
+#define SEN5X_POWER_CURRENT_FAN_CLEANING_MA        100.0f        /**< fan cleaning current at full fan speed in mA */
+
 /**
  * @brief sen55 data structure definition
  */
@@ -204,6 +233,33 @@ typedef struct sen5x_raw_s
     float nox;                        /**< nox value*/
 } sen5x_raw_t;
 
+/**
+ * @brief sen5x sequence structure definition
+ */
+typedef struct sen5x_sequence_s
+{
+    uint32_t fresh;            /**< samples read in sequence */
+    uint32_t gap;              /**< samples read after a gap */
+    uint32_t missed;           /**< samples lost in the gaps */
+    uint32_t duplicate;        /**< reads without a new sample */
+    uint32_t max_gap;          /**< longest gap in samples */
+    uint32_t last_gap;         /**< samples lost before the last read */
+    uint8_t last_tag;          /**< tag of the last read */
+} sen5x_sequence_t;
+
+/**
+ * @brief sen5x energy structure definition
+ */
+typedef struct sen5x_energy_s
+{
+    uint64_t time_us[4];       /**< time in every power mode */
+    float charge_mah[4];       /**< estimated charge in every power mode */
+    float total_mah;           /**< estimated total charge */
+    float average_ma;          /**< estimated average current */
+    uint32_t transitions;      /**< power mode changes */
+    uint8_t mode;              /**< current power mode */
+} sen5x_energy_t;
+
 /**
  * @brief sen5x handle structure definition
  */
@@ -215,8 +271,19 @@ typedef struct sen5x_handle_s
     uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);        /**< point to an iic_read_cmd function address */
     void (*delay_ms)(uint32_t ms);                                            /**< point to a delay_ms function address */
     void (*debug_print)(const char *const fmt, ...);                          /**< point to a debug_print function address */
+    uint64_t (*timestamp_us)(void);                                           /**< point to a timestamp_us function address */
     uint8_t type;                                                             /**< type */
     uint8_t inited;                                                           /**< inited flag */
+    sen5x_sequence_t sequence;                                                /**< sequence counters */
+    uint8_t sequence_timed;                                                   /**< last fresh read time is valid */
+    uint64_t sequence_last_us;                                                /**< time of the last fresh read */
+    uint32_t sequence_max_gap;                                                /**< max gap before the last read */
+    uint8_t energy_mode;                                                      /**< power mode */
+    uint32_t energy_transitions;                                              /**< power mode changes */
+    uint64_t energy_last_us;                                                  /**< time accounted up to */
+    uint64_t energy_cleaning_us;                                              /**< end of the fan cleaning */
+    uint64_t energy_time_us[4];                                               /**< time in every power mode */
+    float energy_current_ma[4];                                               /**< current of every power mode */
 } sen5x_handle_t;
 
 /**
@@ -302,6 +369,14 @@ typedef struct sen5x_info_s
  */
 #define DRIVER_SEN5X_LINK_DEBUG_PRINT(HANDLE, FUC)            (HANDLE)->debug_print = FUC
 
+/**
+ * @brief     link timestamp_us function
+ * @param[in] HANDLE pointer to a sen5x handle structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      optional, without it the energy accounting counts no time
+ */
+#define DRIVER_SEN5X_LINK_TIMESTAMP_US(HANDLE, FUC)           (HANDLE)->timestamp_us = FUC
+
 /**
  * @}
  */
@@ -354,7 +429,7 @@ uint8_t sen5x_get_type(sen5x_handle_t *handle, sen5x_type_t *type);
  *            - 2 handle is NULL
  *            - 3 linked functions is NULL
  *            - 4 reset failed
- * @note      none
+ * @note      a timestamp_us link that doesn't move over the 200ms reset delay is dropped
  */
 uint8_t sen5x_init(sen5x_handle_t *handle);
 
@@ -490,6 +565,113 @@ uint8_t sen5x_read_pm_value(sen5x_handle_t *handle, sen5x_pm_t *pm);
  */
 uint8_t sen5x_read_raw_value(sen5x_handle_t *handle, sen5x_raw_t *raw);
 
+/**
+ * @brief      get the tag of the last read
+ * @param[in]  *handle pointer to a sen5x handle structure
+ * @param[out] *tag pointer to a sample tag buffer
+ * @param[out] *gap pointer to a missed samples buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       a read finding the data ready flag off is a duplicate, a new sample is a gap when the
+ *             timestamp_us link saw more than one sample period since the last new sample, the gap can
+ *             be off by one when the reads drift more than half a period against the samples
+ */
+uint8_t sen5x_get_sample_tag(sen5x_handle_t *handle, sen5x_sample_tag_t *tag, uint32_t *gap);
+
+/**
+ * @brief     set the missed samples before the last read
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @param[in] gap missed samples
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 the last read is not a new sample
+ * @note      optional, replaces the gap the read took from the timestamp_us link, for example with the
+ *            skipped field of sen5x_stamp_push
+ */
+uint8_t sen5x_set_sample_gap(sen5x_handle_t *handle, uint32_t gap);
+
+/**
+ * @brief      get the sequence counters
+ * @param[in]  *handle pointer to a sen5x handle structure
+ * @param[out] *sequence pointer to a sen5x sequence structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       duplicates are counted from the data ready flag, gaps from the timestamp_us link or
+ *             sen5x_set_sample_gap, a read after sen5x_read_pm_value finds the flag still set and counts
+ *             as new, the first read after a power mode change is never a gap
+ */
+uint8_t sen5x_get_sequence(sen5x_handle_t *handle, sen5x_sequence_t *sequence);
+
+/**
+ * @brief     clear the sequence counters
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t sen5x_clear_sequence(sen5x_handle_t *handle);
+
+/**
+ * @brief     set the current of a power mode
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @param[in] mode power mode
+ * @param[in] current_ma current in mA
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 mode or current is invalid
+ * @note      sen5x_init sets the SEN5X_POWER_CURRENT_* datasheet figures
+ */
+uint8_t sen5x_set_power_current(sen5x_handle_t *handle, sen5x_power_mode_t mode, float current_ma);
+
+/**
+ * @brief      get the current of a power mode
+ * @param[in]  *handle pointer to a sen5x handle structure
+ * @param[in]  mode power mode
+ * @param[out] *current_ma pointer to a current buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 mode is invalid
+ * @note       none
+ */
+uint8_t sen5x_get_power_current(sen5x_handle_t *handle, sen5x_power_mode_t mode, float *current_ma);
+
+/**
+ * @brief      get a snapshot of the energy accounting
+ * @param[in]  *handle pointer to a sen5x handle structure
+ * @param[out] *energy pointer to a sen5x energy structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the mode follows the start measurement, start measurement without pm, stop measurement,
+ *             start fan cleaning and reset commands, a fan cleaning returns to the measurement mode after
+ *             10s, the time needs the timestamp_us link and the auto cleaning of the chip is not seen
+ */
+uint8_t sen5x_get_energy(sen5x_handle_t *handle, sen5x_energy_t *energy);
+
+/**
+ * @brief     clear the energy accounting
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      the power mode and the currents are kept
+ */
+uint8_t sen5x_clear_energy(sen5x_handle_t *handle);
+
 /**
  * @brief     set temperature compensation
  * @param[in] *handle pointer to a sen5x handle structure
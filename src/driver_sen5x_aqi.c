@@ -0,0 +1,564 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_aqi.c
+ * @brief     driver sen5x aqi source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_aqi.h"
+
+/**
+ * @brief aqi breakpoint structure definition
+ */
+typedef struct sen5x_aqi_breakpoint_s
+{
+    float c_lo;          /**< band low concentration */
+    float c_hi;          /**< band high concentration */
+    uint16_t i_lo;       /**< band low index */
+    uint16_t i_hi;       /**< band high index */
+} sen5x_aqi_breakpoint_t;
+
+/**
+ * @brief aqi table structure definition
+ */
+typedef struct sen5x_aqi_table_s
+{
+    const sen5x_aqi_breakpoint_t *band;        /**< bands */
+    uint8_t bands;                             /**< band count */
+    float truncate;                            /**< truncation scale, 0 keeps the concentration */
+} sen5x_aqi_table_t;
+
+/**
+ * @brief us epa 2024 breakpoint tables
+ */
+static const sen5x_aqi_breakpoint_t gs_epa_2024_pm2p5[] =
+{
+    {0.0f, 9.0f, 0, 50}, {9.1f, 35.4f, 51, 100}, {35.5f, 55.4f, 101, 150},
+    {55.5f, 125.4f, 151, 200}, {125.5f, 225.4f, 201, 300}, {225.5f, 325.4f, 301, 500},
+};
+static const sen5x_aqi_breakpoint_t gs_epa_2024_pm10[] =
+{
+    {0.0f, 54.0f, 0, 50}, {55.0f, 154.0f, 51, 100}, {155.0f, 254.0f, 101, 150},
+    {255.0f, 354.0f, 151, 200}, {355.0f, 424.0f, 201, 300}, {425.0f, 604.0f, 301, 500},
+};
+
+/**
+ * @brief us epa 2012 breakpoint tables
+ */
+static const sen5x_aqi_breakpoint_t gs_epa_2012_pm2p5[] =
+{
+    {0.0f, 12.0f, 0, 50}, {12.1f, 35.4f, 51, 100}, {35.5f, 55.4f, 101, 150}, {55.5f, 150.4f, 151, 200},
+    {150.5f, 250.4f, 201, 300}, {250.5f, 350.4f, 301, 400}, {350.5f, 500.4f, 401, 500},
+};
+static const sen5x_aqi_breakpoint_t gs_epa_2012_pm10[] =
+{
+    {0.0f, 54.0f, 0, 50}, {55.0f, 154.0f, 51, 100}, {155.0f, 254.0f, 101, 150}, {255.0f, 354.0f, 151, 200},
+    {355.0f, 424.0f, 201, 300}, {425.0f, 504.0f, 301, 400}, {505.0f, 604.0f, 401, 500},
+};
+
+/**
+ * @brief india naqi breakpoint tables
+ */
+static const sen5x_aqi_breakpoint_t gs_india_pm2p5[] =
+{
+    {0.0f, 30.0f, 0, 50}, {31.0f, 60.0f, 51, 100}, {61.0f, 90.0f, 101, 200},
+    {91.0f, 120.0f, 201, 300}, {121.0f, 250.0f, 301, 400}, {251.0f, 380.0f, 401, 500},
+};
+static const sen5x_aqi_breakpoint_t gs_india_pm10[] =
+{
+    {0.0f, 50.0f, 0, 50}, {51.0f, 100.0f, 51, 100}, {101.0f, 250.0f, 101, 200},
+    {251.0f, 350.0f, 201, 300}, {351.0f, 430.0f, 301, 400}, {431.0f, 510.0f, 401, 500},
+};
+
+/**
+ * @brief eu caqi hourly grid tables
+ */
+static const sen5x_aqi_breakpoint_t gs_caqi_pm2p5[] =
+{
+    {0.0f, 15.0f, 0, 25}, {15.0f, 30.0f, 25, 50}, {30.0f, 55.0f, 50, 75}, {55.0f, 110.0f, 75, 100},
+};
+static const sen5x_aqi_breakpoint_t gs_caqi_pm10[] =
+{
+    {0.0f, 25.0f, 0, 25}, {25.0f, 50.0f, 25, 50}, {50.0f, 90.0f, 50, 75}, {90.0f, 180.0f, 75, 100},
+};
+
+/**
+ * @brief standard table, indexed by standard and pollutant
+ */
+static const sen5x_aqi_table_t gs_table[4][2] =
+{
+    {{gs_epa_2024_pm2p5, 6, 10.0f}, {gs_epa_2024_pm10, 6, 1.0f}},
+    {{gs_epa_2012_pm2p5, 7, 10.0f}, {gs_epa_2012_pm10, 7, 1.0f}},
+    {{gs_india_pm2p5, 6, 1.0f}, {gs_india_pm10, 6, 1.0f}},
+    {{gs_caqi_pm2p5, 4, 0.0f}, {gs_caqi_pm10, 4, 0.0f}},
+};
+
+/**
+ * @brief     count the set bits
+ * @param[in] v value
+ * @return    set bits
+ * @note      none
+ */
+static uint8_t a_sen5x_aqi_bits(uint64_t v)
+{
+    uint8_t n;
+
+    n = 0;                                  /* init 0 */
+    while (v != 0)                          /* run all bits */
+    {
+        v &= v - 1;                         /* clear the lowest bit */
+        n++;                                /* count */
+    }
+
+    return n;                               /* return the count */
+}
+
+/**
+ * @brief     get the epa nowcast of a pollutant
+ * @param[in] *aqi pointer to an aqi structure
+ * @param[in] p pollutant
+ * @return    nowcast, nan when the recent hours are missing
+ * @note      needs 2 of the 3 latest hours, the weight factor is limited to 0.5
+ */
+static float a_sen5x_aqi_nowcast(const sen5x_aqi_t *aqi, uint8_t p)
+{
+    uint8_t i;
+    uint8_t n;
+    uint8_t valid;
+    uint8_t recent;
+    uint8_t pos;
+    float c;
+    float min;
+    float max;
+    float w;
+    float f;
+    double num;
+    double den;
+
+    n = (aqi->hours < SEN5X_AQI_NOWCAST_HOURS) ? aqi->hours : SEN5X_AQI_NOWCAST_HOURS;        /* usable hours */
+    valid = 0;                                                                                /* init 0 */
+    recent = 0;                                                                               /* init 0 */
+    min = 0.0f;                                                                               /* init 0 */
+    max = 0.0f;                                                                               /* init 0 */
+    pos = aqi->pos;                                                                           /* newest hour */
+    for (i = 0; i < n; i++)                                                                   /* run the hours */
+    {
+        c = aqi->hour[p][pos];                                                                /* get the hour */
+        if (isnan(c) == 0)                                                                    /* valid hour */
+        {
+            if (valid == 0)                                                                   /* first valid hour */
+            {
+                min = c;                                                                      /* set the min */
+                max = c;                                                                      /* set the max */
+            }
+            min = (c < min) ? c : min;                                                        /* update the min */
+            max = (c > max) ? c : max;                                                        /* update the max */
+            valid++;                                                                          /* one more */
+            recent += (i < 3) ? 1 : 0;                                                        /* count the recent hours */
+        }
+        pos = (pos == 0) ? (SEN5X_AQI_HOURS - 1) : (pos - 1);                                 /* older hour */
+    }
+    if (recent < 2)                                                                           /* not enough recent hours */
+    {
+        return NAN;                                                                           /* return invalid */
+    }
+    w = (max > 0.0f) ? (min / max) : 1.0f;                                                    /* weight factor */
+    w = (w < 0.5f) ? 0.5f : w;                                                                /* limit the weight */
+    num = 0.0;                                                                                /* init 0 */
+    den = 0.0;                                                                                /* init 0 */
+    f = 1.0f;                                                                                 /* newest weight */
+    pos = aqi->pos;                                                                           /* newest hour */
+    for (i = 0; i < n; i++)                                                                   /* run the hours */
+    {
+        c = aqi->hour[p][pos];                                                                /* get the hour */
+        if (isnan(c) == 0)                                                                    /* valid hour */
+        {
+            num += (double)f * c;                                                             /* add the weighted hour */
+            den += f;                                                                         /* add the weight */
+        }
+        f *= w;                                                                               /* next weight */
+        pos = (pos == 0) ? (SEN5X_AQI_HOURS - 1) : (pos - 1);                                 /* older hour */
+    }
+
+    return (float)(num / den);                                                                /* return the nowcast */
+}
+
+/**
+ * @brief     update the result from the hourly averages
+ * @param[in] *aqi pointer to an aqi structure
+ * @note      none
+ */
+static void a_sen5x_aqi_update(sen5x_aqi_t *aqi)
+{
+    uint8_t p;
+    float c;
+
+    aqi->result.valid = 0;                                                                    /* clear the valid bits */
+    aqi->result.aqi = 0;                                                                      /* clear the aqi */
+    aqi->result.dominant = 0;                                                                 /* clear the dominant */
+    for (p = 0; p < 2; p++)                                                                   /* run both pollutants */
+    {
+        if (aqi->hours == 0)                                                                  /* no hours */
+        {
+            c = NAN;                                                                          /* invalid */
+        }
+        else if (aqi->standard == SEN5X_AQI_STANDARD_INDIA_NAQI)                              /* 24 h average */
+        {
+            c = (aqi->day_count[p] >= SEN5X_AQI_MIN_DAY_HOURS) ?
+                (float)(aqi->day_sum[p] / aqi->day_count[p]) : NAN;                           /* day average */
+        }
+        else if (aqi->standard == SEN5X_AQI_STANDARD_EU_CAQI)                                 /* hourly */
+        {
+            c = aqi->hour[p][aqi->pos];                                                       /* last hour */
+        }
+        else                                                                                  /* nowcast */
+        {
+            c = a_sen5x_aqi_nowcast(aqi, p);                                                  /* nowcast */
+        }
+        aqi->result.concentration[p] = c;                                                     /* save the concentration */
+        if ((isnan(c) == 0) &&
+            (sen5x_aqi_get_index((sen5x_aqi_standard_t)aqi->standard, (sen5x_aqi_pollutant_t)p, c,
+                                 &aqi->result.index[p], &aqi->result.category[p]) == 0))      /* map the index */
+        {
+            aqi->result.valid |= (uint8_t)(1 << p);                                           /* flag valid */
+            if (aqi->result.index[p] > aqi->result.aqi)                                       /* new max */
+            {
+                aqi->result.aqi = aqi->result.index[p];                                       /* set the aqi */
+                aqi->result.dominant = p;                                                     /* set the dominant */
+            }
+        }
+    }
+}
+
+/**
+ * @brief     close the open hour and the skipped hours
+ * @param[in] *aqi pointer to an aqi structure
+ * @param[in] hour_ms start of the new hour
+ * @note      none
+ */
+static void a_sen5x_aqi_close(sen5x_aqi_t *aqi, uint64_t hour_ms)
+{
+    uint8_t p;
+    uint64_t hours;
+    float c[2];
+    float old;
+
+    hours = (hour_ms - aqi->hour_ms) / 3600000;                                               /* closed hours */
+    if (hours > SEN5X_AQI_HOURS)                                                              /* long gap */
+    {
+        hours = SEN5X_AQI_HOURS;                                                              /* limit */
+    }
+    for (p = 0; p < 2; p++)                                                                   /* run both pollutants */
+    {
+        c[p] = (a_sen5x_aqi_bits(aqi->minute[p]) >= SEN5X_AQI_MIN_MINUTES) ?
+               (float)(aqi->sum[p] / aqi->count[p]) : NAN;                                    /* hourly average */
+    }
+    while (hours != 0)                                                                        /* run the closed hours */
+    {
+        aqi->pos = (uint8_t)((aqi->pos + 1) % SEN5X_AQI_HOURS);                               /* next slot */
+        for (p = 0; p < 2; p++)                                                               /* run both pollutants */
+        {
+            old = aqi->hour[p][aqi->pos];                                                     /* get the dropped hour */
+            if ((aqi->hours == SEN5X_AQI_HOURS) && (isnan(old) == 0))                         /* leaves the day */
+            {
+                aqi->day_sum[p] -= old;                                                       /* remove from the sum */
+                aqi->day_count[p]--;                                                          /* one less */
+            }
+            aqi->hour[p][aqi->pos] = c[p];                                                    /* set the hour */
+            if (isnan(c[p]) == 0)                                                             /* valid hour */
+            {
+                aqi->day_sum[p] += c[p];                                                      /* add to the sum */
+                aqi->day_count[p]++;                                                          /* one more */
+            }
+            c[p] = NAN;                                                                       /* skipped hours are invalid */
+        }
+        if (aqi->hours < SEN5X_AQI_HOURS)                                                     /* filling */
+        {
+            aqi->hours++;                                                                     /* one more */
+        }
+        hours--;                                                                              /* one less */
+    }
+    aqi->result.hour_ms = hour_ms - 3600000;                                                  /* last closed hour */
+    a_sen5x_aqi_update(aqi);                                                                  /* update the result */
+}
+
+/**
+ * @brief     init the aqi
+ * @param[in] *aqi pointer to an aqi structure
+ * @param[in] standard index standard
+ * @return    status code
+ *            - 0 success
+ *            - 2 aqi is NULL
+ *            - 4 standard is invalid
+ * @note      none
+ */
+uint8_t sen5x_aqi_init(sen5x_aqi_t *aqi, sen5x_aqi_standard_t standard)
+{
+    uint8_t i;
+
+    if (aqi == NULL)                                                      /* check the aqi */
+    {
+        return 2;                                                         /* return error */
+    }
+    if ((uint32_t)standard > SEN5X_AQI_STANDARD_EU_CAQI)                  /* check the standard */
+    {
+        return 4;                                                         /* return error */
+    }
+
+    memset(aqi, 0, sizeof(sen5x_aqi_t));                                  /* clear the aqi */
+    for (i = 0; i < SEN5X_AQI_HOURS; i++)                                 /* clear the ring */
+    {
+        aqi->hour[0][i] = NAN;                                            /* invalid pm2.5 hour */
+        aqi->hour[1][i] = NAN;                                            /* invalid pm10 hour */
+    }
+    aqi->standard = (uint8_t)standard;                                    /* set the standard */
+    aqi->inited = 1;                                                      /* flag inited */
+
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     change the index standard
+ * @param[in] *aqi pointer to an aqi structure
+ * @param[in] standard index standard
+ * @return    status code
+ *            - 0 success
+ *            - 2 aqi is NULL
+ *            - 3 aqi is not initialized
+ *            - 4 standard is invalid
+ * @note      the result is recomputed from the kept hourly averages
+ */
+uint8_t sen5x_aqi_set_standard(sen5x_aqi_t *aqi, sen5x_aqi_standard_t standard)
+{
+    if (aqi == NULL)                                                      /* check the aqi */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (aqi->inited != 1)                                                 /* check the aqi */
+    {
+        return 3;                                                         /* return error */
+    }
+    if ((uint32_t)standard > SEN5X_AQI_STANDARD_EU_CAQI)                  /* check the standard */
+    {
+        return 4;                                                         /* return error */
+    }
+
+    aqi->standard = (uint8_t)standard;                                    /* set the standard */
+    a_sen5x_aqi_update(aqi);                                              /* update the result */
+
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     push a sample
+ * @param[in] *aqi pointer to an aqi structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] pm2p5_ug_m3 pm2.5 mass concentration
+ * @param[in] pm10_ug_m3 pm10 mass concentration
+ * @return    status code
+ *            - 0 success
+ *            - 2 aqi is NULL
+ *            - 3 aqi is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      nan values are skipped, the result is updated when an hour closes
+ */
+uint8_t sen5x_aqi_push(sen5x_aqi_t *aqi, uint64_t timestamp_ms, float pm2p5_ug_m3, float pm10_ug_m3)
+{
+    uint64_t hour_ms;
+    uint64_t bit;
+
+    if (aqi == NULL)                                                                          /* check the aqi */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (aqi->inited != 1)                                                                     /* check the aqi */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if (timestamp_ms < aqi->last_ms)                                                          /* check the timestamp */
+    {
+        return 4;                                                                             /* return error */
+    }
+
+    aqi->last_ms = timestamp_ms;                                                              /* save the timestamp */
+    hour_ms = timestamp_ms - timestamp_ms % 3600000;                                          /* hour start */
+    if ((aqi->open != 0) && (hour_ms != aqi->hour_ms))                                        /* hour has changed */
+    {
+        a_sen5x_aqi_close(aqi, hour_ms);                                                      /* close the hour */
+        aqi->open = 0;                                                                        /* flag closed */
+    }
+    if (aqi->open == 0)                                                                       /* open a new hour */
+    {
+        aqi->hour_ms = hour_ms;                                                               /* set the start */
+        aqi->sum[0] = 0.0;                                                                    /* clear the pm2.5 sum */
+        aqi->sum[1] = 0.0;                                                                    /* clear the pm10 sum */
+        aqi->count[0] = 0;                                                                    /* clear the pm2.5 count */
+        aqi->count[1] = 0;                                                                    /* clear the pm10 count */
+        aqi->minute[0] = 0;                                                                   /* clear the pm2.5 minutes */
+        aqi->minute[1] = 0;                                                                   /* clear the pm10 minutes */
+        aqi->open = 1;                                                                        /* flag open */
+    }
+    bit = 1ULL << ((timestamp_ms - hour_ms) / 60000);                                         /* minute bit */
+    if (isnan(pm2p5_ug_m3) == 0)                                                              /* valid pm2.5 */
+    {
+        aqi->sum[0] += pm2p5_ug_m3;                                                           /* add to the sum */
+        aqi->count[0]++;                                                                      /* one more */
+        aqi->minute[0] |= bit;                                                                /* flag the minute */
+    }
+    if (isnan(pm10_ug_m3) == 0)                                                               /* valid pm10 */
+    {
+        aqi->sum[1] += pm10_ug_m3;                                                            /* add to the sum */
+        aqi->count[1]++;                                                                      /* one more */
+        aqi->minute[1] |= bit;                                                                /* flag the minute */
+    }
+
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     push a pm sample
+ * @param[in] *aqi pointer to an aqi structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] *pm pointer to a sen5x pm structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 aqi or pm is NULL
+ *            - 3 aqi is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      samples without pm_valid only move the hour forward
+ */
+uint8_t sen5x_aqi_push_pm(sen5x_aqi_t *aqi, uint64_t timestamp_ms, const sen5x_pm_t *pm)
+{
+    if (pm == NULL)                                                                           /* check the pm */
+    {
+        return 2;                                                                             /* return error */
+    }
+
+    if (pm->pm_valid == 0)                                                                    /* invalid pm */
+    {
+        return sen5x_aqi_push(aqi, timestamp_ms, NAN, NAN);                                   /* move the hour */
+    }
+
+    return sen5x_aqi_push(aqi, timestamp_ms, pm->pm2p5_ug_m3, pm->pm10_ug_m3);                /* push the sample */
+}
+
+/**
+ * @brief      get the last result
+ * @param[in]  *aqi pointer to an aqi structure
+ * @param[out] *result pointer to a result structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 aqi or result is NULL
+ *             - 3 aqi is not initialized
+ *             - 5 not enough valid hours
+ * @note       none
+ */
+uint8_t sen5x_aqi_get_result(sen5x_aqi_t *aqi, sen5x_aqi_result_t *result)
+{
+    if ((aqi == NULL) || (result == NULL))                                /* check the params */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (aqi->inited != 1)                                                 /* check the aqi */
+    {
+        return 3;                                                         /* return error */
+    }
+
+    *result = aqi->result;                                                /* copy the result */
+    if (aqi->result.valid == 0)                                           /* no index */
+    {
+        return 5;                                                         /* return error */
+    }
+
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      map a concentration through the breakpoint table
+ * @param[in]  standard index standard
+ * @param[in]  pollutant pollutant
+ * @param[in]  concentration concentration in μg/m3
+ * @param[out] *index pointer to an index buffer
+ * @param[out] *category pointer to a category buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 index or category is NULL
+ *             - 4 standard or pollutant is invalid
+ *             - 5 concentration is invalid
+ * @note       concentrations above the table extend the last band
+ */
+uint8_t sen5x_aqi_get_index(sen5x_aqi_standard_t standard, sen5x_aqi_pollutant_t pollutant,
+                            float concentration, uint16_t *index, uint8_t *category)
+{
+    uint8_t i;
+    float c;
+    float v;
+    const sen5x_aqi_table_t *table;
+    const sen5x_aqi_breakpoint_t *band;
+
+    if ((index == NULL) || (category == NULL))                                                /* check the params */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (((uint32_t)standard > SEN5X_AQI_STANDARD_EU_CAQI) ||
+        ((uint32_t)pollutant > SEN5X_AQI_POLLUTANT_PM10))                                     /* check the params */
+    {
+        return 4;                                                                             /* return error */
+    }
+    if (!(concentration >= 0.0f))                                                             /* check the concentration */
+    {
+        return 5;                                                                             /* return error */
+    }
+
+    table = &gs_table[standard][pollutant];                                                   /* get the table */
+    c = concentration;                                                                        /* get the concentration */
+    if (table->truncate > 0.0f)                                                               /* truncate */
+    {
+        c = floorf(c * table->truncate + 1e-3f) / table->truncate;                            /* truncate the digits */
+    }
+    for (i = 0; i < (table->bands - 1); i++)                                                  /* find the band */
+    {
+        if (c <= table->band[i].c_hi)                                                         /* found */
+        {
+            break;                                                                            /* stop */
+        }
+    }
+    band = &table->band[i];                                                                   /* get the band */
+    v = (float)(band->i_hi - band->i_lo) / (band->c_hi - band->c_lo) * (c - band->c_lo) +
+        (float)band->i_lo;                                                                    /* interpolate */
+    v = (v < 0.0f) ? 0.0f : v;                                                                /* limit the low side */
+    v = (v > 65535.0f) ? 65535.0f : v;                                                        /* limit the high side */
+    *index = (uint16_t)(v + 0.5f);                                                            /* round the index */
+    *category = i;                                                                            /* set the category */
+
+    return 0;                                                                                 /* success return 0 */
+}
@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_aqi.h
+ * @brief     driver sen5x aqi header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_AQI_H
+#define DRIVER_SEN5X_AQI_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_aqi_driver sen5x aqi driver function
+ * @brief    sen5x aqi driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x aqi definition
+ */
+#define SEN5X_AQI_HOURS                 24        /**< kept hourly averages */
+#define SEN5X_AQI_NOWCAST_HOURS         12        /**< nowcast hours */
+#define SEN5X_AQI_MIN_MINUTES           45        /**< minutes with data for a valid hour */
+#define SEN5X_AQI_MIN_DAY_HOURS         16        /**< valid hours for a 24 h average */
+
+/**
+ * @brief sen5x aqi standard enumeration definition
+ */
+typedef enum
+{
+    SEN5X_AQI_STANDARD_US_EPA_2024 = 0x00,        /**< us epa aqi with the 2024 pm2.5 breakpoints, nowcast */
+    SEN5X_AQI_STANDARD_US_EPA_2012 = 0x01,        /**< us epa aqi with the 2012 breakpoints, nowcast */
+    SEN5X_AQI_STANDARD_INDIA_NAQI  = 0x02,        /**< india national aqi, 24 h average */
+    SEN5X_AQI_STANDARD_EU_CAQI     = 0x03,        /**< european common aqi, hourly grid */
+} sen5x_aqi_standard_t;
+
+/**
+ * @brief sen5x aqi pollutant enumeration definition
+ */
+typedef enum
+{
+    SEN5X_AQI_POLLUTANT_PM2P5 = 0x00,        /**< pm2.5 */
+    SEN5X_AQI_POLLUTANT_PM10  = 0x01,        /**< pm10 */
+} sen5x_aqi_pollutant_t;
+
+/**
+ * @brief sen5x aqi result structure definition
+ */
+typedef struct sen5x_aqi_result_s
+{
+    uint64_t hour_ms;                 /**< start of the last closed hour */
+    uint8_t valid;                    /**< bit n set when pollutant n has an index */
+    float concentration[2];           /**< averaged concentration of the standard in μg/m3 */
+    uint16_t index[2];                /**< sub index per pollutant */
+    uint8_t category[2];              /**< breakpoint band per pollutant */
+    uint16_t aqi;                     /**< max sub index */
+    uint8_t dominant;                 /**< pollutant of the max sub index */
+} sen5x_aqi_result_t;
+
+/**
+ * @brief sen5x aqi structure definition
+ */
+typedef struct sen5x_aqi_s
+{
+    uint8_t standard;                              /**< index standard */
+    uint8_t open;                                  /**< hour open flag */
+    uint64_t hour_ms;                              /**< start of the open hour */
+    double sum[2];                                 /**< sum of the open hour */
+    uint32_t count[2];                             /**< samples of the open hour */
+    uint64_t minute[2];                            /**< minutes with data in the open hour */
+    float hour[2][SEN5X_AQI_HOURS];                /**< hourly averages ring, nan for invalid hours */
+    uint8_t pos;                                   /**< newest hour in the ring */
+    uint8_t hours;                                 /**< closed hours in the ring */
+    double day_sum[2];                             /**< sum of the valid hours in the ring */
+    uint8_t day_count[2];                          /**< valid hours in the ring */
+    sen5x_aqi_result_t result;                     /**< last result */
+    uint64_t last_ms;                              /**< last timestamp */
+    uint8_t inited;                                /**< inited flag */
+} sen5x_aqi_t;
+
+/**
+ * @brief     init the aqi
+ * @param[in] *aqi pointer to an aqi structure
+ * @param[in] standard index standard
+ * @return    status code
+ *            - 0 success
+ *            - 2 aqi is NULL
+ *            - 4 standard is invalid
+ * @note      none
+ */
+uint8_t sen5x_aqi_init(sen5x_aqi_t *aqi, sen5x_aqi_standard_t standard);
+
+/**
+ * @brief     change the index standard
+ * @param[in] *aqi pointer to an aqi structure
+ * @param[in] standard index standard
+ * @return    status code
+ *            - 0 success
+ *            - 2 aqi is NULL
+ *            - 3 aqi is not initialized
+ *            - 4 standard is invalid
+ * @note      the result is recomputed from the kept hourly averages
+ */
+uint8_t sen5x_aqi_set_standard(sen5x_aqi_t *aqi, sen5x_aqi_standard_t standard);
+
+/**
+ * @brief     push a sample
+ * @param[in] *aqi pointer to an aqi structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] pm2p5_ug_m3 pm2.5 mass concentration
+ * @param[in] pm10_ug_m3 pm10 mass concentration
+ * @return    status code
+ *            - 0 success
+ *            - 2 aqi is NULL
+ *            - 3 aqi is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      nan values are skipped, the result is updated when an hour closes
+ */
+uint8_t sen5x_aqi_push(sen5x_aqi_t *aqi, uint64_t timestamp_ms, float pm2p5_ug_m3, float pm10_ug_m3);
+
+/**
+ * @brief     push a pm sample
+ * @param[in] *aqi pointer to an aqi structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] *pm pointer to a sen5x pm structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 aqi or pm is NULL
+ *            - 3 aqi is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      samples without pm_valid only move the hour forward
+ */
+uint8_t sen5x_aqi_push_pm(sen5x_aqi_t *aqi, uint64_t timestamp_ms, const sen5x_pm_t *pm);
+
+/**
+ * @brief      get the last result
+ * @param[in]  *aqi pointer to an aqi structure
+ * @param[out] *result pointer to a result structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 aqi or result is NULL
+ *             - 3 aqi is not initialized
+ *             - 5 not enough valid hours
+ * @note       none
+ */
+uint8_t sen5x_aqi_get_result(sen5x_aqi_t *aqi, sen5x_aqi_result_t *result);
+
+/**
+ * @brief      map a concentration through the breakpoint table
+ * @param[in]  standard index standard
+ * @param[in]  pollutant pollutant
+ * @param[in]  concentration concentration in μg/m3
+ * @param[out] *index pointer to an index buffer
+ * @param[out] *category pointer to a category buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 index or category is NULL
+ *             - 4 standard or pollutant is invalid
+ *             - 5 concentration is invalid
+ * @note       concentrations above the table extend the last band
+ */
+uint8_t sen5x_aqi_get_index(sen5x_aqi_standard_t standard, sen5x_aqi_pollutant_t pollutant,
+                            float concentration, uint16_t *index, uint8_t *category);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,713 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_archive.c
+ * @brief     driver sen5x archive source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_archive.h"
+
+/**
+ * @brief archive worst case sample length definition
+ */
+#define SEN5X_ARCHIVE_SAMPLE_MAX(ch)        (10 + 3 * (ch))        /**< timestamp varint and 3 bytes per channel */
+
+/**
+ * @brief layout channel count table
+ */
+static const uint8_t gs_channels[3] = {8, 10, 4};
+
+/**
+ * @brief layout signed channel mask table
+ */
+static const uint16_t gs_signed_mask[3] = {0x00F0, 0x0000, 0x0003};
+
+/**
+ * @brief crc32 nibble table of the reflected polynomial 0xEDB88320
+ */
+static const uint32_t gs_crc32_table[16] =
+{
+    0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU, 0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+    0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU, 0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU,
+};
+
+/**
+ * @brief     write a little endian u16
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_sen5x_archive_put_u16(uint8_t *buf, uint16_t v)
+{
+    buf[0] = (uint8_t)((v >> 0) & 0xFF);        /* byte 0 */
+    buf[1] = (uint8_t)((v >> 8) & 0xFF);        /* byte 1 */
+}
+
+/**
+ * @brief     write a little endian u32
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_sen5x_archive_put_u32(uint8_t *buf, uint32_t v)
+{
+    a_sen5x_archive_put_u16(&buf[0], (uint16_t)(v >> 0));         /* low half */
+    a_sen5x_archive_put_u16(&buf[2], (uint16_t)(v >> 16));        /* high half */
+}
+
+/**
+ * @brief     write a little endian u64
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_sen5x_archive_put_u64(uint8_t *buf, uint64_t v)
+{
+    a_sen5x_archive_put_u32(&buf[0], (uint32_t)(v >> 0));         /* low half */
+    a_sen5x_archive_put_u32(&buf[4], (uint32_t)(v >> 32));        /* high half */
+}
+
+/**
+ * @brief     read a little endian u16
+ * @param[in] *buf pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint16_t a_sen5x_archive_get_u16(const uint8_t *buf)
+{
+    return (uint16_t)(((uint16_t)(buf[1]) << 8) | ((uint16_t)(buf[0]) << 0));        /* get the value */
+}
+
+/**
+ * @brief     read a little endian u32
+ * @param[in] *buf pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint32_t a_sen5x_archive_get_u32(const uint8_t *buf)
+{
+    return ((uint32_t)a_sen5x_archive_get_u16(&buf[2]) << 16) | a_sen5x_archive_get_u16(&buf[0]);        /* get the value */
+}
+
+/**
+ * @brief     read a little endian u64
+ * @param[in] *buf pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint64_t a_sen5x_archive_get_u64(const uint8_t *buf)
+{
+    return ((uint64_t)a_sen5x_archive_get_u32(&buf[4]) << 32) | a_sen5x_archive_get_u32(&buf[0]);        /* get the value */
+}
+
+/**
+ * @brief     zigzag encode a signed value
+ * @param[in] v signed value
+ * @return    unsigned value
+ * @note      none
+ */
+static uint64_t a_sen5x_archive_zigzag(int64_t v)
+{
+    uint64_t u = (uint64_t)v;
+
+    return (u << 1) ^ (0 - (u >> 63));        /* move the sign to bit 0 */
+}
+
+/**
+ * @brief     zigzag decode an unsigned value
+ * @param[in] u unsigned value
+ * @return    signed value
+ * @note      none
+ */
+static int64_t a_sen5x_archive_unzigzag(uint64_t u)
+{
+    return (int64_t)((u >> 1) ^ (0 - (u & 1)));        /* move bit 0 to the sign */
+}
+
+/**
+ * @brief     write a varint
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] pos write position
+ * @param[in] v value
+ * @return    next write position
+ * @note      7 bits per byte, bit 7 set on all but the last byte
+ */
+static uint32_t a_sen5x_archive_put_varint(uint8_t *buf, uint32_t pos, uint64_t v)
+{
+    while (v >= 0x80)                                          /* more bytes */
+    {
+        buf[pos++] = (uint8_t)((v & 0x7F) | 0x80);             /* set 7 bits */
+        v >>= 7;                                               /* next 7 bits */
+    }
+    buf[pos++] = (uint8_t)v;                                   /* last byte */
+
+    return pos;                                                /* return the position */
+}
+
+/**
+ * @brief         read a varint
+ * @param[in]     *buf pointer to a data buffer
+ * @param[in,out] *pos pointer to a read position
+ * @param[in]     limit end of the data
+ * @param[out]    *v pointer to a value buffer
+ * @return        status code
+ *                - 0 success
+ *                - 1 varint is truncated
+ * @note          none
+ */
+static uint8_t a_sen5x_archive_get_varint(const uint8_t *buf, uint32_t *pos, uint32_t limit, uint64_t *v)
+{
+    uint8_t shift;
+    uint8_t b;
+
+    *v = 0;                                                    /* init 0 */
+    for (shift = 0; shift < 64; shift += 7)                    /* 10 bytes at most */
+    {
+        if (*pos >= limit)                                     /* check the limit */
+        {
+            return 1;                                          /* return error */
+        }
+        b = buf[(*pos)++];                                     /* get a byte */
+        *v |= (uint64_t)(b & 0x7F) << shift;                   /* set 7 bits */
+        if ((b & 0x80) == 0)                                   /* last byte */
+        {
+            return 0;                                          /* success return 0 */
+        }
+    }
+
+    return 1;                                                  /* return error */
+}
+
+/**
+ * @brief      get the natural value of a channel word
+ * @param[in]  layout block layout
+ * @param[in]  ch channel
+ * @param[in]  word raw word
+ * @param[out] *value pointer to a value buffer
+ * @return     1 if the word is valid, else 0
+ * @note       none
+ */
+static uint8_t a_sen5x_archive_value(uint8_t layout, uint8_t ch, uint16_t word, int32_t *value)
+{
+    if ((gs_signed_mask[layout] & (1U << ch)) != 0)        /* signed channel */
+    {
+        *value = (int16_t)word;                            /* sign extend */
+
+        return (word != 0x7FFFU) ? 1 : 0;                  /* check invalid */
+    }
+    else
+    {
+        *value = word;                                     /* zero extend */
+
+        return (word != 0xFFFFU) ? 1 : 0;                  /* check invalid */
+    }
+}
+
+/**
+ * @brief     clear the current block
+ * @param[in] *encoder pointer to an encoder structure
+ * @note      none
+ */
+static void a_sen5x_archive_reset(sen5x_archive_encoder_t *encoder)
+{
+    encoder->pos = SEN5X_ARCHIVE_HEADER_LENGTH;                                /* payload start */
+    encoder->last_delta = 0;                                                   /* init 0 */
+    memset(encoder->prev, 0, sizeof(encoder->prev));                           /* clear the words */
+    encoder->header.count = 0;                                                 /* no sample */
+    encoder->header.valid_mask = 0;                                            /* no valid channel */
+    encoder->header.length = 0;                                                /* no payload */
+    memset(encoder->header.min, 0, sizeof(encoder->header.min));               /* clear min */
+    memset(encoder->header.max, 0, sizeof(encoder->header.max));               /* clear max */
+}
+
+/**
+ * @brief     write the header and emit the current block
+ * @param[in] *encoder pointer to an encoder structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ * @note      none
+ */
+static uint8_t a_sen5x_archive_emit(sen5x_archive_encoder_t *encoder)
+{
+    uint8_t ch;
+    uint8_t *block = encoder->block;
+    sen5x_archive_header_t *header = &encoder->header;
+
+    header->length = encoder->pos - SEN5X_ARCHIVE_HEADER_LENGTH;                                    /* set the payload length */
+    memset(block, 0, SEN5X_ARCHIVE_HEADER_LENGTH);                                                  /* clear the header */
+    memset(&block[encoder->pos], 0, encoder->block_size - encoder->pos);                            /* clear the padding */
+    a_sen5x_archive_put_u32(&block[0], SEN5X_ARCHIVE_MAGIC);                                        /* set the magic */
+    block[4] = SEN5X_ARCHIVE_VERSION;                                                               /* set the version */
+    block[5] = header->layout;                                                                      /* set the layout */
+    block[6] = header->channels;                                                                    /* set the channels */
+    a_sen5x_archive_put_u16(&block[8], header->count);                                              /* set the count */
+    a_sen5x_archive_put_u16(&block[10], header->valid_mask);                                        /* set the valid mask */
+    a_sen5x_archive_put_u32(&block[12], header->length);                                            /* set the length */
+    a_sen5x_archive_put_u64(&block[16], header->first_ms);                                          /* set the first timestamp */
+    a_sen5x_archive_put_u64(&block[24], header->last_ms);                                           /* set the last timestamp */
+    for (ch = 0; ch < header->channels; ch++)                                                       /* set min and max */
+    {
+        a_sen5x_archive_put_u16(&block[40 + ch * 4 + 0], (uint16_t)header->min[ch]);                /* set min */
+        a_sen5x_archive_put_u16(&block[40 + ch * 4 + 2], (uint16_t)header->max[ch]);                /* set max */
+    }
+    header->crc = sen5x_archive_crc32(0, block, encoder->pos);                                      /* crc with a zero crc field */
+    a_sen5x_archive_put_u32(&block[32], header->crc);                                               /* set the crc */
+    if (encoder->emit_block(block, encoder->block_size) != 0)                                       /* emit the block */
+    {
+        return 1;                                                                                   /* return error */
+    }
+    encoder->blocks++;                                                                              /* one more block */
+    a_sen5x_archive_reset(encoder);                                                                 /* next block */
+
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     get the channel count of a layout
+ * @param[in] layout block layout
+ * @return    channel count, 0 for an unknown layout
+ * @note      none
+ */
+uint8_t sen5x_archive_layout_channels(sen5x_archive_layout_t layout)
+{
+    if ((uint32_t)layout > (uint32_t)SEN5X_ARCHIVE_LAYOUT_RAW)        /* check the layout */
+    {
+        return 0;                                                     /* unknown */
+    }
+
+    return gs_channels[layout];                                       /* return the channels */
+}
+
+/**
+ * @brief      get the natural value of a channel word
+ * @param[in]  layout block layout
+ * @param[in]  ch channel
+ * @param[in]  word raw word
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 word is invalid
+ *             - 2 value is NULL
+ *             - 4 layout or channel is invalid
+ * @note       signed channels are sign extended
+ */
+uint8_t sen5x_archive_get_value(sen5x_archive_layout_t layout, uint8_t ch, uint16_t word, int32_t *value)
+{
+    if (value == NULL)                                                 /* check the value */
+    {
+        return 2;                                                      /* return error */
+    }
+    if (((uint32_t)layout > (uint32_t)SEN5X_ARCHIVE_LAYOUT_RAW) ||
+        (ch >= gs_channels[layout]))                                   /* check the layout and channel */
+    {
+        return 4;                                                      /* return error */
+    }
+
+    return (a_sen5x_archive_value((uint8_t)layout, ch, word, value) != 0) ? 0 : 1;        /* get the value */
+}
+
+/**
+ * @brief     update a crc32
+ * @param[in] crc previous crc, 0 to start
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    crc32
+ * @note      ieee 802.3 polynomial, reflected
+ */
+uint32_t sen5x_archive_crc32(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+
+    crc = ~crc;                                                       /* pre invert */
+    for (i = 0; i < len; i++)                                         /* run all bytes */
+    {
+        crc ^= buf[i];                                                /* xor the byte */
+        crc = (crc >> 4) ^ gs_crc32_table[crc & 0x0F];                /* low nibble */
+        crc = (crc >> 4) ^ gs_crc32_table[crc & 0x0F];                /* high nibble */
+    }
+
+    return ~crc;                                                      /* post invert */
+}
+
+/**
+ * @brief     init the archive encoder
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] layout block layout
+ * @param[in] *block pointer to a block buffer
+ * @param[in] block_size block buffer size
+ * @param[in] *emit_block pointer to an emit block function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 encoder, block or emit_block is NULL
+ *            - 4 layout is invalid
+ *            - 5 block size is invalid
+ * @note      every emitted block is block_size bytes, the block size must be 128 - 1048576
+ */
+uint8_t sen5x_archive_encoder_init(sen5x_archive_encoder_t *encoder, sen5x_archive_layout_t layout,
+                                   uint8_t *block, uint32_t block_size,
+                                   uint8_t (*emit_block)(const uint8_t *block, uint32_t len))
+{
+    if ((encoder == NULL) || (block == NULL) || (emit_block == NULL))        /* check the params */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (sen5x_archive_layout_channels(layout) == 0)                          /* check the layout */
+    {
+        return 4;                                                            /* return error */
+    }
+    if ((block_size < 128) || (block_size > 1048576))                        /* check the block size */
+    {
+        return 5;                                                            /* return error */
+    }
+
+    encoder->emit_block = emit_block;                                        /* set the emit function */
+    encoder->block = block;                                                  /* set the block */
+    encoder->block_size = block_size;                                        /* set the block size */
+    encoder->header.layout = (uint8_t)layout;                                /* set the layout */
+    encoder->header.channels = gs_channels[layout];                          /* set the channels */
+    encoder->header.first_ms = 0;                                            /* init 0 */
+    encoder->header.last_ms = 0;                                             /* init 0 */
+    encoder->last_ms = 0;                                                    /* init 0 */
+    encoder->blocks = 0;                                                     /* init 0 */
+    a_sen5x_archive_reset(encoder);                                          /* clear the block */
+    encoder->inited = 1;                                                     /* flag finish initialization */
+
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     append a sample to the archive
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] *word pointer to the raw words of the layout
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit block failed
+ *            - 2 encoder or word is NULL
+ *            - 3 encoder is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      a full block is emitted before the sample is appended
+ */
+uint8_t sen5x_archive_encode(sen5x_archive_encoder_t *encoder, uint64_t timestamp_ms, const uint16_t *word)
+{
+    uint8_t ch;
+    int32_t value;
+    int64_t delta;
+    sen5x_archive_header_t *header;
+
+    if ((encoder == NULL) || (word == NULL))                                                              /* check the params */
+    {
+        return 2;                                                                                         /* return error */
+    }
+    if (encoder->inited != 1)                                                                             /* check the initialization */
+    {
+        return 3;                                                                                         /* return error */
+    }
+    header = &encoder->header;                                                                            /* get the header */
+    if ((header->count != 0) && (timestamp_ms < encoder->last_ms))                                        /* check the timestamp */
+    {
+        return 4;                                                                                         /* return error */
+    }
+    if ((header->count != 0) &&
+        (((encoder->pos + SEN5X_ARCHIVE_SAMPLE_MAX(header->channels)) > encoder->block_size) ||
+         (header->count == 0xFFFFU)))                                                                     /* check the block space */
+    {
+        if (a_sen5x_archive_emit(encoder) != 0)                                                           /* emit the block */
+        {
+            return 1;                                                                                     /* return error */
+        }
+    }
+
+    if (header->count == 0)                                                                               /* first sample */
+    {
+        header->first_ms = timestamp_ms;                                                                  /* timestamp in the header */
+    }
+    else
+    {
+        delta = (int64_t)(timestamp_ms - encoder->last_ms);                                               /* get the delta */
+        if (header->count == 1)                                                                           /* second sample */
+        {
+            encoder->pos = a_sen5x_archive_put_varint(encoder->block, encoder->pos,
+                                                      a_sen5x_archive_zigzag(delta));                     /* put the delta */
+        }
+        else
+        {
+            encoder->pos = a_sen5x_archive_put_varint(encoder->block, encoder->pos,
+                                                      a_sen5x_archive_zigzag(delta - encoder->last_delta));  /* put the delta of delta */
+        }
+        encoder->last_delta = delta;                                                                      /* save the delta */
+    }
+    for (ch = 0; ch < header->channels; ch++)                                                             /* run all channels */
+    {
+        encoder->pos = a_sen5x_archive_put_varint(encoder->block, encoder->pos,
+                                                  a_sen5x_archive_zigzag((int16_t)(uint16_t)(word[ch] - encoder->prev[ch])));  /* put the delta */
+        encoder->prev[ch] = word[ch];                                                                     /* save the word */
+        if (a_sen5x_archive_value(header->layout, ch, word[ch], &value) != 0)                             /* valid sample */
+        {
+            if ((header->valid_mask & (1U << ch)) == 0)                                                   /* first valid sample */
+            {
+                header->min[ch] = value;                                                                  /* set min */
+                header->max[ch] = value;                                                                  /* set max */
+                header->valid_mask |= (uint16_t)(1U << ch);                                               /* set valid */
+            }
+            else if (value < header->min[ch])                                                             /* check min */
+            {
+                header->min[ch] = value;                                                                  /* set min */
+            }
+            else if (value > header->max[ch])                                                             /* check max */
+            {
+                header->max[ch] = value;                                                                  /* set max */
+            }
+        }
+    }
+    header->count++;                                                                                      /* one more sample */
+    header->last_ms = timestamp_ms;                                                                       /* set the last timestamp */
+    encoder->last_ms = timestamp_ms;                                                                      /* save the timestamp */
+
+    return 0;                                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     emit the current partial block
+ * @param[in] *encoder pointer to an encoder structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit block failed
+ *            - 2 encoder is NULL
+ *            - 3 encoder is not initialized
+ * @note      nothing is emitted for an empty block
+ */
+uint8_t sen5x_archive_flush(sen5x_archive_encoder_t *encoder)
+{
+    if (encoder == NULL)                                  /* check the encoder */
+    {
+        return 2;                                         /* return error */
+    }
+    if (encoder->inited != 1)                             /* check the initialization */
+    {
+        return 3;                                         /* return error */
+    }
+    if (encoder->header.count == 0)                       /* empty block */
+    {
+        return 0;                                         /* success return 0 */
+    }
+
+    return a_sen5x_archive_emit(encoder);                 /* emit the block */
+}
+
+/**
+ * @brief      parse and check a block header
+ * @param[in]  *block pointer to a block buffer
+ * @param[in]  len block length
+ * @param[out] *header pointer to a header structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 block is invalid
+ *             - 2 block or header is NULL
+ * @note       the crc isn't checked
+ */
+uint8_t sen5x_archive_parse_header(const uint8_t *block, uint32_t len, sen5x_archive_header_t *header)
+{
+    uint8_t ch;
+
+    if ((block == NULL) || (header == NULL))                                                                /* check the params */
+    {
+        return 2;                                                                                           /* return error */
+    }
+    if ((len < SEN5X_ARCHIVE_HEADER_LENGTH) || (a_sen5x_archive_get_u32(&block[0]) != SEN5X_ARCHIVE_MAGIC) ||
+        (block[4] != SEN5X_ARCHIVE_VERSION) || (block[5] > SEN5X_ARCHIVE_LAYOUT_RAW) ||
+        (block[6] != gs_channels[block[5]]))                                                                /* check the header */
+    {
+        return 1;                                                                                           /* return error */
+    }
+
+    header->layout = block[5];                                                                              /* get the layout */
+    header->channels = block[6];                                                                            /* get the channels */
+    header->count = a_sen5x_archive_get_u16(&block[8]);                                                     /* get the count */
+    header->valid_mask = a_sen5x_archive_get_u16(&block[10]);                                               /* get the valid mask */
+    header->length = a_sen5x_archive_get_u32(&block[12]);                                                   /* get the length */
+    header->first_ms = a_sen5x_archive_get_u64(&block[16]);                                                 /* get the first timestamp */
+    header->last_ms = a_sen5x_archive_get_u64(&block[24]);                                                  /* get the last timestamp */
+    header->crc = a_sen5x_archive_get_u32(&block[32]);                                                      /* get the crc */
+    if ((header->length > (len - SEN5X_ARCHIVE_HEADER_LENGTH)) || (header->last_ms < header->first_ms))     /* check the length */
+    {
+        return 1;                                                                                           /* return error */
+    }
+    for (ch = 0; ch < SEN5X_ARCHIVE_MAX_CHANNELS; ch++)                                                     /* get min and max */
+    {
+        if ((ch < header->channels) && ((header->valid_mask & (1U << ch)) != 0))                            /* valid channel */
+        {
+            (void)a_sen5x_archive_value(header->layout, ch, a_sen5x_archive_get_u16(&block[40 + ch * 4 + 0]),
+                                        &header->min[ch]);                                                  /* get min */
+            (void)a_sen5x_archive_value(header->layout, ch, a_sen5x_archive_get_u16(&block[40 + ch * 4 + 2]),
+                                        &header->max[ch]);                                                  /* get max */
+        }
+        else
+        {
+            header->min[ch] = 0;                                                                            /* no min */
+            header->max[ch] = 0;                                                                            /* no max */
+        }
+    }
+
+    return 0;                                                                                               /* success return 0 */
+}
+
+/**
+ * @brief     check the crc of a block
+ * @param[in] *block pointer to a block buffer
+ * @param[in] len block length
+ * @return    status code
+ *            - 0 success
+ *            - 1 block is invalid
+ *            - 2 block is NULL
+ * @note      none
+ */
+uint8_t sen5x_archive_check_block(const uint8_t *block, uint32_t len)
+{
+    const uint8_t zero[4] = {0, 0, 0, 0};
+    uint8_t res;
+    uint32_t crc;
+    sen5x_archive_header_t header;
+
+    if (block == NULL)                                                                                  /* check the block */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    res = sen5x_archive_parse_header(block, len, &header);                                              /* parse the header */
+    if (res != 0)                                                                                       /* check the result */
+    {
+        return 1;                                                                                       /* return error */
+    }
+
+    crc = sen5x_archive_crc32(0, block, 32);                                                            /* header before the crc */
+    crc = sen5x_archive_crc32(crc, zero, 4);                                                            /* zero crc field */
+    crc = sen5x_archive_crc32(crc, &block[36], SEN5X_ARCHIVE_HEADER_LENGTH - 36 + header.length);       /* rest of the block */
+    if (crc != header.crc)                                                                              /* check the crc */
+    {
+        return 1;                                                                                       /* return error */
+    }
+
+    return 0;                                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     init the decoder for a block
+ * @param[in] *decoder pointer to a decoder structure
+ * @param[in] *block pointer to a block buffer
+ * @param[in] len block length
+ * @return    status code
+ *            - 0 success
+ *            - 1 block is invalid
+ *            - 2 decoder or block is NULL
+ * @note      the block is read in place and checked with its crc
+ */
+uint8_t sen5x_archive_decoder_init(sen5x_archive_decoder_t *decoder, const uint8_t *block, uint32_t len)
+{
+    if ((decoder == NULL) || (block == NULL))                                    /* check the params */
+    {
+        return 2;                                                                /* return error */
+    }
+    if (sen5x_archive_check_block(block, len) != 0)                              /* check the block */
+    {
+        return 1;                                                                /* return error */
+    }
+
+    (void)sen5x_archive_parse_header(block, len, &decoder->header);              /* parse the header */
+    decoder->block = block;                                                      /* set the block */
+    decoder->pos = SEN5X_ARCHIVE_HEADER_LENGTH;                                  /* payload start */
+    decoder->index = 0;                                                          /* first sample */
+    decoder->last_ms = decoder->header.first_ms;                                 /* first timestamp */
+    decoder->last_delta = 0;                                                     /* init 0 */
+    memset(decoder->prev, 0, sizeof(decoder->prev));                             /* clear the words */
+
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      decode the next sample of a block
+ * @param[in]  *decoder pointer to a decoder structure
+ * @param[out] *timestamp_ms pointer to a timestamp buffer
+ * @param[out] *word pointer to a raw word buffer of the layout
+ * @return     status code
+ *             - 0 success
+ *             - 1 block is corrupt
+ *             - 2 decoder, timestamp_ms or word is NULL
+ *             - 4 no more samples
+ * @note       none
+ */
+uint8_t sen5x_archive_decode(sen5x_archive_decoder_t *decoder, uint64_t *timestamp_ms, uint16_t *word)
+{
+    uint8_t ch;
+    uint32_t limit;
+    uint64_t v;
+
+    if ((decoder == NULL) || (timestamp_ms == NULL) || (word == NULL))                                   /* check the params */
+    {
+        return 2;                                                                                        /* return error */
+    }
+    if (decoder->index >= decoder->header.count)                                                         /* check the count */
+    {
+        return 4;                                                                                        /* no more samples */
+    }
+
+    limit = SEN5X_ARCHIVE_HEADER_LENGTH + decoder->header.length;                                        /* payload end */
+    if (decoder->index != 0)                                                                             /* not the first sample */
+    {
+        if (a_sen5x_archive_get_varint(decoder->block, &decoder->pos, limit, &v) != 0)                   /* get the timestamp */
+        {
+            return 1;                                                                                    /* return error */
+        }
+        if (decoder->index == 1)                                                                         /* second sample */
+        {
+            decoder->last_delta = a_sen5x_archive_unzigzag(v);                                           /* delta */
+        }
+        else
+        {
+            decoder->last_delta += a_sen5x_archive_unzigzag(v);                                          /* delta of delta */
+        }
+        decoder->last_ms += (uint64_t)decoder->last_delta;                                               /* update the timestamp */
+    }
+    for (ch = 0; ch < decoder->header.channels; ch++)                                                    /* run all channels */
+    {
+        if (a_sen5x_archive_get_varint(decoder->block, &decoder->pos, limit, &v) != 0)                   /* get the delta */
+        {
+            return 1;                                                                                    /* return error */
+        }
+        decoder->prev[ch] = (uint16_t)(decoder->prev[ch] + (uint16_t)a_sen5x_archive_unzigzag(v));       /* update the word */
+        word[ch] = decoder->prev[ch];                                                                    /* set the word */
+    }
+    *timestamp_ms = decoder->last_ms;                                                                    /* set the timestamp */
+    decoder->index++;                                                                                    /* next sample */
+
+    return 0;                                                                                            /* success return 0 */
+}
@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_archive.h
+ * @brief     driver sen5x archive header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_ARCHIVE_H
+#define DRIVER_SEN5X_ARCHIVE_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_archive_driver sen5x archive driver function
+ * @brief    sen5x archive driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x archive definition
+ */
+#define SEN5X_ARCHIVE_MAGIC                0x41583553U        /**< block magic "S5XA" */
+#define SEN5X_ARCHIVE_VERSION              0x01               /**< block format version */
+#define SEN5X_ARCHIVE_HEADER_LENGTH        80                 /**< block header length */
+#define SEN5X_ARCHIVE_MAX_CHANNELS         10                 /**< max channels */
+#define SEN5X_ARCHIVE_BLOCK_SIZE           4096               /**< default block size */
+
+/**
+ * @brief sen5x archive layout enumeration definition
+ */
+typedef enum
+{
+    SEN5X_ARCHIVE_LAYOUT_MEASURED = 0x00,        /**< 8 words of read measured values */
+    SEN5X_ARCHIVE_LAYOUT_PM       = 0x01,        /**< 10 words of read measured pm values */
+    SEN5X_ARCHIVE_LAYOUT_RAW      = 0x02,        /**< 4 words of read measured raw values */
+} sen5x_archive_layout_t;
+
+/**
+ * @brief sen5x archive header structure definition
+ */
+typedef struct sen5x_archive_header_s
+{
+    uint8_t layout;                                    /**< block layout */
+    uint8_t channels;                                  /**< channel count */
+    uint16_t count;                                    /**< sample count */
+    uint16_t valid_mask;                               /**< channels with at least one valid sample */
+    uint32_t length;                                   /**< payload length */
+    uint64_t first_ms;                                 /**< first timestamp */
+    uint64_t last_ms;                                  /**< last timestamp */
+    uint32_t crc;                                      /**< block crc32 */
+    int32_t min[SEN5X_ARCHIVE_MAX_CHANNELS];           /**< channel min of the valid samples */
+    int32_t max[SEN5X_ARCHIVE_MAX_CHANNELS];           /**< channel max of the valid samples */
+} sen5x_archive_header_t;
+
+/**
+ * @brief sen5x archive encoder structure definition
+ */
+typedef struct sen5x_archive_encoder_s
+{
+    uint8_t (*emit_block)(const uint8_t *block, uint32_t len);        /**< point to an emit block function address */
+    uint8_t *block;                                                   /**< block buffer */
+    uint32_t block_size;                                              /**< block size */
+    uint32_t pos;                                                     /**< payload write position */
+    uint64_t last_ms;                                                 /**< last timestamp */
+    int64_t last_delta;                                               /**< last timestamp delta */
+    uint16_t prev[SEN5X_ARCHIVE_MAX_CHANNELS];                        /**< previous words */
+    sen5x_archive_header_t header;                                    /**< current header */
+    uint32_t blocks;                                                  /**< emitted blocks */
+    uint8_t inited;                                                   /**< inited flag */
+} sen5x_archive_encoder_t;
+
+/**
+ * @brief sen5x archive decoder structure definition
+ */
+typedef struct sen5x_archive_decoder_s
+{
+    const uint8_t *block;                             /**< block buffer */
+    sen5x_archive_header_t header;                    /**< block header */
+    uint32_t pos;                                     /**< payload read position */
+    uint16_t index;                                   /**< next sample index */
+    uint64_t last_ms;                                 /**< last timestamp */
+    int64_t last_delta;                               /**< last timestamp delta */
+    uint16_t prev[SEN5X_ARCHIVE_MAX_CHANNELS];        /**< previous words */
+} sen5x_archive_decoder_t;
+
+/**
+ * @brief     get the channel count of a layout
+ * @param[in] layout block layout
+ * @return    channel count, 0 for an unknown layout
+ * @note      none
+ */
+uint8_t sen5x_archive_layout_channels(sen5x_archive_layout_t layout);
+
+/**
+ * @brief      get the natural value of a channel word
+ * @param[in]  layout block layout
+ * @param[in]  ch channel
+ * @param[in]  word raw word
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 word is invalid
+ *             - 2 value is NULL
+ *             - 4 layout or channel is invalid
+ * @note       signed channels are sign extended
+ */
+uint8_t sen5x_archive_get_value(sen5x_archive_layout_t layout, uint8_t ch, uint16_t word, int32_t *value);
+
+/**
+ * @brief     update a crc32
+ * @param[in] crc previous crc, 0 to start
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    crc32
+ * @note      ieee 802.3 polynomial, reflected
+ */
+uint32_t sen5x_archive_crc32(uint32_t crc, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief     init the archive encoder
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] layout block layout
+ * @param[in] *block pointer to a block buffer
+ * @param[in] block_size block buffer size
+ * @param[in] *emit_block pointer to an emit block function address
+ * @return    status code
+ *            - 0 success
+ *            - 2 encoder, block or emit_block is NULL
+ *            - 4 layout is invalid
+ *            - 5 block size is invalid
+ * @note      every emitted block is block_size bytes, the block size must be 128 - 1048576
+ */
+uint8_t sen5x_archive_encoder_init(sen5x_archive_encoder_t *encoder, sen5x_archive_layout_t layout,
+                                   uint8_t *block, uint32_t block_size,
+                                   uint8_t (*emit_block)(const uint8_t *block, uint32_t len));
+
+/**
+ * @brief     append a sample to the archive
+ * @param[in] *encoder pointer to an encoder structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] *word pointer to the raw words of the layout
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit block failed
+ *            - 2 encoder or word is NULL
+ *            - 3 encoder is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      a full block is emitted before the sample is appended
+ */
+uint8_t sen5x_archive_encode(sen5x_archive_encoder_t *encoder, uint64_t timestamp_ms, const uint16_t *word);
+
+/**
+ * @brief     emit the current partial block
+ * @param[in] *encoder pointer to an encoder structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit block failed
+ *            - 2 encoder is NULL
+ *            - 3 encoder is not initialized
+ * @note      nothing is emitted for an empty block
+ */
+uint8_t sen5x_archive_flush(sen5x_archive_encoder_t *encoder);
+
+/**
+ * @brief      parse and check a block header
+ * @param[in]  *block pointer to a block buffer
+ * @param[in]  len block length
+ * @param[out] *header pointer to a header structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 block is invalid
+ *             - 2 block or header is NULL
+ * @note       the crc isn't checked
+ */
+uint8_t sen5x_archive_parse_header(const uint8_t *block, uint32_t len, sen5x_archive_header_t *header);
+
+/**
+ * @brief     check the crc of a block
+ * @param[in] *block pointer to a block buffer
+ * @param[in] len block length
+ * @return    status code
+ *            - 0 success
+ *            - 1 block is invalid
+ *            - 2 block is NULL
+ * @note      none
+ */
+uint8_t sen5x_archive_check_block(const uint8_t *block, uint32_t len);
+
+/**
+ * @brief     init the decoder for a block
+ * @param[in] *decoder pointer to a decoder structure
+ * @param[in] *block pointer to a block buffer
+ * @param[in] len block length
+ * @return    status code
+ *            - 0 success
+ *            - 1 block is invalid
+ *            - 2 decoder or block is NULL
+ * @note      the block is read in place and checked with its crc
+ */
+uint8_t sen5x_archive_decoder_init(sen5x_archive_decoder_t *decoder, const uint8_t *block, uint32_t len);
+
+/**
+ * @brief      decode the next sample of a block
+ * @param[in]  *decoder pointer to a decoder structure
+ * @param[out] *timestamp_ms pointer to a timestamp buffer
+ * @param[out] *word pointer to a raw word buffer of the layout
+ * @return     status code
+ *             - 0 success
+ *             - 1 block is corrupt
+ *             - 2 decoder, timestamp_ms or word is NULL
+ *             - 4 no more samples
+ * @note       none
+ */
+uint8_t sen5x_archive_decode(sen5x_archive_decoder_t *decoder, uint64_t *timestamp_ms, uint16_t *word);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,970 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ *
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * @file      driver_sen5x_batch.c
+ * @brief     driver sen5x batch source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_batch.h"
+
+/**
+ * @brief simd selection definition
+ * @note  the path follows the compiler target flags, -mssse3 or -mavx2 enable the x86 paths,
+ *        define SEN5X_BATCH_NO_SIMD to force the scalar code, the neon path isn't verified on
+ *        hardware yet and is used only when SEN5X_BATCH_ENABLE_NEON is defined
+ */
+#if !defined(SEN5X_BATCH_NO_SIMD) && defined(__AVX2__)
+    #include <immintrin.h>
+    #define SEN5X_BATCH_SIMD_PATH        SEN5X_BATCH_SIMD_AVX2         /**< avx2 path */
+    #define SEN5X_BATCH_USE_X86                                        /**< x86 gather and transpose */
+    #define SEN5X_BATCH_USE_AVX2                                       /**< avx2 conversion */
+#elif !defined(SEN5X_BATCH_NO_SIMD) && defined(__SSSE3__)
+    #include <tmmintrin.h>
+    #define SEN5X_BATCH_SIMD_PATH        SEN5X_BATCH_SIMD_SSSE3        /**< ssse3 path */
+    #define SEN5X_BATCH_USE_X86                                        /**< x86 gather and transpose */
+#elif !defined(SEN5X_BATCH_NO_SIMD) && defined(SEN5X_BATCH_ENABLE_NEON) && defined(__ARM_NEON) && defined(__aarch64__)
+    #include <arm_neon.h>
+    #define SEN5X_BATCH_SIMD_PATH        SEN5X_BATCH_SIMD_NEON         /**< neon path */
+    #define SEN5X_BATCH_USE_NEON                                       /**< neon gather and transpose */
+#else
+    #define SEN5X_BATCH_SIMD_PATH        SEN5X_BATCH_SIMD_NONE         /**< scalar path */
+#endif
+
+/**
+ * @brief batch block definition
+ */
+#define SEN5X_BATCH_BLOCK        8        /**< frames decoded per simd block */
+
+/**
+ * @brief crc8 table of the polynomial 0x31
+ */
+static const uint8_t gs_crc_table[256] =
+{
+    0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0xB9, 0x88, 0xDB, 0xEA, 0x7D, 0x4C, 0x1F, 0x2E,
+    0x43, 0x72, 0x21, 0x10, 0x87, 0xB6, 0xE5, 0xD4, 0xFA, 0xCB, 0x98, 0xA9, 0x3E, 0x0F, 0x5C, 0x6D,
+    0x86, 0xB7, 0xE4, 0xD5, 0x42, 0x73, 0x20, 0x11, 0x3F, 0x0E, 0x5D, 0x6C, 0xFB, 0xCA, 0x99, 0xA8,
+    0xC5, 0xF4, 0xA7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7C, 0x4D, 0x1E, 0x2F, 0xB8, 0x89, 0xDA, 0xEB,
+    0x3D, 0x0C, 0x5F, 0x6E, 0xF9, 0xC8, 0x9B, 0xAA, 0x84, 0xB5, 0xE6, 0xD7, 0x40, 0x71, 0x22, 0x13,
+    0x7E, 0x4F, 0x1C, 0x2D, 0xBA, 0x8B, 0xD8, 0xE9, 0xC7, 0xF6, 0xA5, 0x94, 0x03, 0x32, 0x61, 0x50,
+    0xBB, 0x8A, 0xD9, 0xE8, 0x7F, 0x4E, 0x1D, 0x2C, 0x02, 0x33, 0x60, 0x51, 0xC6, 0xF7, 0xA4, 0x95,
+    0xF8, 0xC9, 0x9A, 0xAB, 0x3C, 0x0D, 0x5E, 0x6F, 0x41, 0x70, 0x23, 0x12, 0x85, 0xB4, 0xE7, 0xD6,
+    0x7A, 0x4B, 0x18, 0x29, 0xBE, 0x8F, 0xDC, 0xED, 0xC3, 0xF2, 0xA1, 0x90, 0x07, 0x36, 0x65, 0x54,
+    0x39, 0x08, 0x5B, 0x6A, 0xFD, 0xCC, 0x9F, 0xAE, 0x80, 0xB1, 0xE2, 0xD3, 0x44, 0x75, 0x26, 0x17,
+    0xFC, 0xCD, 0x9E, 0xAF, 0x38, 0x09, 0x5A, 0x6B, 0x45, 0x74, 0x27, 0x16, 0x81, 0xB0, 0xE3, 0xD2,
+    0xBF, 0x8E, 0xDD, 0xEC, 0x7B, 0x4A, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xC2, 0xF3, 0xA0, 0x91,
+    0x47, 0x76, 0x25, 0x14, 0x83, 0xB2, 0xE1, 0xD0, 0xFE, 0xCF, 0x9C, 0xAD, 0x3A, 0x0B, 0x58, 0x69,
+    0x04, 0x35, 0x66, 0x57, 0xC0, 0xF1, 0xA2, 0x93, 0xBD, 0x8C, 0xDF, 0xEE, 0x79, 0x48, 0x1B, 0x2A,
+    0xC1, 0xF0, 0xA3, 0x92, 0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1A, 0x2B, 0xBC, 0x8D, 0xDE, 0xEF,
+    0x82, 0xB3, 0xE0, 0xD1, 0x46, 0x77, 0x24, 0x15, 0x3B, 0x0A, 0x59, 0x68, 0xFF, 0xCE, 0x9D, 0xAC,
+};
+
+/**
+ * @brief     check the crc of every word in a frame
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] words word count
+ * @return    check result
+ *            - 0 crc error
+ *            - 1 crc ok
+ * @note      none
+ */
+static uint8_t a_sen5x_batch_crc_check(const uint8_t *frame, uint8_t words)
+{
+    uint8_t i;
+    uint8_t crc;
+
+    for (i = 0; i < words; i++)                                    /* check all words */
+    {
+        crc = gs_crc_table[0xFF ^ frame[i * 3 + 0]];               /* msb */
+        crc = gs_crc_table[crc ^ frame[i * 3 + 1]];                /* lsb */
+        if (crc != frame[i * 3 + 2])                               /* check crc */
+        {
+            return 0;                                              /* crc error */
+        }
+    }
+
+    return 1;                                                      /* crc ok */
+}
+
+/**
+ * @brief     get a big endian word from a frame
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] word word index
+ * @return    word
+ * @note      none
+ */
+static uint16_t a_sen5x_batch_word(const uint8_t *frame, uint8_t word)
+{
+    return (uint16_t)(((uint16_t)(frame[word * 3 + 0]) << 8) | ((uint16_t)(frame[word * 3 + 1]) << 0));        /* get the word */
+}
+
+/**
+ * @brief     decode one read measured values frame
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] i column index
+ * @param[in] *columns pointer to a sen5x batch measured structure
+ * @note      same conversion as sen55_read
+ */
+static void a_sen5x_batch_measured_frame(const uint8_t *frame, uint32_t i, sen5x_batch_measured_t *columns)
+{
+    uint16_t pm1p0;
+    uint16_t pm2p5;
+    uint16_t pm4p0;
+    uint16_t pm10;
+    int16_t humidity;
+    int16_t temperature;
+    int16_t voc;
+    int16_t nox;
+
+    pm1p0 = a_sen5x_batch_word(frame, 0);                                                         /* copy pm1.0 */
+    pm2p5 = a_sen5x_batch_word(frame, 1);                                                         /* copy pm2.5 */
+    pm4p0 = a_sen5x_batch_word(frame, 2);                                                         /* copy pm4.0 */
+    pm10 = a_sen5x_batch_word(frame, 3);                                                          /* copy pm10 */
+    humidity = (int16_t)a_sen5x_batch_word(frame, 4);                                             /* humidity raw */
+    temperature = (int16_t)a_sen5x_batch_word(frame, 5);                                          /* temperature raw */
+    voc = (int16_t)a_sen5x_batch_word(frame, 6);                                                  /* voc raw */
+    nox = (int16_t)a_sen5x_batch_word(frame, 7);                                                  /* nox raw */
+    if ((pm1p0 == 0xFFFFU) || (pm2p5 == 0xFFFFU) || (pm4p0 == 0xFFFFU) || (pm10 == 0xFFFFU))      /* check invalid */
+    {
+        columns->pm1p0_ug_m3[i] = NAN;                                                            /* set nan */
+        columns->pm2p5_ug_m3[i] = NAN;                                                            /* set nan */
+        columns->pm4p0_ug_m3[i] = NAN;                                                            /* set nan */
+        columns->pm10_ug_m3[i] = NAN;                                                             /* set nan */
+        columns->pm_valid[i] = 0;                                                                 /* set invalid */
+    }
+    else
+    {
+        columns->pm1p0_ug_m3[i] = (float)(pm1p0) / 10.0f;                                         /* convert pm1.0 */
+        columns->pm2p5_ug_m3[i] = (float)(pm2p5) / 10.0f;                                         /* convert pm2.5 */
+        columns->pm4p0_ug_m3[i] = (float)(pm4p0) / 10.0f;                                         /* convert pm4.0 */
+        columns->pm10_ug_m3[i] = (float)(pm10) / 10.0f;                                           /* convert pm10 */
+        columns->pm_valid[i] = 1;                                                                 /* set valid */
+    }
+    columns->compensated_ambient_humidity_percentage[i] = (humidity == 0x7FFF) ?
+                                                          NAN : ((float)(humidity) / 100.0f);     /* convert humidity */
+    columns->compensated_ambient_temperature_degree[i] = (temperature == 0x7FFF) ?
+                                                         NAN : ((float)(temperature) / 200.0f);   /* convert temperature */
+    columns->voc_index[i] = (voc == 0x7FFF) ? NAN : ((float)(voc) / 10.0f);                       /* convert voc */
+    columns->nox_index[i] = (nox == 0x7FFF) ? NAN : ((float)(nox) / 10.0f);                       /* convert nox */
+}
+
+/**
+ * @brief     decode one read measured pm values frame
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] i column index
+ * @param[in] *columns pointer to a sen5x batch pm structure
+ * @note      same conversion as sen5x_read_pm_value
+ */
+static void a_sen5x_batch_pm_frame(const uint8_t *frame, uint32_t i, sen5x_batch_pm_t *columns)
+{
+    uint8_t j;
+    uint16_t word[10];
+
+    for (j = 0; j < 10; j++)                                                        /* copy all words */
+    {
+        word[j] = a_sen5x_batch_word(frame, j);                                     /* copy the word */
+    }
+    for (j = 0; j < 10; j++)                                                        /* check all words */
+    {
+        if (word[j] == 0xFFFFU)                                                     /* check invalid */
+        {
+            break;                                                                  /* break */
+        }
+    }
+    if (j != 10)                                                                    /* invalid */
+    {
+        columns->pm1p0_ug_m3[i] = NAN;                                              /* set nan */
+        columns->pm2p5_ug_m3[i] = NAN;                                              /* set nan */
+        columns->pm4p0_ug_m3[i] = NAN;                                              /* set nan */
+        columns->pm10_ug_m3[i] = NAN;                                               /* set nan */
+        columns->pm0p5_cm3[i] = NAN;                                                /* set nan */
+        columns->pm1p0_cm3[i] = NAN;                                                /* set nan */
+        columns->pm2p5_cm3[i] = NAN;                                                /* set nan */
+        columns->pm4p0_cm3[i] = NAN;                                                /* set nan */
+        columns->pm10_cm3[i] = NAN;                                                 /* set nan */
+        columns->typical_particle_um[i] = NAN;                                      /* set nan */
+        columns->pm_valid[i] = 0;                                                   /* set invalid */
+    }
+    else
+    {
+        columns->pm1p0_ug_m3[i] = (float)(word[0]) / 10.0f;                         /* convert data */
+        columns->pm2p5_ug_m3[i] = (float)(word[1]) / 10.0f;                         /* convert data */
+        columns->pm4p0_ug_m3[i] = (float)(word[2]) / 10.0f;                         /* convert data */
+        columns->pm10_ug_m3[i] = (float)(word[3]) / 10.0f;                          /* convert data */
+        columns->pm0p5_cm3[i] = (float)(word[4]) / 10.0f;                           /* convert data */
+        columns->pm1p0_cm3[i] = (float)(word[5]) / 10.0f;                           /* convert data */
+        columns->pm2p5_cm3[i] = (float)(word[6]) / 10.0f;                           /* convert data */
+        columns->pm4p0_cm3[i] = (float)(word[7]) / 10.0f;                           /* convert data */
+        columns->pm10_cm3[i] = (float)(word[8]) / 10.0f;                            /* convert data */
+        columns->typical_particle_um[i] = (float)(word[9]) / 1000.0f;               /* convert data */
+        columns->pm_valid[i] = 1;                                                   /* set valid */
+    }
+}
+
+/**
+ * @brief     set one measured values row to nan
+ * @param[in] i column index
+ * @param[in] *columns pointer to a sen5x batch measured structure
+ * @note      none
+ */
+static void a_sen5x_batch_measured_invalidate(uint32_t i, sen5x_batch_measured_t *columns)
+{
+    columns->pm1p0_ug_m3[i] = NAN;                                    /* set nan */
+    columns->pm2p5_ug_m3[i] = NAN;                                    /* set nan */
+    columns->pm4p0_ug_m3[i] = NAN;                                    /* set nan */
+    columns->pm10_ug_m3[i] = NAN;                                     /* set nan */
+    columns->compensated_ambient_humidity_percentage[i] = NAN;        /* set nan */
+    columns->compensated_ambient_temperature_degree[i] = NAN;         /* set nan */
+    columns->voc_index[i] = NAN;                                      /* set nan */
+    columns->nox_index[i] = NAN;                                      /* set nan */
+    columns->pm_valid[i] = 0;                                         /* set invalid */
+}
+
+/**
+ * @brief     set one pm values row to nan
+ * @param[in] i column index
+ * @param[in] *columns pointer to a sen5x batch pm structure
+ * @note      none
+ */
+static void a_sen5x_batch_pm_invalidate(uint32_t i, sen5x_batch_pm_t *columns)
+{
+    columns->pm1p0_ug_m3[i] = NAN;                  /* set nan */
+    columns->pm2p5_ug_m3[i] = NAN;                  /* set nan */
+    columns->pm4p0_ug_m3[i] = NAN;                  /* set nan */
+    columns->pm10_ug_m3[i] = NAN;                   /* set nan */
+    columns->pm0p5_cm3[i] = NAN;                    /* set nan */
+    columns->pm1p0_cm3[i] = NAN;                    /* set nan */
+    columns->pm2p5_cm3[i] = NAN;                    /* set nan */
+    columns->pm4p0_cm3[i] = NAN;                    /* set nan */
+    columns->pm10_cm3[i] = NAN;                     /* set nan */
+    columns->typical_particle_um[i] = NAN;          /* set nan */
+    columns->pm_valid[i] = 0;                       /* set invalid */
+}
+
+#if defined(SEN5X_BATCH_USE_X86)
+
+/**
+ * @brief     gather words 0 - 7 of a frame as native 16 bit lanes
+ * @param[in] *frame pointer to a frame buffer
+ * @return    words
+ * @note      reads bytes 0 - 23 of the frame
+ */
+static inline __m128i a_sen5x_batch_gather(const uint8_t *frame)
+{
+    const __m128i lo_mask = _mm_setr_epi8(1, 0, 4, 3, 7, 6, 10, 9, 13, 12,
+                                          -128, -128, -128, -128, -128, -128);        /* words 0 - 4 from byte 0 */
+    const __m128i hi_mask = _mm_setr_epi8(-128, -128, -128, -128, -128, -128, -128, -128, -128, -128,
+                                          8, 7, 11, 10, 14, 13);                      /* words 5 - 7 from byte 8 */
+    __m128i lo;
+    __m128i hi;
+
+    lo = _mm_loadu_si128((const __m128i *)(const void *)(frame + 0));                 /* load bytes 0 - 15 */
+    hi = _mm_loadu_si128((const __m128i *)(const void *)(frame + 8));                 /* load bytes 8 - 23 */
+
+    return _mm_or_si128(_mm_shuffle_epi8(lo, lo_mask), _mm_shuffle_epi8(hi, hi_mask));        /* swap and merge */
+}
+
+/**
+ * @brief     gather words 8 - 9 of a pm frame into lanes 0 - 1
+ * @param[in] *frame pointer to a frame buffer
+ * @return    words
+ * @note      reads bytes 14 - 29 of the frame
+ */
+static inline __m128i a_sen5x_batch_gather_tail(const uint8_t *frame)
+{
+    const __m128i mask = _mm_setr_epi8(11, 10, 14, 13, -128, -128, -128, -128,
+                                       -128, -128, -128, -128, -128, -128, -128, -128);        /* words 8 - 9 from byte 14 */
+
+    return _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(frame + 14)), mask);   /* swap */
+}
+
+/**
+ * @brief         transpose 8 frames x 8 words into 8 words x 8 frames
+ * @param[in,out] *r pointer to 8 registers
+ * @note          none
+ */
+static inline void a_sen5x_batch_transpose(__m128i *r)
+{
+    __m128i t0, t1, t2, t3, t4, t5, t6, t7;
+    __m128i u0, u1, u2, u3, u4, u5, u6, u7;
+
+    t0 = _mm_unpacklo_epi16(r[0], r[1]);        /* words 0 - 3 of frames 0 - 1 */
+    t1 = _mm_unpackhi_epi16(r[0], r[1]);        /* words 4 - 7 of frames 0 - 1 */
+    t2 = _mm_unpacklo_epi16(r[2], r[3]);        /* words 0 - 3 of frames 2 - 3 */
+    t3 = _mm_unpackhi_epi16(r[2], r[3]);        /* words 4 - 7 of frames 2 - 3 */
+    t4 = _mm_unpacklo_epi16(r[4], r[5]);        /* words 0 - 3 of frames 4 - 5 */
+    t5 = _mm_unpackhi_epi16(r[4], r[5]);        /* words 4 - 7 of frames 4 - 5 */
+    t6 = _mm_unpacklo_epi16(r[6], r[7]);        /* words 0 - 3 of frames 6 - 7 */
+    t7 = _mm_unpackhi_epi16(r[6], r[7]);        /* words 4 - 7 of frames 6 - 7 */
+    u0 = _mm_unpacklo_epi32(t0, t2);            /* words 0 - 1 of frames 0 - 3 */
+    u1 = _mm_unpackhi_epi32(t0, t2);            /* words 2 - 3 of frames 0 - 3 */
+    u2 = _mm_unpacklo_epi32(t1, t3);            /* words 4 - 5 of frames 0 - 3 */
+    u3 = _mm_unpackhi_epi32(t1, t3);            /* words 6 - 7 of frames 0 - 3 */
+    u4 = _mm_unpacklo_epi32(t4, t6);            /* words 0 - 1 of frames 4 - 7 */
+    u5 = _mm_unpackhi_epi32(t4, t6);            /* words 2 - 3 of frames 4 - 7 */
+    u6 = _mm_unpacklo_epi32(t5, t7);            /* words 4 - 5 of frames 4 - 7 */
+    u7 = _mm_unpackhi_epi32(t5, t7);            /* words 6 - 7 of frames 4 - 7 */
+    r[0] = _mm_unpacklo_epi64(u0, u4);          /* word 0 */
+    r[1] = _mm_unpackhi_epi64(u0, u4);          /* word 1 */
+    r[2] = _mm_unpacklo_epi64(u1, u5);          /* word 2 */
+    r[3] = _mm_unpackhi_epi64(u1, u5);          /* word 3 */
+    r[4] = _mm_unpacklo_epi64(u2, u6);          /* word 4 */
+    r[5] = _mm_unpackhi_epi64(u2, u6);          /* word 5 */
+    r[6] = _mm_unpacklo_epi64(u3, u7);          /* word 6 */
+    r[7] = _mm_unpackhi_epi64(u3, u7);          /* word 7 */
+}
+
+/**
+ * @brief     transpose words 8 - 9 of 8 pm frames
+ * @param[in] *g pointer to 8 gathered tails
+ * @param[out] *r pointer to 2 registers
+ * @note      none
+ */
+static inline void a_sen5x_batch_transpose_tail(const __m128i *g, __m128i *r)
+{
+    __m128i u0;
+    __m128i u1;
+
+    u0 = _mm_unpacklo_epi32(_mm_unpacklo_epi16(g[0], g[1]), _mm_unpacklo_epi16(g[2], g[3]));        /* frames 0 - 3 */
+    u1 = _mm_unpacklo_epi32(_mm_unpacklo_epi16(g[4], g[5]), _mm_unpacklo_epi16(g[6], g[7]));        /* frames 4 - 7 */
+    r[0] = _mm_unpacklo_epi64(u0, u1);                                                              /* word 8 */
+    r[1] = _mm_unpackhi_epi64(u0, u1);                                                              /* word 9 */
+}
+
+/**
+ * @brief     store the pm valid flags of 8 frames
+ * @param[in] invalid 16 bit invalid mask
+ * @param[in] *out pointer to an output buffer
+ * @note      none
+ */
+static inline void a_sen5x_batch_store_valid(__m128i invalid, uint8_t *out)
+{
+    __m128i flag;
+
+    flag = _mm_andnot_si128(_mm_packs_epi16(invalid, invalid), _mm_set1_epi8(1));        /* 1 when valid */
+    _mm_storel_epi64((__m128i *)(void *)out, flag);                                       /* store 8 flags */
+}
+
+#if defined(SEN5X_BATCH_USE_AVX2)
+
+/**
+ * @brief     convert and store 8 unsigned words
+ * @param[in] word 16 bit words
+ * @param[in] invalid 16 bit nan mask
+ * @param[in] scale divisor
+ * @param[in] *out pointer to an output buffer
+ * @note      none
+ */
+static inline void a_sen5x_batch_store_u16(__m128i word, __m128i invalid, float scale, float *out)
+{
+    __m256 value;
+
+    value = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(word)), _mm256_set1_ps(scale));          /* convert */
+    value = _mm256_blendv_ps(value, _mm256_set1_ps(NAN),
+                             _mm256_castsi256_ps(_mm256_cvtepi16_epi32(invalid)));                          /* set nan */
+    _mm256_storeu_ps(out, value);                                                                           /* store */
+}
+
+/**
+ * @brief     convert and store 8 signed words
+ * @param[in] word 16 bit words
+ * @param[in] invalid 16 bit nan mask
+ * @param[in] scale divisor
+ * @param[in] *out pointer to an output buffer
+ * @note      none
+ */
+static inline void a_sen5x_batch_store_s16(__m128i word, __m128i invalid, float scale, float *out)
+{
+    __m256 value;
+
+    value = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(word)), _mm256_set1_ps(scale));          /* convert */
+    value = _mm256_blendv_ps(value, _mm256_set1_ps(NAN),
+                             _mm256_castsi256_ps(_mm256_cvtepi16_epi32(invalid)));                          /* set nan */
+    _mm256_storeu_ps(out, value);                                                                           /* store */
+}
+
+#else
+
+/**
+ * @brief     convert and store 8 words
+ * @param[in] lo 32 bit words 0 - 3
+ * @param[in] hi 32 bit words 4 - 7
+ * @param[in] invalid 16 bit nan mask
+ * @param[in] scale divisor
+ * @param[in] *out pointer to an output buffer
+ * @note      none
+ */
+static inline void a_sen5x_batch_store_i32(__m128i lo, __m128i hi, __m128i invalid, float scale, float *out)
+{
+    const __m128 nan = _mm_set1_ps(NAN);
+    __m128 mask;
+    __m128 value;
+
+    value = _mm_div_ps(_mm_cvtepi32_ps(lo), _mm_set1_ps(scale));                     /* convert words 0 - 3 */
+    mask = _mm_castsi128_ps(_mm_unpacklo_epi16(invalid, invalid));                   /* widen the mask */
+    value = _mm_or_ps(_mm_andnot_ps(mask, value), _mm_and_ps(mask, nan));            /* set nan */
+    _mm_storeu_ps(out + 0, value);                                                   /* store */
+    value = _mm_div_ps(_mm_cvtepi32_ps(hi), _mm_set1_ps(scale));                     /* convert words 4 - 7 */
+    mask = _mm_castsi128_ps(_mm_unpackhi_epi16(invalid, invalid));                   /* widen the mask */
+    value = _mm_or_ps(_mm_andnot_ps(mask, value), _mm_and_ps(mask, nan));            /* set nan */
+    _mm_storeu_ps(out + 4, value);                                                   /* store */
+}
+
+/**
+ * @brief     convert and store 8 unsigned words
+ * @param[in] word 16 bit words
+ * @param[in] invalid 16 bit nan mask
+ * @param[in] scale divisor
+ * @param[in] *out pointer to an output buffer
+ * @note      none
+ */
+static inline void a_sen5x_batch_store_u16(__m128i word, __m128i invalid, float scale, float *out)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    a_sen5x_batch_store_i32(_mm_unpacklo_epi16(word, zero), _mm_unpackhi_epi16(word, zero),
+                            invalid, scale, out);                                                  /* zero extend */
+}
+
+/**
+ * @brief     convert and store 8 signed words
+ * @param[in] word 16 bit words
+ * @param[in] invalid 16 bit nan mask
+ * @param[in] scale divisor
+ * @param[in] *out pointer to an output buffer
+ * @note      none
+ */
+static inline void a_sen5x_batch_store_s16(__m128i word, __m128i invalid, float scale, float *out)
+{
+    a_sen5x_batch_store_i32(_mm_srai_epi32(_mm_unpacklo_epi16(word, word), 16),
+                            _mm_srai_epi32(_mm_unpackhi_epi16(word, word), 16),
+                            invalid, scale, out);                                                  /* sign extend */
+}
+
+#endif
+
+/**
+ * @brief     decode 8 read measured values frames
+ * @param[in] *frames pointer to 8 frames
+ * @param[in] i column index
+ * @param[in] *columns pointer to a sen5x batch measured structure
+ * @note      none
+ */
+static void a_sen5x_batch_measured_block(const uint8_t *frames, uint32_t i, sen5x_batch_measured_t *columns)
+{
+    const __m128i ones = _mm_set1_epi16(-1);
+    const __m128i max = _mm_set1_epi16(0x7FFF);
+    __m128i r[8];
+    __m128i pm;
+    uint8_t j;
+
+    for (j = 0; j < 8; j++)                                                                        /* gather 8 frames */
+    {
+        r[j] = a_sen5x_batch_gather(&frames[j * SEN5X_BATCH_MEASURED_FRAME_LENGTH]);               /* gather */
+    }
+    a_sen5x_batch_transpose(r);                                                                    /* frames to columns */
+    pm = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(r[0], ones), _mm_cmpeq_epi16(r[1], ones)),
+                      _mm_or_si128(_mm_cmpeq_epi16(r[2], ones), _mm_cmpeq_epi16(r[3], ones)));     /* pm invalid mask */
+    a_sen5x_batch_store_u16(r[0], pm, 10.0f, &columns->pm1p0_ug_m3[i]);                            /* convert pm1.0 */
+    a_sen5x_batch_store_u16(r[1], pm, 10.0f, &columns->pm2p5_ug_m3[i]);                            /* convert pm2.5 */
+    a_sen5x_batch_store_u16(r[2], pm, 10.0f, &columns->pm4p0_ug_m3[i]);                            /* convert pm4.0 */
+    a_sen5x_batch_store_u16(r[3], pm, 10.0f, &columns->pm10_ug_m3[i]);                             /* convert pm10 */
+    a_sen5x_batch_store_valid(pm, &columns->pm_valid[i]);                                          /* set pm valid */
+    a_sen5x_batch_store_s16(r[4], _mm_cmpeq_epi16(r[4], max), 100.0f,
+                            &columns->compensated_ambient_humidity_percentage[i]);                 /* convert humidity */
+    a_sen5x_batch_store_s16(r[5], _mm_cmpeq_epi16(r[5], max), 200.0f,
+                            &columns->compensated_ambient_temperature_degree[i]);                  /* convert temperature */
+    a_sen5x_batch_store_s16(r[6], _mm_cmpeq_epi16(r[6], max), 10.0f, &columns->voc_index[i]);     /* convert voc */
+    a_sen5x_batch_store_s16(r[7], _mm_cmpeq_epi16(r[7], max), 10.0f, &columns->nox_index[i]);     /* convert nox */
+}
+
+/**
+ * @brief     decode 8 read measured pm values frames
+ * @param[in] *frames pointer to 8 frames
+ * @param[in] i column index
+ * @param[in] *columns pointer to a sen5x batch pm structure
+ * @note      none
+ */
+static void a_sen5x_batch_pm_block(const uint8_t *frames, uint32_t i, sen5x_batch_pm_t *columns)
+{
+    const __m128i ones = _mm_set1_epi16(-1);
+    __m128i r[8];
+    __m128i g[8];
+    __m128i t[2];
+    __m128i pm;
+    uint8_t j;
+
+    for (j = 0; j < 8; j++)                                                                        /* gather 8 frames */
+    {
+        r[j] = a_sen5x_batch_gather(&frames[j * SEN5X_BATCH_PM_FRAME_LENGTH]);                     /* gather words 0 - 7 */
+        g[j] = a_sen5x_batch_gather_tail(&frames[j * SEN5X_BATCH_PM_FRAME_LENGTH]);                /* gather words 8 - 9 */
+    }
+    a_sen5x_batch_transpose(r);                                                                    /* frames to columns */
+    a_sen5x_batch_transpose_tail(g, t);                                                            /* frames to columns */
+    pm = _mm_or_si128(_mm_cmpeq_epi16(t[0], ones), _mm_cmpeq_epi16(t[1], ones));                   /* check words 8 - 9 */
+    for (j = 0; j < 8; j++)                                                                        /* check words 0 - 7 */
+    {
+        pm = _mm_or_si128(pm, _mm_cmpeq_epi16(r[j], ones));                                        /* merge the mask */
+    }
+    a_sen5x_batch_store_u16(r[0], pm, 10.0f, &columns->pm1p0_ug_m3[i]);                            /* convert data */
+    a_sen5x_batch_store_u16(r[1], pm, 10.0f, &columns->pm2p5_ug_m3[i]);                            /* convert data */
+    a_sen5x_batch_store_u16(r[2], pm, 10.0f, &columns->pm4p0_ug_m3[i]);                            /* convert data */
+    a_sen5x_batch_store_u16(r[3], pm, 10.0f, &columns->pm10_ug_m3[i]);                             /* convert data */
+    a_sen5x_batch_store_u16(r[4], pm, 10.0f, &columns->pm0p5_cm3[i]);                              /* convert data */
+    a_sen5x_batch_store_u16(r[5], pm, 10.0f, &columns->pm1p0_cm3[i]);                              /* convert data */
+    a_sen5x_batch_store_u16(r[6], pm, 10.0f, &columns->pm2p5_cm3[i]);                              /* convert data */
+    a_sen5x_batch_store_u16(r[7], pm, 10.0f, &columns->pm4p0_cm3[i]);                              /* convert data */
+    a_sen5x_batch_store_u16(t[0], pm, 10.0f, &columns->pm10_cm3[i]);                               /* convert data */
+    a_sen5x_batch_store_u16(t[1], pm, 1000.0f, &columns->typical_particle_um[i]);                  /* convert data */
+    a_sen5x_batch_store_valid(pm, &columns->pm_valid[i]);                                          /* set pm valid */
+}
+
+#elif defined(SEN5X_BATCH_USE_NEON)
+
+/**
+ * @brief     gather words 0 - 7 of a frame as native 16 bit lanes
+ * @param[in] *frame pointer to a frame buffer
+ * @return    words
+ * @note      reads bytes 0 - 23 of the frame
+ */
+static inline uint16x8_t a_sen5x_batch_gather(const uint8_t *frame)
+{
+    static const uint8_t lo_mask[16] = {1, 0, 4, 3, 7, 6, 10, 9, 13, 12, 255, 255, 255, 255, 255, 255};        /* words 0 - 4 from byte 0 */
+    static const uint8_t hi_mask[16] = {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 8, 7, 11, 10, 14, 13};  /* words 5 - 7 from byte 8 */
+    uint8x16_t lo;
+    uint8x16_t hi;
+
+    lo = vqtbl1q_u8(vld1q_u8(frame + 0), vld1q_u8(lo_mask));                                                 /* swap words 0 - 4 */
+    hi = vqtbl1q_u8(vld1q_u8(frame + 8), vld1q_u8(hi_mask));                                                 /* swap words 5 - 7 */
+
+    return vreinterpretq_u16_u8(vorrq_u8(lo, hi));                                                           /* merge */
+}
+
+/**
+ * @brief     gather words 8 - 9 of a pm frame into lanes 0 - 1
+ * @param[in] *frame pointer to a frame buffer
+ * @return    words
+ * @note      reads bytes 14 - 29 of the frame
+ */
+static inline uint16x8_t a_sen5x_batch_gather_tail(const uint8_t *frame)
+{
+    static const uint8_t mask[16] = {11, 10, 14, 13, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255};   /* words 8 - 9 from byte 14 */
+
+    return vreinterpretq_u16_u8(vqtbl1q_u8(vld1q_u8(frame + 14), vld1q_u8(mask)));                           /* swap */
+}
+
+/**
+ * @brief     interleave the low 32 bit lanes
+ * @param[in] a first register
+ * @param[in] b second register
+ * @return    result
+ * @note      none
+ */
+static inline uint16x8_t a_sen5x_batch_zip1_u32(uint16x8_t a, uint16x8_t b)
+{
+    return vreinterpretq_u16_u32(vzip1q_u32(vreinterpretq_u32_u16(a), vreinterpretq_u32_u16(b)));        /* zip */
+}
+
+/**
+ * @brief     interleave the high 32 bit lanes
+ * @param[in] a first register
+ * @param[in] b second register
+ * @return    result
+ * @note      none
+ */
+static inline uint16x8_t a_sen5x_batch_zip2_u32(uint16x8_t a, uint16x8_t b)
+{
+    return vreinterpretq_u16_u32(vzip2q_u32(vreinterpretq_u32_u16(a), vreinterpretq_u32_u16(b)));        /* zip */
+}
+
+/**
+ * @brief     interleave the low 64 bit lanes
+ * @param[in] a first register
+ * @param[in] b second register
+ * @return    result
+ * @note      none
+ */
+static inline uint16x8_t a_sen5x_batch_zip1_u64(uint16x8_t a, uint16x8_t b)
+{
+    return vreinterpretq_u16_u64(vzip1q_u64(vreinterpretq_u64_u16(a), vreinterpretq_u64_u16(b)));        /* zip */
+}
+
+/**
+ * @brief     interleave the high 64 bit lanes
+ * @param[in] a first register
+ * @param[in] b second register
+ * @return    result
+ * @note      none
+ */
+static inline uint16x8_t a_sen5x_batch_zip2_u64(uint16x8_t a, uint16x8_t b)
+{
+    return vreinterpretq_u16_u64(vzip2q_u64(vreinterpretq_u64_u16(a), vreinterpretq_u64_u16(b)));        /* zip */
+}
+
+/**
+ * @brief         transpose 8 frames x 8 words into 8 words x 8 frames
+ * @param[in,out] *r pointer to 8 registers
+ * @note          none
+ */
+static inline void a_sen5x_batch_transpose(uint16x8_t *r)
+{
+    uint16x8_t t0, t1, t2, t3, t4, t5, t6, t7;
+    uint16x8_t u0, u1, u2, u3, u4, u5, u6, u7;
+
+    t0 = vzip1q_u16(r[0], r[1]);                  /* words 0 - 3 of frames 0 - 1 */
+    t1 = vzip2q_u16(r[0], r[1]);                  /* words 4 - 7 of frames 0 - 1 */
+    t2 = vzip1q_u16(r[2], r[3]);                  /* words 0 - 3 of frames 2 - 3 */
+    t3 = vzip2q_u16(r[2], r[3]);                  /* words 4 - 7 of frames 2 - 3 */
+    t4 = vzip1q_u16(r[4], r[5]);                  /* words 0 - 3 of frames 4 - 5 */
+    t5 = vzip2q_u16(r[4], r[5]);                  /* words 4 - 7 of frames 4 - 5 */
+    t6 = vzip1q_u16(r[6], r[7]);                  /* words 0 - 3 of frames 6 - 7 */
+    t7 = vzip2q_u16(r[6], r[7]);                  /* words 4 - 7 of frames 6 - 7 */
+    u0 = a_sen5x_batch_zip1_u32(t0, t2);          /* words 0 - 1 of frames 0 - 3 */
+    u1 = a_sen5x_batch_zip2_u32(t0, t2);          /* words 2 - 3 of frames 0 - 3 */
+    u2 = a_sen5x_batch_zip1_u32(t1, t3);          /* words 4 - 5 of frames 0 - 3 */
+    u3 = a_sen5x_batch_zip2_u32(t1, t3);          /* words 6 - 7 of frames 0 - 3 */
+    u4 = a_sen5x_batch_zip1_u32(t4, t6);          /* words 0 - 1 of frames 4 - 7 */
+    u5 = a_sen5x_batch_zip2_u32(t4, t6);          /* words 2 - 3 of frames 4 - 7 */
+    u6 = a_sen5x_batch_zip1_u32(t5, t7);          /* words 4 - 5 of frames 4 - 7 */
+    u7 = a_sen5x_batch_zip2_u32(t5, t7);          /* words 6 - 7 of frames 4 - 7 */
+    r[0] = a_sen5x_batch_zip1_u64(u0, u4);        /* word 0 */
+    r[1] = a_sen5x_batch_zip2_u64(u0, u4);        /* word 1 */
+    r[2] = a_sen5x_batch_zip1_u64(u1, u5);        /* word 2 */
+    r[3] = a_sen5x_batch_zip2_u64(u1, u5);        /* word 3 */
+    r[4] = a_sen5x_batch_zip1_u64(u2, u6);        /* word 4 */
+    r[5] = a_sen5x_batch_zip2_u64(u2, u6);        /* word 5 */
+    r[6] = a_sen5x_batch_zip1_u64(u3, u7);        /* word 6 */
+    r[7] = a_sen5x_batch_zip2_u64(u3, u7);        /* word 7 */
+}
+
+/**
+ * @brief      transpose words 8 - 9 of 8 pm frames
+ * @param[in]  *g pointer to 8 gathered tails
+ * @param[out] *r pointer to 2 registers
+ * @note       none
+ */
+static inline void a_sen5x_batch_transpose_tail(const uint16x8_t *g, uint16x8_t *r)
+{
+    uint16x8_t u0;
+    uint16x8_t u1;
+
+    u0 = a_sen5x_batch_zip1_u32(vzip1q_u16(g[0], g[1]), vzip1q_u16(g[2], g[3]));        /* frames 0 - 3 */
+    u1 = a_sen5x_batch_zip1_u32(vzip1q_u16(g[4], g[5]), vzip1q_u16(g[6], g[7]));        /* frames 4 - 7 */
+    r[0] = a_sen5x_batch_zip1_u64(u0, u1);                                              /* word 8 */
+    r[1] = a_sen5x_batch_zip2_u64(u0, u1);                                              /* word 9 */
+}
+
+/**
+ * @brief     store the pm valid flags of 8 frames
+ * @param[in] invalid 16 bit invalid mask
+ * @param[in] *out pointer to an output buffer
+ * @note      none
+ */
+static inline void a_sen5x_batch_store_valid(uint16x8_t invalid, uint8_t *out)
+{
+    vst1_u8(out, vbic_u8(vdup_n_u8(1), vmovn_u16(invalid)));        /* 1 when valid */
+}
+
+/**
+ * @brief     convert and store 8 words
+ * @param[in] lo 32 bit words 0 - 3
+ * @param[in] hi 32 bit words 4 - 7
+ * @param[in] invalid 16 bit nan mask
+ * @param[in] scale divisor
+ * @param[in] *out pointer to an output buffer
+ * @note      none
+ */
+static inline void a_sen5x_batch_store_f32(float32x4_t lo, float32x4_t hi, uint16x8_t invalid, float scale, float *out)
+{
+    const float32x4_t nan = vdupq_n_f32(NAN);
+    const float32x4_t div = vdupq_n_f32(scale);
+    uint32x4_t mask_lo;
+    uint32x4_t mask_hi;
+
+    mask_lo = vreinterpretq_u32_s32(vmovl_s16(vreinterpret_s16_u16(vget_low_u16(invalid))));        /* widen the mask */
+    mask_hi = vreinterpretq_u32_s32(vmovl_s16(vreinterpret_s16_u16(vget_high_u16(invalid))));       /* widen the mask */
+    vst1q_f32(out + 0, vbslq_f32(mask_lo, nan, vdivq_f32(lo, div)));                                /* convert words 0 - 3 */
+    vst1q_f32(out + 4, vbslq_f32(mask_hi, nan, vdivq_f32(hi, div)));                                /* convert words 4 - 7 */
+}
+
+/**
+ * @brief     convert and store 8 unsigned words
+ * @param[in] word 16 bit words
+ * @param[in] invalid 16 bit nan mask
+ * @param[in] scale divisor
+ * @param[in] *out pointer to an output buffer
+ * @note      none
+ */
+static inline void a_sen5x_batch_store_u16(uint16x8_t word, uint16x8_t invalid, float scale, float *out)
+{
+    a_sen5x_batch_store_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(word))),
+                            vcvtq_f32_u32(vmovl_u16(vget_high_u16(word))),
+                            invalid, scale, out);                                    /* zero extend */
+}
+
+/**
+ * @brief     convert and store 8 signed words
+ * @param[in] word 16 bit words
+ * @param[in] invalid 16 bit nan mask
+ * @param[in] scale divisor
+ * @param[in] *out pointer to an output buffer
+ * @note      none
+ */
+static inline void a_sen5x_batch_store_s16(uint16x8_t word, uint16x8_t invalid, float scale, float *out)
+{
+    a_sen5x_batch_store_f32(vcvtq_f32_s32(vmovl_s16(vreinterpret_s16_u16(vget_low_u16(word)))),
+                            vcvtq_f32_s32(vmovl_s16(vreinterpret_s16_u16(vget_high_u16(word)))),
+                            invalid, scale, out);                                    /* sign extend */
+}
+
+/**
+ * @brief     decode 8 read measured values frames
+ * @param[in] *frames pointer to 8 frames
+ * @param[in] i column index
+ * @param[in] *columns pointer to a sen5x batch measured structure
+ * @note      none
+ */
+static void a_sen5x_batch_measured_block(const uint8_t *frames, uint32_t i, sen5x_batch_measured_t *columns)
+{
+    const uint16x8_t ones = vdupq_n_u16(0xFFFFU);
+    const uint16x8_t max = vdupq_n_u16(0x7FFFU);
+    uint16x8_t r[8];
+    uint16x8_t pm;
+    uint8_t j;
+
+    for (j = 0; j < 8; j++)                                                                        /* gather 8 frames */
+    {
+        r[j] = a_sen5x_batch_gather(&frames[j * SEN5X_BATCH_MEASURED_FRAME_LENGTH]);               /* gather */
+    }
+    a_sen5x_batch_transpose(r);                                                                    /* frames to columns */
+    pm = vorrq_u16(vorrq_u16(vceqq_u16(r[0], ones), vceqq_u16(r[1], ones)),
+                   vorrq_u16(vceqq_u16(r[2], ones), vceqq_u16(r[3], ones)));                       /* pm invalid mask */
+    a_sen5x_batch_store_u16(r[0], pm, 10.0f, &columns->pm1p0_ug_m3[i]);                            /* convert pm1.0 */
+    a_sen5x_batch_store_u16(r[1], pm, 10.0f, &columns->pm2p5_ug_m3[i]);                            /* convert pm2.5 */
+    a_sen5x_batch_store_u16(r[2], pm, 10.0f, &columns->pm4p0_ug_m3[i]);                            /* convert pm4.0 */
+    a_sen5x_batch_store_u16(r[3], pm, 10.0f, &columns->pm10_ug_m3[i]);                             /* convert pm10 */
+    a_sen5x_batch_store_valid(pm, &columns->pm_valid[i]);                                          /* set pm valid */
+    a_sen5x_batch_store_s16(r[4], vceqq_u16(r[4], max), 100.0f,
+                            &columns->compensated_ambient_humidity_percentage[i]);                 /* convert humidity */
+    a_sen5x_batch_store_s16(r[5], vceqq_u16(r[5], max), 200.0f,
+                            &columns->compensated_ambient_temperature_degree[i]);                  /* convert temperature */
+    a_sen5x_batch_store_s16(r[6], vceqq_u16(r[6], max), 10.0f, &columns->voc_index[i]);           /* convert voc */
+    a_sen5x_batch_store_s16(r[7], vceqq_u16(r[7], max), 10.0f, &columns->nox_index[i]);           /* convert nox */
+}
+
+/**
+ * @brief     decode 8 read measured pm values frames
+ * @param[in] *frames pointer to 8 frames
+ * @param[in] i column index
+ * @param[in] *columns pointer to a sen5x batch pm structure
+ * @note      none
+ */
+static void a_sen5x_batch_pm_block(const uint8_t *frames, uint32_t i, sen5x_batch_pm_t *columns)
+{
+    const uint16x8_t ones = vdupq_n_u16(0xFFFFU);
+    uint16x8_t r[8];
+    uint16x8_t g[8];
+    uint16x8_t t[2];
+    uint16x8_t pm;
+    uint8_t j;
+
+    for (j = 0; j < 8; j++)                                                                        /* gather 8 frames */
+    {
+        r[j] = a_sen5x_batch_gather(&frames[j * SEN5X_BATCH_PM_FRAME_LENGTH]);                     /* gather words 0 - 7 */
+        g[j] = a_sen5x_batch_gather_tail(&frames[j * SEN5X_BATCH_PM_FRAME_LENGTH]);                /* gather words 8 - 9 */
+    }
+    a_sen5x_batch_transpose(r);                                                                    /* frames to columns */
+    a_sen5x_batch_transpose_tail(g, t);                                                            /* frames to columns */
+    pm = vorrq_u16(vceqq_u16(t[0], ones), vceqq_u16(t[1], ones));                                  /* check words 8 - 9 */
+    for (j = 0; j < 8; j++)                                                                        /* check words 0 - 7 */
+    {
+        pm = vorrq_u16(pm, vceqq_u16(r[j], ones));                                                 /* merge the mask */
+    }
+    a_sen5x_batch_store_u16(r[0], pm, 10.0f, &columns->pm1p0_ug_m3[i]);                            /* convert data */
+    a_sen5x_batch_store_u16(r[1], pm, 10.0f, &columns->pm2p5_ug_m3[i]);                            /* convert data */
+    a_sen5x_batch_store_u16(r[2], pm, 10.0f, &columns->pm4p0_ug_m3[i]);                            /* convert data */
+    a_sen5x_batch_store_u16(r[3], pm, 10.0f, &columns->pm10_ug_m3[i]);                             /* convert data */
+    a_sen5x_batch_store_u16(r[4], pm, 10.0f, &columns->pm0p5_cm3[i]);                              /* convert data */
+    a_sen5x_batch_store_u16(r[5], pm, 10.0f, &columns->pm1p0_cm3[i]);                              /* convert data */
+    a_sen5x_batch_store_u16(r[6], pm, 10.0f, &columns->pm2p5_cm3[i]);                              /* convert data */
+    a_sen5x_batch_store_u16(r[7], pm, 10.0f, &columns->pm4p0_cm3[i]);                              /* convert data */
+    a_sen5x_batch_store_u16(t[0], pm, 10.0f, &columns->pm10_cm3[i]);                               /* convert data */
+    a_sen5x_batch_store_u16(t[1], pm, 1000.0f, &columns->typical_particle_um[i]);                  /* convert data */
+    a_sen5x_batch_store_valid(pm, &columns->pm_valid[i]);                                          /* set pm valid */
+}
+
+#endif
+
+/**
+ * @brief      get the simd instruction set used by the batch decoder
+ * @param[out] *simd pointer to a simd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 simd is NULL
+ * @note       the instruction set is selected at compile time from the target flags,
+ *             e.g. -mssse3, -mavx2 or an aarch64 target
+ */
+uint8_t sen5x_batch_get_simd(sen5x_batch_simd_t *simd)
+{
+    if (simd == NULL)                        /* check simd */
+    {
+        return 2;                            /* return error */
+    }
+
+    *simd = SEN5X_BATCH_SIMD_PATH;           /* set the simd */
+
+    return 0;                                /* success return 0 */
+}
+
+/**
+ * @brief      decode read measured values frames into columns
+ * @param[in]  *frames pointer to count frames of 24 bytes
+ * @param[in]  count frame count
+ * @param[out] *columns pointer to a sen5x batch measured structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 frames or columns is NULL
+ * @note       every column must hold count elements, the results are bit identical to sen55_read,
+ *             a frame with a crc error is decoded as nan with pm_valid 0 when crc_valid isn't NULL
+ */
+uint8_t sen5x_batch_decode_measured_values(const uint8_t *frames, uint32_t count, sen5x_batch_measured_t *columns)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t end;
+
+    if ((frames == NULL) || (columns == NULL))                                                                   /* check the params */
+    {
+        return 2;                                                                                                /* return error */
+    }
+    if ((columns->pm1p0_ug_m3 == NULL) || (columns->pm2p5_ug_m3 == NULL) ||
+        (columns->pm4p0_ug_m3 == NULL) || (columns->pm10_ug_m3 == NULL) ||
+        (columns->compensated_ambient_humidity_percentage == NULL) ||
+        (columns->compensated_ambient_temperature_degree == NULL) ||
+        (columns->voc_index == NULL) || (columns->nox_index == NULL) || (columns->pm_valid == NULL))            /* check the columns */
+    {
+        return 2;                                                                                                /* return error */
+    }
+
+    for (i = 0; i < count; i = end)                                                                              /* run all blocks */
+    {
+        end = ((count - i) > SEN5X_BATCH_BLOCK) ? (i + SEN5X_BATCH_BLOCK) : count;                               /* block end */
+#if defined(SEN5X_BATCH_USE_X86) || defined(SEN5X_BATCH_USE_NEON)
+        if ((end - i) == SEN5X_BATCH_BLOCK)                                                                      /* full block */
+        {
+            a_sen5x_batch_measured_block(&frames[i * SEN5X_BATCH_MEASURED_FRAME_LENGTH], i, columns);           /* simd decode */
+        }
+        else
+#endif
+        {
+            for (j = i; j < end; j++)                                                                            /* tail frames */
+            {
+                a_sen5x_batch_measured_frame(&frames[j * SEN5X_BATCH_MEASURED_FRAME_LENGTH], j, columns);        /* scalar decode */
+            }
+        }
+        if (columns->crc_valid != NULL)                                                                          /* check crc */
+        {
+            for (j = i; j < end; j++)                                                                            /* check the block */
+            {
+                columns->crc_valid[j] = a_sen5x_batch_crc_check(&frames[j * SEN5X_BATCH_MEASURED_FRAME_LENGTH], 8);  /* check crc */
+                if (columns->crc_valid[j] == 0)                                                                  /* crc error */
+                {
+                    a_sen5x_batch_measured_invalidate(j, columns);                                               /* set nan */
+                }
+            }
+        }
+    }
+
+    return 0;                                                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      decode read measured pm values frames into columns
+ * @param[in]  *frames pointer to count frames of 30 bytes
+ * @param[in]  count frame count
+ * @param[out] *columns pointer to a sen5x batch pm structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 frames or columns is NULL
+ * @note       every column must hold count elements, the results are bit identical to sen5x_read_pm_value,
+ *             a frame with a crc error is decoded as nan with pm_valid 0 when crc_valid isn't NULL
+ */
+uint8_t sen5x_batch_decode_pm_values(const uint8_t *frames, uint32_t count, sen5x_batch_pm_t *columns)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t end;
+
+    if ((frames == NULL) || (columns == NULL))                                                          /* check the params */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    if ((columns->pm1p0_ug_m3 == NULL) || (columns->pm2p5_ug_m3 == NULL) ||
+        (columns->pm4p0_ug_m3 == NULL) || (columns->pm10_ug_m3 == NULL) ||
+        (columns->pm0p5_cm3 == NULL) || (columns->pm1p0_cm3 == NULL) ||
+        (columns->pm2p5_cm3 == NULL) || (columns->pm4p0_cm3 == NULL) ||
+        (columns->pm10_cm3 == NULL) || (columns->typical_particle_um == NULL) ||
+        (columns->pm_valid == NULL))                                                                    /* check the columns */
+    {
+        return 2;                                                                                       /* return error */
+    }
+
+    for (i = 0; i < count; i = end)                                                                     /* run all blocks */
+    {
+        end = ((count - i) > SEN5X_BATCH_BLOCK) ? (i + SEN5X_BATCH_BLOCK) : count;                      /* block end */
+#if defined(SEN5X_BATCH_USE_X86) || defined(SEN5X_BATCH_USE_NEON)
+        if ((end - i) == SEN5X_BATCH_BLOCK)                                                             /* full block */
+        {
+            a_sen5x_batch_pm_block(&frames[i * SEN5X_BATCH_PM_FRAME_LENGTH], i, columns);               /* simd decode */
+        }
+        else
+#endif
+        {
+            for (j = i; j < end; j++)                                                                   /* tail frames */
+            {
+                a_sen5x_batch_pm_frame(&frames[j * SEN5X_BATCH_PM_FRAME_LENGTH], j, columns);           /* scalar decode */
+            }
+        }
+        if (columns->crc_valid != NULL)                                                                 /* check crc */
+        {
+            for (j = i; j < end; j++)                                                                   /* check the block */
+            {
+                columns->crc_valid[j] = a_sen5x_batch_crc_check(&frames[j * SEN5X_BATCH_PM_FRAME_LENGTH], 10);  /* check crc */
+                if (columns->crc_valid[j] == 0)                                                         /* crc error */
+                {
+                    a_sen5x_batch_pm_invalidate(j, columns);                                            /* set nan */
+                }
+            }
+        }
+    }
+
+    return 0;                                                                                           /* success return 0 */
+}
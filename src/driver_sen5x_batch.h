@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_batch.h
+ * @brief     driver sen5x batch header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_BATCH_H
+#define DRIVER_SEN5X_BATCH_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_batch_driver sen5x batch driver function
+ * @brief    sen5x batch driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x batch frame length definition
+ */
+#define SEN5X_BATCH_MEASURED_FRAME_LENGTH        24        /**< read measured values frame length */
+#define SEN5X_BATCH_PM_FRAME_LENGTH              30        /**< read measured pm values frame length */
+
+/**
+ * @brief sen5x batch simd enumeration definition
+ */
+typedef enum
+{
+    SEN5X_BATCH_SIMD_NONE  = 0x00,        /**< scalar code */
+    SEN5X_BATCH_SIMD_SSSE3 = 0x01,        /**< x86 ssse3 */
+    SEN5X_BATCH_SIMD_AVX2  = 0x02,        /**< x86 avx2 */
+    SEN5X_BATCH_SIMD_NEON  = 0x03,        /**< aarch64 neon, not verified on hardware */
+} sen5x_batch_simd_t;
+
+/**
+ * @brief sen5x batch measured values column structure definition
+ */
+typedef struct sen5x_batch_measured_s
+{
+    float *pm1p0_ug_m3;                                  /**< mass concentration pm1.0 column [μg/m3] */
+    float *pm2p5_ug_m3;                                  /**< mass concentration pm2.5 column [μg/m3] */
+    float *pm4p0_ug_m3;                                  /**< mass concentration pm4.0 column [μg/m3] */
+    float *pm10_ug_m3;                                   /**< mass concentration pm10 column [μg/m3] */
+    float *compensated_ambient_humidity_percentage;      /**< compensated ambient humidity percentage column */
+    float *compensated_ambient_temperature_degree;       /**< compensated ambient temperature degree column */
+    float *voc_index;                                    /**< voc index column */
+    float *nox_index;                                    /**< nox index column */
+    uint8_t *pm_valid;                                   /**< pm valid column */
+    uint8_t *crc_valid;                                  /**< crc valid column, NULL skips the crc check */
+} sen5x_batch_measured_t;
+
+/**
+ * @brief sen5x batch pm values column structure definition
+ */
+typedef struct sen5x_batch_pm_s
+{
+    float *pm1p0_ug_m3;                /**< mass concentration pm1.0 column [μg/m3] */
+    float *pm2p5_ug_m3;                /**< mass concentration pm2.5 column [μg/m3] */
+    float *pm4p0_ug_m3;                /**< mass concentration pm4.0 column [μg/m3] */
+    float *pm10_ug_m3;                 /**< mass concentration pm10 column [μg/m3] */
+    float *pm0p5_cm3;                  /**< number concentration pm0.5 column [#/cm3] */
+    float *pm1p0_cm3;                  /**< number concentration pm1.0 column [#/cm3] */
+    float *pm2p5_cm3;                  /**< number concentration pm2.5 column [#/cm3] */
+    float *pm4p0_cm3;                  /**< number concentration pm4.0 column [#/cm3] */
+    float *pm10_cm3;                   /**< number concentration pm10 column [#/cm3] */
+    float *typical_particle_um;        /**< typical particle size column [um] */
+    uint8_t *pm_valid;                 /**< pm valid column */
+    uint8_t *crc_valid;                /**< crc valid column, NULL skips the crc check */
+} sen5x_batch_pm_t;
+
+/**
+ * @brief      get the simd instruction set used by the batch decoder
+ * @param[out] *simd pointer to a simd buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 simd is NULL
+ * @note       the instruction set is selected at compile time from the target flags,
+ *             e.g. -mssse3, -mavx2 or an aarch64 target
+ */
+uint8_t sen5x_batch_get_simd(sen5x_batch_simd_t *simd);
+
+/**
+ * @brief      decode read measured values frames into columns
+ * @param[in]  *frames pointer to count frames of 24 bytes
+ * @param[in]  count frame count
+ * @param[out] *columns pointer to a sen5x batch measured structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 frames or columns is NULL
+ * @note       every column must hold count elements, the results are bit identical to sen55_read,
+ *             a frame with a crc error is decoded as nan with pm_valid 0 when crc_valid isn't NULL
+ */
+uint8_t sen5x_batch_decode_measured_values(const uint8_t *frames, uint32_t count, sen5x_batch_measured_t *columns);
+
+/**
+ * @brief      decode read measured pm values frames into columns
+ * @param[in]  *frames pointer to count frames of 30 bytes
+ * @param[in]  count frame count
+ * @param[out] *columns pointer to a sen5x batch pm structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 frames or columns is NULL
+ * @note       every column must hold count elements, the results are bit identical to sen5x_read_pm_value,
+ *             a frame with a crc error is decoded as nan with pm_valid 0 when crc_valid isn't NULL
+ */
+uint8_t sen5x_batch_decode_pm_values(const uint8_t *frames, uint32_t count, sen5x_batch_pm_t *columns);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,399 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_calib.c
+ * @brief     driver sen5x calib source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_calib.h"
+
+/**
+ * @brief sen5x calib definition
+ */
+#define SEN5X_CALIB_GOLDEN            0.6180339887498949        /**< inverse golden ratio */
+#define SEN5X_CALIB_TOLERANCE         0.5                       /**< time constant tolerance in seconds */
+
+/**
+ * @brief sen5x calib source structure definition
+ */
+typedef struct sen5x_calib_source_s
+{
+    const float *sensor;                 /**< sensor temperature series in degrees, NULL for raw */
+    const sen5x_raw_t *raw;              /**< raw series */
+    const float *reference;              /**< reference temperature series in degrees */
+    uint32_t count;                      /**< sample count */
+} sen5x_calib_source_t;
+
+/**
+ * @brief sen5x calib fit structure definition
+ */
+typedef struct sen5x_calib_fit_s
+{
+    double slope;                /**< normalized temperature offset slope */
+    double offset;               /**< temperature offset in degrees */
+    double sse;                  /**< residual sum of squares */
+    double see;                  /**< sum of squares without compensation */
+    uint32_t n;                  /**< usable sample pairs */
+} sen5x_calib_fit_t;
+
+/**
+ * @brief     get a sensor temperature
+ * @param[in] *src pointer to a source structure
+ * @param[in] i sample index
+ * @return    temperature in degrees, nan if missing
+ * @note      the raw temperature scale is 200 ticks per degree
+ */
+static inline double a_sen5x_calib_sensor(const sen5x_calib_source_t *src, uint32_t i)
+{
+    if (src->sensor != NULL)                                                           /* float series */
+    {
+        return (double)src->sensor[i];                                                 /* return the degree */
+    }
+
+    return (double)src->raw[i].temperature_raw / 200.0;                                /* return the raw degree */
+}
+
+/**
+ * @brief      fit slope and offset at a fixed time constant
+ * @param[in]  *src pointer to a source structure
+ * @param[in]  tau time constant in seconds
+ * @param[in]  interval sampling interval in seconds
+ * @param[out] *fit pointer to a fit structure
+ * @return     none
+ * @note       the lowpass is linear, so lowpass(slope * x + offset) = slope * lowpass(x) + offset and one pass
+ *             gives the sums of the closed form least squares of the reference error on the filtered sensor
+ */
+static void a_sen5x_calib_evaluate(const sen5x_calib_source_t *src, double tau, double interval,
+                                   sen5x_calib_fit_t *fit)
+{
+    uint32_t i;
+    uint8_t started;
+    double alpha;
+    double x;
+    double z;
+    double e;
+    double sz;
+    double se;
+    double szz;
+    double sze;
+    double see;
+    double vzz;
+    double vze;
+
+    alpha = (tau > 0.0) ? (1.0 - exp(-interval / tau)) : 1.0;                          /* lowpass gain */
+    started = 0;                                                                       /* no state yet */
+    z = 0.0;                                                                           /* init the state */
+    sz = 0.0;                                                                          /* init the sums */
+    se = 0.0;                                                                          /* init the sums */
+    szz = 0.0;                                                                         /* init the sums */
+    sze = 0.0;                                                                         /* init the sums */
+    see = 0.0;                                                                         /* init the sums */
+    fit->n = 0;                                                                        /* no pairs */
+    for (i = 0; i < src->count; i++)                                                   /* run all samples */
+    {
+        x = a_sen5x_calib_sensor(src, i);                                              /* sensor sample */
+        if (isnan(x) != 0)                                                             /* missing sensor sample */
+        {
+            continue;                                                                  /* hold the state */
+        }
+        if (started == 0)                                                              /* first sample */
+        {
+            z = x;                                                                     /* start settled */
+            started = 1;                                                               /* started */
+        }
+        z += alpha * (x - z);                                                          /* lowpass */
+        if (isnan(src->reference[i]) != 0)                                             /* missing reference */
+        {
+            continue;                                                                  /* skip the pair */
+        }
+        e = (double)src->reference[i] - x;                                             /* reference error */
+        sz += z;                                                                       /* accumulate */
+        se += e;                                                                       /* accumulate */
+        szz += z * z;                                                                  /* accumulate */
+        sze += z * e;                                                                  /* accumulate */
+        see += e * e;                                                                  /* accumulate */
+        fit->n++;                                                                      /* one more pair */
+    }
+    if (fit->n == 0)                                                                   /* no pairs */
+    {
+        fit->slope = 0.0;                                                              /* no slope */
+        fit->offset = 0.0;                                                             /* no offset */
+        fit->sse = 0.0;                                                                /* no error */
+        fit->see = 0.0;                                                                /* no error */
+
+        return;                                                                        /* return */
+    }
+
+    vzz = szz - sz * sz / fit->n;                                                      /* centered sensor variance */
+    vze = sze - sz * se / fit->n;                                                      /* centered covariance */
+    fit->see = see;                                                                    /* save the raw error */
+    if (vzz > 1e-6 * fit->n)                                                           /* sensor moved */
+    {
+        fit->slope = vze / vzz;                                                        /* least squares slope */
+    }
+    else
+    {
+        fit->slope = 0.0;                                                              /* offset only */
+    }
+    fit->offset = (se - fit->slope * sz) / fit->n;                                     /* least squares offset */
+    fit->sse = (see - se * se / fit->n) - fit->slope * vze;                            /* residual sum of squares */
+    fit->sse = (fit->sse < 0.0) ? 0.0 : fit->sse;                                      /* rounding guard */
+}
+
+/**
+ * @brief      search the time constant and fit the compensation
+ * @param[in]  *calib pointer to a calib structure
+ * @param[in]  *src pointer to a source structure
+ * @param[out] *result pointer to a calib result structure
+ * @return     status code
+ *             - 0 success
+ *             - 4 too few usable samples
+ *             - 5 the fitted values exceed the registers
+ * @note       a log spaced grid brackets the best time constant, a golden section search refines it
+ *             and the final fit runs at the whole second the register can hold
+ */
+static uint8_t a_sen5x_calib_search(sen5x_calib_t *calib, const sen5x_calib_source_t *src,
+                                    sen5x_calib_result_t *result)
+{
+    uint32_t k;
+    uint32_t best;
+    uint32_t evaluations;
+    double grid[SEN5X_CALIB_GRID_POINTS + 1];
+    double sse[SEN5X_CALIB_GRID_POINTS + 1];
+    double lo;
+    double hi;
+    double c;
+    double d;
+    double fc;
+    double fd;
+    double tau;
+    double offset_reg;
+    double slope_reg;
+    sen5x_calib_fit_t fit;
+
+    grid[0] = 0.0;                                                                     /* no lowpass */
+    for (k = 1; k <= SEN5X_CALIB_GRID_POINTS; k++)                                     /* 1 s up to the max */
+    {
+        grid[k] = pow((double)calib->max_time_constant,
+                      (double)(k - 1) / (double)(SEN5X_CALIB_GRID_POINTS - 1));        /* log spaced */
+    }
+    evaluations = 0;                                                                   /* init the evaluations */
+    best = 0;                                                                          /* init the best */
+    for (k = 0; k <= SEN5X_CALIB_GRID_POINTS; k++)                                     /* coarse grid */
+    {
+        if ((k > 0) && (calib->max_time_constant < 1.0f))                              /* static offset only */
+        {
+            break;                                                                     /* stop */
+        }
+        a_sen5x_calib_evaluate(src, grid[k], calib->sampling_interval, &fit);          /* fit */
+        evaluations++;                                                                 /* one more */
+        if (fit.n < SEN5X_CALIB_MIN_SAMPLES)                                           /* check the pairs */
+        {
+            return 4;                                                                  /* return error */
+        }
+        sse[k] = fit.sse;                                                              /* save the error */
+        best = (sse[k] < sse[best]) ? k : best;                                        /* keep the best */
+    }
+
+    if (best > 0)                                                                      /* refine */
+    {
+        lo = grid[best - 1];                                                           /* lower bracket */
+        hi = (best < SEN5X_CALIB_GRID_POINTS) ? grid[best + 1] : grid[best];           /* upper bracket */
+        c = hi - SEN5X_CALIB_GOLDEN * (hi - lo);                                       /* lower probe */
+        d = lo + SEN5X_CALIB_GOLDEN * (hi - lo);                                       /* upper probe */
+        a_sen5x_calib_evaluate(src, c, calib->sampling_interval, &fit);                /* fit */
+        fc = fit.sse;                                                                  /* lower probe error */
+        a_sen5x_calib_evaluate(src, d, calib->sampling_interval, &fit);                /* fit */
+        fd = fit.sse;                                                                  /* upper probe error */
+        evaluations += 2;                                                              /* two more */
+        while ((hi - lo) > SEN5X_CALIB_TOLERANCE)                                      /* golden section */
+        {
+            if (fc < fd)                                                               /* minimum below d */
+            {
+                hi = d;                                                                /* drop the top */
+                d = c;                                                                 /* reuse the probe */
+                fd = fc;                                                               /* reuse the error */
+                c = hi - SEN5X_CALIB_GOLDEN * (hi - lo);                               /* new lower probe */
+                a_sen5x_calib_evaluate(src, c, calib->sampling_interval, &fit);        /* fit */
+                fc = fit.sse;                                                          /* save the error */
+            }
+            else                                                                       /* minimum above c */
+            {
+                lo = c;                                                                /* drop the bottom */
+                c = d;                                                                 /* reuse the probe */
+                fc = fd;                                                               /* reuse the error */
+                d = lo + SEN5X_CALIB_GOLDEN * (hi - lo);                               /* new upper probe */
+                a_sen5x_calib_evaluate(src, d, calib->sampling_interval, &fit);        /* fit */
+                fd = fit.sse;                                                          /* save the error */
+            }
+            evaluations++;                                                             /* one more */
+        }
+        tau = floor(0.5 * (lo + hi) + 0.5);                                            /* whole seconds */
+    }
+    else
+    {
+        tau = 0.0;                                                                     /* no lowpass */
+    }
+    a_sen5x_calib_evaluate(src, tau, calib->sampling_interval, &fit);                  /* final fit */
+    evaluations++;                                                                     /* one more */
+
+    offset_reg = floor(fit.offset * 200.0 + 0.5);                                      /* offset register */
+    slope_reg = floor(fit.slope * 10000.0 + 0.5);                                      /* slope register */
+    if ((offset_reg < -32768.0) || (offset_reg > 32767.0) ||
+        (slope_reg < -32768.0) || (slope_reg > 32767.0) || (tau > 65535.0))            /* check the registers */
+    {
+        return 5;                                                                      /* return error */
+    }
+    result->temperature_offset_degree = (float)fit.offset;                             /* save the offset */
+    result->normalized_temperature_offset_slope_factor = (float)fit.slope;             /* save the slope */
+    result->time_constant_second = (float)tau;                                         /* save the time constant */
+    result->temperature_offset_reg = (int16_t)offset_reg;                              /* save the register */
+    result->normalized_temperature_offset_slope_reg = (int16_t)slope_reg;              /* save the register */
+    result->time_constant_reg = (uint16_t)tau;                                         /* save the register */
+    result->rmse_before_degree = (float)sqrt(fit.see / fit.n);                         /* error without compensation */
+    result->rmse_after_degree = (float)sqrt(fit.sse / fit.n);                          /* error with compensation */
+    result->samples = fit.n;                                                           /* save the pairs */
+    result->evaluations = evaluations;                                                 /* save the evaluations */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     init the temperature compensation fitter
+ * @param[in] *calib pointer to a calib structure
+ * @param[in] sampling_interval sampling interval in seconds
+ * @param[in] max_time_constant longest searched time constant in seconds
+ * @return    status code
+ *            - 0 success
+ *            - 2 calib is NULL
+ *            - 4 sampling interval is invalid
+ *            - 5 max time constant is invalid
+ * @note      sampling_interval > 0, 0 <= max_time_constant <= 65535, 0 fits a static offset only
+ */
+uint8_t sen5x_calib_init(sen5x_calib_t *calib, float sampling_interval, float max_time_constant)
+{
+    if (calib == NULL)                                                                 /* check the calib */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (!(sampling_interval > 0.0f))                                                   /* check the interval */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if (!((max_time_constant >= 0.0f) && (max_time_constant <= 65535.0f)))             /* check the max time constant */
+    {
+        return 5;                                                                      /* return error */
+    }
+
+    memset(calib, 0, sizeof(sen5x_calib_t));                                           /* clear the calib */
+    calib->sampling_interval = sampling_interval;                                      /* save the interval */
+    calib->max_time_constant = max_time_constant;                                      /* save the max time constant */
+    calib->inited = 1;                                                                 /* set the inited */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      fit the temperature compensation to a reference thermometer
+ * @param[in]  *calib pointer to a calib structure
+ * @param[in]  *sensor pointer to an uncompensated sensor temperature series in degrees
+ * @param[in]  *reference pointer to a reference temperature series in degrees
+ * @param[in]  count sample count
+ * @param[out] *result pointer to a calib result structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 calib, sensor, reference or result is NULL
+ *             - 3 calib is not initialized
+ *             - 4 too few usable samples
+ *             - 5 the fitted values exceed the registers
+ * @note       the model is reference = sensor + lowpass(slope * sensor + offset) with a first order lowpass
+ *             of the time constant, the sensor series must be read with a zero compensation,
+ *             nan samples are skipped and the results go to sen5x_set_temperature_compensation
+ */
+uint8_t sen5x_calib_fit(sen5x_calib_t *calib, const float *sensor, const float *reference,
+                        uint32_t count, sen5x_calib_result_t *result)
+{
+    sen5x_calib_source_t src;
+
+    if ((calib == NULL) || (sensor == NULL) || (reference == NULL) || (result == NULL))   /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (calib->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    src.sensor = sensor;                                                               /* set the sensor */
+    src.raw = NULL;                                                                    /* no raw */
+    src.reference = reference;                                                         /* set the reference */
+    src.count = count;                                                                 /* set the count */
+
+    return a_sen5x_calib_search(calib, &src, result);                                  /* fit */
+}
+
+/**
+ * @brief      fit the temperature compensation to a reference thermometer from raw values
+ * @param[in]  *calib pointer to a calib structure
+ * @param[in]  *raw pointer to a sen5x raw buffer read by sen5x_read_raw_value
+ * @param[in]  *reference pointer to a reference temperature series in degrees
+ * @param[in]  count sample count
+ * @param[out] *result pointer to a calib result structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 calib, raw, reference or result is NULL
+ *             - 3 calib is not initialized
+ *             - 4 too few usable samples
+ *             - 5 the fitted values exceed the registers
+ * @note       the raw temperature is not compensated, so the sensor may keep its current compensation
+ */
+uint8_t sen5x_calib_fit_raw(sen5x_calib_t *calib, const sen5x_raw_t *raw, const float *reference,
+                            uint32_t count, sen5x_calib_result_t *result)
+{
+    sen5x_calib_source_t src;
+
+    if ((calib == NULL) || (raw == NULL) || (reference == NULL) || (result == NULL))   /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (calib->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    src.sensor = NULL;                                                                 /* no float series */
+    src.raw = raw;                                                                     /* set the raw */
+    src.reference = reference;                                                         /* set the reference */
+    src.count = count;                                                                 /* set the count */
+
+    return a_sen5x_calib_search(calib, &src, result);                                  /* fit */
+}
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_calib.h
+ * @brief     driver sen5x calib header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_CALIB_H
+#define DRIVER_SEN5X_CALIB_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_calib_driver sen5x calib driver function
+ * @brief    sen5x calib driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x calib definition
+ */
+#define SEN5X_CALIB_DEFAULT_MAX_TIME_CONSTANT      7200.0f        /**< longest searched time constant in seconds */
+#define SEN5X_CALIB_GRID_POINTS                    24             /**< coarse log spaced time constants */
+#define SEN5X_CALIB_MIN_SAMPLES                    3              /**< fewest usable sample pairs */
+
+/**
+ * @brief sen5x calib structure definition
+ */
+typedef struct sen5x_calib_s
+{
+    float sampling_interval;                 /**< sampling interval in seconds */
+    float max_time_constant;                 /**< longest searched time constant in seconds */
+    uint8_t inited;                          /**< inited flag */
+} sen5x_calib_t;
+
+/**
+ * @brief sen5x calib result structure definition
+ */
+typedef struct sen5x_calib_result_s
+{
+    float temperature_offset_degree;                      /**< fitted temperature offset */
+    float normalized_temperature_offset_slope_factor;     /**< fitted normalized temperature offset slope */
+    float time_constant_second;                           /**< fitted time constant */
+    int16_t temperature_offset_reg;                       /**< temperature offset register raw data */
+    int16_t normalized_temperature_offset_slope_reg;      /**< normalized temperature offset slope register raw data */
+    uint16_t time_constant_reg;                           /**< time constant register raw data */
+    float rmse_before_degree;                             /**< reference error without compensation */
+    float rmse_after_degree;                              /**< reference error with the fitted compensation */
+    uint32_t samples;                                     /**< usable sample pairs */
+    uint32_t evaluations;                                 /**< time constants evaluated */
+} sen5x_calib_result_t;
+
+/**
+ * @brief     init the temperature compensation fitter
+ * @param[in] *calib pointer to a calib structure
+ * @param[in] sampling_interval sampling interval in seconds
+ * @param[in] max_time_constant longest searched time constant in seconds
+ * @return    status code
+ *            - 0 success
+ *            - 2 calib is NULL
+ *            - 4 sampling interval is invalid
+ *            - 5 max time constant is invalid
+ * @note      sampling_interval > 0, 0 <= max_time_constant <= 65535, 0 fits a static offset only
+ */
+uint8_t sen5x_calib_init(sen5x_calib_t *calib, float sampling_interval, float max_time_constant);
+
+/**
+ * @brief      fit the temperature compensation to a reference thermometer
+ * @param[in]  *calib pointer to a calib structure
+ * @param[in]  *sensor pointer to an uncompensated sensor temperature series in degrees
+ * @param[in]  *reference pointer to a reference temperature series in degrees
+ * @param[in]  count sample count
+ * @param[out] *result pointer to a calib result structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 calib, sensor, reference or result is NULL
+ *             - 3 calib is not initialized
+ *             - 4 too few usable samples
+ *             - 5 the fitted values exceed the registers
+ * @note       the model is reference = sensor + lowpass(slope * sensor + offset) with a first order lowpass
+ *             of the time constant, the sensor series must be read with a zero compensation,
+ *             nan samples are skipped and the results go to sen5x_set_temperature_compensation
+ */
+uint8_t sen5x_calib_fit(sen5x_calib_t *calib, const float *sensor, const float *reference,
+                        uint32_t count, sen5x_calib_result_t *result);
+
+/**
+ * @brief      fit the temperature compensation to a reference thermometer from raw values
+ * @param[in]  *calib pointer to a calib structure
+ * @param[in]  *raw pointer to a sen5x raw buffer read by sen5x_read_raw_value
+ * @param[in]  *reference pointer to a reference temperature series in degrees
+ * @param[in]  count sample count
+ * @param[out] *result pointer to a calib result structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 calib, raw, reference or result is NULL
+ *             - 3 calib is not initialized
+ *             - 4 too few usable samples
+ *             - 5 the fitted values exceed the registers
+ * @note       the raw temperature is not compensated, so the sensor may keep its current compensation
+ */
+uint8_t sen5x_calib_fit_raw(sen5x_calib_t *calib, const sen5x_raw_t *raw, const float *reference,
+                            uint32_t count, sen5x_calib_result_t *result);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
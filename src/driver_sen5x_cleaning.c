@@ -0,0 +1,623 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_cleaning.c
+ * @brief     driver sen5x cleaning source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_cleaning.h"
+
+/**
+ * @brief sen5x cleaning definition
+ */
+#define SEN5X_CLEANING_POLL_AGE_MS        2000             /**< a status read this close to a sample covers it */
+#define SEN5X_CLEANING_LEARNED_PPM        200.0            /**< chip clock error left after learning in ppm */
+#define SEN5X_CLEANING_LEARN_ERR_MS       2000             /**< max anchor uncertainty used for learning */
+#define SEN5X_CLEANING_OPEN_MS            UINT64_MAX       /**< window end while the bit is on */
+
+/**
+ * @brief      get the predicted auto cleaning window
+ * @param[in]  *cleaning pointer to a cleaning structure
+ * @param[out] *lo_ms pointer to a window start buffer
+ * @param[out] *hi_ms pointer to a window end buffer
+ * @param[out] *band_ms pointer to an uncertainty buffer
+ * @return     1 if a window is predicted
+ * @note       the window covers the start uncertainty, the cleaning and the settle time
+ */
+static uint8_t a_sen5x_cleaning_predict(sen5x_cleaning_t *cleaning, uint64_t *lo_ms, uint64_t *hi_ms, uint64_t *band_ms)
+{
+    double period;
+    double ppm;
+    uint64_t pred;
+    uint64_t band;
+
+    if ((cleaning->interval_s == 0) || (cleaning->running == 0))                       /* no auto cleaning */
+    {
+        return 0;                                                                      /* no window */
+    }
+    period = (double)cleaning->interval_s * 1000.0;                                    /* chip period in ms */
+    ppm = (cleaning->learned != 0) ? SEN5X_CLEANING_LEARNED_PPM : cleaning->drift_ppm;   /* clock error */
+    pred = cleaning->anchor_ms + (uint64_t)(period * cleaning->scale);                 /* predicted start */
+    band = cleaning->anchor_err_ms + (uint64_t)(period * ppm * 1e-6);                  /* start uncertainty */
+    *lo_ms = (pred > cleaning->anchor_ms + band) ? pred - band : cleaning->anchor_ms;   /* window start */
+    *hi_ms = pred + band + cleaning->duration_ms + cleaning->settle_ms;                /* window end */
+    *band_ms = band;                                                                   /* save the band */
+
+    return 1;                                                                          /* window */
+}
+
+/**
+ * @brief     move the prediction past the windows that are over
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @param[in] now_ms current time in ms
+ * @return    none
+ * @note      a window with a status read inside that saw no cleaning is counted as missed, without a status
+ *            read the cleaning is assumed to have happened at the predicted time
+ */
+static void a_sen5x_cleaning_roll(sen5x_cleaning_t *cleaning, uint64_t now_ms)
+{
+    uint64_t lo;
+    uint64_t hi;
+    uint64_t band;
+
+    while (a_sen5x_cleaning_predict(cleaning, &lo, &hi, &band) != 0)                   /* window predicted */
+    {
+        if ((now_ms <= hi) || (cleaning->bit != 0))                                    /* window not over */
+        {
+            return;                                                                    /* return */
+        }
+        if ((cleaning->polled != 0) && (cleaning->poll_ms >= lo))                      /* status read inside */
+        {
+            cleaning->stats.missed++;                                                  /* count the miss */
+        }
+        cleaning->anchor_ms = hi - band - cleaning->duration_ms - cleaning->settle_ms;   /* predicted start */
+        cleaning->anchor_err_ms = (uint32_t)band;                                      /* keep the uncertainty */
+    }
+}
+
+/**
+ * @brief     move the anchor
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @param[in] anchor_ms new anchor in ms
+ * @param[in] err_ms uncertainty of the anchor in ms
+ * @param[in] observed 1 if the anchor is an auto cleaning seen in the status
+ * @return    none
+ * @note      an auto cleaning with a sharp start after a sharp anchor learns the chip clock
+ */
+static void a_sen5x_cleaning_anchor(sen5x_cleaning_t *cleaning, uint64_t anchor_ms, uint32_t err_ms, uint8_t observed)
+{
+    double scale;
+
+    if ((observed != 0) && (cleaning->interval_s != 0) &&
+        (cleaning->anchor_err_ms <= SEN5X_CLEANING_LEARN_ERR_MS) &&
+        (err_ms <= SEN5X_CLEANING_LEARN_ERR_MS) && (anchor_ms > cleaning->anchor_ms))   /* sharp interval */
+    {
+        scale = (double)(anchor_ms - cleaning->anchor_ms) / ((double)cleaning->interval_s * 1000.0);   /* measured scale */
+        if (fabs(scale - 1.0) <= 2.0 * cleaning->drift_ppm * 1e-6)                     /* plausible */
+        {
+            cleaning->scale = scale;                                                   /* save the scale */
+            cleaning->learned = 1;                                                     /* set learned */
+        }
+    }
+    cleaning->anchor_ms = anchor_ms;                                                   /* set the anchor */
+    cleaning->anchor_err_ms = err_ms;                                                  /* set the uncertainty */
+}
+
+/**
+ * @brief     init the cleaning tracker
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @param[in] interval_s auto cleaning interval set in the chip, 0 when it is disabled
+ * @param[in] duration_ms fan cleaning duration in ms
+ * @param[in] settle_ms pm settle time after the cleaning in ms
+ * @param[in] drift_ppm chip clock error before it is learned in ppm
+ * @return    status code
+ *            - 0 success
+ *            - 2 cleaning is NULL
+ *            - 4 interval is invalid
+ *            - 5 duration is invalid
+ *            - 6 drift is invalid
+ * @note      interval_s is 0 or 10 <= interval_s <= 604800, duration_ms > 0, 0 <= drift_ppm <= 100000
+ */
+uint8_t sen5x_cleaning_init(sen5x_cleaning_t *cleaning, uint32_t interval_s, uint32_t duration_ms,
+                            uint32_t settle_ms, float drift_ppm)
+{
+    if (cleaning == NULL)                                                              /* check the cleaning */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((interval_s != 0) && ((interval_s < 10) || (interval_s > 604800)))             /* check the interval */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if (duration_ms == 0)                                                              /* check the duration */
+    {
+        return 5;                                                                      /* return error */
+    }
+    if (!((drift_ppm >= 0.0f) && (drift_ppm <= 100000.0f)))                            /* check the drift */
+    {
+        return 6;                                                                      /* return error */
+    }
+
+    memset(cleaning, 0, sizeof(sen5x_cleaning_t));                                     /* clear the cleaning */
+    cleaning->interval_s = interval_s;                                                 /* set the interval */
+    cleaning->duration_ms = duration_ms;                                               /* set the duration */
+    cleaning->settle_ms = settle_ms;                                                   /* set the settle time */
+    cleaning->drift_ppm = drift_ppm;                                                   /* set the drift */
+    cleaning->scale = 1.0;                                                             /* nominal chip clock */
+    cleaning->inited = 1;                                                              /* flag inited */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     tell the tracker the measurement started
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @param[in] now_ms current time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 cleaning is NULL
+ *            - 3 cleaning is not initialized
+ * @note      the auto cleaning interval of the chip counts from the measurement start and from every cleaning
+ */
+uint8_t sen5x_cleaning_measurement_started(sen5x_cleaning_t *cleaning, uint64_t now_ms)
+{
+    if (cleaning == NULL)                                                              /* check the cleaning */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (cleaning->inited != 1)                                                         /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    cleaning->running = 1;                                                             /* set running */
+    cleaning->anchor_ms = now_ms;                                                      /* interval starts now */
+    cleaning->anchor_err_ms = 0;                                                       /* sharp anchor */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     tell the tracker the measurement stopped
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 cleaning is NULL
+ *            - 3 cleaning is not initialized
+ * @note      no auto cleaning is predicted until the measurement starts again
+ */
+uint8_t sen5x_cleaning_measurement_stopped(sen5x_cleaning_t *cleaning)
+{
+    if (cleaning == NULL)                                                              /* check the cleaning */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (cleaning->inited != 1)                                                         /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    cleaning->running = 0;                                                             /* clear running */
+    cleaning->bit = 0;                                                                 /* the fan is off */
+    if ((cleaning->window != 0) && (cleaning->hi_ms == SEN5X_CLEANING_OPEN_MS))        /* open window */
+    {
+        cleaning->hi_ms = cleaning->poll_ms + cleaning->settle_ms;                     /* close the window */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     tell the tracker the auto cleaning interval changed
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @param[in] interval_s new interval set by sen5x_set_auto_cleaning_interval, 0 after sen5x_disable_auto_cleaning_interval
+ * @param[in] now_ms current time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 cleaning is NULL
+ *            - 3 cleaning is not initialized
+ *            - 4 interval is invalid
+ * @note      the interval counts from the change
+ */
+uint8_t sen5x_cleaning_set_interval(sen5x_cleaning_t *cleaning, uint32_t interval_s, uint64_t now_ms)
+{
+    if (cleaning == NULL)                                                              /* check the cleaning */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (cleaning->inited != 1)                                                         /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if ((interval_s != 0) && ((interval_s < 10) || (interval_s > 604800)))             /* check the interval */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    cleaning->interval_s = interval_s;                                                 /* set the interval */
+    cleaning->anchor_ms = now_ms;                                                      /* interval starts now */
+    cleaning->anchor_err_ms = 0;                                                       /* sharp anchor */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     tell the tracker a fan cleaning was started
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @param[in] now_ms time sen5x_start_fan_cleaning returned in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 cleaning is NULL
+ *            - 3 cleaning is not initialized
+ * @note      the window is known without a status read
+ */
+uint8_t sen5x_cleaning_started(sen5x_cleaning_t *cleaning, uint64_t now_ms)
+{
+    if (cleaning == NULL)                                                              /* check the cleaning */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (cleaning->inited != 1)                                                         /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    cleaning->stats.started++;                                                         /* count the start */
+    cleaning->lo_ms = now_ms;                                                          /* window start */
+    cleaning->hi_ms = now_ms + cleaning->duration_ms + cleaning->settle_ms;            /* window end */
+    cleaning->window = 1;                                                              /* window valid */
+    cleaning->anchor_ms = now_ms;                                                      /* interval starts now */
+    cleaning->anchor_err_ms = 0;                                                       /* sharp anchor */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      check if the status should be read
+ * @param[in]  *cleaning pointer to a cleaning structure
+ * @param[in]  now_ms current time in ms
+ * @param[out] *poll pointer to a poll buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 cleaning or poll is NULL
+ *             - 3 cleaning is not initialized
+ * @note       poll is set inside the predicted auto cleaning window and while an observed cleaning lasts,
+ *             a status read made for an other reason can be passed to sen5x_cleaning_update as well
+ */
+uint8_t sen5x_cleaning_poll(sen5x_cleaning_t *cleaning, uint64_t now_ms, uint8_t *poll)
+{
+    uint64_t lo;
+    uint64_t hi;
+    uint64_t band;
+
+    if ((cleaning == NULL) || (poll == NULL))                                          /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (cleaning->inited != 1)                                                         /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    a_sen5x_cleaning_roll(cleaning, now_ms);                                           /* drop the old windows */
+    *poll = cleaning->bit;                                                             /* follow a cleaning */
+    if ((a_sen5x_cleaning_predict(cleaning, &lo, &hi, &band) != 0) &&
+        (now_ms >= lo) && (now_ms <= hi))                                              /* inside the window */
+    {
+        *poll = 1;                                                                     /* read the status */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     feed a status read
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @param[in] now_ms time of the read in ms
+ * @param[in] status device status read by sen5x_get_device_status
+ * @return    status code
+ *            - 0 success
+ *            - 2 cleaning is NULL
+ *            - 3 cleaning is not initialized
+ * @note      an observed auto cleaning moves the prediction and learns the chip clock when its start is sharp
+ */
+uint8_t sen5x_cleaning_update(sen5x_cleaning_t *cleaning, uint64_t now_ms, uint32_t status)
+{
+    uint64_t lo;
+
+    if (cleaning == NULL)                                                              /* check the cleaning */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (cleaning->inited != 1)                                                         /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    cleaning->stats.polls++;                                                           /* count the read */
+    if ((status & SEN5X_STATUS_FAN_CLEANING_ACTIVE) != 0)                              /* cleaning on */
+    {
+        if (cleaning->bit == 0)                                                        /* rising edge */
+        {
+            if ((cleaning->window != 0) && (now_ms >= cleaning->lo_ms) && (now_ms <= cleaning->hi_ms))   /* started cleaning */
+            {
+                cleaning->hi_ms = SEN5X_CLEANING_OPEN_MS;                              /* keep it open */
+            }
+            else
+            {
+                lo = (now_ms > cleaning->duration_ms) ? now_ms - cleaning->duration_ms : 0;   /* earliest start */
+                if ((cleaning->polled != 0) && (cleaning->idle_ms > lo))               /* later idle read */
+                {
+                    lo = cleaning->idle_ms;                                            /* sharper start */
+                }
+                cleaning->lo_ms = lo;                                                  /* window start */
+                cleaning->hi_ms = SEN5X_CLEANING_OPEN_MS;                              /* open until the bit clears */
+                cleaning->window = 1;                                                  /* window valid */
+                cleaning->stats.observed++;                                            /* count the cleaning */
+                a_sen5x_cleaning_anchor(cleaning, lo + (now_ms - lo) / 2,
+                                        (uint32_t)((now_ms - lo) / 2), 1);             /* move the anchor */
+            }
+        }
+        cleaning->bit = 1;                                                             /* set the bit */
+    }
+    else
+    {
+        if ((cleaning->bit != 0) && (cleaning->window != 0) &&
+            (cleaning->hi_ms == SEN5X_CLEANING_OPEN_MS))                               /* falling edge */
+        {
+            cleaning->hi_ms = now_ms + cleaning->settle_ms;                            /* close the window */
+        }
+        cleaning->bit = 0;                                                             /* clear the bit */
+        cleaning->idle_ms = now_ms;                                                    /* save the idle read */
+    }
+    cleaning->poll_ms = now_ms;                                                        /* save the read */
+    cleaning->polled = 1;                                                              /* status seen */
+    a_sen5x_cleaning_roll(cleaning, now_ms);                                           /* drop the old windows */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      tag a sample
+ * @param[in]  *cleaning pointer to a cleaning structure
+ * @param[in]  sample_ms time of the sample in ms
+ * @param[out] *tag pointer to a tag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 cleaning or tag is NULL
+ *             - 3 cleaning is not initialized
+ * @note       feed the status read of the cycle before the sample is tagged, a sample inside the predicted
+ *             window is tagged predicted when no status was read within 2 s of it
+ */
+uint8_t sen5x_cleaning_check(sen5x_cleaning_t *cleaning, uint64_t sample_ms, sen5x_cleaning_tag_t *tag)
+{
+    uint64_t lo;
+    uint64_t hi;
+    uint64_t band;
+
+    if ((cleaning == NULL) || (tag == NULL))                                           /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (cleaning->inited != 1)                                                         /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    a_sen5x_cleaning_roll(cleaning, sample_ms);                                        /* drop the old windows */
+    cleaning->stats.samples++;                                                         /* count the sample */
+    *tag = SEN5X_CLEANING_TAG_NONE;                                                    /* init the tag */
+    if ((cleaning->window != 0) && (sample_ms >= cleaning->lo_ms) && (sample_ms <= cleaning->hi_ms))   /* known window */
+    {
+        *tag = SEN5X_CLEANING_TAG_ACTIVE;                                              /* active */
+        cleaning->stats.active++;                                                      /* count it */
+    }
+    else if ((a_sen5x_cleaning_predict(cleaning, &lo, &hi, &band) != 0) && (sample_ms >= lo) && (sample_ms <= hi) &&
+             ((cleaning->polled == 0) || (cleaning->poll_ms + SEN5X_CLEANING_POLL_AGE_MS < sample_ms) ||
+              (cleaning->poll_ms > sample_ms + SEN5X_CLEANING_POLL_AGE_MS)))           /* unchecked prediction */
+    {
+        *tag = SEN5X_CLEANING_TAG_PREDICTED;                                           /* predicted */
+        cleaning->stats.predicted++;                                                   /* count it */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief         clear pm_valid of a sen55 sample in a cleaning window
+ * @param[in]     *cleaning pointer to a cleaning structure
+ * @param[in]     sample_ms time of the sample in ms
+ * @param[in,out] *data pointer to a sen55 data structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 cleaning or data is NULL
+ *                - 3 cleaning is not initialized
+ * @note          active and predicted samples are masked, the aggregates skip samples without pm_valid
+ */
+uint8_t sen5x_cleaning_mask_sen55(sen5x_cleaning_t *cleaning, uint64_t sample_ms, sen55_data_t *data)
+{
+    uint8_t res;
+    sen5x_cleaning_tag_t tag;
+
+    if (data == NULL)                                                                  /* check the data */
+    {
+        return 2;                                                                      /* return error */
+    }
+    res = sen5x_cleaning_check(cleaning, sample_ms, &tag);                             /* tag the sample */
+    if (res != 0)                                                                      /* check the result */
+    {
+        return res;                                                                    /* return error */
+    }
+    if (tag != SEN5X_CLEANING_TAG_NONE)                                                /* in a window */
+    {
+        data->pm_valid = 0;                                                            /* set invalid */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief         clear pm_valid of a sen54 sample in a cleaning window
+ * @param[in]     *cleaning pointer to a cleaning structure
+ * @param[in]     sample_ms time of the sample in ms
+ * @param[in,out] *data pointer to a sen54 data structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 cleaning or data is NULL
+ *                - 3 cleaning is not initialized
+ * @note          active and predicted samples are masked, the aggregates skip samples without pm_valid
+ */
+uint8_t sen5x_cleaning_mask_sen54(sen5x_cleaning_t *cleaning, uint64_t sample_ms, sen54_data_t *data)
+{
+    uint8_t res;
+    sen5x_cleaning_tag_t tag;
+
+    if (data == NULL)                                                                  /* check the data */
+    {
+        return 2;                                                                      /* return error */
+    }
+    res = sen5x_cleaning_check(cleaning, sample_ms, &tag);                             /* tag the sample */
+    if (res != 0)                                                                      /* check the result */
+    {
+        return res;                                                                    /* return error */
+    }
+    if (tag != SEN5X_CLEANING_TAG_NONE)                                                /* in a window */
+    {
+        data->pm_valid = 0;                                                            /* set invalid */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief         clear pm_valid of a sen50 sample in a cleaning window
+ * @param[in]     *cleaning pointer to a cleaning structure
+ * @param[in]     sample_ms time of the sample in ms
+ * @param[in,out] *data pointer to a sen50 data structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 cleaning or data is NULL
+ *                - 3 cleaning is not initialized
+ * @note          active and predicted samples are masked, the aggregates skip samples without pm_valid
+ */
+uint8_t sen5x_cleaning_mask_sen50(sen5x_cleaning_t *cleaning, uint64_t sample_ms, sen50_data_t *data)
+{
+    uint8_t res;
+    sen5x_cleaning_tag_t tag;
+
+    if (data == NULL)                                                                  /* check the data */
+    {
+        return 2;                                                                      /* return error */
+    }
+    res = sen5x_cleaning_check(cleaning, sample_ms, &tag);                             /* tag the sample */
+    if (res != 0)                                                                      /* check the result */
+    {
+        return res;                                                                    /* return error */
+    }
+    if (tag != SEN5X_CLEANING_TAG_NONE)                                                /* in a window */
+    {
+        data->pm_valid = 0;                                                            /* set invalid */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief         clear pm_valid of a pm sample in a cleaning window
+ * @param[in]     *cleaning pointer to a cleaning structure
+ * @param[in]     sample_ms time of the sample in ms
+ * @param[in,out] *pm pointer to a sen5x pm structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 cleaning or pm is NULL
+ *                - 3 cleaning is not initialized
+ * @note          active and predicted samples are masked, the aggregates skip samples without pm_valid
+ */
+uint8_t sen5x_cleaning_mask_pm(sen5x_cleaning_t *cleaning, uint64_t sample_ms, sen5x_pm_t *pm)
+{
+    uint8_t res;
+    sen5x_cleaning_tag_t tag;
+
+    if (pm == NULL)                                                                    /* check the pm */
+    {
+        return 2;                                                                      /* return error */
+    }
+    res = sen5x_cleaning_check(cleaning, sample_ms, &tag);                             /* tag the sample */
+    if (res != 0)                                                                      /* check the result */
+    {
+        return res;                                                                    /* return error */
+    }
+    if (tag != SEN5X_CLEANING_TAG_NONE)                                                /* in a window */
+    {
+        pm->pm_valid = 0;                                                              /* set invalid */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the tracker statistics
+ * @param[in]  *cleaning pointer to a cleaning structure
+ * @param[out] *stats pointer to a cleaning stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 cleaning or stats is NULL
+ *             - 3 cleaning is not initialized
+ * @note       none
+ */
+uint8_t sen5x_cleaning_get_stats(sen5x_cleaning_t *cleaning, sen5x_cleaning_stats_t *stats)
+{
+    uint64_t lo;
+    uint64_t hi;
+    uint64_t band;
+
+    if ((cleaning == NULL) || (stats == NULL))                                         /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (cleaning->inited != 1)                                                         /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    *stats = cleaning->stats;                                                          /* copy the stats */
+    stats->drift_ppm = (cleaning->learned != 0) ? (float)((cleaning->scale - 1.0) * 1e6) : 0.0f;   /* learned drift */
+    stats->next_ms = 0;                                                                /* init the prediction */
+    stats->band_ms = 0;                                                                /* init the band */
+    if (a_sen5x_cleaning_predict(cleaning, &lo, &hi, &band) != 0)                      /* window predicted */
+    {
+        stats->next_ms = hi - band - cleaning->duration_ms - cleaning->settle_ms;      /* predicted start */
+        stats->band_ms = (uint32_t)band;                                               /* uncertainty */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
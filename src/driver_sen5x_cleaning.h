@@ -0,0 +1,293 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_cleaning.h
+ * @brief     driver sen5x cleaning header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_CLEANING_H
+#define DRIVER_SEN5X_CLEANING_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_cleaning_driver sen5x cleaning driver function
+ * @brief    sen5x cleaning driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x cleaning definition
+ */
+#define SEN5X_CLEANING_DEFAULT_INTERVAL_S        604800         /**< auto cleaning interval of the chip in s */
+#define SEN5X_CLEANING_DEFAULT_DURATION_MS       10000          /**< fan cleaning duration in ms */
+#define SEN5X_CLEANING_DEFAULT_SETTLE_MS         2000           /**< pm settle time after the cleaning in ms */
+#define SEN5X_CLEANING_DEFAULT_DRIFT_PPM         10000.0f       /**< chip clock error before it is learned in ppm */
+
+/**
+ * @brief sen5x cleaning tag enumeration definition
+ */
+typedef enum
+{
+    SEN5X_CLEANING_TAG_NONE      = 0x00,        /**< no cleaning */
+    SEN5X_CLEANING_TAG_ACTIVE    = 0x01,        /**< inside a started or observed cleaning window */
+    SEN5X_CLEANING_TAG_PREDICTED = 0x02,        /**< inside the predicted auto cleaning window without a status read */
+} sen5x_cleaning_tag_t;
+
+/**
+ * @brief sen5x cleaning stats structure definition
+ */
+typedef struct sen5x_cleaning_stats_s
+{
+    uint64_t polls;                     /**< status reads */
+    uint64_t samples;                   /**< checked samples */
+    uint64_t active;                    /**< samples tagged active */
+    uint64_t predicted;                 /**< samples tagged predicted */
+    uint32_t started;                   /**< started cleanings */
+    uint32_t observed;                  /**< auto cleanings seen in the status */
+    uint32_t missed;                    /**< predicted windows passed without a cleaning */
+    float drift_ppm;                    /**< learned chip clock error, 0 before it is learned */
+    uint64_t next_ms;                   /**< predicted start of the next auto cleaning, 0 when disabled */
+    uint32_t band_ms;                   /**< uncertainty of the prediction */
+} sen5x_cleaning_stats_t;
+
+/**
+ * @brief sen5x cleaning structure definition
+ */
+typedef struct sen5x_cleaning_s
+{
+    uint32_t interval_s;                /**< auto cleaning interval, 0 when disabled */
+    uint32_t duration_ms;               /**< fan cleaning duration */
+    uint32_t settle_ms;                 /**< pm settle time after the cleaning */
+    float drift_ppm;                    /**< chip clock error before it is learned */
+    double scale;                       /**< host ms per chip ms */
+    uint8_t learned;                    /**< scale learned */
+    uint8_t running;                    /**< measurement running */
+    uint64_t anchor_ms;                 /**< start of the current auto interval */
+    uint32_t anchor_err_ms;             /**< uncertainty of the anchor */
+    uint64_t lo_ms;                     /**< start of the last cleaning window */
+    uint64_t hi_ms;                     /**< end of the last cleaning window, max while the bit is on */
+    uint8_t window;                     /**< cleaning window valid */
+    uint8_t bit;                        /**< last status read shows the cleaning */
+    uint64_t poll_ms;                   /**< time of the last status read */
+    uint64_t idle_ms;                   /**< time of the last status read without the cleaning */
+    uint8_t polled;                     /**< status read seen */
+    sen5x_cleaning_stats_t stats;       /**< stats */
+    uint8_t inited;                     /**< inited flag */
+} sen5x_cleaning_t;
+
+/**
+ * @brief     init the cleaning tracker
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @param[in] interval_s auto cleaning interval set in the chip, 0 when it is disabled
+ * @param[in] duration_ms fan cleaning duration in ms
+ * @param[in] settle_ms pm settle time after the cleaning in ms
+ * @param[in] drift_ppm chip clock error before it is learned in ppm
+ * @return    status code
+ *            - 0 success
+ *            - 2 cleaning is NULL
+ *            - 4 interval is invalid
+ *            - 5 duration is invalid
+ *            - 6 drift is invalid
+ * @note      interval_s is 0 or 10 <= interval_s <= 604800, duration_ms > 0, 0 <= drift_ppm <= 100000
+ */
+uint8_t sen5x_cleaning_init(sen5x_cleaning_t *cleaning, uint32_t interval_s, uint32_t duration_ms,
+                            uint32_t settle_ms, float drift_ppm);
+
+/**
+ * @brief     tell the tracker the measurement started
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @param[in] now_ms current time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 cleaning is NULL
+ *            - 3 cleaning is not initialized
+ * @note      the auto cleaning interval of the chip counts from the measurement start and from every cleaning
+ */
+uint8_t sen5x_cleaning_measurement_started(sen5x_cleaning_t *cleaning, uint64_t now_ms);
+
+/**
+ * @brief     tell the tracker the measurement stopped
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 cleaning is NULL
+ *            - 3 cleaning is not initialized
+ * @note      no auto cleaning is predicted until the measurement starts again
+ */
+uint8_t sen5x_cleaning_measurement_stopped(sen5x_cleaning_t *cleaning);
+
+/**
+ * @brief     tell the tracker the auto cleaning interval changed
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @param[in] interval_s new interval set by sen5x_set_auto_cleaning_interval, 0 after sen5x_disable_auto_cleaning_interval
+ * @param[in] now_ms current time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 cleaning is NULL
+ *            - 3 cleaning is not initialized
+ *            - 4 interval is invalid
+ * @note      the interval counts from the change
+ */
+uint8_t sen5x_cleaning_set_interval(sen5x_cleaning_t *cleaning, uint32_t interval_s, uint64_t now_ms);
+
+/**
+ * @brief     tell the tracker a fan cleaning was started
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @param[in] now_ms time sen5x_start_fan_cleaning returned in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 cleaning is NULL
+ *            - 3 cleaning is not initialized
+ * @note      the window is known without a status read
+ */
+uint8_t sen5x_cleaning_started(sen5x_cleaning_t *cleaning, uint64_t now_ms);
+
+/**
+ * @brief      check if the status should be read
+ * @param[in]  *cleaning pointer to a cleaning structure
+ * @param[in]  now_ms current time in ms
+ * @param[out] *poll pointer to a poll buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 cleaning or poll is NULL
+ *             - 3 cleaning is not initialized
+ * @note       poll is set inside the predicted auto cleaning window and while an observed cleaning lasts,
+ *             a status read made for an other reason can be passed to sen5x_cleaning_update as well
+ */
+uint8_t sen5x_cleaning_poll(sen5x_cleaning_t *cleaning, uint64_t now_ms, uint8_t *poll);
+
+/**
+ * @brief     feed a status read
+ * @param[in] *cleaning pointer to a cleaning structure
+ * @param[in] now_ms time of the read in ms
+ * @param[in] status device status read by sen5x_get_device_status
+ * @return    status code
+ *            - 0 success
+ *            - 2 cleaning is NULL
+ *            - 3 cleaning is not initialized
+ * @note      an observed auto cleaning moves the prediction and learns the chip clock when its start is sharp
+ */
+uint8_t sen5x_cleaning_update(sen5x_cleaning_t *cleaning, uint64_t now_ms, uint32_t status);
+
+/**
+ * @brief      tag a sample
+ * @param[in]  *cleaning pointer to a cleaning structure
+ * @param[in]  sample_ms time of the sample in ms
+ * @param[out] *tag pointer to a tag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 cleaning or tag is NULL
+ *             - 3 cleaning is not initialized
+ * @note       feed the status read of the cycle before the sample is tagged, a sample inside the predicted
+ *             window is tagged predicted when no status was read within 2 s of it
+ */
+uint8_t sen5x_cleaning_check(sen5x_cleaning_t *cleaning, uint64_t sample_ms, sen5x_cleaning_tag_t *tag);
+
+/**
+ * @brief         clear pm_valid of a sen55 sample in a cleaning window
+ * @param[in]     *cleaning pointer to a cleaning structure
+ * @param[in]     sample_ms time of the sample in ms
+ * @param[in,out] *data pointer to a sen55 data structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 cleaning or data is NULL
+ *                - 3 cleaning is not initialized
+ * @note          active and predicted samples are masked, the aggregates skip samples without pm_valid
+ */
+uint8_t sen5x_cleaning_mask_sen55(sen5x_cleaning_t *cleaning, uint64_t sample_ms, sen55_data_t *data);
+
+/**
+ * @brief         clear pm_valid of a sen54 sample in a cleaning window
+ * @param[in]     *cleaning pointer to a cleaning structure
+ * @param[in]     sample_ms time of the sample in ms
+ * @param[in,out] *data pointer to a sen54 data structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 cleaning or data is NULL
+ *                - 3 cleaning is not initialized
+ * @note          active and predicted samples are masked, the aggregates skip samples without pm_valid
+ */
+uint8_t sen5x_cleaning_mask_sen54(sen5x_cleaning_t *cleaning, uint64_t sample_ms, sen54_data_t *data);
+
+/**
+ * @brief         clear pm_valid of a sen50 sample in a cleaning window
+ * @param[in]     *cleaning pointer to a cleaning structure
+ * @param[in]     sample_ms time of the sample in ms
+ * @param[in,out] *data pointer to a sen50 data structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 cleaning or data is NULL
+ *                - 3 cleaning is not initialized
+ * @note          active and predicted samples are masked, the aggregates skip samples without pm_valid
+ */
+uint8_t sen5x_cleaning_mask_sen50(sen5x_cleaning_t *cleaning, uint64_t sample_ms, sen50_data_t *data);
+
+/**
+ * @brief         clear pm_valid of a pm sample in a cleaning window
+ * @param[in]     *cleaning pointer to a cleaning structure
+ * @param[in]     sample_ms time of the sample in ms
+ * @param[in,out] *pm pointer to a sen5x pm structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 cleaning or pm is NULL
+ *                - 3 cleaning is not initialized
+ * @note          active and predicted samples are masked, the aggregates skip samples without pm_valid
+ */
+uint8_t sen5x_cleaning_mask_pm(sen5x_cleaning_t *cleaning, uint64_t sample_ms, sen5x_pm_t *pm);
+
+/**
+ * @brief      get the tracker statistics
+ * @param[in]  *cleaning pointer to a cleaning structure
+ * @param[out] *stats pointer to a cleaning stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 cleaning or stats is NULL
+ *             - 3 cleaning is not initialized
+ * @note       none
+ */
+uint8_t sen5x_cleaning_get_stats(sen5x_cleaning_t *cleaning, sen5x_cleaning_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,502 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_duty.c
+ * @brief     driver sen5x duty source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_duty.h"
+
+/**
+ * @brief sen5x duty definition
+ */
+#define SEN5X_DUTY_BASELINE_S        3600.0f        /**< time constant of the gas baseline in s */
+#define SEN5X_DUTY_MIN_INDEX         1.0f           /**< smallest index of a warmed up gas signal */
+
+/**
+ * @brief     account the time up to now
+ * @param[in] *duty pointer to a duty structure
+ * @param[in] now_ms current time in ms
+ * @note      the time of a pm mode splits at the end of the stabilisation
+ */
+static void a_sen5x_duty_account(sen5x_duty_t *duty, uint64_t now_ms)
+{
+    uint64_t trusted;
+
+    if (now_ms <= duty->last_ms)                                                       /* nothing passed */
+    {
+        return;                                                                        /* return */
+    }
+    if (duty->running == 0)                                                            /* idle */
+    {
+        duty->last_ms = now_ms;                                                        /* skip the time */
+
+        return;                                                                        /* return */
+    }
+    if (duty->pm != 0)                                                                 /* pm mode */
+    {
+        trusted = duty->start_ms + duty->settle_ms;                                    /* end of the stabilisation */
+        if (duty->last_ms < trusted)                                                   /* settling */
+        {
+            duty->stats.settle_ms += ((now_ms < trusted) ? now_ms : trusted) - duty->last_ms;   /* settle time */
+        }
+        if (now_ms > trusted)                                                          /* trusted */
+        {
+            duty->stats.pm_ms += now_ms - ((duty->last_ms > trusted) ? duty->last_ms : trusted);   /* pm time */
+        }
+    }
+    else
+    {
+        duty->stats.gas_ms += now_ms - duty->last_ms;                                  /* gas time */
+    }
+    duty->last_ms = now_ms;                                                            /* save the time */
+}
+
+/**
+ * @brief     init the duty cycle controller
+ * @param[in] *duty pointer to a duty structure
+ * @param[in] period_s scheduled pm window period in s
+ * @param[in] window_ms trusted pm time of a window in ms
+ * @param[in] settle_ms pm stabilisation time in ms
+ * @param[in] voc_jump voc index rise over its baseline that starts a window
+ * @param[in] nox_jump nox index rise over its baseline that starts a window, 0 to ignore nox
+ * @return    status code
+ *            - 0 success
+ *            - 2 duty is NULL
+ *            - 4 period is invalid
+ *            - 5 window is invalid
+ *            - 6 jump is invalid
+ * @note      10 <= period_s <= 86400, 0 < window_ms, settle_ms + window_ms <= period_s * 1000, voc_jump > 0,
+ *            nox_jump >= 0, the currents start at SEN5X_POWER_CURRENT_RHT_GAS_MA and SEN5X_POWER_CURRENT_MEASUREMENT_MA
+ */
+uint8_t sen5x_duty_init(sen5x_duty_t *duty, uint32_t period_s, uint32_t window_ms, uint32_t settle_ms,
+                        float voc_jump, float nox_jump)
+{
+    if (duty == NULL)                                                                  /* check the duty */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((period_s < 10) || (period_s > 86400))                                         /* check the period */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if ((window_ms == 0) || ((uint64_t)settle_ms + window_ms > (uint64_t)period_s * 1000))   /* check the window */
+    {
+        return 5;                                                                      /* return error */
+    }
+    if ((!(voc_jump > 0.0f)) || (!(nox_jump >= 0.0f)))                                 /* check the jumps */
+    {
+        return 6;                                                                      /* return error */
+    }
+
+    memset(duty, 0, sizeof(sen5x_duty_t));                                             /* clear the duty */
+    duty->period_s = period_s;                                                         /* set the period */
+    duty->window_ms = window_ms;                                                       /* set the window */
+    duty->settle_ms = settle_ms;                                                       /* set the settle time */
+    duty->voc_jump = voc_jump;                                                         /* set the voc jump */
+    duty->nox_jump = nox_jump;                                                         /* set the nox jump */
+    duty->gas_ma = SEN5X_POWER_CURRENT_RHT_GAS_MA;                                     /* set the gas current */
+    duty->pm_ma = SEN5X_POWER_CURRENT_MEASUREMENT_MA;                                  /* set the pm current */
+    duty->inited = 1;                                                                  /* flag inited */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     set the mode currents of the energy estimate
+ * @param[in] *duty pointer to a duty structure
+ * @param[in] gas_ma rht and gas only measurement current in mA
+ * @param[in] pm_ma measurement current in mA
+ * @return    status code
+ *            - 0 success
+ *            - 2 duty is NULL
+ *            - 3 duty is not initialized
+ *            - 4 current is invalid
+ * @note      0 <= gas_ma <= pm_ma
+ */
+uint8_t sen5x_duty_set_current(sen5x_duty_t *duty, float gas_ma, float pm_ma)
+{
+    if (duty == NULL)                                                                  /* check the duty */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (duty->inited != 1)                                                             /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if ((!(gas_ma >= 0.0f)) || (!(pm_ma >= gas_ma)))                                   /* check the currents */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    duty->gas_ma = gas_ma;                                                             /* set the gas current */
+    duty->pm_ma = pm_ma;                                                               /* set the pm current */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     take the mode currents of the energy estimate from a driver handle
+ * @param[in] *duty pointer to a duty structure
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 get current failed
+ *            - 2 duty or handle is NULL
+ *            - 3 duty is not initialized
+ *            - 4 current is invalid
+ * @note      uses the rht/gas-only and measurement currents of sen5x_set_power_current, so the estimate
+ *            matches sen5x_get_energy
+ */
+uint8_t sen5x_duty_set_current_from_handle(sen5x_duty_t *duty, sen5x_handle_t *handle)
+{
+    float gas_ma;
+    float pm_ma;
+
+    if ((duty == NULL) || (handle == NULL))                                            /* check the duty and handle */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (duty->inited != 1)                                                             /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if ((sen5x_get_power_current(handle, SEN5X_POWER_MODE_RHT_GAS, &gas_ma) != 0) ||
+        (sen5x_get_power_current(handle, SEN5X_POWER_MODE_MEASUREMENT, &pm_ma) != 0))   /* get the currents */
+    {
+        return 1;                                                                      /* return error */
+    }
+
+    return sen5x_duty_set_current(duty, gas_ma, pm_ma);                                /* set the currents */
+}
+
+/**
+ * @brief      get the mode the sensor should run now
+ * @param[in]  *duty pointer to a duty structure
+ * @param[in]  now_ms current time in ms
+ * @param[out] *action pointer to an action buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 duty or action is NULL
+ *             - 3 duty is not initialized
+ * @note       the first poll starts the rht and gas only mode, a pm window starts on the schedule or after a
+ *             gas jump and ends window_ms after the pm is trusted, run the command of the action and tell the
+ *             controller with sen5x_duty_switched, the action repeats until then
+ */
+uint8_t sen5x_duty_poll(sen5x_duty_t *duty, uint64_t now_ms, sen5x_duty_action_t *action)
+{
+    if ((duty == NULL) || (action == NULL))                                            /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (duty->inited != 1)                                                             /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    a_sen5x_duty_account(duty, now_ms);                                                /* account the time */
+    *action = SEN5X_DUTY_ACTION_NONE;                                                  /* init the action */
+    if (duty->running == 0)                                                            /* not started */
+    {
+        *action = SEN5X_DUTY_ACTION_GAS;                                               /* start the gas mode */
+    }
+    else if (duty->pm == 0)                                                            /* gas mode */
+    {
+        if ((duty->pending != 0) || (now_ms >= duty->next_ms))                         /* jump or schedule */
+        {
+            *action = SEN5X_DUTY_ACTION_PM;                                            /* start a window */
+        }
+    }
+    else
+    {
+        if (now_ms >= duty->end_ms)                                                    /* window over */
+        {
+            *action = SEN5X_DUTY_ACTION_GAS;                                           /* back to the gas mode */
+        }
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     tell the controller the mode was switched
+ * @param[in] *duty pointer to a duty structure
+ * @param[in] action action that was run
+ * @param[in] now_ms time the command returned in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 duty is NULL
+ *            - 3 duty is not initialized
+ *            - 4 action is invalid
+ * @note      the pm is trusted settle_ms after the switch to the measurement mode
+ */
+uint8_t sen5x_duty_switched(sen5x_duty_t *duty, sen5x_duty_action_t action, uint64_t now_ms)
+{
+    if (duty == NULL)                                                                  /* check the duty */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (duty->inited != 1)                                                             /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if ((action != SEN5X_DUTY_ACTION_GAS) && (action != SEN5X_DUTY_ACTION_PM))         /* check the action */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    a_sen5x_duty_account(duty, now_ms);                                                /* account the time */
+    if (action == SEN5X_DUTY_ACTION_PM)                                                /* pm mode */
+    {
+        if (duty->pending != 0)                                                        /* started by a jump */
+        {
+            duty->stats.triggered++;                                                   /* count it */
+        }
+        else
+        {
+            duty->stats.scheduled++;                                                   /* count it */
+        }
+        duty->pm = 1;                                                                  /* set the pm mode */
+        duty->pending = 0;                                                             /* clear the jump */
+        duty->start_ms = now_ms;                                                       /* set the start */
+        duty->end_ms = now_ms + duty->settle_ms + duty->window_ms;                     /* set the end */
+        duty->next_ms = now_ms + (uint64_t)duty->period_s * 1000;                      /* next scheduled window */
+    }
+    else
+    {
+        duty->pm = 0;                                                                  /* set the gas mode */
+    }
+    duty->running = 1;                                                                 /* set running */
+    duty->last_ms = now_ms;                                                            /* account from now */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      feed the gas indices of a sample
+ * @param[in]  *duty pointer to a duty structure
+ * @param[in]  now_ms time of the sample in ms
+ * @param[in]  voc_index voc index of the sample
+ * @param[in]  nox_index nox index of the sample
+ * @param[out] *trust pointer to a trust buffer, 1 when the pm of the sample can be used
+ * @return     status code
+ *             - 0 success
+ *             - 2 duty or trust is NULL
+ *             - 3 duty is not initialized
+ * @note       the indices are compared with a baseline that follows them with a time constant of one hour,
+ *             a rising jump in the gas mode starts a window at the next poll, a rising jump in a window
+ *             extends it, a jump ends below half of its threshold
+ */
+uint8_t sen5x_duty_update(sen5x_duty_t *duty, uint64_t now_ms, float voc_index, float nox_index, uint8_t *trust)
+{
+    uint8_t jump;
+    float alpha;
+    float scale;
+    uint64_t end;
+
+    if ((duty == NULL) || (trust == NULL))                                             /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (duty->inited != 1)                                                             /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    a_sen5x_duty_account(duty, now_ms);                                                /* account the time */
+    jump = 0;                                                                          /* init the jump */
+    if (voc_index >= SEN5X_DUTY_MIN_INDEX)                                             /* warmed up */
+    {
+        if (duty->based == 0)                                                          /* first sample */
+        {
+            duty->voc_base = voc_index;                                                /* init the voc baseline */
+            duty->nox_base = fmaxf(nox_index, SEN5X_DUTY_MIN_INDEX);                    /* init the nox baseline */
+            duty->base_ms = now_ms;                                                    /* save the time */
+            duty->based = 1;                                                           /* baseline valid */
+        }
+        else if (now_ms > duty->base_ms)                                               /* time passed */
+        {
+            alpha = (float)(now_ms - duty->base_ms) / 1000.0f;                         /* elapsed time */
+            alpha = alpha / (SEN5X_DUTY_BASELINE_S + alpha);                           /* baseline weight */
+            duty->voc_base += alpha * (voc_index - duty->voc_base);                    /* follow the voc */
+            if (nox_index >= SEN5X_DUTY_MIN_INDEX)                                     /* nox warmed up */
+            {
+                duty->nox_base += alpha * (nox_index - duty->nox_base);                /* follow the nox */
+            }
+            duty->base_ms = now_ms;                                                    /* save the time */
+        }
+        scale = (duty->jump != 0) ? 0.5f : 1.0f;                                       /* hysteresis while risen */
+        if (voc_index - duty->voc_base >= duty->voc_jump * scale)                      /* voc jump */
+        {
+            jump = 1;                                                                  /* set the jump */
+        }
+        if ((duty->nox_jump > 0.0f) && (nox_index >= SEN5X_DUTY_MIN_INDEX) &&
+            (nox_index - duty->nox_base >= duty->nox_jump * scale))                    /* nox jump */
+        {
+            jump = 1;                                                                  /* set the jump */
+        }
+    }
+    if ((jump != 0) && (duty->jump == 0) && (duty->running != 0))                      /* new jump while running */
+    {
+        if (duty->pm != 0)                                                             /* in a window */
+        {
+            end = now_ms + duty->window_ms;                                            /* extended end */
+            if (end > duty->end_ms)                                                    /* later */
+            {
+                duty->end_ms = end;                                                    /* extend the window */
+                duty->stats.extended++;                                                /* count it */
+            }
+        }
+        else
+        {
+            duty->pending = 1;                                                         /* start a window */
+        }
+    }
+    duty->jump = jump;                                                                 /* save the jump */
+    *trust = ((duty->pm != 0) && (now_ms >= duty->start_ms + duty->settle_ms)) ? 1 : 0;   /* pm settled */
+    duty->stats.samples++;                                                             /* count the sample */
+    if (*trust == 0)                                                                   /* not trusted */
+    {
+        duty->stats.masked++;                                                          /* count it */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief         feed a sen55 sample and clear its pm_valid when the pm is not trusted
+ * @param[in]     *duty pointer to a duty structure
+ * @param[in]     now_ms time of the sample in ms
+ * @param[in,out] *data pointer to a sen55 data structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 duty or data is NULL
+ *                - 3 duty is not initialized
+ * @note          the aggregates skip samples without pm_valid
+ */
+uint8_t sen5x_duty_update_sen55(sen5x_duty_t *duty, uint64_t now_ms, sen55_data_t *data)
+{
+    uint8_t res;
+    uint8_t trust;
+
+    if (data == NULL)                                                                  /* check the data */
+    {
+        return 2;                                                                      /* return error */
+    }
+    res = sen5x_duty_update(duty, now_ms, data->voc_index, data->nox_index, &trust);   /* feed the sample */
+    if (res != 0)                                                                      /* check the result */
+    {
+        return res;                                                                    /* return error */
+    }
+    if (trust == 0)                                                                    /* not trusted */
+    {
+        data->pm_valid = 0;                                                            /* set invalid */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief         feed a sen54 sample and clear its pm_valid when the pm is not trusted
+ * @param[in]     *duty pointer to a duty structure
+ * @param[in]     now_ms time of the sample in ms
+ * @param[in,out] *data pointer to a sen54 data structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 duty or data is NULL
+ *                - 3 duty is not initialized
+ * @note          the sen54 has no nox, the aggregates skip samples without pm_valid
+ */
+uint8_t sen5x_duty_update_sen54(sen5x_duty_t *duty, uint64_t now_ms, sen54_data_t *data)
+{
+    uint8_t res;
+    uint8_t trust;
+
+    if (data == NULL)                                                                  /* check the data */
+    {
+        return 2;                                                                      /* return error */
+    }
+    res = sen5x_duty_update(duty, now_ms, data->voc_index, 0.0f, &trust);              /* feed the sample */
+    if (res != 0)                                                                      /* check the result */
+    {
+        return res;                                                                    /* return error */
+    }
+    if (trust == 0)                                                                    /* not trusted */
+    {
+        data->pm_valid = 0;                                                            /* set invalid */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the controller statistics
+ * @param[in]  *duty pointer to a duty structure
+ * @param[in]  now_ms current time in ms
+ * @param[out] *stats pointer to a duty stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 duty or stats is NULL
+ *             - 3 duty is not initialized
+ * @note       the time is accounted up to now_ms, the energy uses the supply of SEN5X_DUTY_DEFAULT_SUPPLY_V
+ */
+uint8_t sen5x_duty_get_stats(sen5x_duty_t *duty, uint64_t now_ms, sen5x_duty_stats_t *stats)
+{
+    uint64_t on;
+    uint64_t total;
+
+    if ((duty == NULL) || (stats == NULL))                                             /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (duty->inited != 1)                                                             /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    a_sen5x_duty_account(duty, now_ms);                                                /* account the time */
+    *stats = duty->stats;                                                              /* copy the stats */
+    on = stats->settle_ms + stats->pm_ms;                                              /* fan on time */
+    total = stats->gas_ms + on;                                                        /* running time */
+    stats->charge_mah = (float)(((double)stats->gas_ms * duty->gas_ma +
+                                 (double)on * duty->pm_ma) / 3600000.0);               /* charge */
+    stats->energy_mwh = stats->charge_mah * SEN5X_DUTY_DEFAULT_SUPPLY_V;               /* energy */
+    stats->duty = 0.0f;                                                                /* init the duty */
+    stats->average_ma = 0.0f;                                                          /* init the current */
+    if (total != 0)                                                                    /* time passed */
+    {
+        stats->duty = (float)((double)on / (double)total);                             /* fan on share */
+        stats->average_ma = (float)((double)stats->charge_mah * 3600000.0 / (double)total);   /* average current */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
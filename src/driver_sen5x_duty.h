@@ -0,0 +1,262 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_duty.h
+ * @brief     driver sen5x duty header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_DUTY_H
+#define DRIVER_SEN5X_DUTY_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_duty_driver sen5x duty driver function
+ * @brief    sen5x duty driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x duty definition
+ */
+#define SEN5X_DUTY_DEFAULT_PERIOD_S           900           /**< scheduled pm window period in s */
+#define SEN5X_DUTY_DEFAULT_WINDOW_MS          30000         /**< trusted pm time of a window in ms */
+#define SEN5X_DUTY_DEFAULT_SETTLE_MS          30000         /**< pm stabilisation time after the fan starts in ms */
+#define SEN5X_DUTY_DEFAULT_VOC_JUMP           50.0f         /**< voc index rise over its baseline that starts a window */
+#define SEN5X_DUTY_DEFAULT_NOX_JUMP           20.0f         /**< nox index rise over its baseline that starts a window */
+#define SEN5X_DUTY_DEFAULT_SUPPLY_V           5.0f          /**< supply voltage in V */
+
+/**
+ * @brief sen5x duty action enumeration definition
+ */
+typedef enum
+{
+    SEN5X_DUTY_ACTION_NONE = 0x00,        /**< keep the mode */
+    SEN5X_DUTY_ACTION_GAS  = 0x01,        /**< call sen5x_start_measurement_without_pm */
+    SEN5X_DUTY_ACTION_PM   = 0x02,        /**< call sen5x_start_measurement */
+} sen5x_duty_action_t;
+
+/**
+ * @brief sen5x duty stats structure definition
+ */
+typedef struct sen5x_duty_stats_s
+{
+    uint64_t gas_ms;                    /**< time in rht and gas only mode */
+    uint64_t settle_ms;                 /**< time with the fan on before the pm is trusted */
+    uint64_t pm_ms;                     /**< time with trusted pm */
+    uint32_t scheduled;                 /**< scheduled pm windows */
+    uint32_t triggered;                 /**< pm windows started by a gas jump */
+    uint32_t extended;                  /**< pm windows extended by a gas jump */
+    uint64_t samples;                   /**< checked samples */
+    uint64_t masked;                    /**< samples with untrusted pm */
+    float duty;                         /**< share of the time with the fan on */
+    float average_ma;                   /**< estimated average current */
+    float charge_mah;                   /**< estimated charge */
+    float energy_mwh;                   /**< estimated energy */
+} sen5x_duty_stats_t;
+
+/**
+ * @brief sen5x duty structure definition
+ */
+typedef struct sen5x_duty_s
+{
+    uint32_t period_s;                  /**< scheduled pm window period */
+    uint32_t window_ms;                 /**< trusted pm time of a window */
+    uint32_t settle_ms;                 /**< pm stabilisation time */
+    float voc_jump;                     /**< voc index jump */
+    float nox_jump;                     /**< nox index jump, 0 to ignore nox */
+    float gas_ma;                       /**< rht and gas only current */
+    float pm_ma;                        /**< measurement current */
+    uint8_t running;                    /**< a measurement mode runs */
+    uint8_t pm;                         /**< measurement with pm runs */
+    uint8_t pending;                    /**< gas jump waits for a pm window */
+    uint8_t jump;                       /**< last sample was a jump */
+    uint8_t based;                      /**< baseline valid */
+    float voc_base;                     /**< slow voc index baseline */
+    float nox_base;                     /**< slow nox index baseline */
+    uint64_t last_ms;                   /**< time accounted up to */
+    uint64_t start_ms;                  /**< start of the pm mode */
+    uint64_t end_ms;                    /**< end of the pm window */
+    uint64_t next_ms;                   /**< next scheduled pm window */
+    uint64_t base_ms;                   /**< time of the last baseline update */
+    sen5x_duty_stats_t stats;           /**< stats */
+    uint8_t inited;                     /**< inited flag */
+} sen5x_duty_t;
+
+/**
+ * @brief     init the duty cycle controller
+ * @param[in] *duty pointer to a duty structure
+ * @param[in] period_s scheduled pm window period in s
+ * @param[in] window_ms trusted pm time of a window in ms
+ * @param[in] settle_ms pm stabilisation time in ms
+ * @param[in] voc_jump voc index rise over its baseline that starts a window
+ * @param[in] nox_jump nox index rise over its baseline that starts a window, 0 to ignore nox
+ * @return    status code
+ *            - 0 success
+ *            - 2 duty is NULL
+ *            - 4 period is invalid
+ *            - 5 window is invalid
+ *            - 6 jump is invalid
+ * @note      10 <= period_s <= 86400, 0 < window_ms, settle_ms + window_ms <= period_s * 1000, voc_jump > 0,
+ *            nox_jump >= 0, the currents start at SEN5X_POWER_CURRENT_RHT_GAS_MA and SEN5X_POWER_CURRENT_MEASUREMENT_MA
+ */
+uint8_t sen5x_duty_init(sen5x_duty_t *duty, uint32_t period_s, uint32_t window_ms, uint32_t settle_ms,
+                        float voc_jump, float nox_jump);
+
+/**
+ * @brief     set the mode currents of the energy estimate
+ * @param[in] *duty pointer to a duty structure
+ * @param[in] gas_ma rht and gas only measurement current in mA
+ * @param[in] pm_ma measurement current in mA
+ * @return    status code
+ *            - 0 success
+ *            - 2 duty is NULL
+ *            - 3 duty is not initialized
+ *            - 4 current is invalid
+ * @note      0 <= gas_ma <= pm_ma
+ */
+uint8_t sen5x_duty_set_current(sen5x_duty_t *duty, float gas_ma, float pm_ma);
+
+/**
+ * @brief     take the mode currents of the energy estimate from a driver handle
+ * @param[in] *duty pointer to a duty structure
+ * @param[in] *handle pointer to a sen5x handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 get current failed
+ *            - 2 duty or handle is NULL
+ *            - 3 duty is not initialized
+ *            - 4 current is invalid
+ * @note      uses the rht/gas-only and measurement currents of sen5x_set_power_current, so the estimate
+ *            matches sen5x_get_energy
+ */
+uint8_t sen5x_duty_set_current_from_handle(sen5x_duty_t *duty, sen5x_handle_t *handle);
+
+/**
+ * @brief      get the mode the sensor should run now
+ * @param[in]  *duty pointer to a duty structure
+ * @param[in]  now_ms current time in ms
+ * @param[out] *action pointer to an action buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 duty or action is NULL
+ *             - 3 duty is not initialized
+ * @note       the first poll starts the rht and gas only mode, a pm window starts on the schedule or after a
+ *             gas jump and ends window_ms after the pm is trusted, run the command of the action and tell the
+ *             controller with sen5x_duty_switched, the action repeats until then
+ */
+uint8_t sen5x_duty_poll(sen5x_duty_t *duty, uint64_t now_ms, sen5x_duty_action_t *action);
+
+/**
+ * @brief     tell the controller the mode was switched
+ * @param[in] *duty pointer to a duty structure
+ * @param[in] action action that was run
+ * @param[in] now_ms time the command returned in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 duty is NULL
+ *            - 3 duty is not initialized
+ *            - 4 action is invalid
+ * @note      the pm is trusted settle_ms after the switch to the measurement mode
+ */
+uint8_t sen5x_duty_switched(sen5x_duty_t *duty, sen5x_duty_action_t action, uint64_t now_ms);
+
+/**
+ * @brief      feed the gas indices of a sample
+ * @param[in]  *duty pointer to a duty structure
+ * @param[in]  now_ms time of the sample in ms
+ * @param[in]  voc_index voc index of the sample
+ * @param[in]  nox_index nox index of the sample
+ * @param[out] *trust pointer to a trust buffer, 1 when the pm of the sample can be used
+ * @return     status code
+ *             - 0 success
+ *             - 2 duty or trust is NULL
+ *             - 3 duty is not initialized
+ * @note       the indices are compared with a baseline that follows them with a time constant of one hour,
+ *             a rising jump in the gas mode starts a window at the next poll, a rising jump in a window
+ *             extends it, a jump ends below half of its threshold
+ */
+uint8_t sen5x_duty_update(sen5x_duty_t *duty, uint64_t now_ms, float voc_index, float nox_index, uint8_t *trust);
+
+/**
+ * @brief         feed a sen55 sample and clear its pm_valid when the pm is not trusted
+ * @param[in]     *duty pointer to a duty structure
+ * @param[in]     now_ms time of the sample in ms
+ * @param[in,out] *data pointer to a sen55 data structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 duty or data is NULL
+ *                - 3 duty is not initialized
+ * @note          the aggregates skip samples without pm_valid
+ */
+uint8_t sen5x_duty_update_sen55(sen5x_duty_t *duty, uint64_t now_ms, sen55_data_t *data);
+
+/**
+ * @brief         feed a sen54 sample and clear its pm_valid when the pm is not trusted
+ * @param[in]     *duty pointer to a duty structure
+ * @param[in]     now_ms time of the sample in ms
+ * @param[in,out] *data pointer to a sen54 data structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 duty or data is NULL
+ *                - 3 duty is not initialized
+ * @note          the sen54 has no nox, the aggregates skip samples without pm_valid
+ */
+uint8_t sen5x_duty_update_sen54(sen5x_duty_t *duty, uint64_t now_ms, sen54_data_t *data);
+
+/**
+ * @brief      get the controller statistics
+ * @param[in]  *duty pointer to a duty structure
+ * @param[in]  now_ms current time in ms
+ * @param[out] *stats pointer to a duty stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 duty or stats is NULL
+ *             - 3 duty is not initialized
+ * @note       the time is accounted up to now_ms, the energy uses the supply of SEN5X_DUTY_DEFAULT_SUPPLY_V
+ */
+uint8_t sen5x_duty_get_stats(sen5x_duty_t *duty, uint64_t now_ms, sen5x_duty_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,586 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_filter.c
+ * @brief     driver sen5x filter source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_filter.h"
+
+/**
+ * @brief node definition
+ */
+#define SEN5X_FILTER_HEAD        0                                      /**< head node */
+#define SEN5X_FILTER_TAIL        (SEN5X_FILTER_MAX_WINDOW + 1)          /**< tail node */
+
+/**
+ * @brief     check the order of two nodes
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] a first node
+ * @param[in] b second node
+ * @return    1 if a sorts before b, else 0
+ * @note      equal values sort by node so every key is unique
+ */
+static inline uint8_t a_sen5x_filter_less(const sen5x_filter_t *filter, uint8_t a, uint8_t b)
+{
+    return ((filter->value[a] < filter->value[b]) ||
+            ((filter->value[a] == filter->value[b]) && (a < b))) ? 1 : 0;        /* compare the keys */
+}
+
+/**
+ * @brief     insert a node into the skip list
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] node node with its value set
+ * @note      none
+ */
+static void a_sen5x_filter_insert(sen5x_filter_t *filter, uint8_t node)
+{
+    int8_t l;
+    uint8_t d;
+    uint8_t p;
+    uint8_t steps;
+    uint8_t chain[SEN5X_FILTER_LEVELS];
+    uint8_t steps_at[SEN5X_FILTER_LEVELS];
+
+    p = SEN5X_FILTER_HEAD;                                                                    /* start at the head */
+    for (l = SEN5X_FILTER_LEVELS - 1; l >= 0; l--)                                            /* run from the top */
+    {
+        steps_at[l] = 0;                                                                      /* init 0 */
+        while (a_sen5x_filter_less(filter, filter->next[p][l], node) != 0)                    /* move right */
+        {
+            steps_at[l] += filter->width[p][l];                                               /* count the steps */
+            p = filter->next[p][l];                                                           /* next node */
+        }
+        chain[l] = p;                                                                         /* save the predecessor */
+    }
+    filter->seed = filter->seed * 1664525U + 1013904223U;                                     /* next random */
+    d = 1;                                                                                    /* at least one level */
+    while ((d < SEN5X_FILTER_LEVELS) && (((filter->seed >> (31 - d)) & 1) != 0))              /* coin flips */
+    {
+        d++;                                                                                  /* one more level */
+    }
+    filter->level[node] = d;                                                                  /* save the level */
+    steps = 0;                                                                                /* init 0 */
+    for (l = 0; l < d; l++)                                                                   /* link the levels */
+    {
+        p = chain[l];                                                                         /* get the predecessor */
+        filter->next[node][l] = filter->next[p][l];                                           /* link the next */
+        filter->next[p][l] = node;                                                            /* link the node */
+        filter->width[node][l] = (uint8_t)(filter->width[p][l] - steps);                      /* node width */
+        filter->width[p][l] = (uint8_t)(steps + 1);                                           /* predecessor width */
+        steps = (uint8_t)(steps + steps_at[l]);                                               /* steps to the next level */
+    }
+    for (l = d; l < SEN5X_FILTER_LEVELS; l++)                                                 /* levels above the node */
+    {
+        filter->width[chain[l]][l]++;                                                         /* one more below */
+    }
+}
+
+/**
+ * @brief     remove a node from the skip list
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] node node in the list
+ * @note      none
+ */
+static void a_sen5x_filter_remove(sen5x_filter_t *filter, uint8_t node)
+{
+    int8_t l;
+    uint8_t p;
+
+    p = SEN5X_FILTER_HEAD;                                                                    /* start at the head */
+    for (l = SEN5X_FILTER_LEVELS - 1; l >= 0; l--)                                            /* run from the top */
+    {
+        while (a_sen5x_filter_less(filter, filter->next[p][l], node) != 0)                    /* move right */
+        {
+            p = filter->next[p][l];                                                           /* next node */
+        }
+        if (l < filter->level[node])                                                          /* node is linked here */
+        {
+            filter->width[p][l] = (uint8_t)(filter->width[p][l] + filter->width[node][l] - 1);   /* merge the widths */
+            filter->next[p][l] = filter->next[node][l];                                       /* unlink the node */
+        }
+        else
+        {
+            filter->width[p][l]--;                                                            /* one less below */
+        }
+    }
+}
+
+/**
+ * @brief     get an order statistic
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] i rank from 0
+ * @return    value of the rank
+ * @note      i must be below the count
+ */
+static float a_sen5x_filter_at(const sen5x_filter_t *filter, uint8_t i)
+{
+    int8_t l;
+    uint8_t p;
+    uint16_t left;
+
+    p = SEN5X_FILTER_HEAD;                                                                    /* start at the head */
+    left = (uint16_t)(i + 1);                                                                 /* steps to go */
+    for (l = SEN5X_FILTER_LEVELS - 1; l >= 0; l--)                                            /* run from the top */
+    {
+        while (filter->width[p][l] <= left)                                                   /* jump fits */
+        {
+            left = (uint16_t)(left - filter->width[p][l]);                                    /* count the steps */
+            p = filter->next[p][l];                                                           /* next node */
+        }
+    }
+
+    return filter->value[p];                                                                  /* return the value */
+}
+
+/**
+ * @brief     get the window median
+ * @param[in] *filter pointer to a filter structure
+ * @return    median
+ * @note      the window must not be empty
+ */
+static float a_sen5x_filter_median(const sen5x_filter_t *filter)
+{
+    uint8_t h;
+
+    h = (uint8_t)(filter->count / 2);                                                         /* half */
+    if ((filter->count & 1) != 0)                                                             /* odd window */
+    {
+        return a_sen5x_filter_at(filter, h);                                                  /* middle value */
+    }
+
+    return 0.5f * (a_sen5x_filter_at(filter, (uint8_t)(h - 1)) + a_sen5x_filter_at(filter, h));   /* middle pair */
+}
+
+/**
+ * @brief     get a deviation from the median
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] m median
+ * @param[in] split first rank at or above the median
+ * @param[in] side 0 for the lower side, 1 for the upper side
+ * @param[in] i index in the side, nearest to the median first
+ * @return    deviation
+ * @note      both sides are sorted ascending by deviation
+ */
+static float a_sen5x_filter_deviation(const sen5x_filter_t *filter, float m, uint8_t split, uint8_t side, uint8_t i)
+{
+    if (side == 0)                                                                            /* lower side */
+    {
+        return m - a_sen5x_filter_at(filter, (uint8_t)(split - 1 - i));                      /* below the median */
+    }
+
+    return a_sen5x_filter_at(filter, (uint8_t)(split + i)) - m;                               /* above the median */
+}
+
+/**
+ * @brief     get the k-th smallest deviation from the median
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] m median
+ * @param[in] k rank from 0
+ * @return    deviation
+ * @note      selects from the two sorted sides in O(log n) order statistics
+ */
+static float a_sen5x_filter_kth_deviation(const sen5x_filter_t *filter, float m, uint8_t k)
+{
+    int16_t lo;
+    int16_t hi;
+    int16_t i;
+    int16_t j;
+    int16_t na;
+    int16_t nb;
+    uint8_t split;
+    float a;
+    float b;
+
+    split = (uint8_t)(filter->count / 2);                                                     /* lower side size */
+    na = split;                                                                               /* lower side */
+    nb = (int16_t)(filter->count - split);                                                    /* upper side */
+    lo = (int16_t)(k + 1 - nb);                                                               /* fewest from the lower side */
+    lo = (lo < 0) ? 0 : lo;                                                                   /* limit */
+    hi = (int16_t)(k + 1);                                                                    /* most from the lower side */
+    hi = (hi > na) ? na : hi;                                                                 /* limit */
+    while (1)                                                                                 /* binary search */
+    {
+        i = (int16_t)((lo + hi) / 2);                                                         /* from the lower side */
+        j = (int16_t)(k + 1 - i);                                                             /* from the upper side */
+        if ((i < hi) && (j > 0) &&
+            (a_sen5x_filter_deviation(filter, m, split, 1, (uint8_t)(j - 1)) >
+             a_sen5x_filter_deviation(filter, m, split, 0, (uint8_t)i)))                      /* too few from the lower side */
+        {
+            lo = (int16_t)(i + 1);                                                            /* move up */
+        }
+        else if ((i > lo) && (j < nb) &&
+                 (a_sen5x_filter_deviation(filter, m, split, 0, (uint8_t)(i - 1)) >
+                  a_sen5x_filter_deviation(filter, m, split, 1, (uint8_t)j)))                 /* too many from the lower side */
+        {
+            hi = (int16_t)(i - 1);                                                            /* move down */
+        }
+        else
+        {
+            a = (i > 0) ? a_sen5x_filter_deviation(filter, m, split, 0, (uint8_t)(i - 1)) : -1.0f;   /* last of the lower side */
+            b = (j > 0) ? a_sen5x_filter_deviation(filter, m, split, 1, (uint8_t)(j - 1)) : -1.0f;   /* last of the upper side */
+
+            return (a > b) ? a : b;                                                           /* return the k-th */
+        }
+    }
+}
+
+/**
+ * @brief     get the window median absolute deviation
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] m median
+ * @return    mad
+ * @note      the window must not be empty
+ */
+static float a_sen5x_filter_mad(const sen5x_filter_t *filter, float m)
+{
+    uint8_t h;
+
+    h = (uint8_t)(filter->count / 2);                                                         /* half */
+    if ((filter->count & 1) != 0)                                                             /* odd window */
+    {
+        return a_sen5x_filter_kth_deviation(filter, m, h);                                    /* middle deviation */
+    }
+
+    return 0.5f * (a_sen5x_filter_kth_deviation(filter, m, (uint8_t)(h - 1)) +
+                   a_sen5x_filter_kth_deviation(filter, m, h));                               /* middle pair */
+}
+
+/**
+ * @brief     init a filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] mode filter mode
+ * @param[in] window window samples
+ * @param[in] threshold hampel threshold in standard deviations
+ * @param[in] min_delta smallest deviation treated as an outlier
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 4 mode is invalid
+ *            - 5 window is invalid
+ * @note      1 <= window <= SEN5X_FILTER_MAX_WINDOW, an odd window has a true median
+ */
+uint8_t sen5x_filter_init(sen5x_filter_t *filter, sen5x_filter_mode_t mode, uint8_t window,
+                          float threshold, float min_delta)
+{
+    uint8_t l;
+
+    if (filter == NULL)                                                                       /* check the filter */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if ((mode != SEN5X_FILTER_MODE_MEDIAN) && (mode != SEN5X_FILTER_MODE_HAMPEL))             /* check the mode */
+    {
+        return 4;                                                                             /* return error */
+    }
+    if ((window == 0) || (window > SEN5X_FILTER_MAX_WINDOW))                                  /* check the window */
+    {
+        return 5;                                                                             /* return error */
+    }
+
+    memset(filter, 0, sizeof(sen5x_filter_t));                                                /* clear the filter */
+    for (l = 0; l < SEN5X_FILTER_LEVELS; l++)                                                 /* link the head */
+    {
+        filter->next[SEN5X_FILTER_HEAD][l] = SEN5X_FILTER_TAIL;                               /* head to tail */
+        filter->width[SEN5X_FILTER_HEAD][l] = 1;                                              /* one step */
+    }
+    filter->value[SEN5X_FILTER_TAIL] = INFINITY;                                              /* tail sorts last */
+    filter->window = window;                                                                  /* set the window */
+    filter->mode = (uint8_t)mode;                                                             /* set the mode */
+    filter->threshold = threshold;                                                            /* set the threshold */
+    filter->min_delta = min_delta;                                                            /* set the min delta */
+    filter->seed = 0x5EED;                                                                    /* set the seed */
+    filter->inited = 1;                                                                       /* flag inited */
+
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      run a sample through the filter
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  in input sample
+ * @param[out] *out pointer to an output buffer
+ * @param[out] *replaced pointer to a replaced flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter, out or replaced is NULL
+ *             - 3 filter is not initialized
+ * @note       non finite samples are not added to the window and pass through
+ */
+uint8_t sen5x_filter_update(sen5x_filter_t *filter, float in, float *out, uint8_t *replaced)
+{
+    uint8_t node;
+    float m;
+    float limit;
+
+    if ((filter == NULL) || (out == NULL) || (replaced == NULL))                              /* check the params */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (filter->inited != 1)                                                                  /* check the filter */
+    {
+        return 3;                                                                             /* return error */
+    }
+
+    *out = in;                                                                                /* pass through */
+    *replaced = 0;                                                                            /* not replaced */
+    if (isfinite(in) == 0)                                                                    /* invalid sample */
+    {
+        return 0;                                                                             /* success return 0 */
+    }
+    if (filter->count == filter->window)                                                      /* window is full */
+    {
+        node = filter->ring[filter->head];                                                    /* reuse the oldest node */
+        a_sen5x_filter_remove(filter, node);                                                  /* remove the oldest */
+        filter->head = (uint8_t)((filter->head + 1) % filter->window);                        /* next oldest */
+        filter->count--;                                                                      /* one less */
+    }
+    else
+    {
+        node = (uint8_t)(filter->count + 1);                                                  /* unused node */
+    }
+    filter->value[node] = in;                                                                 /* set the value */
+    a_sen5x_filter_insert(filter, node);                                                      /* insert the node */
+    filter->ring[(filter->head + filter->count) % filter->window] = node;                     /* save the arrival */
+    filter->count++;                                                                          /* one more */
+
+    m = a_sen5x_filter_median(filter);                                                        /* get the median */
+    if (filter->mode == SEN5X_FILTER_MODE_MEDIAN)                                             /* median mode */
+    {
+        *out = m;                                                                             /* output the median */
+        *replaced = (m != in) ? 1 : 0;                                                        /* flag replaced */
+    }
+    else if (fabsf(in - m) > filter->min_delta)                                               /* hampel candidate */
+    {
+        limit = filter->threshold * SEN5X_FILTER_MAD_SCALE * a_sen5x_filter_mad(filter, m);   /* outlier limit */
+        limit = (limit < filter->min_delta) ? filter->min_delta : limit;                      /* at least the min delta */
+        if (fabsf(in - m) > limit)                                                            /* outlier */
+        {
+            *out = m;                                                                         /* output the median */
+            *replaced = 1;                                                                    /* flag replaced */
+        }
+    }
+
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      get the window median
+ * @param[in]  *filter pointer to a filter structure
+ * @param[out] *median pointer to a median buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter or median is NULL
+ *             - 3 filter is not initialized
+ *             - 5 window is empty
+ * @note       none
+ */
+uint8_t sen5x_filter_get_median(sen5x_filter_t *filter, float *median)
+{
+    if ((filter == NULL) || (median == NULL))                             /* check the params */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (filter->inited != 1)                                              /* check the filter */
+    {
+        return 3;                                                         /* return error */
+    }
+    if (filter->count == 0)                                               /* check the window */
+    {
+        return 5;                                                         /* return error */
+    }
+
+    *median = a_sen5x_filter_median(filter);                              /* get the median */
+
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief      get the window median absolute deviation
+ * @param[in]  *filter pointer to a filter structure
+ * @param[out] *mad pointer to a mad buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter or mad is NULL
+ *             - 3 filter is not initialized
+ *             - 5 window is empty
+ * @note       none
+ */
+uint8_t sen5x_filter_get_mad(sen5x_filter_t *filter, float *mad)
+{
+    if ((filter == NULL) || (mad == NULL))                                /* check the params */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (filter->inited != 1)                                              /* check the filter */
+    {
+        return 3;                                                         /* return error */
+    }
+    if (filter->count == 0)                                               /* check the window */
+    {
+        return 5;                                                         /* return error */
+    }
+
+    *mad = a_sen5x_filter_mad(filter, a_sen5x_filter_median(filter));     /* get the mad */
+
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     init a pm filter bank
+ * @param[in] *bank pointer to a pm filter bank structure
+ * @param[in] mode filter mode
+ * @param[in] window window samples
+ * @param[in] threshold hampel threshold in standard deviations
+ * @param[in] min_delta smallest deviation treated as an outlier
+ * @return    status code
+ *            - 0 success
+ *            - 2 bank is NULL
+ *            - 4 mode is invalid
+ *            - 5 window is invalid
+ * @note      none
+ */
+uint8_t sen5x_filter_pm_init(sen5x_filter_pm_t *bank, sen5x_filter_mode_t mode, uint8_t window,
+                             float threshold, float min_delta)
+{
+    uint8_t res;
+    uint8_t ch;
+
+    if (bank == NULL)                                                                         /* check the bank */
+    {
+        return 2;                                                                             /* return error */
+    }
+
+    for (ch = 0; ch < SEN5X_FILTER_PM_CHANNELS; ch++)                                         /* run all channels */
+    {
+        res = sen5x_filter_init(&bank->channel[ch], mode, window, threshold, min_delta);      /* init the channel */
+        if (res != 0)                                                                         /* check the result */
+        {
+            return res;                                                                       /* return the error */
+        }
+    }
+    bank->replaced = 0;                                                                       /* clear the counter */
+
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief         filter four pm mass concentrations in place
+ * @param[in]     *bank pointer to a pm filter bank structure
+ * @param[in,out] **value pointer to the four value addresses
+ * @note          none
+ */
+static void a_sen5x_filter_pm_run(sen5x_filter_pm_t *bank, float *const *value)
+{
+    uint8_t ch;
+    uint8_t replaced;
+    float out;
+
+    for (ch = 0; ch < SEN5X_FILTER_PM_CHANNELS; ch++)                                         /* run all channels */
+    {
+        (void)sen5x_filter_update(&bank->channel[ch], *value[ch], &out, &replaced);           /* filter the channel */
+        *value[ch] = out;                                                                     /* write back */
+        bank->replaced += replaced;                                                           /* count the replaced */
+    }
+}
+
+/**
+ * @brief         filter the pm mass concentrations of a pm sample in place
+ * @param[in]     *bank pointer to a pm filter bank structure
+ * @param[in,out] *pm pointer to a sen5x pm structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 bank or pm is NULL
+ *                - 3 bank is not initialized
+ * @note          samples without pm_valid are left untouched, the raw words are kept
+ */
+uint8_t sen5x_filter_pm(sen5x_filter_pm_t *bank, sen5x_pm_t *pm)
+{
+    float *value[SEN5X_FILTER_PM_CHANNELS];
+
+    if ((bank == NULL) || (pm == NULL))                                   /* check the params */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (bank->channel[0].inited != 1)                                     /* check the bank */
+    {
+        return 3;                                                         /* return error */
+    }
+    if (pm->pm_valid == 0)                                                /* invalid pm */
+    {
+        return 0;                                                         /* success return 0 */
+    }
+
+    value[0] = &pm->pm1p0_ug_m3;                                          /* pm1.0 mass */
+    value[1] = &pm->pm2p5_ug_m3;                                          /* pm2.5 mass */
+    value[2] = &pm->pm4p0_ug_m3;                                          /* pm4.0 mass */
+    value[3] = &pm->pm10_ug_m3;                                           /* pm10 mass */
+    a_sen5x_filter_pm_run(bank, value);                                   /* run the filters */
+
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief         filter the pm mass concentrations of a sen55 sample in place
+ * @param[in]     *bank pointer to a pm filter bank structure
+ * @param[in,out] *data pointer to a sen55 data structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 bank or data is NULL
+ *                - 3 bank is not initialized
+ * @note          samples without pm_valid are left untouched, the raw words are kept
+ */
+uint8_t sen5x_filter_sen55(sen5x_filter_pm_t *bank, sen55_data_t *data)
+{
+    float *value[SEN5X_FILTER_PM_CHANNELS];
+
+    if ((bank == NULL) || (data == NULL))                                 /* check the params */
+    {
+        return 2;                                                         /* return error */
+    }
+    if (bank->channel[0].inited != 1)                                     /* check the bank */
+    {
+        return 3;                                                         /* return error */
+    }
+    if (data->pm_valid == 0)                                              /* invalid pm */
+    {
+        return 0;                                                         /* success return 0 */
+    }
+
+    value[0] = &data->pm1p0_ug_m3;                                        /* pm1.0 mass */
+    value[1] = &data->pm2p5_ug_m3;                                        /* pm2.5 mass */
+    value[2] = &data->pm4p0_ug_m3;                                        /* pm4.0 mass */
+    value[3] = &data->pm10_ug_m3;                                         /* pm10 mass */
+    a_sen5x_filter_pm_run(bank, value);                                   /* run the filters */
+
+    return 0;                                                             /* success return 0 */
+}
@@ -0,0 +1,221 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_filter.h
+ * @brief     driver sen5x filter header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_FILTER_H
+#define DRIVER_SEN5X_FILTER_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_filter_driver sen5x filter driver function
+ * @brief    sen5x filter driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x filter max window definition, the storage of every channel is fixed by it
+ */
+#ifndef SEN5X_FILTER_MAX_WINDOW
+    #define SEN5X_FILTER_MAX_WINDOW        31        /**< max window samples, 1 - 254 */
+#endif
+
+/**
+ * @brief sen5x filter skip list levels definition, 2^levels should reach the max window
+ */
+#ifndef SEN5X_FILTER_LEVELS
+    #define SEN5X_FILTER_LEVELS            5         /**< skip list levels */
+#endif
+
+#if (SEN5X_FILTER_MAX_WINDOW < 1) || (SEN5X_FILTER_MAX_WINDOW > 254)
+    #error "SEN5X_FILTER_MAX_WINDOW must be 1 - 254"
+#endif
+
+/**
+ * @brief sen5x filter definition
+ */
+#define SEN5X_FILTER_PM_CHANNELS           4         /**< pm1.0, pm2.5, pm4.0 and pm10 mass concentration */
+#define SEN5X_FILTER_MAD_SCALE             1.4826f   /**< mad to standard deviation of a normal distribution */
+
+/**
+ * @brief sen5x filter mode enumeration definition
+ */
+typedef enum
+{
+    SEN5X_FILTER_MODE_MEDIAN = 0x00,        /**< output the window median */
+    SEN5X_FILTER_MODE_HAMPEL = 0x01,        /**< output the sample, or the window median when it is an outlier */
+} sen5x_filter_mode_t;
+
+/**
+ * @brief sen5x filter structure definition
+ */
+typedef struct sen5x_filter_s
+{
+    float value[SEN5X_FILTER_MAX_WINDOW + 2];                                /**< node values, node 0 is the head and the last node is the tail */
+    uint8_t next[SEN5X_FILTER_MAX_WINDOW + 2][SEN5X_FILTER_LEVELS];          /**< node links */
+    uint8_t width[SEN5X_FILTER_MAX_WINDOW + 2][SEN5X_FILTER_LEVELS];         /**< link widths */
+    uint8_t level[SEN5X_FILTER_MAX_WINDOW + 2];                              /**< node levels */
+    uint8_t ring[SEN5X_FILTER_MAX_WINDOW];                                   /**< nodes in arrival order */
+    uint8_t head;                                                            /**< oldest ring entry */
+    uint8_t count;                                                           /**< samples in the window */
+    uint8_t window;                                                          /**< window samples */
+    uint8_t mode;                                                            /**< filter mode */
+    float threshold;                                                         /**< hampel threshold in standard deviations */
+    float min_delta;                                                         /**< smallest deviation treated as an outlier */
+    uint32_t seed;                                                           /**< level random seed */
+    uint8_t inited;                                                          /**< inited flag */
+} sen5x_filter_t;
+
+/**
+ * @brief sen5x filter pm bank structure definition
+ */
+typedef struct sen5x_filter_pm_s
+{
+    sen5x_filter_t channel[SEN5X_FILTER_PM_CHANNELS];        /**< pm mass concentration filters */
+    uint32_t replaced;                                       /**< replaced outliers */
+} sen5x_filter_pm_t;
+
+/**
+ * @brief     init a filter
+ * @param[in] *filter pointer to a filter structure
+ * @param[in] mode filter mode
+ * @param[in] window window samples
+ * @param[in] threshold hampel threshold in standard deviations
+ * @param[in] min_delta smallest deviation treated as an outlier
+ * @return    status code
+ *            - 0 success
+ *            - 2 filter is NULL
+ *            - 4 mode is invalid
+ *            - 5 window is invalid
+ * @note      1 <= window <= SEN5X_FILTER_MAX_WINDOW, an odd window has a true median
+ */
+uint8_t sen5x_filter_init(sen5x_filter_t *filter, sen5x_filter_mode_t mode, uint8_t window,
+                          float threshold, float min_delta);
+
+/**
+ * @brief      run a sample through the filter
+ * @param[in]  *filter pointer to a filter structure
+ * @param[in]  in input sample
+ * @param[out] *out pointer to an output buffer
+ * @param[out] *replaced pointer to a replaced flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter, out or replaced is NULL
+ *             - 3 filter is not initialized
+ * @note       non finite samples are not added to the window and pass through
+ */
+uint8_t sen5x_filter_update(sen5x_filter_t *filter, float in, float *out, uint8_t *replaced);
+
+/**
+ * @brief      get the window median
+ * @param[in]  *filter pointer to a filter structure
+ * @param[out] *median pointer to a median buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter or median is NULL
+ *             - 3 filter is not initialized
+ *             - 5 window is empty
+ * @note       none
+ */
+uint8_t sen5x_filter_get_median(sen5x_filter_t *filter, float *median);
+
+/**
+ * @brief      get the window median absolute deviation
+ * @param[in]  *filter pointer to a filter structure
+ * @param[out] *mad pointer to a mad buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 filter or mad is NULL
+ *             - 3 filter is not initialized
+ *             - 5 window is empty
+ * @note       none
+ */
+uint8_t sen5x_filter_get_mad(sen5x_filter_t *filter, float *mad);
+
+/**
+ * @brief     init a pm filter bank
+ * @param[in] *bank pointer to a pm filter bank structure
+ * @param[in] mode filter mode
+ * @param[in] window window samples
+ * @param[in] threshold hampel threshold in standard deviations
+ * @param[in] min_delta smallest deviation treated as an outlier
+ * @return    status code
+ *            - 0 success
+ *            - 2 bank is NULL
+ *            - 4 mode is invalid
+ *            - 5 window is invalid
+ * @note      none
+ */
+uint8_t sen5x_filter_pm_init(sen5x_filter_pm_t *bank, sen5x_filter_mode_t mode, uint8_t window,
+                             float threshold, float min_delta);
+
+/**
+ * @brief         filter the pm mass concentrations of a pm sample in place
+ * @param[in]     *bank pointer to a pm filter bank structure
+ * @param[in,out] *pm pointer to a sen5x pm structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 bank or pm is NULL
+ *                - 3 bank is not initialized
+ * @note          samples without pm_valid are left untouched, the raw words are kept
+ */
+uint8_t sen5x_filter_pm(sen5x_filter_pm_t *bank, sen5x_pm_t *pm);
+
+/**
+ * @brief         filter the pm mass concentrations of a sen55 sample in place
+ * @param[in]     *bank pointer to a pm filter bank structure
+ * @param[in,out] *data pointer to a sen55 data structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 bank or data is NULL
+ *                - 3 bank is not initialized
+ * @note          samples without pm_valid are left untouched, the raw words are kept
+ */
+uint8_t sen5x_filter_sen55(sen5x_filter_pm_t *bank, sen55_data_t *data);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
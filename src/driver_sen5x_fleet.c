@@ -0,0 +1,608 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_fleet.c
+ * @brief     driver sen5x fleet source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_fleet.h"
+
+/**
+ * @brief     write a little endian u32
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_sen5x_fleet_put_u32(uint8_t *buf, uint32_t v)
+{
+    buf[0] = (uint8_t)((v >> 0) & 0xFF);          /* byte 0 */
+    buf[1] = (uint8_t)((v >> 8) & 0xFF);          /* byte 1 */
+    buf[2] = (uint8_t)((v >> 16) & 0xFF);         /* byte 2 */
+    buf[3] = (uint8_t)((v >> 24) & 0xFF);         /* byte 3 */
+}
+
+/**
+ * @brief     write a little endian u64
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_sen5x_fleet_put_u64(uint8_t *buf, uint64_t v)
+{
+    a_sen5x_fleet_put_u32(&buf[0], (uint32_t)(v >> 0));         /* low half */
+    a_sen5x_fleet_put_u32(&buf[4], (uint32_t)(v >> 32));        /* high half */
+}
+
+/**
+ * @brief     read a little endian u32
+ * @param[in] *buf pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint32_t a_sen5x_fleet_get_u32(const uint8_t *buf)
+{
+    return ((uint32_t)buf[3] << 24) | ((uint32_t)buf[2] << 16) |
+           ((uint32_t)buf[1] << 8) | ((uint32_t)buf[0] << 0);        /* get the value */
+}
+
+/**
+ * @brief     read a little endian u64
+ * @param[in] *buf pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint64_t a_sen5x_fleet_get_u64(const uint8_t *buf)
+{
+    return ((uint64_t)a_sen5x_fleet_get_u32(&buf[4]) << 32) | a_sen5x_fleet_get_u32(&buf[0]);        /* get the value */
+}
+
+/**
+ * @brief     get the due time of a sensor
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] sensor sensor index
+ * @return    due time in ms
+ * @note      the first plan slot after the last cleaning, a late cleaning keeps the plan grid
+ */
+static uint64_t a_sen5x_fleet_due(sen5x_fleet_t *fleet, uint8_t sensor)
+{
+    uint64_t base;
+    uint64_t period;
+
+    base = fleet->epoch_ms + fleet->offset_ms[sensor];                                 /* first slot */
+    period = (uint64_t)fleet->period_s * 1000;                                         /* period in ms */
+    if (fleet->done_ms[sensor] < base)                                                 /* not cleaned yet */
+    {
+        return base;                                                                   /* first slot */
+    }
+
+    return base + ((fleet->done_ms[sensor] - base) / period + 1) * period;             /* next slot */
+}
+
+/**
+ * @brief     check if a room can spare a sensor
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] sensor sensor to clean
+ * @return    1 if the room keeps min_valid valid sensors
+ * @note      none
+ */
+static uint8_t a_sen5x_fleet_room_ok(sen5x_fleet_t *fleet, uint8_t sensor)
+{
+    uint8_t i;
+    uint8_t valid;
+
+    valid = 0;                                                                         /* init the count */
+    for (i = 0; i < fleet->sensors; i++)                                               /* all sensors */
+    {
+        if ((i != sensor) && (fleet->room[i] == fleet->room[sensor]) && (fleet->valid[i] != 0))   /* valid neighbour */
+        {
+            valid++;                                                                   /* count it */
+        }
+    }
+
+    return (valid >= fleet->min_valid) ? 1 : 0;                                        /* check the count */
+}
+
+/**
+ * @brief     init the fleet cleaning scheduler
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] sensors sensor count
+ * @param[in] period_s cleaning period of every sensor in s
+ * @param[in] slot_ms cleaning slot in ms
+ * @param[in] min_valid valid sensors a room keeps during a cleaning
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 4 sensors is invalid
+ *            - 5 period is invalid
+ *            - 6 slot is invalid
+ * @note      1 <= sensors <= 32, 10 <= period_s <= 604800, 0 < slot_ms * sensors <= period_s * 1000,
+ *            every sensor starts in room 0 and valid, disable the auto cleaning of every sensor with
+ *            sen5x_disable_auto_cleaning_interval so only the scheduler cleans
+ */
+uint8_t sen5x_fleet_init(sen5x_fleet_t *fleet, uint8_t sensors, uint32_t period_s, uint32_t slot_ms, uint8_t min_valid)
+{
+    if (fleet == NULL)                                                                 /* check the fleet */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((sensors == 0) || (sensors > SEN5X_FLEET_MAX_SENSORS))                         /* check the sensors */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if ((period_s < 10) || (period_s > 604800))                                        /* check the period */
+    {
+        return 5;                                                                      /* return error */
+    }
+    if ((slot_ms == 0) || ((uint64_t)slot_ms * sensors > (uint64_t)period_s * 1000))   /* check the slot */
+    {
+        return 6;                                                                      /* return error */
+    }
+
+    memset(fleet, 0, sizeof(sen5x_fleet_t));                                           /* clear the fleet */
+    fleet->sensors = sensors;                                                          /* set the sensors */
+    fleet->period_s = period_s;                                                        /* set the period */
+    fleet->slot_ms = slot_ms;                                                          /* set the slot */
+    fleet->min_valid = min_valid;                                                      /* set the min valid */
+    memset(fleet->valid, 1, sizeof(fleet->valid));                                     /* all valid */
+    fleet->inited = 1;                                                                 /* flag inited */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     set the room of a sensor
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] sensor sensor index
+ * @param[in] room room id
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 3 fleet is not initialized
+ *            - 4 sensor is invalid
+ * @note      a changed room drops the plan
+ */
+uint8_t sen5x_fleet_set_room(sen5x_fleet_t *fleet, uint8_t sensor, uint8_t room)
+{
+    if (fleet == NULL)                                                                 /* check the fleet */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (fleet->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (sensor >= fleet->sensors)                                                      /* check the sensor */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    if (fleet->room[sensor] != room)                                                   /* room changed */
+    {
+        fleet->room[sensor] = room;                                                    /* set the room */
+        fleet->planned = 0;                                                            /* drop the plan */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     build a new plan
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] now_ms current time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 3 fleet is not initialized
+ *            - 4 a room has no more sensors than min_valid
+ * @note      the sensors get evenly spaced slots of the period in an order that takes turns between the
+ *            rooms, so only one sensor cleans at a time and the cleanings of a room are spread out,
+ *            the time must come from a clock that survives a restart
+ */
+uint8_t sen5x_fleet_plan(sen5x_fleet_t *fleet, uint64_t now_ms)
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t size;
+    uint8_t placed;
+    uint8_t taken[SEN5X_FLEET_MAX_SENSORS];
+    uint8_t served[SEN5X_FLEET_MAX_SENSORS];
+    uint32_t step;
+
+    if (fleet == NULL)                                                                 /* check the fleet */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (fleet->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    for (i = 0; i < fleet->sensors; i++)                                               /* check every room */
+    {
+        size = 0;                                                                      /* init the size */
+        for (j = 0; j < fleet->sensors; j++)                                           /* all sensors */
+        {
+            size += (fleet->room[j] == fleet->room[i]) ? 1 : 0;                        /* count the room */
+        }
+        if (size <= fleet->min_valid)                                                  /* room too small */
+        {
+            return 4;                                                                  /* return error */
+        }
+    }
+
+    memset(taken, 0, sizeof(taken));                                                   /* nothing placed */
+    step = (uint32_t)(((uint64_t)fleet->period_s * 1000) / fleet->sensors);            /* slot spacing */
+    placed = 0;                                                                        /* init placed */
+    while (placed < fleet->sensors)                                                    /* one turn of the rooms */
+    {
+        memset(served, 0, sizeof(served));                                             /* no room served */
+        for (i = 0; i < fleet->sensors; i++)                                           /* first sensor of every room */
+        {
+            if (taken[i] != 0)                                                         /* already placed */
+            {
+                continue;                                                              /* next sensor */
+            }
+            for (j = 0; j < fleet->sensors; j++)                                       /* check the served rooms */
+            {
+                if ((served[j] != 0) && (fleet->room[j] == fleet->room[i]))            /* room served */
+                {
+                    break;                                                             /* stop */
+                }
+            }
+            if (j < fleet->sensors)                                                    /* not its turn */
+            {
+                continue;                                                              /* next sensor */
+            }
+            fleet->offset_ms[i] = step * placed;                                       /* set the offset */
+            taken[i] = 1;                                                              /* placed */
+            served[i] = 1;                                                             /* room served */
+            placed++;                                                                  /* next slot */
+        }
+    }
+    fleet->epoch_ms = now_ms;                                                          /* set the epoch */
+    memset(fleet->done_ms, 0, sizeof(fleet->done_ms));                                 /* nothing cleaned */
+    memset(fleet->busy_ms, 0, sizeof(fleet->busy_ms));                                 /* nothing running */
+    memset(fleet->deferred, 0, sizeof(fleet->deferred));                               /* nothing waits */
+    fleet->planned = 1;                                                                /* plan valid */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     set whether a sensor delivers valid values
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] sensor sensor index
+ * @param[in] valid 1 if valid, 0 for a faulty or lost sensor
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 3 fleet is not initialized
+ *            - 4 sensor is invalid
+ * @note      none
+ */
+uint8_t sen5x_fleet_set_valid(sen5x_fleet_t *fleet, uint8_t sensor, uint8_t valid)
+{
+    if (fleet == NULL)                                                                 /* check the fleet */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (fleet->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (sensor >= fleet->sensors)                                                      /* check the sensor */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    fleet->valid[sensor] = (valid != 0) ? 1 : 0;                                       /* set the valid */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the sensor to clean now
+ * @param[in]  *fleet pointer to a fleet structure
+ * @param[in]  now_ms current time in ms
+ * @param[out] *sensor pointer to a sensor buffer, SEN5X_FLEET_NONE when no cleaning is due
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet or sensor is NULL
+ *             - 3 fleet is not initialized or has no plan
+ * @note       a due cleaning waits while another sensor cleans or while its room would drop below
+ *             min_valid valid sensors, start it with sen5x_start_fan_cleaning and tell the scheduler with
+ *             sen5x_fleet_done
+ */
+uint8_t sen5x_fleet_poll(sen5x_fleet_t *fleet, uint64_t now_ms, uint8_t *sensor)
+{
+    uint8_t i;
+    uint64_t due;
+    uint64_t best;
+
+    if ((fleet == NULL) || (sensor == NULL))                                           /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((fleet->inited != 1) || (fleet->planned != 1))                                 /* check the plan */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    *sensor = SEN5X_FLEET_NONE;                                                        /* init the sensor */
+    for (i = 0; i < fleet->sensors; i++)                                               /* check the running cleanings */
+    {
+        if (fleet->busy_ms[i] > now_ms)                                                /* a sensor cleans */
+        {
+            return 0;                                                                  /* wait for it */
+        }
+    }
+    best = UINT64_MAX;                                                                 /* init the best */
+    for (i = 0; i < fleet->sensors; i++)                                               /* all sensors */
+    {
+        due = a_sen5x_fleet_due(fleet, i);                                             /* get the due time */
+        if (due > now_ms)                                                              /* not due */
+        {
+            continue;                                                                  /* next sensor */
+        }
+        if (a_sen5x_fleet_room_ok(fleet, i) == 0)                                      /* room can't spare it */
+        {
+            if (fleet->deferred[i] == 0)                                               /* first wait */
+            {
+                fleet->deferred[i] = 1;                                                /* set deferred */
+                fleet->stats.deferred++;                                               /* count it */
+            }
+            continue;                                                                  /* next sensor */
+        }
+        if (due < best)                                                                /* earliest due */
+        {
+            best = due;                                                                /* save the due time */
+            *sensor = i;                                                               /* save the sensor */
+        }
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     tell the scheduler a cleaning was started
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] sensor sensor index
+ * @param[in] now_ms time sen5x_start_fan_cleaning returned in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 3 fleet is not initialized or has no plan
+ *            - 4 sensor is invalid
+ * @note      save the plan after it so a restart neither repeats nor skips the cleaning
+ */
+uint8_t sen5x_fleet_done(sen5x_fleet_t *fleet, uint8_t sensor, uint64_t now_ms)
+{
+    uint64_t due;
+
+    if (fleet == NULL)                                                                 /* check the fleet */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((fleet->inited != 1) || (fleet->planned != 1))                                 /* check the plan */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (sensor >= fleet->sensors)                                                      /* check the sensor */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    due = a_sen5x_fleet_due(fleet, sensor);                                            /* get the due time */
+    if ((now_ms > due) && (now_ms - due > fleet->stats.max_delay_ms))                  /* longer wait */
+    {
+        fleet->stats.max_delay_ms = now_ms - due;                                      /* save the wait */
+    }
+    fleet->done_ms[sensor] = now_ms;                                                   /* save the cleaning */
+    fleet->busy_ms[sensor] = now_ms + fleet->slot_ms;                                  /* slot in use */
+    fleet->deferred[sensor] = 0;                                                       /* clear deferred */
+    fleet->stats.cleanings++;                                                          /* count the cleaning */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      save the plan
+ * @param[in]  *fleet pointer to a fleet structure
+ * @param[out] *buf pointer to a buffer of SEN5X_FLEET_PLAN_LENGTH(sensors) bytes
+ * @param[in]  len buffer length
+ * @param[out] *used pointer to a used length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet, buf or used is NULL
+ *             - 3 fleet is not initialized or has no plan
+ *             - 4 buffer is too small
+ * @note       little endian with a crc32
+ */
+uint8_t sen5x_fleet_save(sen5x_fleet_t *fleet, uint8_t *buf, uint32_t len, uint32_t *used)
+{
+    uint8_t i;
+    uint32_t n;
+
+    if ((fleet == NULL) || (buf == NULL) || (used == NULL))                            /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((fleet->inited != 1) || (fleet->planned != 1))                                 /* check the plan */
+    {
+        return 3;                                                                      /* return error */
+    }
+    n = SEN5X_FLEET_PLAN_LENGTH(fleet->sensors);                                       /* plan length */
+    if (len < n)                                                                       /* check the length */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    a_sen5x_fleet_put_u32(&buf[0], SEN5X_FLEET_MAGIC);                                 /* set the magic */
+    buf[4] = fleet->sensors;                                                           /* set the sensors */
+    buf[5] = fleet->min_valid;                                                         /* set the min valid */
+    buf[6] = 0;                                                                        /* reserved */
+    buf[7] = 0;                                                                        /* reserved */
+    a_sen5x_fleet_put_u32(&buf[8], fleet->period_s);                                   /* set the period */
+    a_sen5x_fleet_put_u32(&buf[12], fleet->slot_ms);                                   /* set the slot */
+    a_sen5x_fleet_put_u64(&buf[16], fleet->epoch_ms);                                  /* set the epoch */
+    for (i = 0; i < fleet->sensors; i++)                                               /* all sensors */
+    {
+        buf[24 + 13 * i] = fleet->room[i];                                             /* set the room */
+        a_sen5x_fleet_put_u32(&buf[24 + 13 * i + 1], fleet->offset_ms[i]);             /* set the offset */
+        a_sen5x_fleet_put_u64(&buf[24 + 13 * i + 5], fleet->done_ms[i]);               /* set the last cleaning */
+    }
+    a_sen5x_fleet_put_u32(&buf[n - 4], sen5x_archive_crc32(0, buf, n - 4));            /* set the crc */
+    *used = n;                                                                         /* save the length */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     load a saved plan
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] *buf pointer to a saved plan
+ * @param[in] len plan length
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet or buf is NULL
+ *            - 3 fleet is not initialized
+ *            - 4 plan is truncated or corrupted
+ *            - 5 plan doesn't match the sensors, period, slot, min_valid or rooms
+ * @note      set the rooms before loading, build a new plan when the load fails, a cleaning started
+ *            less than one slot before the save keeps its slot
+ */
+uint8_t sen5x_fleet_load(sen5x_fleet_t *fleet, const uint8_t *buf, uint32_t len)
+{
+    uint8_t i;
+    uint32_t n;
+
+    if ((fleet == NULL) || (buf == NULL))                                              /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (fleet->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if ((len < SEN5X_FLEET_PLAN_LENGTH(1)) || (a_sen5x_fleet_get_u32(&buf[0]) != SEN5X_FLEET_MAGIC))   /* check the header */
+    {
+        return 4;                                                                      /* return error */
+    }
+    n = SEN5X_FLEET_PLAN_LENGTH(buf[4]);                                               /* plan length */
+    if ((buf[4] == 0) || (buf[4] > SEN5X_FLEET_MAX_SENSORS) || (len < n) ||
+        (a_sen5x_fleet_get_u32(&buf[n - 4]) != sen5x_archive_crc32(0, buf, n - 4)))    /* check the crc */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if ((buf[4] != fleet->sensors) || (buf[5] != fleet->min_valid) ||
+        (a_sen5x_fleet_get_u32(&buf[8]) != fleet->period_s) ||
+        (a_sen5x_fleet_get_u32(&buf[12]) != fleet->slot_ms))                           /* check the config */
+    {
+        return 5;                                                                      /* return error */
+    }
+    for (i = 0; i < fleet->sensors; i++)                                               /* check the rooms */
+    {
+        if (buf[24 + 13 * i] != fleet->room[i])                                        /* room moved */
+        {
+            return 5;                                                                  /* return error */
+        }
+    }
+
+    fleet->epoch_ms = a_sen5x_fleet_get_u64(&buf[16]);                                 /* get the epoch */
+    for (i = 0; i < fleet->sensors; i++)                                               /* all sensors */
+    {
+        fleet->offset_ms[i] = a_sen5x_fleet_get_u32(&buf[24 + 13 * i + 1]);            /* get the offset */
+        fleet->done_ms[i] = a_sen5x_fleet_get_u64(&buf[24 + 13 * i + 5]);              /* get the last cleaning */
+        fleet->busy_ms[i] = fleet->done_ms[i] + fleet->slot_ms;                        /* a cleaning may still run */
+    }
+    memset(fleet->deferred, 0, sizeof(fleet->deferred));                               /* nothing waits */
+    fleet->planned = 1;                                                                /* plan valid */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the time of the next cleaning of a sensor
+ * @param[in]  *fleet pointer to a fleet structure
+ * @param[in]  sensor sensor index
+ * @param[out] *due_ms pointer to a due time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet or due_ms is NULL
+ *             - 3 fleet is not initialized or has no plan
+ *             - 4 sensor is invalid
+ * @note       a due time in the past means the cleaning waits
+ */
+uint8_t sen5x_fleet_get_due(sen5x_fleet_t *fleet, uint8_t sensor, uint64_t *due_ms)
+{
+    if ((fleet == NULL) || (due_ms == NULL))                                           /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((fleet->inited != 1) || (fleet->planned != 1))                                 /* check the plan */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (sensor >= fleet->sensors)                                                      /* check the sensor */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    *due_ms = a_sen5x_fleet_due(fleet, sensor);                                        /* get the due time */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the scheduler statistics
+ * @param[in]  *fleet pointer to a fleet structure
+ * @param[out] *stats pointer to a fleet stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet or stats is NULL
+ *             - 3 fleet is not initialized
+ * @note       none
+ */
+uint8_t sen5x_fleet_get_stats(sen5x_fleet_t *fleet, sen5x_fleet_stats_t *stats)
+{
+    if ((fleet == NULL) || (stats == NULL))                                            /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (fleet->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    *stats = fleet->stats;                                                             /* copy the stats */
+
+    return 0;                                                                          /* success return 0 */
+}
@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_fleet.h
+ * @brief     driver sen5x fleet header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_FLEET_H
+#define DRIVER_SEN5X_FLEET_H
+
+#include "driver_sen5x_archive.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_fleet_driver sen5x fleet driver function
+ * @brief    sen5x fleet driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x fleet definition
+ */
+#define SEN5X_FLEET_MAX_SENSORS             32                   /**< max sensors */
+#define SEN5X_FLEET_MAGIC                   0x46583553U          /**< plan magic "S5XF" */
+#define SEN5X_FLEET_NONE                    0xFF                 /**< no sensor */
+#define SEN5X_FLEET_DEFAULT_PERIOD_S        604800               /**< cleaning period of every sensor in s */
+#define SEN5X_FLEET_DEFAULT_SLOT_MS         15000                /**< cleaning, settle time and guard in ms */
+
+/**
+ * @brief     get the length of a saved plan
+ * @param[in] sensors sensor count
+ * @return    length in bytes
+ * @note      none
+ */
+#define SEN5X_FLEET_PLAN_LENGTH(sensors)    (24 + 13 * (sensors) + 4)
+
+/**
+ * @brief sen5x fleet stats structure definition
+ */
+typedef struct sen5x_fleet_stats_s
+{
+    uint64_t cleanings;                 /**< cleanings done */
+    uint64_t deferred;                  /**< due cleanings that waited for their room */
+    uint64_t max_delay_ms;              /**< longest wait of a due cleaning */
+} sen5x_fleet_stats_t;
+
+/**
+ * @brief sen5x fleet structure definition
+ */
+typedef struct sen5x_fleet_s
+{
+    uint8_t sensors;                                            /**< sensor count */
+    uint8_t min_valid;                                          /**< valid sensors a room keeps during a cleaning */
+    uint32_t period_s;                                          /**< cleaning period of every sensor */
+    uint32_t slot_ms;                                           /**< cleaning slot */
+    uint64_t epoch_ms;                                          /**< plan start */
+    uint8_t room[SEN5X_FLEET_MAX_SENSORS];                      /**< room of every sensor */
+    uint32_t offset_ms[SEN5X_FLEET_MAX_SENSORS];                /**< plan offset of every sensor */
+    uint64_t done_ms[SEN5X_FLEET_MAX_SENSORS];                  /**< last cleaning of every sensor, 0 for none */
+    uint64_t busy_ms[SEN5X_FLEET_MAX_SENSORS];                  /**< end of the running cleaning */
+    uint8_t valid[SEN5X_FLEET_MAX_SENSORS];                     /**< sensor delivers valid values */
+    uint8_t deferred[SEN5X_FLEET_MAX_SENSORS];                  /**< due cleaning waits for its room */
+    uint8_t planned;                                            /**< plan valid */
+    sen5x_fleet_stats_t stats;                                  /**< stats */
+    uint8_t inited;                                             /**< inited flag */
+} sen5x_fleet_t;
+
+/**
+ * @brief     init the fleet cleaning scheduler
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] sensors sensor count
+ * @param[in] period_s cleaning period of every sensor in s
+ * @param[in] slot_ms cleaning slot in ms
+ * @param[in] min_valid valid sensors a room keeps during a cleaning
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 4 sensors is invalid
+ *            - 5 period is invalid
+ *            - 6 slot is invalid
+ * @note      1 <= sensors <= 32, 10 <= period_s <= 604800, 0 < slot_ms * sensors <= period_s * 1000,
+ *            every sensor starts in room 0 and valid, disable the auto cleaning of every sensor with
+ *            sen5x_disable_auto_cleaning_interval so only the scheduler cleans
+ */
+uint8_t sen5x_fleet_init(sen5x_fleet_t *fleet, uint8_t sensors, uint32_t period_s, uint32_t slot_ms, uint8_t min_valid);
+
+/**
+ * @brief     set the room of a sensor
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] sensor sensor index
+ * @param[in] room room id
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 3 fleet is not initialized
+ *            - 4 sensor is invalid
+ * @note      a changed room drops the plan
+ */
+uint8_t sen5x_fleet_set_room(sen5x_fleet_t *fleet, uint8_t sensor, uint8_t room);
+
+/**
+ * @brief     build a new plan
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] now_ms current time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 3 fleet is not initialized
+ *            - 4 a room has no more sensors than min_valid
+ * @note      the sensors get evenly spaced slots of the period in an order that takes turns between the
+ *            rooms, so only one sensor cleans at a time and the cleanings of a room are spread out,
+ *            the time must come from a clock that survives a restart
+ */
+uint8_t sen5x_fleet_plan(sen5x_fleet_t *fleet, uint64_t now_ms);
+
+/**
+ * @brief     set whether a sensor delivers valid values
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] sensor sensor index
+ * @param[in] valid 1 if valid, 0 for a faulty or lost sensor
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 3 fleet is not initialized
+ *            - 4 sensor is invalid
+ * @note      none
+ */
+uint8_t sen5x_fleet_set_valid(sen5x_fleet_t *fleet, uint8_t sensor, uint8_t valid);
+
+/**
+ * @brief      get the sensor to clean now
+ * @param[in]  *fleet pointer to a fleet structure
+ * @param[in]  now_ms current time in ms
+ * @param[out] *sensor pointer to a sensor buffer, SEN5X_FLEET_NONE when no cleaning is due
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet or sensor is NULL
+ *             - 3 fleet is not initialized or has no plan
+ * @note       a due cleaning waits while another sensor cleans or while its room would drop below
+ *             min_valid valid sensors, start it with sen5x_start_fan_cleaning and tell the scheduler with
+ *             sen5x_fleet_done
+ */
+uint8_t sen5x_fleet_poll(sen5x_fleet_t *fleet, uint64_t now_ms, uint8_t *sensor);
+
+/**
+ * @brief     tell the scheduler a cleaning was started
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] sensor sensor index
+ * @param[in] now_ms time sen5x_start_fan_cleaning returned in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 3 fleet is not initialized or has no plan
+ *            - 4 sensor is invalid
+ * @note      save the plan after it so a restart neither repeats nor skips the cleaning
+ */
+uint8_t sen5x_fleet_done(sen5x_fleet_t *fleet, uint8_t sensor, uint64_t now_ms);
+
+/**
+ * @brief      save the plan
+ * @param[in]  *fleet pointer to a fleet structure
+ * @param[out] *buf pointer to a buffer of SEN5X_FLEET_PLAN_LENGTH(sensors) bytes
+ * @param[in]  len buffer length
+ * @param[out] *used pointer to a used length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet, buf or used is NULL
+ *             - 3 fleet is not initialized or has no plan
+ *             - 4 buffer is too small
+ * @note       little endian with a crc32
+ */
+uint8_t sen5x_fleet_save(sen5x_fleet_t *fleet, uint8_t *buf, uint32_t len, uint32_t *used);
+
+/**
+ * @brief     load a saved plan
+ * @param[in] *fleet pointer to a fleet structure
+ * @param[in] *buf pointer to a saved plan
+ * @param[in] len plan length
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet or buf is NULL
+ *            - 3 fleet is not initialized
+ *            - 4 plan is truncated or corrupted
+ *            - 5 plan doesn't match the sensors, period, slot, min_valid or rooms
+ * @note      set the rooms before loading, build a new plan when the load fails, a cleaning started
+ *            less than one slot before the save keeps its slot
+ */
+uint8_t sen5x_fleet_load(sen5x_fleet_t *fleet, const uint8_t *buf, uint32_t len);
+
+/**
+ * @brief      get the time of the next cleaning of a sensor
+ * @param[in]  *fleet pointer to a fleet structure
+ * @param[in]  sensor sensor index
+ * @param[out] *due_ms pointer to a due time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet or due_ms is NULL
+ *             - 3 fleet is not initialized or has no plan
+ *             - 4 sensor is invalid
+ * @note       a due time in the past means the cleaning waits
+ */
+uint8_t sen5x_fleet_get_due(sen5x_fleet_t *fleet, uint8_t sensor, uint64_t *due_ms);
+
+/**
+ * @brief      get the scheduler statistics
+ * @param[in]  *fleet pointer to a fleet structure
+ * @param[out] *stats pointer to a fleet stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet or stats is NULL
+ *             - 3 fleet is not initialized
+ * @note       none
+ */
+uint8_t sen5x_fleet_get_stats(sen5x_fleet_t *fleet, sen5x_fleet_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
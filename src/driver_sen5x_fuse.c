@@ -0,0 +1,441 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_fuse.c
+ * @brief     driver sen5x fuse source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_fuse.h"
+
+/**
+ * @brief sen5x fuse definition
+ */
+#define SEN5X_FUSE_PM_MASK        (SEN5X_STATUS_FAN_SPEED_ERROR | SEN5X_STATUS_FAN_CLEANING_ACTIVE | \
+                                   SEN5X_STATUS_LASER_ERROR | SEN5X_STATUS_FAN_ERROR)     /**< status bits invalidating pm */
+#define SEN5X_FUSE_RHT_MASK       (SEN5X_STATUS_RHT_ERROR)                                /**< status bits invalidating rht */
+#define SEN5X_FUSE_GAS_MASK       (SEN5X_STATUS_GAS_ERROR)                                /**< status bits invalidating gas */
+#define SEN5X_FUSE_OUTLIER        3.0f                                                    /**< outlier threshold in spreads */
+#define SEN5X_FUSE_MAD_SCALE      1.4826f                                                 /**< mad to standard deviation */
+
+/**
+ * @brief layout channel status mask table
+ */
+static const uint32_t gs_mask[2][SEN5X_FUSE_MAX_CHANNELS] =
+{
+    {SEN5X_FUSE_PM_MASK, SEN5X_FUSE_PM_MASK, SEN5X_FUSE_PM_MASK, SEN5X_FUSE_PM_MASK,
+     SEN5X_FUSE_RHT_MASK, SEN5X_FUSE_RHT_MASK, SEN5X_FUSE_GAS_MASK, SEN5X_FUSE_GAS_MASK, 0, 0},
+    {SEN5X_FUSE_PM_MASK, SEN5X_FUSE_PM_MASK, SEN5X_FUSE_PM_MASK, SEN5X_FUSE_PM_MASK, SEN5X_FUSE_PM_MASK,
+     SEN5X_FUSE_PM_MASK, SEN5X_FUSE_PM_MASK, SEN5X_FUSE_PM_MASK, SEN5X_FUSE_PM_MASK, SEN5X_FUSE_PM_MASK},
+};
+
+/**
+ * @brief layout channel accuracy table
+ * @note  datasheet accuracy at low levels, the outlier threshold never goes below 3 times these
+ */
+static const float gs_accuracy[2][SEN5X_FUSE_MAX_CHANNELS] =
+{
+    {5.0f, 5.0f, 5.0f, 5.0f, 4.5f, 0.45f, 15.0f, 15.0f, 0.0f, 0.0f},
+    {5.0f, 5.0f, 5.0f, 5.0f, 5.0f, 5.0f, 5.0f, 5.0f, 5.0f, 0.1f},
+};
+
+/**
+ * @brief     select the k-th smallest value
+ * @param[in] *a pointer to a value buffer
+ * @param[in] n value count
+ * @param[in] k order
+ * @return    k-th smallest value
+ * @note      the buffer is left partitioned around k, expected linear time
+ */
+static float a_sen5x_fuse_select(float *a, int32_t n, int32_t k)
+{
+    int32_t lo;
+    int32_t hi;
+    int32_t i;
+    int32_t j;
+    float pivot;
+    float t;
+
+    lo = 0;                                                                            /* first */
+    hi = n - 1;                                                                        /* last */
+    while (lo < hi)                                                                    /* until one value is left */
+    {
+        pivot = a[lo + (hi - lo) / 2];                                                 /* middle pivot */
+        i = lo;                                                                        /* left cursor */
+        j = hi;                                                                        /* right cursor */
+        while (i <= j)                                                                 /* partition */
+        {
+            while (a[i] < pivot)                                                       /* left side is fine */
+            {
+                i++;                                                                   /* next */
+            }
+            while (a[j] > pivot)                                                       /* right side is fine */
+            {
+                j--;                                                                   /* next */
+            }
+            if (i <= j)                                                                /* swap the pair */
+            {
+                t = a[i];                                                              /* save */
+                a[i] = a[j];                                                           /* swap */
+                a[j] = t;                                                              /* swap */
+                i++;                                                                   /* next */
+                j--;                                                                   /* next */
+            }
+        }
+        if (k <= j)                                                                    /* in the left part */
+        {
+            hi = j;                                                                    /* keep the left */
+        }
+        else if (k >= i)                                                               /* in the right part */
+        {
+            lo = i;                                                                    /* keep the right */
+        }
+        else
+        {
+            break;                                                                     /* equal to the pivot */
+        }
+    }
+
+    return a[k];                                                                       /* return the value */
+}
+
+/**
+ * @brief     get the median
+ * @param[in] *a pointer to a value buffer
+ * @param[in] n value count
+ * @return    median
+ * @note      the buffer is reordered
+ */
+static float a_sen5x_fuse_median(float *a, int32_t n)
+{
+    int32_t i;
+    float upper;
+    float lower;
+
+    upper = a_sen5x_fuse_select(a, n, n / 2);                                          /* upper median */
+    if ((n % 2) != 0)                                                                  /* odd count */
+    {
+        return upper;                                                                  /* middle value */
+    }
+    lower = a[0];                                                                      /* init the lower median */
+    for (i = 1; i < n / 2; i++)                                                        /* max of the lower half */
+    {
+        lower = (a[i] > lower) ? a[i] : lower;                                         /* update */
+    }
+
+    return 0.5f * (lower + upper);                                                     /* mean of the middle values */
+}
+
+/**
+ * @brief     init the fusion
+ * @param[in] *fuse pointer to a fuse structure
+ * @param[in] layout SEN5X_ARCHIVE_LAYOUT_MEASURED or SEN5X_ARCHIVE_LAYOUT_PM
+ * @param[in] sensors sensor count
+ * @param[in] method fuse method
+ * @param[in] trim trimmed fraction per side of the trimmed mean
+ * @param[in] bias_ticks time constant of the bias estimates in ticks, 0 disables them
+ * @return    status code
+ *            - 0 success
+ *            - 2 fuse is NULL
+ *            - 4 layout is invalid
+ *            - 5 sensors is invalid
+ *            - 6 method is invalid
+ *            - 7 trim is invalid
+ * @note      1 <= sensors <= 32, 0 <= trim < 0.5
+ */
+uint8_t sen5x_fuse_init(sen5x_fuse_t *fuse, sen5x_archive_layout_t layout, uint8_t sensors,
+                        sen5x_fuse_method_t method, float trim, uint32_t bias_ticks)
+{
+    if (fuse == NULL)                                                                  /* check the fuse */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((layout != SEN5X_ARCHIVE_LAYOUT_MEASURED) && (layout != SEN5X_ARCHIVE_LAYOUT_PM))   /* check the layout */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if ((sensors == 0) || (sensors > SEN5X_FUSE_MAX_SENSORS))                          /* check the sensors */
+    {
+        return 5;                                                                      /* return error */
+    }
+    if ((method != SEN5X_FUSE_METHOD_MEDIAN) && (method != SEN5X_FUSE_METHOD_TRIMMED_MEAN))   /* check the method */
+    {
+        return 6;                                                                      /* return error */
+    }
+    if (!((trim >= 0.0f) && (trim < 0.5f)))                                            /* check the trim */
+    {
+        return 7;                                                                      /* return error */
+    }
+
+    memset(fuse, 0, sizeof(sen5x_fuse_t));                                             /* clear the fuse */
+    fuse->layout = (uint8_t)layout;                                                    /* set the layout */
+    fuse->sensors = sensors;                                                           /* set the sensors */
+    fuse->channels = sen5x_archive_layout_channels(layout);                            /* set the channels */
+    fuse->method = (uint8_t)method;                                                    /* set the method */
+    fuse->trim = trim;                                                                 /* set the trim */
+    fuse->alpha = (bias_ticks != 0) ? 1.0f / (float)bias_ticks : 0.0f;                 /* set the bias step */
+    fuse->inited = 1;                                                                  /* flag inited */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     set the device status of a sensor
+ * @param[in] *fuse pointer to a fuse structure
+ * @param[in] sensor sensor index
+ * @param[in] status device status read by sen5x_get_device_status
+ * @return    status code
+ *            - 0 success
+ *            - 2 fuse is NULL
+ *            - 3 fuse is not initialized
+ *            - 4 sensor is invalid
+ * @note      fan, fan speed, laser and fan cleaning bits leave out the pm channels, the rht error bit
+ *            leaves out humidity and temperature and the gas error bit leaves out voc and nox
+ */
+uint8_t sen5x_fuse_set_status(sen5x_fuse_t *fuse, uint8_t sensor, uint32_t status)
+{
+    if (fuse == NULL)                                                                  /* check the fuse */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (fuse->inited != 1)                                                             /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (sensor >= fuse->sensors)                                                       /* check the sensor */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    fuse->status[sensor] = status;                                                     /* save the status */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      fuse an aligned row
+ * @param[in]  *fuse pointer to a fuse structure
+ * @param[in]  *row pointer to a resample row structure with one stream per sensor
+ * @param[out] *result pointer to a fuse result structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 fuse, row or result is NULL
+ *             - 3 fuse is not initialized
+ *             - 4 row doesn't match the sensors or the layout
+ * @note       a value further than 3 robust spreads, but at least 3 channel accuracies, from the median
+ *             is an outlier, the biases follow the clipped residuals so a fault lasting much longer than
+ *             bias_ticks is learned as an offset, the work is linear in the sensors without allocation
+ */
+uint8_t sen5x_fuse_update(sen5x_fuse_t *fuse, const sen5x_resample_row_t *row, sen5x_fuse_result_t *result)
+{
+    uint8_t c;
+    uint8_t s;
+    int32_t i;
+    int32_t n;
+    int32_t kept;
+    int32_t k;
+    float v;
+    float m;
+    float r;
+    float thr;
+    float sum;
+
+    if ((fuse == NULL) || (row == NULL) || (result == NULL))                           /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (fuse->inited != 1)                                                             /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if ((row->streams != fuse->sensors) || (row->channels != fuse->channels))          /* check the row */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    result->tick_ms = row->tick_ms;                                                    /* set the tick */
+    result->channels = fuse->channels;                                                 /* set the channels */
+    for (c = 0; c < fuse->channels; c++)                                               /* run all channels */
+    {
+        n = 0;                                                                         /* init 0 */
+        result->excluded[c] = 0;                                                       /* init 0 */
+        result->outlier[c] = 0;                                                        /* init 0 */
+        for (s = 0; s < fuse->sensors; s++)                                            /* collect the usable values */
+        {
+            v = row->value[c][s];                                                      /* get the value */
+            if (((row->valid & (1UL << s)) == 0) || (isnan(v) != 0))                   /* no value */
+            {
+                continue;                                                              /* next sensor */
+            }
+            if ((fuse->status[s] & gs_mask[fuse->layout][c]) != 0)                     /* device status error */
+            {
+                result->excluded[c] |= 1UL << s;                                       /* flag excluded */
+                fuse->stats[s].excluded++;                                             /* count excluded */
+                continue;                                                              /* next sensor */
+            }
+            fuse->value[n] = v - fuse->bias[c][s];                                     /* bias corrected value */
+            fuse->index[n] = s;                                                        /* save the sensor */
+            n++;                                                                       /* one more */
+        }
+        result->used[c] = (uint8_t)n;                                                  /* set the used sensors */
+        if (n == 0)                                                                    /* no usable sensor */
+        {
+            result->value[c] = NAN;                                                    /* no consensus */
+            result->spread[c] = NAN;                                                   /* no spread */
+            continue;                                                                  /* next channel */
+        }
+
+        memcpy(fuse->work, fuse->value, sizeof(float) * n);                            /* copy for the selection */
+        m = a_sen5x_fuse_median(fuse->work, n);                                        /* median */
+        for (i = 0; i < n; i++)                                                        /* absolute deviations */
+        {
+            fuse->work[i] = fabsf(fuse->value[i] - m);                                 /* deviation */
+        }
+        result->spread[c] = (n >= 3) ? SEN5X_FUSE_MAD_SCALE * a_sen5x_fuse_median(fuse->work, n) : 0.0f;   /* robust spread */
+        thr = SEN5X_FUSE_OUTLIER * ((result->spread[c] > gs_accuracy[fuse->layout][c]) ?
+              result->spread[c] : gs_accuracy[fuse->layout][c]);                       /* outlier threshold */
+        kept = 0;                                                                      /* init 0 */
+        sum = 0.0f;                                                                    /* init 0 */
+        for (i = 0; i < n; i++)                                                        /* flag and follow the biases */
+        {
+            s = fuse->index[i];                                                        /* get the sensor */
+            r = fuse->value[i] - m;                                                    /* residual */
+            fuse->stats[s].values++;                                                   /* count the value */
+            if (fabsf(r) > thr)                                                        /* outlier */
+            {
+                result->outlier[c] |= 1UL << s;                                        /* flag the outlier */
+                fuse->stats[s].outliers++;                                             /* count the outlier */
+                r = (r > 0.0f) ? thr : -thr;                                           /* clip the residual */
+                fuse->bias[c][s] += fuse->alpha * r;                                   /* follow slowly */
+                continue;                                                              /* next sensor */
+            }
+            fuse->bias[c][s] += fuse->alpha * r;                                       /* follow the bias */
+            sum += fuse->bias[c][s];                                                   /* sum the biases */
+            fuse->work[kept] = fuse->value[i];                                         /* keep the value */
+            kept++;                                                                    /* one more */
+        }
+        if (kept != 0)                                                                 /* keep the biases centered */
+        {
+            sum /= (float)kept;                                                        /* mean bias of the kept sensors */
+            for (i = 0; i < n; i++)                                                    /* run the used sensors */
+            {
+                fuse->bias[c][fuse->index[i]] -= sum;                                  /* center */
+            }
+        }
+        if ((fuse->method == SEN5X_FUSE_METHOD_TRIMMED_MEAN) && (kept != 0))           /* trimmed mean */
+        {
+            k = (int32_t)(fuse->trim * (float)kept);                                   /* values trimmed per side */
+            (void)a_sen5x_fuse_select(fuse->work, kept, k);                            /* cut the low side */
+            if (kept - 2 * k > 1)                                                      /* more than one value left */
+            {
+                (void)a_sen5x_fuse_select(&fuse->work[k], kept - k, kept - 1 - 2 * k);   /* cut the high side */
+            }
+            sum = 0.0f;                                                                /* init 0 */
+            for (i = k; i < kept - k; i++)                                             /* sum the middle */
+            {
+                sum += fuse->work[i];                                                  /* add the value */
+            }
+            m = sum / (float)(kept - 2 * k);                                           /* trimmed mean */
+        }
+        result->value[c] = m;                                                          /* set the consensus */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the bias estimates of a sensor
+ * @param[in]  *fuse pointer to a fuse structure
+ * @param[in]  sensor sensor index
+ * @param[out] *bias pointer to a bias buffer of the layout channels
+ * @return     status code
+ *             - 0 success
+ *             - 2 fuse or bias is NULL
+ *             - 3 fuse is not initialized
+ *             - 4 sensor is invalid
+ * @note       the biases of the unflagged sensors average to 0
+ */
+uint8_t sen5x_fuse_get_bias(sen5x_fuse_t *fuse, uint8_t sensor, float *bias)
+{
+    uint8_t c;
+
+    if ((fuse == NULL) || (bias == NULL))                                              /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (fuse->inited != 1)                                                             /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (sensor >= fuse->sensors)                                                       /* check the sensor */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    for (c = 0; c < fuse->channels; c++)                                               /* run all channels */
+    {
+        bias[c] = fuse->bias[c][sensor];                                               /* copy the bias */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the stats of a sensor
+ * @param[in]  *fuse pointer to a fuse structure
+ * @param[in]  sensor sensor index
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 fuse or stats is NULL
+ *             - 3 fuse is not initialized
+ *             - 4 sensor is invalid
+ * @note       none
+ */
+uint8_t sen5x_fuse_get_stats(sen5x_fuse_t *fuse, uint8_t sensor, sen5x_fuse_stats_t *stats)
+{
+    if ((fuse == NULL) || (stats == NULL))                                             /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (fuse->inited != 1)                                                             /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (sensor >= fuse->sensors)                                                       /* check the sensor */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    *stats = fuse->stats[sensor];                                                      /* copy the stats */
+
+    return 0;                                                                          /* success return 0 */
+}
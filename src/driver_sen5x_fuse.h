@@ -0,0 +1,200 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_fuse.h
+ * @brief     driver sen5x fuse header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_FUSE_H
+#define DRIVER_SEN5X_FUSE_H
+
+#include "driver_sen5x_archive.h"
+#include "driver_sen5x_resample.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_fuse_driver sen5x fuse driver function
+ * @brief    sen5x fuse driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x fuse definition
+ */
+#define SEN5X_FUSE_MAX_SENSORS         SEN5X_RESAMPLE_MAX_STREAMS         /**< max sensors */
+#define SEN5X_FUSE_MAX_CHANNELS        10                                 /**< max channels */
+
+/**
+ * @brief sen5x fuse method enumeration definition
+ */
+typedef enum
+{
+    SEN5X_FUSE_METHOD_MEDIAN       = 0x00,        /**< median of the bias corrected values */
+    SEN5X_FUSE_METHOD_TRIMMED_MEAN = 0x01,        /**< trimmed mean of the bias corrected values without the outliers */
+} sen5x_fuse_method_t;
+
+/**
+ * @brief sen5x fuse result structure definition
+ */
+typedef struct sen5x_fuse_result_s
+{
+    uint64_t tick_ms;                                 /**< row tick */
+    uint8_t channels;                                 /**< channel count */
+    float value[SEN5X_FUSE_MAX_CHANNELS];             /**< consensus value, nan without a usable sensor */
+    float spread[SEN5X_FUSE_MAX_CHANNELS];            /**< robust spread of the sensors around the consensus */
+    uint8_t used[SEN5X_FUSE_MAX_CHANNELS];            /**< sensors with a usable value */
+    uint32_t outlier[SEN5X_FUSE_MAX_CHANNELS];        /**< flagged sensors, bit n is sensor n */
+    uint32_t excluded[SEN5X_FUSE_MAX_CHANNELS];       /**< sensors left out by their device status */
+} sen5x_fuse_result_t;
+
+/**
+ * @brief sen5x fuse sensor stats structure definition
+ */
+typedef struct sen5x_fuse_stats_s
+{
+    uint64_t values;                    /**< usable channel values */
+    uint64_t outliers;                  /**< flagged channel values */
+    uint64_t excluded;                  /**< channel values left out by the device status */
+} sen5x_fuse_stats_t;
+
+/**
+ * @brief sen5x fuse structure definition
+ */
+typedef struct sen5x_fuse_s
+{
+    uint8_t layout;                                                        /**< archive layout of the channels */
+    uint8_t sensors;                                                       /**< sensor count */
+    uint8_t channels;                                                      /**< channel count */
+    uint8_t method;                                                        /**< fuse method */
+    float trim;                                                            /**< trimmed fraction per side */
+    float alpha;                                                           /**< bias step per tick */
+    uint32_t status[SEN5X_FUSE_MAX_SENSORS];                               /**< last device status per sensor */
+    float bias[SEN5X_FUSE_MAX_CHANNELS][SEN5X_FUSE_MAX_SENSORS];           /**< bias estimates */
+    float value[SEN5X_FUSE_MAX_SENSORS];                                   /**< bias corrected values of a channel */
+    float work[SEN5X_FUSE_MAX_SENSORS];                                    /**< selection buffer */
+    uint8_t index[SEN5X_FUSE_MAX_SENSORS];                                 /**< sensor of each corrected value */
+    sen5x_fuse_stats_t stats[SEN5X_FUSE_MAX_SENSORS];                      /**< sensor stats */
+    uint8_t inited;                                                        /**< inited flag */
+} sen5x_fuse_t;
+
+/**
+ * @brief     init the fusion
+ * @param[in] *fuse pointer to a fuse structure
+ * @param[in] layout SEN5X_ARCHIVE_LAYOUT_MEASURED or SEN5X_ARCHIVE_LAYOUT_PM
+ * @param[in] sensors sensor count
+ * @param[in] method fuse method
+ * @param[in] trim trimmed fraction per side of the trimmed mean
+ * @param[in] bias_ticks time constant of the bias estimates in ticks, 0 disables them
+ * @return    status code
+ *            - 0 success
+ *            - 2 fuse is NULL
+ *            - 4 layout is invalid
+ *            - 5 sensors is invalid
+ *            - 6 method is invalid
+ *            - 7 trim is invalid
+ * @note      1 <= sensors <= 32, 0 <= trim < 0.5
+ */
+uint8_t sen5x_fuse_init(sen5x_fuse_t *fuse, sen5x_archive_layout_t layout, uint8_t sensors,
+                        sen5x_fuse_method_t method, float trim, uint32_t bias_ticks);
+
+/**
+ * @brief     set the device status of a sensor
+ * @param[in] *fuse pointer to a fuse structure
+ * @param[in] sensor sensor index
+ * @param[in] status device status read by sen5x_get_device_status
+ * @return    status code
+ *            - 0 success
+ *            - 2 fuse is NULL
+ *            - 3 fuse is not initialized
+ *            - 4 sensor is invalid
+ * @note      fan, fan speed, laser and fan cleaning bits leave out the pm channels, the rht error bit
+ *            leaves out humidity and temperature and the gas error bit leaves out voc and nox
+ */
+uint8_t sen5x_fuse_set_status(sen5x_fuse_t *fuse, uint8_t sensor, uint32_t status);
+
+/**
+ * @brief      fuse an aligned row
+ * @param[in]  *fuse pointer to a fuse structure
+ * @param[in]  *row pointer to a resample row structure with one stream per sensor
+ * @param[out] *result pointer to a fuse result structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 fuse, row or result is NULL
+ *             - 3 fuse is not initialized
+ *             - 4 row doesn't match the sensors or the layout
+ * @note       a value further than 3 robust spreads, but at least 3 channel accuracies, from the median
+ *             is an outlier, the biases follow the clipped residuals so a fault lasting much longer than
+ *             bias_ticks is learned as an offset, the work is linear in the sensors without allocation
+ */
+uint8_t sen5x_fuse_update(sen5x_fuse_t *fuse, const sen5x_resample_row_t *row, sen5x_fuse_result_t *result);
+
+/**
+ * @brief      get the bias estimates of a sensor
+ * @param[in]  *fuse pointer to a fuse structure
+ * @param[in]  sensor sensor index
+ * @param[out] *bias pointer to a bias buffer of the layout channels
+ * @return     status code
+ *             - 0 success
+ *             - 2 fuse or bias is NULL
+ *             - 3 fuse is not initialized
+ *             - 4 sensor is invalid
+ * @note       the biases of the unflagged sensors average to 0
+ */
+uint8_t sen5x_fuse_get_bias(sen5x_fuse_t *fuse, uint8_t sensor, float *bias);
+
+/**
+ * @brief      get the stats of a sensor
+ * @param[in]  *fuse pointer to a fuse structure
+ * @param[in]  sensor sensor index
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 fuse or stats is NULL
+ *             - 3 fuse is not initialized
+ *             - 4 sensor is invalid
+ * @note       none
+ */
+uint8_t sen5x_fuse_get_stats(sen5x_fuse_t *fuse, uint8_t sensor, sen5x_fuse_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
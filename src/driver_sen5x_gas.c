@@ -0,0 +1,874 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_gas.c
+ * @brief     driver sen5x gas source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_gas.h"
+
+/**
+ * @brief fixed point definition
+ */
+#define F16(x)                                ((int32_t)(((x) >= 0) ? ((x) * 65536.0 + 0.5) : ((x) * 65536.0 - 0.5)))
+#define FIX16_ONE                             0x00010000
+#define FIX16_MAXIMUM                         0x7FFFFFFF
+#define FIX16_MINIMUM                         (-0x7FFFFFFF - 1)
+
+/**
+ * @brief gas index algorithm definition
+ */
+#define INITIAL_BLACKOUT                      45.0                 /**< seconds without output */
+#define INDEX_GAIN                            230                  /**< default gain factor */
+#define SRAW_STD_INITIAL                      50                   /**< default initial standard deviation */
+#define SRAW_STD_BONUS_VOC                    220.0                /**< voc standard deviation bonus */
+#define SRAW_STD_NOX                          2000.0               /**< fixed nox standard deviation */
+#define TAU_MEAN_HOURS                        12                   /**< default mean learning time */
+#define TAU_VARIANCE_HOURS                    12                   /**< default variance learning time */
+#define TAU_INITIAL_MEAN_VOC                  20.0                 /**< initial voc mean learning time in seconds */
+#define TAU_INITIAL_MEAN_NOX                  1200.0               /**< initial nox mean learning time in seconds */
+#define INIT_DURATION_MEAN_VOC                (3600.0 * 0.75)      /**< initial voc mean learning duration */
+#define INIT_DURATION_MEAN_NOX                (3600.0 * 4.75)      /**< initial nox mean learning duration */
+#define INIT_TRANSITION_MEAN                  0.01                 /**< initial mean transition slope */
+#define TAU_INITIAL_VARIANCE                  2500.0               /**< initial variance learning time in seconds */
+#define INIT_DURATION_VARIANCE_VOC            (3600.0 * 1.45)      /**< initial voc variance learning duration */
+#define INIT_DURATION_VARIANCE_NOX            (3600.0 * 5.70)      /**< initial nox variance learning duration */
+#define INIT_TRANSITION_VARIANCE              0.01                 /**< initial variance transition slope */
+#define GATING_THRESHOLD_VOC                  340.0                /**< voc gating threshold */
+#define GATING_THRESHOLD_NOX                  30.0                 /**< nox gating threshold */
+#define GATING_THRESHOLD_INITIAL              510.0                /**< initial gating threshold */
+#define GATING_THRESHOLD_TRANSITION           0.09                 /**< gating transition slope */
+#define GATING_VOC_MAX_DURATION_MINUTES       (60 * 3)             /**< default voc gating duration */
+#define GATING_NOX_MAX_DURATION_MINUTES       (60 * 12)            /**< default nox gating duration */
+#define GATING_MAX_RATIO                      0.3                  /**< gating duration ratio */
+#define SIGMOID_L                             500.0                /**< index sigmoid height */
+#define SIGMOID_K_VOC                         (-0.0065)            /**< voc index sigmoid slope */
+#define SIGMOID_X0_VOC                        213.0                /**< voc index sigmoid center */
+#define SIGMOID_K_NOX                         (-0.0101)            /**< nox index sigmoid slope */
+#define SIGMOID_X0_NOX                        614.0                /**< nox index sigmoid center */
+#define VOC_INDEX_OFFSET_DEFAULT              100                  /**< default voc index offset */
+#define NOX_INDEX_OFFSET_DEFAULT              1                    /**< default nox index offset */
+#define LP_TAU_FAST                           20.0                 /**< fast lowpass time constant */
+#define LP_TAU_SLOW                           500.0                /**< slow lowpass time constant */
+#define LP_ALPHA                              (-0.2)               /**< adaptive lowpass factor */
+#define VOC_SRAW_MINIMUM                      20000                /**< voc sraw minimum */
+#define NOX_SRAW_MINIMUM                      10000                /**< nox sraw minimum */
+#define PERSISTENCE_UPTIME_GAMMA              (3.0 * 3600.0)       /**< learning time of restored states */
+#define MVE_GAMMA_SCALING                     64.0                 /**< estimator gain scaling */
+#define MVE_ADDITIONAL_GAMMA_MEAN_SCALING     8.0                  /**< estimator mean gain scaling */
+#define MVE_FIX16_MAX                         32767.0              /**< estimator uptime limit */
+
+/**
+ * @brief     multiply two fixed point values
+ * @param[in] a first value
+ * @param[in] b second value
+ * @return    rounded and saturated product
+ * @note      none
+ */
+static int32_t a_sen5x_gas_mul(int32_t a, int32_t b)
+{
+    int64_t p;
+
+    p = (int64_t)a * (int64_t)b;                                                       /* full product */
+    p = (p >= 0) ? ((p + 0x8000) >> 16) : (-((-p + 0x8000) >> 16));                   /* round half away from zero */
+    if (p > FIX16_MAXIMUM)                                                             /* check the upper limit */
+    {
+        return FIX16_MAXIMUM;                                                          /* saturate */
+    }
+    if (p < -FIX16_MAXIMUM)                                                            /* check the lower limit */
+    {
+        return -FIX16_MAXIMUM;                                                         /* saturate */
+    }
+
+    return (int32_t)p;                                                                 /* return the product */
+}
+
+/**
+ * @brief     divide two fixed point values
+ * @param[in] a dividend
+ * @param[in] b divisor
+ * @return    rounded and saturated quotient
+ * @note      a zero divisor gives the minimum value like libfixmath
+ */
+static int32_t a_sen5x_gas_div(int32_t a, int32_t b)
+{
+    int64_t n;
+    int64_t d;
+    int64_t q;
+
+    if (b == 0)                                                                        /* check the divisor */
+    {
+        return FIX16_MINIMUM;                                                          /* return the minimum */
+    }
+    n = (a >= 0) ? ((int64_t)a) : (-(int64_t)a);                                       /* absolute dividend */
+    d = (b >= 0) ? ((int64_t)b) : (-(int64_t)b);                                       /* absolute divisor */
+    q = ((n << 16) + (d >> 1)) / d;                                                    /* rounded quotient */
+    q = (q > FIX16_MAXIMUM) ? FIX16_MAXIMUM : q;                                       /* saturate */
+
+    return ((a < 0) != (b < 0)) ? ((int32_t)(-q)) : ((int32_t)q);                      /* apply the sign */
+}
+
+/**
+ * @brief     square root of a fixed point value
+ * @param[in] a value
+ * @return    rounded square root
+ * @note      a value <= 0 gives 0
+ */
+static int32_t a_sen5x_gas_sqrt(int32_t a)
+{
+    uint64_t v;
+    uint64_t r;
+    uint64_t bit;
+
+    if (a <= 0)                                                                        /* check the value */
+    {
+        return 0;                                                                      /* return 0 */
+    }
+    v = (uint64_t)a << 16;                                                             /* scale to q32.32 */
+    r = 0;                                                                             /* init the root */
+    bit = (uint64_t)1 << 62;                                                           /* highest even bit */
+    while (bit > v)                                                                    /* find the start bit */
+    {
+        bit >>= 2;                                                                     /* next even bit */
+    }
+    while (bit != 0)                                                                   /* digit by digit */
+    {
+        if (v >= r + bit)                                                              /* digit is 1 */
+        {
+            v -= r + bit;                                                              /* subtract */
+            r = (r >> 1) + bit;                                                        /* set the digit */
+        }
+        else
+        {
+            r >>= 1;                                                                   /* digit is 0 */
+        }
+        bit >>= 2;                                                                     /* next digit */
+    }
+    if (v > r)                                                                         /* round the last digit */
+    {
+        r++;                                                                           /* round up */
+    }
+
+    return (int32_t)r;                                                                 /* return the root */
+}
+
+/**
+ * @brief     exponential of a fixed point value
+ * @param[in] x exponent
+ * @return    exponential
+ * @note      multiplies exp(+-1), exp(+-1/8), exp(+-1/64) and exp(+-1/512) like the
+ *            fixed point reference of the algorithm
+ */
+static int32_t a_sen5x_gas_exp(int32_t x)
+{
+    static const int32_t gs_exp_pos[4] = {F16(2.7182818), F16(1.1331485), F16(1.0157477), F16(1.0019550)};
+    static const int32_t gs_exp_neg[4] = {F16(0.3678794), F16(0.8824969), F16(0.9844964), F16(0.9980488)};
+    const int32_t *values;
+    int32_t res;
+    int32_t arg;
+    uint8_t i;
+
+    if (x >= F16(10.3972))                                                             /* check the upper limit */
+    {
+        return FIX16_MAXIMUM;                                                          /* return the maximum */
+    }
+    if (x <= F16(-11.7835))                                                            /* check the lower limit */
+    {
+        return 0;                                                                      /* return 0 */
+    }
+    if (x < 0)                                                                         /* negative exponent */
+    {
+        x = -x;                                                                        /* absolute value */
+        values = gs_exp_neg;                                                           /* negative table */
+    }
+    else
+    {
+        values = gs_exp_pos;                                                           /* positive table */
+    }
+    res = FIX16_ONE;                                                                   /* init the result */
+    arg = FIX16_ONE;                                                                   /* init the step */
+    for (i = 0; i < 4; i++)                                                            /* run all steps */
+    {
+        while (x >= arg)                                                               /* step fits */
+        {
+            res = a_sen5x_gas_mul(res, values[i]);                                     /* multiply */
+            x -= arg;                                                                  /* consume the step */
+        }
+        arg >>= 3;                                                                     /* next step */
+    }
+
+    return res;                                                                        /* return the result */
+}
+
+/**
+ * @brief     one plus the exponential of a fixed point value
+ * @param[in] x exponent
+ * @return    saturated sum
+ * @note      denominator of all sigmoids
+ */
+static int32_t a_sen5x_gas_exp_plus_one(int32_t x)
+{
+    int32_t e;
+
+    e = a_sen5x_gas_exp(x);                                                            /* exponential */
+
+    return (e > FIX16_MAXIMUM - FIX16_ONE) ? FIX16_MAXIMUM : (e + FIX16_ONE);          /* saturated sum */
+}
+
+/**
+ * @brief     sigmoid of the mean variance estimator
+ * @param[in] *gas pointer to a gas structure
+ * @param[in] sample sample
+ * @return    sigmoid value from 0 to 1
+ * @note      none
+ */
+static int32_t a_sen5x_gas_mve_sigmoid(sen5x_gas_t *gas, int32_t sample)
+{
+    int32_t x;
+
+    x = a_sen5x_gas_mul(gas->mve_sigmoid_k, sample - gas->mve_sigmoid_x0);             /* scaled distance */
+    if (x < F16(-50.0))                                                                /* far below */
+    {
+        return FIX16_ONE;                                                              /* return 1 */
+    }
+    if (x > F16(50.0))                                                                 /* far above */
+    {
+        return 0;                                                                      /* return 0 */
+    }
+
+    return a_sen5x_gas_div(FIX16_ONE, a_sen5x_gas_exp_plus_one(x));                    /* return the sigmoid */
+}
+
+/**
+ * @brief     update the gains of the mean variance estimator
+ * @param[in] *gas pointer to a gas structure
+ * @note      the learning slows down after the initial phase and is gated while the index is high
+ */
+static void a_sen5x_gas_mve_calculate_gamma(sen5x_gas_t *gas)
+{
+    int32_t uptime_limit;
+    int32_t sigmoid_gamma_mean;
+    int32_t gamma_mean;
+    int32_t gating_threshold_mean;
+    int32_t sigmoid_gating_mean;
+    int32_t sigmoid_gamma_variance;
+    int32_t gamma_variance;
+    int32_t gating_threshold_variance;
+    int32_t sigmoid_gating_variance;
+
+    uptime_limit = F16(MVE_FIX16_MAX) - gas->sampling_interval;                        /* uptime limit */
+    if (gas->mve_uptime_gamma < uptime_limit)                                          /* check the limit */
+    {
+        gas->mve_uptime_gamma += gas->sampling_interval;                               /* learning time */
+    }
+    if (gas->mve_uptime_gating < uptime_limit)                                         /* check the limit */
+    {
+        gas->mve_uptime_gating += gas->sampling_interval;                              /* gating time */
+    }
+
+    gas->mve_sigmoid_x0 = gas->init_duration_mean;                                     /* initial mean phase */
+    gas->mve_sigmoid_k = F16(INIT_TRANSITION_MEAN);                                    /* transition slope */
+    sigmoid_gamma_mean = a_sen5x_gas_mve_sigmoid(gas, gas->mve_uptime_gamma);          /* initial weight */
+    gamma_mean = gas->mve_gamma_mean + a_sen5x_gas_mul(gas->mve_gamma_initial_mean - gas->mve_gamma_mean,
+                                                       sigmoid_gamma_mean);            /* mean gain */
+    gating_threshold_mean = gas->gating_threshold +
+                            a_sen5x_gas_mul(F16(GATING_THRESHOLD_INITIAL) - gas->gating_threshold,
+                                            a_sen5x_gas_mve_sigmoid(gas, gas->mve_uptime_gating));   /* mean threshold */
+    gas->mve_sigmoid_x0 = gating_threshold_mean;                                       /* gating center */
+    gas->mve_sigmoid_k = F16(GATING_THRESHOLD_TRANSITION);                             /* gating slope */
+    sigmoid_gating_mean = a_sen5x_gas_mve_sigmoid(gas, gas->gas_index);                /* mean gating */
+    gas->mve_current_gamma_mean = a_sen5x_gas_mul(sigmoid_gating_mean, gamma_mean);    /* gated mean gain */
+
+    gas->mve_sigmoid_x0 = gas->init_duration_variance;                                 /* initial variance phase */
+    gas->mve_sigmoid_k = F16(INIT_TRANSITION_VARIANCE);                                /* transition slope */
+    sigmoid_gamma_variance = a_sen5x_gas_mve_sigmoid(gas, gas->mve_uptime_gamma);      /* initial weight */
+    gamma_variance = gas->mve_gamma_variance +
+                     a_sen5x_gas_mul(gas->mve_gamma_initial_variance - gas->mve_gamma_variance,
+                                     sigmoid_gamma_variance - sigmoid_gamma_mean);     /* variance gain */
+    gating_threshold_variance = gas->gating_threshold +
+                                a_sen5x_gas_mul(F16(GATING_THRESHOLD_INITIAL) - gas->gating_threshold,
+                                                a_sen5x_gas_mve_sigmoid(gas, gas->mve_uptime_gating));   /* variance threshold */
+    gas->mve_sigmoid_x0 = gating_threshold_variance;                                   /* gating center */
+    gas->mve_sigmoid_k = F16(GATING_THRESHOLD_TRANSITION);                             /* gating slope */
+    sigmoid_gating_variance = a_sen5x_gas_mve_sigmoid(gas, gas->gas_index);            /* variance gating */
+    gas->mve_current_gamma_variance = a_sen5x_gas_mul(sigmoid_gating_variance, gamma_variance);   /* gated variance gain */
+
+    gas->mve_gating_duration_minutes += a_sen5x_gas_mul(a_sen5x_gas_div(gas->sampling_interval, F16(60.0)),
+                                                        a_sen5x_gas_mul(FIX16_ONE - sigmoid_gating_mean,
+                                                                        F16(1.0 + GATING_MAX_RATIO)) -
+                                                        F16(GATING_MAX_RATIO));        /* gated time */
+    if (gas->mve_gating_duration_minutes < 0)                                          /* check the lower limit */
+    {
+        gas->mve_gating_duration_minutes = 0;                                          /* limit */
+    }
+    if (gas->mve_gating_duration_minutes > gas->gating_max_duration_minutes)           /* gated too long */
+    {
+        gas->mve_uptime_gating = 0;                                                    /* relearn the threshold */
+    }
+}
+
+/**
+ * @brief     update the mean variance estimator
+ * @param[in] *gas pointer to a gas structure
+ * @param[in] sraw sraw above the minimum
+ * @note      the standard deviation update is scaled down for large deviations to stay in range
+ */
+static void a_sen5x_gas_mve_process(sen5x_gas_t *gas, int32_t sraw)
+{
+    int32_t delta_sgp;
+    int32_t c;
+    int32_t scaling;
+
+    if (gas->mve_initialized == 0)                                                     /* first sample */
+    {
+        gas->mve_initialized = 1;                                                      /* set initialized */
+        gas->mve_sraw_offset = sraw;                                                   /* start at the sample */
+        gas->mve_mean = 0;                                                             /* zero mean */
+
+        return;                                                                        /* return */
+    }
+    if ((gas->mve_mean >= F16(100.0)) || (gas->mve_mean <= F16(-100.0)))               /* mean drifted */
+    {
+        gas->mve_sraw_offset += gas->mve_mean;                                         /* move the offset */
+        gas->mve_mean = 0;                                                             /* zero mean */
+    }
+    sraw -= gas->mve_sraw_offset;                                                      /* relative sraw */
+    a_sen5x_gas_mve_calculate_gamma(gas);                                              /* update the gains */
+    delta_sgp = a_sen5x_gas_div(sraw - gas->mve_mean, F16(MVE_GAMMA_SCALING));         /* scaled deviation */
+    c = (delta_sgp < 0) ? (gas->mve_std - delta_sgp) : (gas->mve_std + delta_sgp);     /* deviation bound */
+    scaling = FIX16_ONE;                                                               /* no scaling */
+    if (c > F16(1440.0))                                                               /* large deviation */
+    {
+        scaling = a_sen5x_gas_div(c, F16(1440.0));                                     /* ratio */
+        scaling = a_sen5x_gas_mul(scaling, scaling);                                   /* squared ratio */
+    }
+    gas->mve_std = a_sen5x_gas_mul(a_sen5x_gas_sqrt(a_sen5x_gas_mul(scaling, F16(MVE_GAMMA_SCALING) - gas->mve_current_gamma_variance)),
+                                   a_sen5x_gas_sqrt(a_sen5x_gas_mul(gas->mve_std,
+                                                                    a_sen5x_gas_div(gas->mve_std,
+                                                                                    a_sen5x_gas_mul(F16(MVE_GAMMA_SCALING), scaling))) +
+                                                    a_sen5x_gas_mul(a_sen5x_gas_div(a_sen5x_gas_mul(gas->mve_current_gamma_variance, delta_sgp),
+                                                                                    scaling), delta_sgp)));   /* update the std */
+    gas->mve_mean += a_sen5x_gas_div(a_sen5x_gas_mul(gas->mve_current_gamma_mean, delta_sgp),
+                                     F16(MVE_ADDITIONAL_GAMMA_MEAN_SCALING));          /* update the mean */
+}
+
+/**
+ * @brief     map a sraw to the unscaled index
+ * @param[in] *gas pointer to a gas structure
+ * @param[in] sraw sraw above the minimum
+ * @return    unscaled index
+ * @note      voc uses the learned standard deviation, nox a fixed one
+ */
+static int32_t a_sen5x_gas_mox_process(sen5x_gas_t *gas, int32_t sraw)
+{
+    if (gas->type == SEN5X_GAS_TYPE_NOX)                                               /* nox */
+    {
+        return a_sen5x_gas_mul(a_sen5x_gas_div(sraw - gas->mox_sraw_mean, F16(SRAW_STD_NOX)),
+                               gas->index_gain);                                       /* fixed std */
+    }
+
+    return a_sen5x_gas_mul(a_sen5x_gas_div(sraw - gas->mox_sraw_mean,
+                                           -(gas->mox_sraw_std + F16(SRAW_STD_BONUS_VOC))),
+                           gas->index_gain);                                           /* learned std */
+}
+
+/**
+ * @brief     map the unscaled index to the gas index
+ * @param[in] *gas pointer to a gas structure
+ * @param[in] sample unscaled index
+ * @return    gas index
+ * @note      the sigmoid passes the index offset at the learned mean
+ */
+static int32_t a_sen5x_gas_sigmoid_scaled(sen5x_gas_t *gas, int32_t sample)
+{
+    int32_t x;
+    int32_t shift;
+
+    x = a_sen5x_gas_mul(gas->sigmoid_scaled_k, sample - gas->sigmoid_scaled_x0);       /* scaled distance */
+    if (x < F16(-50.0))                                                                /* far below */
+    {
+        return F16(SIGMOID_L);                                                         /* return the height */
+    }
+    if (x > F16(50.0))                                                                 /* far above */
+    {
+        return 0;                                                                      /* return 0 */
+    }
+    if (sample >= 0)                                                                   /* above the mean */
+    {
+        if (gas->sigmoid_scaled_offset_default == FIX16_ONE)                           /* nox */
+        {
+            shift = a_sen5x_gas_mul(F16(500.0 / 499.0), FIX16_ONE - gas->index_offset);   /* nox shift */
+        }
+        else
+        {
+            shift = a_sen5x_gas_div(F16(SIGMOID_L) - a_sen5x_gas_mul(F16(5.0), gas->index_offset),
+                                    F16(4.0));                                         /* voc shift */
+        }
+
+        return a_sen5x_gas_div(F16(SIGMOID_L) + shift, a_sen5x_gas_exp_plus_one(x)) - shift;   /* shifted sigmoid */
+    }
+
+    return a_sen5x_gas_mul(a_sen5x_gas_div(gas->index_offset, gas->sigmoid_scaled_offset_default),
+                           a_sen5x_gas_div(F16(SIGMOID_L), a_sen5x_gas_exp_plus_one(x)));   /* scaled sigmoid */
+}
+
+/**
+ * @brief     run the adaptive lowpass
+ * @param[in] *gas pointer to a gas structure
+ * @param[in] sample gas index
+ * @return    filtered gas index
+ * @note      the time constant shrinks when the fast and slow filters disagree
+ */
+static int32_t a_sen5x_gas_lowpass(sen5x_gas_t *gas, int32_t sample)
+{
+    int32_t abs_delta;
+    int32_t f1;
+    int32_t tau_a;
+    int32_t a3;
+
+    if (gas->lp_initialized == 0)                                                      /* first sample */
+    {
+        gas->lp_x1 = sample;                                                           /* init the fast state */
+        gas->lp_x2 = sample;                                                           /* init the slow state */
+        gas->lp_x3 = sample;                                                           /* init the adaptive state */
+        gas->lp_initialized = 1;                                                       /* set initialized */
+    }
+    gas->lp_x1 = a_sen5x_gas_mul(FIX16_ONE - gas->lp_a1, gas->lp_x1) + a_sen5x_gas_mul(gas->lp_a1, sample);   /* fast */
+    gas->lp_x2 = a_sen5x_gas_mul(FIX16_ONE - gas->lp_a2, gas->lp_x2) + a_sen5x_gas_mul(gas->lp_a2, sample);   /* slow */
+    abs_delta = gas->lp_x1 - gas->lp_x2;                                               /* disagreement */
+    abs_delta = (abs_delta < 0) ? (-abs_delta) : abs_delta;                            /* absolute value */
+    f1 = a_sen5x_gas_exp(a_sen5x_gas_mul(F16(LP_ALPHA), abs_delta));                   /* weight */
+    tau_a = a_sen5x_gas_mul(F16(LP_TAU_SLOW - LP_TAU_FAST), f1) + F16(LP_TAU_FAST);    /* time constant */
+    a3 = a_sen5x_gas_div(gas->sampling_interval, gas->sampling_interval + tau_a);      /* adaptive gain */
+    gas->lp_x3 = a_sen5x_gas_mul(FIX16_ONE - a3, gas->lp_x3) + a_sen5x_gas_mul(a3, sample);   /* adaptive */
+
+    return gas->lp_x3;                                                                 /* return the state */
+}
+
+/**
+ * @brief     init all algorithm instances from the tuning
+ * @param[in] *gas pointer to a gas structure
+ * @note      none
+ */
+static void a_sen5x_gas_init_instances(sen5x_gas_t *gas)
+{
+    int32_t hours;
+
+    hours = a_sen5x_gas_div(gas->sampling_interval, F16(3600.0));                      /* interval in hours, the numerators keep full precision */
+    gas->mve_initialized = 0;                                                          /* not initialized */
+    gas->mve_mean = 0;                                                                 /* zero mean */
+    gas->mve_sraw_offset = 0;                                                          /* zero offset */
+    gas->mve_std = gas->sraw_std_initial;                                              /* initial std */
+    gas->mve_gamma_mean = a_sen5x_gas_div(a_sen5x_gas_div(a_sen5x_gas_mul(F16(MVE_ADDITIONAL_GAMMA_MEAN_SCALING * MVE_GAMMA_SCALING),
+                                                                          gas->sampling_interval), F16(3600.0)),
+                                          gas->tau_mean_hours + hours);                /* long term mean gain */
+    gas->mve_gamma_variance = a_sen5x_gas_div(a_sen5x_gas_div(a_sen5x_gas_mul(F16(MVE_GAMMA_SCALING), gas->sampling_interval),
+                                                              F16(3600.0)),
+                                              gas->tau_variance_hours + hours);        /* long term variance gain */
+    gas->mve_gamma_initial_mean = a_sen5x_gas_div(a_sen5x_gas_mul(F16(MVE_ADDITIONAL_GAMMA_MEAN_SCALING * MVE_GAMMA_SCALING),
+                                                                  gas->sampling_interval),
+                                                  ((gas->type == SEN5X_GAS_TYPE_NOX) ? F16(TAU_INITIAL_MEAN_NOX) : F16(TAU_INITIAL_MEAN_VOC)) +
+                                                  gas->sampling_interval);             /* initial mean gain */
+    gas->mve_gamma_initial_variance = a_sen5x_gas_div(a_sen5x_gas_mul(F16(MVE_GAMMA_SCALING), gas->sampling_interval),
+                                                      F16(TAU_INITIAL_VARIANCE) + gas->sampling_interval);   /* initial variance gain */
+    gas->mve_current_gamma_mean = 0;                                                   /* no gain */
+    gas->mve_current_gamma_variance = 0;                                               /* no gain */
+    gas->mve_uptime_gamma = 0;                                                         /* no learning time */
+    gas->mve_uptime_gating = 0;                                                        /* no gating time */
+    gas->mve_gating_duration_minutes = 0;                                              /* no gated time */
+    gas->mox_sraw_std = gas->mve_std;                                                  /* model std */
+    gas->mox_sraw_mean = gas->mve_mean + gas->mve_sraw_offset;                         /* model mean */
+    if (gas->type == SEN5X_GAS_TYPE_NOX)                                               /* nox */
+    {
+        gas->sigmoid_scaled_k = F16(SIGMOID_K_NOX);                                    /* nox slope */
+        gas->sigmoid_scaled_x0 = F16(SIGMOID_X0_NOX);                                  /* nox center */
+        gas->sigmoid_scaled_offset_default = F16(NOX_INDEX_OFFSET_DEFAULT);            /* nox offset */
+    }
+    else
+    {
+        gas->sigmoid_scaled_k = F16(SIGMOID_K_VOC);                                    /* voc slope */
+        gas->sigmoid_scaled_x0 = F16(SIGMOID_X0_VOC);                                  /* voc center */
+        gas->sigmoid_scaled_offset_default = F16(VOC_INDEX_OFFSET_DEFAULT);            /* voc offset */
+    }
+    gas->lp_a1 = a_sen5x_gas_div(gas->sampling_interval, F16(LP_TAU_FAST) + gas->sampling_interval);   /* fast gain */
+    gas->lp_a2 = a_sen5x_gas_div(gas->sampling_interval, F16(LP_TAU_SLOW) + gas->sampling_interval);   /* slow gain */
+    gas->lp_initialized = 0;                                                           /* not initialized */
+}
+
+/**
+ * @brief     init the gas index algorithm with the default tuning of a gas type
+ * @param[in] *gas pointer to a gas structure
+ * @param[in] type gas type
+ * @param[in] sampling_interval sampling interval in seconds
+ * @return    status code
+ *            - 0 success
+ *            - 2 gas is NULL
+ *            - 4 type is invalid
+ *            - 5 sampling interval is invalid
+ * @note      0.5 <= sampling_interval <= 60, the sensor samples every second,
+ *            the default voc tuning is 100, 12, 12, 180, 50, 230 and the default nox tuning is 1, 12, 12, 720, 50, 230
+ */
+uint8_t sen5x_gas_init(sen5x_gas_t *gas, sen5x_gas_type_t type, float sampling_interval)
+{
+    if (gas == NULL)                                                                   /* check the gas */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((type != SEN5X_GAS_TYPE_VOC) && (type != SEN5X_GAS_TYPE_NOX))                  /* check the type */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if (!((sampling_interval >= SEN5X_GAS_MIN_SAMPLING_INTERVAL) &&
+          (sampling_interval <= SEN5X_GAS_MAX_SAMPLING_INTERVAL)))                     /* check the sampling interval */
+    {
+        return 5;                                                                      /* return error */
+    }
+
+    memset(gas, 0, sizeof(sen5x_gas_t));                                               /* clear the gas */
+    gas->type = (uint8_t)type;                                                         /* save the type */
+    gas->sampling_interval = F16(sampling_interval);                                   /* save the sampling interval */
+    if (type == SEN5X_GAS_TYPE_NOX)                                                    /* nox */
+    {
+        gas->index_offset = F16(NOX_INDEX_OFFSET_DEFAULT);                             /* nox index offset */
+        gas->sraw_minimum = NOX_SRAW_MINIMUM;                                          /* nox sraw minimum */
+        gas->gating_max_duration_minutes = F16(GATING_NOX_MAX_DURATION_MINUTES);       /* nox gating duration */
+        gas->init_duration_mean = F16(INIT_DURATION_MEAN_NOX);                         /* nox mean duration */
+        gas->init_duration_variance = F16(INIT_DURATION_VARIANCE_NOX);                 /* nox variance duration */
+        gas->gating_threshold = F16(GATING_THRESHOLD_NOX);                             /* nox gating threshold */
+    }
+    else
+    {
+        gas->index_offset = F16(VOC_INDEX_OFFSET_DEFAULT);                             /* voc index offset */
+        gas->sraw_minimum = VOC_SRAW_MINIMUM;                                          /* voc sraw minimum */
+        gas->gating_max_duration_minutes = F16(GATING_VOC_MAX_DURATION_MINUTES);       /* voc gating duration */
+        gas->init_duration_mean = F16(INIT_DURATION_MEAN_VOC);                         /* voc mean duration */
+        gas->init_duration_variance = F16(INIT_DURATION_VARIANCE_VOC);                 /* voc variance duration */
+        gas->gating_threshold = F16(GATING_THRESHOLD_VOC);                             /* voc gating threshold */
+    }
+    gas->index_gain = F16(INDEX_GAIN);                                                 /* gain factor */
+    gas->tau_mean_hours = F16(TAU_MEAN_HOURS);                                         /* mean learning time */
+    gas->tau_variance_hours = F16(TAU_VARIANCE_HOURS);                                 /* variance learning time */
+    gas->sraw_std_initial = F16(SRAW_STD_INITIAL);                                     /* initial std */
+    a_sen5x_gas_init_instances(gas);                                                   /* init the instances */
+    gas->inited = 1;                                                                   /* set the inited */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     reset the learned states and keep the tuning
+ * @param[in] *gas pointer to a gas structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 gas is NULL
+ *            - 3 gas is not initialized
+ * @note      none
+ */
+uint8_t sen5x_gas_reset(sen5x_gas_t *gas)
+{
+    if (gas == NULL)                                                                   /* check the gas */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (gas->inited != 1)                                                              /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    gas->uptime = 0;                                                                   /* restart the blackout */
+    gas->sraw = 0;                                                                     /* no sraw */
+    gas->gas_index = 0;                                                                /* no index */
+    a_sen5x_gas_init_instances(gas);                                                   /* init the instances */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     set the tuning and restart the learning
+ * @param[in] *gas pointer to a gas structure
+ * @param[in] index_offset index offset
+ * @param[in] learning_time_offset_hour learning time offset hour
+ * @param[in] learning_time_gain_hour learning time gain hour
+ * @param[in] gating_max_duration_minute gating max duration minute
+ * @param[in] std_initial std initial
+ * @param[in] gain_factor gain factor
+ * @return    status code
+ *            - 0 success
+ *            - 2 gas is NULL
+ *            - 3 gas is not initialized
+ *            - 4 param is invalid
+ * @note      the ranges are the ones of sen5x_set_voc_algorithm_tuning and sen5x_set_nox_algorithm_tuning
+ */
+uint8_t sen5x_gas_set_tuning(sen5x_gas_t *gas, int16_t index_offset,
+                             int16_t learning_time_offset_hour, int16_t learning_time_gain_hour,
+                             int16_t gating_max_duration_minute, int16_t std_initial,
+                             int16_t gain_factor)
+{
+    if (gas == NULL)                                                                   /* check the gas */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (gas->inited != 1)                                                              /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if ((index_offset < 1) || (index_offset > 250) ||
+        (learning_time_offset_hour < 1) || (learning_time_offset_hour > 1000) ||
+        (learning_time_gain_hour < 1) || (learning_time_gain_hour > 1000) ||
+        (gating_max_duration_minute < 0) || (gating_max_duration_minute > 3000) ||
+        (std_initial < 10) || (std_initial > 5000) ||
+        (gain_factor < 1) || (gain_factor > 1000))                                     /* check the params */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    gas->index_offset = (int32_t)index_offset * FIX16_ONE;                             /* save the index offset */
+    gas->tau_mean_hours = (int32_t)learning_time_offset_hour * FIX16_ONE;              /* save the mean learning time */
+    gas->tau_variance_hours = (int32_t)learning_time_gain_hour * FIX16_ONE;            /* save the variance learning time */
+    gas->gating_max_duration_minutes = (int32_t)gating_max_duration_minute * FIX16_ONE;   /* save the gating duration */
+    gas->sraw_std_initial = (int32_t)std_initial * FIX16_ONE;                          /* save the initial std */
+    gas->index_gain = (int32_t)gain_factor * FIX16_ONE;                                /* save the gain factor */
+    a_sen5x_gas_init_instances(gas);                                                   /* init the instances */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the tuning
+ * @param[in]  *gas pointer to a gas structure
+ * @param[out] *index_offset pointer to an index offset buffer
+ * @param[out] *learning_time_offset_hour pointer to a learning time offset hour buffer
+ * @param[out] *learning_time_gain_hour pointer to a learning time gain hour buffer
+ * @param[out] *gating_max_duration_minute pointer to a gating max duration minute buffer
+ * @param[out] *std_initial pointer to a std initial buffer
+ * @param[out] *gain_factor pointer to a gain factor buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 gas or a buffer is NULL
+ *             - 3 gas is not initialized
+ * @note       none
+ */
+uint8_t sen5x_gas_get_tuning(sen5x_gas_t *gas, int16_t *index_offset,
+                             int16_t *learning_time_offset_hour, int16_t *learning_time_gain_hour,
+                             int16_t *gating_max_duration_minute, int16_t *std_initial,
+                             int16_t *gain_factor)
+{
+    if ((gas == NULL) || (index_offset == NULL) || (learning_time_offset_hour == NULL) ||
+        (learning_time_gain_hour == NULL) || (gating_max_duration_minute == NULL) ||
+        (std_initial == NULL) || (gain_factor == NULL))                                /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (gas->inited != 1)                                                              /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    *index_offset = (int16_t)(gas->index_offset / FIX16_ONE);                          /* get the index offset */
+    *learning_time_offset_hour = (int16_t)(gas->tau_mean_hours / FIX16_ONE);           /* get the mean learning time */
+    *learning_time_gain_hour = (int16_t)(gas->tau_variance_hours / FIX16_ONE);         /* get the variance learning time */
+    *gating_max_duration_minute = (int16_t)(gas->gating_max_duration_minutes / FIX16_ONE);   /* get the gating duration */
+    *std_initial = (int16_t)(gas->sraw_std_initial / FIX16_ONE);                       /* get the initial std */
+    *gain_factor = (int16_t)(gas->index_gain / FIX16_ONE);                             /* get the gain factor */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the learned states
+ * @param[in]  *gas pointer to a gas structure
+ * @param[out] *mean pointer to a q16.16 sraw mean buffer
+ * @param[out] *std pointer to a q16.16 sraw standard deviation buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 gas, mean or std is NULL
+ *             - 3 gas is not initialized
+ * @note       only voc states are meaningful to persist, the nox learning is fast
+ */
+uint8_t sen5x_gas_get_states(sen5x_gas_t *gas, int32_t *mean, int32_t *std)
+{
+    if ((gas == NULL) || (mean == NULL) || (std == NULL))                              /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (gas->inited != 1)                                                              /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    *mean = gas->mve_mean + gas->mve_sraw_offset;                                      /* get the mean */
+    *std = gas->mve_std;                                                               /* get the std */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     restore learned states
+ * @param[in] *gas pointer to a gas structure
+ * @param[in] mean q16.16 sraw mean
+ * @param[in] std q16.16 sraw standard deviation
+ * @return    status code
+ *            - 0 success
+ *            - 2 gas is NULL
+ *            - 3 gas is not initialized
+ *            - 4 std is invalid
+ * @note      the restored states skip the initial learning phase
+ */
+uint8_t sen5x_gas_set_states(sen5x_gas_t *gas, int32_t mean, int32_t std)
+{
+    if (gas == NULL)                                                                   /* check the gas */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (gas->inited != 1)                                                              /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (std <= 0)                                                                      /* check the std */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    gas->mve_mean = mean;                                                              /* set the mean */
+    gas->mve_sraw_offset = 0;                                                          /* zero offset */
+    gas->mve_std = std;                                                                /* set the std */
+    gas->mve_uptime_gamma = F16(PERSISTENCE_UPTIME_GAMMA);                             /* skip the initial phase */
+    gas->mve_initialized = 1;                                                          /* set initialized */
+    gas->mox_sraw_std = std;                                                           /* model std */
+    gas->mox_sraw_mean = mean;                                                         /* model mean */
+    gas->sraw = mean;                                                                  /* last sraw */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      process one sraw sample
+ * @param[in]  *gas pointer to a gas structure
+ * @param[in]  sraw sraw ticks
+ * @param[out] *index pointer to a gas index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 gas or index is NULL
+ *             - 3 gas is not initialized
+ * @note       call once per sampling interval, the index is 0 during the first 45 seconds
+ *             and sraw outside 1 - 64999 keeps the previous sraw
+ */
+uint8_t sen5x_gas_process(sen5x_gas_t *gas, int32_t sraw, int32_t *index)
+{
+    if ((gas == NULL) || (index == NULL))                                              /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (gas->inited != 1)                                                              /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    if (gas->uptime <= F16(INITIAL_BLACKOUT))                                          /* blackout */
+    {
+        gas->uptime += gas->sampling_interval;                                         /* count the uptime */
+    }
+    else
+    {
+        if ((sraw > 0) && (sraw < 65000))                                              /* usable sraw */
+        {
+            if (sraw < gas->sraw_minimum + 1)                                          /* below the range */
+            {
+                sraw = gas->sraw_minimum + 1;                                          /* limit */
+            }
+            else if (sraw > gas->sraw_minimum + 32767)                                 /* above the range */
+            {
+                sraw = gas->sraw_minimum + 32767;                                      /* limit */
+            }
+            gas->sraw = (sraw - gas->sraw_minimum) * FIX16_ONE;                        /* save the sraw */
+        }
+        if ((gas->type == SEN5X_GAS_TYPE_VOC) || (gas->mve_initialized != 0))          /* model is usable */
+        {
+            gas->gas_index = a_sen5x_gas_mox_process(gas, gas->sraw);                  /* unscaled index */
+            gas->gas_index = a_sen5x_gas_sigmoid_scaled(gas, gas->gas_index);          /* scaled index */
+        }
+        else
+        {
+            gas->gas_index = gas->index_offset;                                        /* average condition */
+        }
+        gas->gas_index = a_sen5x_gas_lowpass(gas, gas->gas_index);                     /* filter */
+        if (gas->gas_index < F16(0.5))                                                 /* check the lower limit */
+        {
+            gas->gas_index = F16(0.5);                                                 /* limit */
+        }
+        if (gas->sraw > 0)                                                             /* learn */
+        {
+            a_sen5x_gas_mve_process(gas, gas->sraw);                                   /* update the estimator */
+            gas->mox_sraw_std = gas->mve_std;                                          /* model std */
+            gas->mox_sraw_mean = gas->mve_mean + gas->mve_sraw_offset;                 /* model mean */
+        }
+    }
+    *index = (gas->gas_index + F16(0.5)) >> 16;                                        /* round to an integer */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      process raw values read by sen5x_read_raw_value
+ * @param[in]  *gas pointer to a gas structure
+ * @param[in]  *raw pointer to a sen5x raw buffer
+ * @param[in]  count sample count
+ * @param[out] *index pointer to a gas index buffer of count elements
+ * @return     status code
+ *             - 0 success
+ *             - 2 gas, raw or index is NULL
+ *             - 3 gas is not initialized
+ * @note       uses voc_raw or nox_raw by the gas type, one sample per sampling interval, several gas
+ *             structures with different tunings can process the same raw buffer
+ */
+uint8_t sen5x_gas_process_raw(sen5x_gas_t *gas, const sen5x_raw_t *raw, uint32_t count, int32_t *index)
+{
+    uint32_t i;
+
+    if ((gas == NULL) || (raw == NULL) || (index == NULL))                             /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (gas->inited != 1)                                                              /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    for (i = 0; i < count; i++)                                                        /* run all samples */
+    {
+        (void)sen5x_gas_process(gas, (gas->type == SEN5X_GAS_TYPE_NOX) ?
+                                (int32_t)raw[i].nox_raw : (int32_t)raw[i].voc_raw,
+                                &index[i]);                                            /* process the sample */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
@@ -0,0 +1,250 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_gas.h
+ * @brief     driver sen5x gas header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_GAS_H
+#define DRIVER_SEN5X_GAS_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_gas_driver sen5x gas driver function
+ * @brief    sen5x gas driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x gas definition
+ */
+#define SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL      1.0f         /**< sensor sampling interval in seconds */
+#define SEN5X_GAS_MIN_SAMPLING_INTERVAL          0.5f         /**< smallest supported sampling interval in seconds */
+#define SEN5X_GAS_MAX_SAMPLING_INTERVAL          60.0f        /**< largest supported sampling interval in seconds */
+
+/**
+ * @brief sen5x gas type enumeration definition
+ */
+typedef enum
+{
+    SEN5X_GAS_TYPE_VOC = 0x00,        /**< voc index */
+    SEN5X_GAS_TYPE_NOX = 0x01,        /**< nox index */
+} sen5x_gas_type_t;
+
+/**
+ * @brief sen5x gas structure definition
+ * @note  all int32_t members except sraw_minimum are q16.16 fixed point values
+ */
+typedef struct sen5x_gas_s
+{
+    uint8_t type;                                        /**< gas type */
+    int32_t sampling_interval;                           /**< sampling interval in seconds */
+    int32_t index_offset;                                /**< index of the average condition */
+    int32_t sraw_minimum;                                /**< lower sraw limit in ticks */
+    int32_t gating_max_duration_minutes;                 /**< longest gating in minutes */
+    int32_t init_duration_mean;                          /**< initial mean learning duration in seconds */
+    int32_t init_duration_variance;                      /**< initial variance learning duration in seconds */
+    int32_t gating_threshold;                            /**< index above which learning is gated */
+    int32_t index_gain;                                  /**< index gain factor */
+    int32_t tau_mean_hours;                              /**< mean learning time in hours */
+    int32_t tau_variance_hours;                          /**< variance learning time in hours */
+    int32_t sraw_std_initial;                            /**< initial sraw standard deviation */
+    int32_t uptime;                                      /**< time since reset in seconds */
+    int32_t sraw;                                        /**< last sraw above the minimum */
+    int32_t gas_index;                                   /**< last gas index */
+    uint8_t mve_initialized;                             /**< mean variance estimator initialized flag */
+    int32_t mve_mean;                                    /**< mean relative to the sraw offset */
+    int32_t mve_sraw_offset;                             /**< sraw offset */
+    int32_t mve_std;                                     /**< sraw standard deviation */
+    int32_t mve_gamma_mean;                              /**< long term mean gain */
+    int32_t mve_gamma_variance;                          /**< long term variance gain */
+    int32_t mve_gamma_initial_mean;                      /**< initial mean gain */
+    int32_t mve_gamma_initial_variance;                  /**< initial variance gain */
+    int32_t mve_current_gamma_mean;                      /**< gated mean gain of the sample */
+    int32_t mve_current_gamma_variance;                  /**< gated variance gain of the sample */
+    int32_t mve_uptime_gamma;                            /**< learning time in seconds */
+    int32_t mve_uptime_gating;                           /**< time since the gating reset in seconds */
+    int32_t mve_gating_duration_minutes;                 /**< gated time in minutes */
+    int32_t mve_sigmoid_k;                               /**< estimator sigmoid slope */
+    int32_t mve_sigmoid_x0;                              /**< estimator sigmoid center */
+    int32_t mox_sraw_std;                                /**< model sraw standard deviation */
+    int32_t mox_sraw_mean;                               /**< model sraw mean */
+    int32_t sigmoid_scaled_k;                            /**< index sigmoid slope */
+    int32_t sigmoid_scaled_x0;                           /**< index sigmoid center */
+    int32_t sigmoid_scaled_offset_default;               /**< default index offset of the gas type */
+    int32_t lp_a1;                                       /**< fast lowpass gain */
+    int32_t lp_a2;                                       /**< slow lowpass gain */
+    uint8_t lp_initialized;                              /**< lowpass initialized flag */
+    int32_t lp_x1;                                       /**< fast lowpass state */
+    int32_t lp_x2;                                       /**< slow lowpass state */
+    int32_t lp_x3;                                       /**< adaptive lowpass state */
+    uint8_t inited;                                      /**< inited flag */
+} sen5x_gas_t;
+
+/**
+ * @brief     init the gas index algorithm with the default tuning of a gas type
+ * @param[in] *gas pointer to a gas structure
+ * @param[in] type gas type
+ * @param[in] sampling_interval sampling interval in seconds
+ * @return    status code
+ *            - 0 success
+ *            - 2 gas is NULL
+ *            - 4 type is invalid
+ *            - 5 sampling interval is invalid
+ * @note      0.5 <= sampling_interval <= 60, the sensor samples every second,
+ *            the default voc tuning is 100, 12, 12, 180, 50, 230 and the default nox tuning is 1, 12, 12, 720, 50, 230
+ */
+uint8_t sen5x_gas_init(sen5x_gas_t *gas, sen5x_gas_type_t type, float sampling_interval);
+
+/**
+ * @brief     reset the learned states and keep the tuning
+ * @param[in] *gas pointer to a gas structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 gas is NULL
+ *            - 3 gas is not initialized
+ * @note      none
+ */
+uint8_t sen5x_gas_reset(sen5x_gas_t *gas);
+
+/**
+ * @brief     set the tuning and restart the learning
+ * @param[in] *gas pointer to a gas structure
+ * @param[in] index_offset index offset
+ * @param[in] learning_time_offset_hour learning time offset hour
+ * @param[in] learning_time_gain_hour learning time gain hour
+ * @param[in] gating_max_duration_minute gating max duration minute
+ * @param[in] std_initial std initial
+ * @param[in] gain_factor gain factor
+ * @return    status code
+ *            - 0 success
+ *            - 2 gas is NULL
+ *            - 3 gas is not initialized
+ *            - 4 param is invalid
+ * @note      the ranges are the ones of sen5x_set_voc_algorithm_tuning and sen5x_set_nox_algorithm_tuning
+ */
+uint8_t sen5x_gas_set_tuning(sen5x_gas_t *gas, int16_t index_offset,
+                             int16_t learning_time_offset_hour, int16_t learning_time_gain_hour,
+                             int16_t gating_max_duration_minute, int16_t std_initial,
+                             int16_t gain_factor);
+
+/**
+ * @brief      get the tuning
+ * @param[in]  *gas pointer to a gas structure
+ * @param[out] *index_offset pointer to an index offset buffer
+ * @param[out] *learning_time_offset_hour pointer to a learning time offset hour buffer
+ * @param[out] *learning_time_gain_hour pointer to a learning time gain hour buffer
+ * @param[out] *gating_max_duration_minute pointer to a gating max duration minute buffer
+ * @param[out] *std_initial pointer to a std initial buffer
+ * @param[out] *gain_factor pointer to a gain factor buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 gas or a buffer is NULL
+ *             - 3 gas is not initialized
+ * @note       none
+ */
+uint8_t sen5x_gas_get_tuning(sen5x_gas_t *gas, int16_t *index_offset,
+                             int16_t *learning_time_offset_hour, int16_t *learning_time_gain_hour,
+                             int16_t *gating_max_duration_minute, int16_t *std_initial,
+                             int16_t *gain_factor);
+
+/**
+ * @brief      get the learned states
+ * @param[in]  *gas pointer to a gas structure
+ * @param[out] *mean pointer to a q16.16 sraw mean buffer
+ * @param[out] *std pointer to a q16.16 sraw standard deviation buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 gas, mean or std is NULL
+ *             - 3 gas is not initialized
+ * @note       only voc states are meaningful to persist, the nox learning is fast
+ */
+uint8_t sen5x_gas_get_states(sen5x_gas_t *gas, int32_t *mean, int32_t *std);
+
+/**
+ * @brief     restore learned states
+ * @param[in] *gas pointer to a gas structure
+ * @param[in] mean q16.16 sraw mean
+ * @param[in] std q16.16 sraw standard deviation
+ * @return    status code
+ *            - 0 success
+ *            - 2 gas is NULL
+ *            - 3 gas is not initialized
+ *            - 4 std is invalid
+ * @note      the restored states skip the initial learning phase
+ */
+uint8_t sen5x_gas_set_states(sen5x_gas_t *gas, int32_t mean, int32_t std);
+
+/**
+ * @brief      process one sraw sample
+ * @param[in]  *gas pointer to a gas structure
+ * @param[in]  sraw sraw ticks
+ * @param[out] *index pointer to a gas index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 gas or index is NULL
+ *             - 3 gas is not initialized
+ * @note       call once per sampling interval, the index is 0 during the first 45 seconds
+ *             and sraw outside 1 - 64999 keeps the previous sraw
+ */
+uint8_t sen5x_gas_process(sen5x_gas_t *gas, int32_t sraw, int32_t *index);
+
+/**
+ * @brief      process raw values read by sen5x_read_raw_value
+ * @param[in]  *gas pointer to a gas structure
+ * @param[in]  *raw pointer to a sen5x raw buffer
+ * @param[in]  count sample count
+ * @param[out] *index pointer to a gas index buffer of count elements
+ * @return     status code
+ *             - 0 success
+ *             - 2 gas, raw or index is NULL
+ *             - 3 gas is not initialized
+ * @note       uses voc_raw or nox_raw by the gas type, one sample per sampling interval, several gas
+ *             structures with different tunings can process the same raw buffer
+ */
+uint8_t sen5x_gas_process_raw(sen5x_gas_t *gas, const sen5x_raw_t *raw, uint32_t count, int32_t *index);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,404 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_health.c
+ * @brief     driver sen5x health source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_health.h"
+
+/**
+ * @brief     account the time up to now
+ * @param[in] *health pointer to a health structure
+ * @param[in] sensor sensor index
+ * @param[in] now_ms current time in ms
+ * @return    none
+ * @note      the first call starts the sensor and sets its poll phase
+ */
+static void a_sen5x_health_account(sen5x_health_t *health, uint8_t sensor, uint64_t now_ms)
+{
+    sen5x_health_sensor_t *s;
+    uint64_t dt;
+
+    s = &health->sensor[sensor];                                                       /* get the sensor */
+    if (s->started == 0)                                                               /* first cycle */
+    {
+        s->started = 1;                                                                /* set started */
+        s->last_ms = now_ms;                                                           /* start the accounting */
+        s->next_ms = now_ms + (uint64_t)health->interval_ms * sensor / health->sensors;   /* spread the polls */
+
+        return;                                                                        /* return */
+    }
+    if (now_ms <= s->last_ms)                                                          /* no time passed */
+    {
+        return;                                                                        /* return */
+    }
+    dt = now_ms - s->last_ms;                                                          /* elapsed time */
+    if (s->stats.lost != 0)                                                            /* register lost */
+    {
+        s->stats.lost_ms += dt;                                                        /* add lost time */
+    }
+    else if ((s->stats.status & health->mask) != 0)                                    /* confirmed error */
+    {
+        s->stats.fault_ms += dt;                                                       /* add fault time */
+    }
+    else
+    {
+        s->stats.uptime_ms += dt;                                                      /* add uptime */
+    }
+    s->stats.tracked_ms += dt;                                                         /* add tracked time */
+    s->last_ms = now_ms;                                                               /* save the time */
+}
+
+/**
+ * @brief     set the next poll after a status read
+ * @param[in] *health pointer to a health structure
+ * @param[in] sensor sensor index
+ * @param[in] now_ms time of the read in ms
+ * @return    none
+ * @note      the poll phase of the sensor is kept
+ */
+static void a_sen5x_health_schedule(sen5x_health_t *health, uint8_t sensor, uint64_t now_ms)
+{
+    sen5x_health_sensor_t *s;
+
+    s = &health->sensor[sensor];                                                       /* get the sensor */
+    if (s->next_ms <= now_ms)                                                          /* poll was due */
+    {
+        s->next_ms += (uint64_t)health->interval_ms *
+                      ((now_ms - s->next_ms) / health->interval_ms + 1);               /* next slot after now */
+    }
+}
+
+/**
+ * @brief     emit an event
+ * @param[in] *health pointer to a health structure
+ * @param[in] sensor sensor index
+ * @param[in] now_ms time of the read in ms
+ * @param[in] type event type
+ * @param[in] bit changed status bit
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ * @note      none
+ */
+static uint8_t a_sen5x_health_emit(sen5x_health_t *health, uint8_t sensor, uint64_t now_ms,
+                                   sen5x_health_event_type_t type, uint32_t bit)
+{
+    sen5x_health_event_t event;
+
+    health->sensor[sensor].stats.events++;                                             /* count the event */
+    if (health->emit == NULL)                                                          /* no emit function */
+    {
+        return 0;                                                                      /* success return 0 */
+    }
+    event.timestamp_ms = now_ms;                                                       /* set the time */
+    event.bit = bit;                                                                   /* set the bit */
+    event.status = health->sensor[sensor].stats.status;                                /* set the status */
+    event.sensor = sensor;                                                             /* set the sensor */
+    event.type = (uint8_t)type;                                                        /* set the type */
+    if (health->emit(&event) != 0)                                                     /* emit the event */
+    {
+        return 1;                                                                      /* return error */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     init the health monitor
+ * @param[in] *health pointer to a health structure
+ * @param[in] sensors sensor count
+ * @param[in] interval_ms status poll interval in ms
+ * @param[in] debounce consecutive polls that confirm a change
+ * @param[in] mask watched status bits
+ * @param[in] *emit pointer to an emit function address called with every event, NULL keeps only the stats
+ * @return    status code
+ *            - 0 success
+ *            - 2 health is NULL
+ *            - 4 sensors is invalid
+ *            - 5 interval is invalid
+ *            - 6 debounce is invalid
+ *            - 7 mask is invalid
+ * @note      1 <= sensors <= 32, interval_ms > 0, 1 <= debounce <= 255, mask != 0
+ */
+uint8_t sen5x_health_init(sen5x_health_t *health, uint8_t sensors, uint32_t interval_ms, uint8_t debounce,
+                          uint32_t mask, uint8_t (*emit)(const sen5x_health_event_t *event))
+{
+    if (health == NULL)                                                                /* check the health */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((sensors == 0) || (sensors > SEN5X_HEALTH_MAX_SENSORS))                        /* check the sensors */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if (interval_ms == 0)                                                              /* check the interval */
+    {
+        return 5;                                                                      /* return error */
+    }
+    if (debounce == 0)                                                                 /* check the debounce */
+    {
+        return 6;                                                                      /* return error */
+    }
+    if (mask == 0)                                                                     /* check the mask */
+    {
+        return 7;                                                                      /* return error */
+    }
+
+    memset(health, 0, sizeof(sen5x_health_t));                                         /* clear the health */
+    health->sensors = sensors;                                                         /* set the sensors */
+    health->interval_ms = interval_ms;                                                 /* set the interval */
+    health->debounce = debounce;                                                       /* set the debounce */
+    health->mask = mask;                                                               /* set the mask */
+    health->emit = emit;                                                               /* set the emit function */
+    health->inited = 1;                                                                /* flag inited */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      run a read cycle of a sensor
+ * @param[in]  *health pointer to a health structure
+ * @param[in]  sensor sensor index
+ * @param[in]  now_ms current time in ms
+ * @param[out] *poll pointer to a poll buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 health or poll is NULL
+ *             - 3 health is not initialized
+ *             - 4 sensor is invalid
+ * @note       call it right after the measured values are read, when poll is set read the status with
+ *             sen5x_get_device_status in the same cycle and pass it to sen5x_health_update or
+ *             sen5x_health_fail, the status read then fills the idle time before the next sample,
+ *             the polls of the sensors are spread over the interval and a change being confirmed is
+ *             polled every cycle
+ */
+uint8_t sen5x_health_cycle(sen5x_health_t *health, uint8_t sensor, uint64_t now_ms, uint8_t *poll)
+{
+    if ((health == NULL) || (poll == NULL))                                            /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (health->inited != 1)                                                           /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (sensor >= health->sensors)                                                     /* check the sensor */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    a_sen5x_health_account(health, sensor, now_ms);                                    /* account the time */
+    *poll = ((health->sensor[sensor].pending != 0) ||
+             (now_ms >= health->sensor[sensor].next_ms)) ? 1 : 0;                      /* poll when due */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      feed a status read of a sensor
+ * @param[in]  *health pointer to a health structure
+ * @param[in]  sensor sensor index
+ * @param[in]  now_ms time of the read in ms
+ * @param[in]  status device status read by sen5x_get_device_status
+ * @param[out] *clear pointer to a clear buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 emit failed
+ *             - 2 health or clear is NULL
+ *             - 3 health is not initialized
+ *             - 4 sensor is invalid
+ * @note       the error bits stay set until they are cleared, when clear is set call
+ *             sen5x_clear_device_status so the next poll shows whether the error is still there
+ */
+uint8_t sen5x_health_update(sen5x_health_t *health, uint8_t sensor, uint64_t now_ms, uint32_t status, uint8_t *clear)
+{
+    uint8_t res;
+    uint8_t b;
+    uint32_t bit;
+    sen5x_health_sensor_t *s;
+
+    if ((health == NULL) || (clear == NULL))                                           /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (health->inited != 1)                                                           /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (sensor >= health->sensors)                                                     /* check the sensor */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    res = 0;                                                                           /* init the result */
+    s = &health->sensor[sensor];                                                       /* get the sensor */
+    a_sen5x_health_account(health, sensor, now_ms);                                    /* account the time */
+    s->stats.polls++;                                                                  /* count the poll */
+    s->failures = 0;                                                                   /* reset the failures */
+    if (s->stats.lost != 0)                                                            /* register was lost */
+    {
+        s->stats.lost = 0;                                                             /* clear lost */
+        res |= a_sen5x_health_emit(health, sensor, now_ms, SEN5X_HEALTH_EVENT_RESTORED, 0);   /* emit restored */
+    }
+    status &= health->mask;                                                            /* watched bits */
+    if (status != 0)                                                                   /* error bit set */
+    {
+        s->stats.error_polls++;                                                        /* count the error poll */
+    }
+    s->pending = 0;                                                                    /* init pending */
+    for (b = 0; b < 32; b++)                                                           /* check all bits */
+    {
+        bit = (uint32_t)1 << b;                                                        /* get the bit */
+        if ((health->mask & bit) == 0)                                                 /* not watched */
+        {
+            continue;                                                                  /* next bit */
+        }
+        if (((status ^ s->stats.status) & bit) == 0)                                   /* same as debounced */
+        {
+            s->count[b] = 0;                                                           /* reset the count */
+            continue;                                                                  /* next bit */
+        }
+        s->count[b]++;                                                                 /* count the poll */
+        if (s->count[b] < health->debounce)                                            /* not confirmed */
+        {
+            s->pending = 1;                                                            /* poll again next cycle */
+            continue;                                                                  /* next bit */
+        }
+        s->count[b] = 0;                                                               /* reset the count */
+        s->stats.status ^= bit;                                                        /* flip the debounced bit */
+        res |= a_sen5x_health_emit(health, sensor, now_ms, ((s->stats.status & bit) != 0) ?
+                                   SEN5X_HEALTH_EVENT_RAISED : SEN5X_HEALTH_EVENT_CLEARED, bit);   /* emit the change */
+    }
+    a_sen5x_health_schedule(health, sensor, now_ms);                                   /* set the next poll */
+    *clear = (status != 0) ? 1 : 0;                                                    /* clear the latched bits */
+
+    return res;                                                                        /* return the result */
+}
+
+/**
+ * @brief     feed a failed status read of a sensor
+ * @param[in] *health pointer to a health structure
+ * @param[in] sensor sensor index
+ * @param[in] now_ms time of the read in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 health is NULL
+ *            - 3 health is not initialized
+ *            - 4 sensor is invalid
+ * @note      debounce consecutive failures raise the lost event, the next good read the restored event
+ */
+uint8_t sen5x_health_fail(sen5x_health_t *health, uint8_t sensor, uint64_t now_ms)
+{
+    uint8_t res;
+    sen5x_health_sensor_t *s;
+
+    if (health == NULL)                                                                /* check the health */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (health->inited != 1)                                                           /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (sensor >= health->sensors)                                                     /* check the sensor */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    res = 0;                                                                           /* init the result */
+    s = &health->sensor[sensor];                                                       /* get the sensor */
+    a_sen5x_health_account(health, sensor, now_ms);                                    /* account the time */
+    s->stats.polls++;                                                                  /* count the poll */
+    s->stats.failures++;                                                               /* count the failure */
+    if (s->failures < 255)                                                             /* saturate */
+    {
+        s->failures++;                                                                 /* count the failure */
+    }
+    if ((s->stats.lost == 0) && (s->failures >= health->debounce))                     /* confirmed lost */
+    {
+        s->stats.lost = 1;                                                             /* set lost */
+        res = a_sen5x_health_emit(health, sensor, now_ms, SEN5X_HEALTH_EVENT_LOST, 0);   /* emit lost */
+    }
+    if (s->stats.lost == 0)                                                            /* not confirmed yet */
+    {
+        s->pending = 1;                                                                /* poll again next cycle */
+    }
+    else
+    {
+        s->pending = 0;                                                                /* retry at the interval */
+        a_sen5x_health_schedule(health, sensor, now_ms);                               /* set the next poll */
+    }
+
+    return res;                                                                        /* return the result */
+}
+
+/**
+ * @brief      get the stats of a sensor
+ * @param[in]  *health pointer to a health structure
+ * @param[in]  sensor sensor index
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 health or stats is NULL
+ *             - 3 health is not initialized
+ *             - 4 sensor is invalid
+ * @note       none
+ */
+uint8_t sen5x_health_get_stats(sen5x_health_t *health, uint8_t sensor, sen5x_health_stats_t *stats)
+{
+    sen5x_health_sensor_t *s;
+
+    if ((health == NULL) || (stats == NULL))                                           /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (health->inited != 1)                                                           /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (sensor >= health->sensors)                                                     /* check the sensor */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    s = &health->sensor[sensor];                                                       /* get the sensor */
+    *stats = s->stats;                                                                 /* copy the stats */
+    stats->error_rate = (s->stats.polls > s->stats.failures) ?
+                        (float)s->stats.error_polls / (float)(s->stats.polls - s->stats.failures) : 0.0f;   /* error rate */
+    stats->availability = (s->stats.tracked_ms != 0) ?
+                          (float)s->stats.uptime_ms / (float)s->stats.tracked_ms : 0.0f;   /* availability */
+
+    return 0;                                                                          /* success return 0 */
+}
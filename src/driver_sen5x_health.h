@@ -0,0 +1,227 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_health.h
+ * @brief     driver sen5x health header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_HEALTH_H
+#define DRIVER_SEN5X_HEALTH_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_health_driver sen5x health driver function
+ * @brief    sen5x health driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x health definition
+ */
+#define SEN5X_HEALTH_MAX_SENSORS             32                   /**< max sensors */
+#define SEN5X_HEALTH_DEFAULT_INTERVAL_MS     60000                /**< status poll interval in ms */
+#define SEN5X_HEALTH_DEFAULT_DEBOUNCE        2                    /**< consecutive polls that confirm a change */
+#define SEN5X_HEALTH_DEFAULT_MASK            (SEN5X_STATUS_FAN_SPEED_ERROR | SEN5X_STATUS_GAS_ERROR | \
+                                              SEN5X_STATUS_RHT_ERROR | SEN5X_STATUS_LASER_ERROR | \
+                                              SEN5X_STATUS_FAN_ERROR)                                  /**< error bits */
+
+/**
+ * @brief sen5x health event type enumeration definition
+ */
+typedef enum
+{
+    SEN5X_HEALTH_EVENT_RAISED   = 0x00,        /**< a status bit is confirmed on */
+    SEN5X_HEALTH_EVENT_CLEARED  = 0x01,        /**< a status bit is confirmed off */
+    SEN5X_HEALTH_EVENT_LOST     = 0x02,        /**< the status register can't be read */
+    SEN5X_HEALTH_EVENT_RESTORED = 0x03,        /**< the status register can be read again */
+} sen5x_health_event_type_t;
+
+/**
+ * @brief sen5x health event structure definition
+ */
+typedef struct sen5x_health_event_s
+{
+    uint64_t timestamp_ms;              /**< time of the confirming poll */
+    uint32_t bit;                       /**< changed status bit, 0 for the lost and restored events */
+    uint32_t status;                    /**< debounced status after the event */
+    uint8_t sensor;                     /**< sensor index */
+    uint8_t type;                       /**< event type */
+} sen5x_health_event_t;
+
+/**
+ * @brief sen5x health stats structure definition
+ */
+typedef struct sen5x_health_stats_s
+{
+    uint64_t tracked_ms;                /**< time since the first cycle */
+    uint64_t uptime_ms;                 /**< time readable without a confirmed error */
+    uint64_t fault_ms;                  /**< time readable with a confirmed error */
+    uint64_t lost_ms;                   /**< time the status register was lost */
+    uint64_t polls;                     /**< status reads */
+    uint64_t failures;                  /**< failed status reads */
+    uint64_t error_polls;               /**< status reads with an error bit */
+    uint64_t events;                    /**< emitted events */
+    uint32_t status;                    /**< debounced status */
+    uint8_t lost;                       /**< status register lost */
+    float error_rate;                   /**< error_polls of the good status reads */
+    float availability;                 /**< uptime_ms of tracked_ms */
+} sen5x_health_stats_t;
+
+/**
+ * @brief sen5x health sensor structure definition
+ */
+typedef struct sen5x_health_sensor_s
+{
+    uint64_t next_ms;                                  /**< time of the next poll */
+    uint64_t last_ms;                                  /**< time accounted up to */
+    uint8_t count[32];                                 /**< consecutive polls against the debounced bit */
+    uint8_t failures;                                  /**< consecutive failed reads */
+    uint8_t pending;                                   /**< a change is being confirmed */
+    uint8_t started;                                   /**< first cycle seen */
+    sen5x_health_stats_t stats;                        /**< stats */
+} sen5x_health_sensor_t;
+
+/**
+ * @brief sen5x health structure definition
+ */
+typedef struct sen5x_health_s
+{
+    uint8_t sensors;                                                      /**< sensor count */
+    uint8_t debounce;                                                     /**< consecutive polls that confirm a change */
+    uint32_t interval_ms;                                                 /**< poll interval */
+    uint32_t mask;                                                        /**< watched status bits */
+    uint8_t (*emit)(const sen5x_health_event_t *event);                   /**< point to an emit function address */
+    sen5x_health_sensor_t sensor[SEN5X_HEALTH_MAX_SENSORS];               /**< sensor state */
+    uint8_t inited;                                                       /**< inited flag */
+} sen5x_health_t;
+
+/**
+ * @brief     init the health monitor
+ * @param[in] *health pointer to a health structure
+ * @param[in] sensors sensor count
+ * @param[in] interval_ms status poll interval in ms
+ * @param[in] debounce consecutive polls that confirm a change
+ * @param[in] mask watched status bits
+ * @param[in] *emit pointer to an emit function address called with every event, NULL keeps only the stats
+ * @return    status code
+ *            - 0 success
+ *            - 2 health is NULL
+ *            - 4 sensors is invalid
+ *            - 5 interval is invalid
+ *            - 6 debounce is invalid
+ *            - 7 mask is invalid
+ * @note      1 <= sensors <= 32, interval_ms > 0, 1 <= debounce <= 255, mask != 0
+ */
+uint8_t sen5x_health_init(sen5x_health_t *health, uint8_t sensors, uint32_t interval_ms, uint8_t debounce,
+                          uint32_t mask, uint8_t (*emit)(const sen5x_health_event_t *event));
+
+/**
+ * @brief      run a read cycle of a sensor
+ * @param[in]  *health pointer to a health structure
+ * @param[in]  sensor sensor index
+ * @param[in]  now_ms current time in ms
+ * @param[out] *poll pointer to a poll buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 health or poll is NULL
+ *             - 3 health is not initialized
+ *             - 4 sensor is invalid
+ * @note       call it right after the measured values are read, when poll is set read the status with
+ *             sen5x_get_device_status in the same cycle and pass it to sen5x_health_update or
+ *             sen5x_health_fail, the status read then fills the idle time before the next sample,
+ *             the polls of the sensors are spread over the interval and a change being confirmed is
+ *             polled every cycle
+ */
+uint8_t sen5x_health_cycle(sen5x_health_t *health, uint8_t sensor, uint64_t now_ms, uint8_t *poll);
+
+/**
+ * @brief      feed a status read of a sensor
+ * @param[in]  *health pointer to a health structure
+ * @param[in]  sensor sensor index
+ * @param[in]  now_ms time of the read in ms
+ * @param[in]  status device status read by sen5x_get_device_status
+ * @param[out] *clear pointer to a clear buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 emit failed
+ *             - 2 health or clear is NULL
+ *             - 3 health is not initialized
+ *             - 4 sensor is invalid
+ * @note       the error bits stay set until they are cleared, when clear is set call
+ *             sen5x_clear_device_status so the next poll shows whether the error is still there
+ */
+uint8_t sen5x_health_update(sen5x_health_t *health, uint8_t sensor, uint64_t now_ms, uint32_t status, uint8_t *clear);
+
+/**
+ * @brief     feed a failed status read of a sensor
+ * @param[in] *health pointer to a health structure
+ * @param[in] sensor sensor index
+ * @param[in] now_ms time of the read in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 health is NULL
+ *            - 3 health is not initialized
+ *            - 4 sensor is invalid
+ * @note      debounce consecutive failures raise the lost event, the next good read the restored event
+ */
+uint8_t sen5x_health_fail(sen5x_health_t *health, uint8_t sensor, uint64_t now_ms);
+
+/**
+ * @brief      get the stats of a sensor
+ * @param[in]  *health pointer to a health structure
+ * @param[in]  sensor sensor index
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 health or stats is NULL
+ *             - 3 health is not initialized
+ *             - 4 sensor is invalid
+ * @note       none
+ */
+uint8_t sen5x_health_get_stats(sen5x_health_t *health, uint8_t sensor, sen5x_health_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
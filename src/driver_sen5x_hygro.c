@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_hygro.c
+ * @brief     driver sen5x hygro source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_hygro.h"
+
+/**
+ * @brief     look up the inverse growth factor
+ * @param[in] *hygro pointer to a hygro structure
+ * @param[in] humidity relative humidity in percentage, not nan
+ * @return    dry to wet mass ratio
+ * @note      linear interpolation between two table entries
+ */
+static inline float a_sen5x_hygro_inverse(const sen5x_hygro_t *hygro, float humidity)
+{
+    uint32_t i;
+    float x;
+
+    x = humidity * (1.0f / SEN5X_HYGRO_TABLE_STEP);                                    /* table position */
+    x = (x < 0.0f) ? 0.0f : x;                                                         /* lower limit */
+    x = (x > (float)(SEN5X_HYGRO_TABLE_SIZE - 1)) ? (float)(SEN5X_HYGRO_TABLE_SIZE - 1) : x;   /* upper limit */
+    i = (uint32_t)x;                                                                   /* lower entry */
+    i = (i > SEN5X_HYGRO_TABLE_SIZE - 2) ? (SEN5X_HYGRO_TABLE_SIZE - 2) : i;           /* keep a next entry */
+    x -= (float)i;                                                                     /* fraction */
+
+    return hygro->inverse_growth[i] + x * (hygro->inverse_growth[i + 1] - hygro->inverse_growth[i]);   /* interpolate */
+}
+
+/**
+ * @brief     init the hygro correction and build its table
+ * @param[in] *hygro pointer to a hygro structure
+ * @param[in] kappa hygroscopicity parameter
+ * @param[in] density dry particle density relative to water
+ * @param[in] max_humidity humidity limit in percentage
+ * @return    status code
+ *            - 0 success
+ *            - 2 hygro is NULL
+ *            - 4 kappa is invalid
+ *            - 5 density is invalid
+ *            - 6 max humidity is invalid
+ * @note      kappa >= 0, density > 0, 0 < max_humidity < 100,
+ *            the growth factor is 1 + kappa / density * aw / (1 - aw) with aw = humidity / 100
+ */
+uint8_t sen5x_hygro_init(sen5x_hygro_t *hygro, float kappa, float density, float max_humidity)
+{
+    uint32_t i;
+    double aw;
+
+    if (hygro == NULL)                                                                 /* check the hygro */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (!(kappa >= 0.0f))                                                              /* check the kappa */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if (!(density > 0.0f))                                                             /* check the density */
+    {
+        return 5;                                                                      /* return error */
+    }
+    if (!((max_humidity > 0.0f) && (max_humidity < 100.0f)))                           /* check the max humidity */
+    {
+        return 6;                                                                      /* return error */
+    }
+
+    memset(hygro, 0, sizeof(sen5x_hygro_t));                                           /* clear the hygro */
+    for (i = 0; i < SEN5X_HYGRO_TABLE_SIZE; i++)                                       /* build the table */
+    {
+        aw = (double)i * SEN5X_HYGRO_TABLE_STEP;                                       /* humidity */
+        aw = ((aw > max_humidity) ? max_humidity : aw) / 100.0;                        /* water activity */
+        hygro->inverse_growth[i] = (float)(1.0 / (1.0 + (double)kappa / density * aw / (1.0 - aw)));   /* dry to wet ratio */
+    }
+    hygro->kappa = kappa;                                                              /* save the kappa */
+    hygro->density = density;                                                          /* save the density */
+    hygro->max_humidity = max_humidity;                                                /* save the max humidity */
+    hygro->inited = 1;                                                                 /* set the inited */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the growth factor at a humidity
+ * @param[in]  *hygro pointer to a hygro structure
+ * @param[in]  humidity relative humidity in percentage
+ * @param[out] *factor pointer to a growth factor buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 hygro or factor is NULL
+ *             - 3 hygro is not initialized
+ *             - 4 humidity is nan
+ * @note       humidity above max_humidity uses the factor at max_humidity
+ */
+uint8_t sen5x_hygro_get_factor(sen5x_hygro_t *hygro, float humidity, float *factor)
+{
+    if ((hygro == NULL) || (factor == NULL))                                           /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (hygro->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (isnan(humidity) != 0)                                                          /* check the humidity */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    *factor = 1.0f / a_sen5x_hygro_inverse(hygro, humidity);                           /* get the factor */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      correct the pm mass concentrations of a sen55 sample
+ * @param[in]  *hygro pointer to a hygro structure
+ * @param[in]  *data pointer to a sen55 data structure
+ * @param[out] *result pointer to a hygro result structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 hygro, data or result is NULL
+ *             - 3 hygro is not initialized
+ * @note       the sample keeps the raw values, a sample without pm_valid or with a nan humidity
+ *             gives nan outputs and valid 0
+ */
+uint8_t sen5x_hygro_correct_sen55(sen5x_hygro_t *hygro, const sen55_data_t *data, sen5x_hygro_result_t *result)
+{
+    float inverse;
+
+    if ((hygro == NULL) || (data == NULL) || (result == NULL))                         /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (hygro->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    if ((data->pm_valid == 0) || (isnan(data->compensated_ambient_humidity_percentage) != 0))   /* check the sample */
+    {
+        result->pm1p0_ug_m3 = NAN;                                                     /* no pm1.0 */
+        result->pm2p5_ug_m3 = NAN;                                                     /* no pm2.5 */
+        result->pm4p0_ug_m3 = NAN;                                                     /* no pm4.0 */
+        result->pm10_ug_m3 = NAN;                                                      /* no pm10 */
+        result->growth_factor = NAN;                                                   /* no factor */
+        result->valid = 0;                                                             /* invalid */
+
+        return 0;                                                                      /* success return 0 */
+    }
+    inverse = a_sen5x_hygro_inverse(hygro, data->compensated_ambient_humidity_percentage);   /* look up */
+    result->pm1p0_ug_m3 = data->pm1p0_ug_m3 * inverse;                                 /* correct pm1.0 */
+    result->pm2p5_ug_m3 = data->pm2p5_ug_m3 * inverse;                                 /* correct pm2.5 */
+    result->pm4p0_ug_m3 = data->pm4p0_ug_m3 * inverse;                                 /* correct pm4.0 */
+    result->pm10_ug_m3 = data->pm10_ug_m3 * inverse;                                   /* correct pm10 */
+    result->growth_factor = 1.0f / inverse;                                            /* save the factor */
+    result->valid = 1;                                                                 /* valid */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      correct the pm mass concentrations of decoded columns
+ * @param[in]  *hygro pointer to a hygro structure
+ * @param[in]  *columns pointer to a sen5x batch measured structure
+ * @param[in]  count sample count
+ * @param[out] *corrected pointer to a hygro columns structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 hygro, columns, corrected or a pm column is NULL
+ *             - 3 hygro is not initialized
+ * @note       runs after sen5x_batch_decode_measured_values, the raw columns are kept,
+ *             a sample without pm_valid or with a nan humidity gives nan outputs
+ */
+uint8_t sen5x_hygro_correct_columns(sen5x_hygro_t *hygro, const sen5x_batch_measured_t *columns,
+                                    uint32_t count, sen5x_hygro_columns_t *corrected)
+{
+    uint32_t i;
+    float rh;
+    float inverse;
+
+    if ((hygro == NULL) || (columns == NULL) || (corrected == NULL))                   /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((columns->pm1p0_ug_m3 == NULL) || (columns->pm2p5_ug_m3 == NULL) ||
+        (columns->pm4p0_ug_m3 == NULL) || (columns->pm10_ug_m3 == NULL) ||
+        (columns->compensated_ambient_humidity_percentage == NULL) || (columns->pm_valid == NULL))   /* check the input columns */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((corrected->pm1p0_ug_m3 == NULL) || (corrected->pm2p5_ug_m3 == NULL) ||
+        (corrected->pm4p0_ug_m3 == NULL) || (corrected->pm10_ug_m3 == NULL))           /* check the output columns */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (hygro->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    for (i = 0; i < count; i++)                                                        /* run all samples */
+    {
+        rh = columns->compensated_ambient_humidity_percentage[i];                      /* get the humidity */
+        inverse = ((columns->pm_valid[i] != 0) && (isnan(rh) == 0)) ?
+                  a_sen5x_hygro_inverse(hygro, rh) : NAN;                              /* look up */
+        corrected->pm1p0_ug_m3[i] = columns->pm1p0_ug_m3[i] * inverse;                 /* correct pm1.0 */
+        corrected->pm2p5_ug_m3[i] = columns->pm2p5_ug_m3[i] * inverse;                 /* correct pm2.5 */
+        corrected->pm4p0_ug_m3[i] = columns->pm4p0_ug_m3[i] * inverse;                 /* correct pm4.0 */
+        corrected->pm10_ug_m3[i] = columns->pm10_ug_m3[i] * inverse;                   /* correct pm10 */
+        if (corrected->growth_factor != NULL)                                          /* factor wanted */
+        {
+            corrected->growth_factor[i] = 1.0f / inverse;                              /* save the factor */
+        }
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
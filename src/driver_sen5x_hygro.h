@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_hygro.h
+ * @brief     driver sen5x hygro header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_HYGRO_H
+#define DRIVER_SEN5X_HYGRO_H
+
+#include "driver_sen5x.h"
+#include "driver_sen5x_batch.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_hygro_driver sen5x hygro driver function
+ * @brief    sen5x hygro driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x hygro definition
+ */
+#define SEN5X_HYGRO_TABLE_STEP                0.5f         /**< table step in humidity percentage */
+#define SEN5X_HYGRO_TABLE_SIZE                201          /**< table entries from 0 % to 100 % */
+#define SEN5X_HYGRO_DEFAULT_KAPPA             0.4f         /**< typical kappa of mixed ambient aerosol */
+#define SEN5X_HYGRO_DEFAULT_DENSITY           1.65f        /**< typical dry particle density relative to water */
+#define SEN5X_HYGRO_DEFAULT_MAX_HUMIDITY      95.0f        /**< humidity where the correction stops growing */
+
+/**
+ * @brief sen5x hygro structure definition
+ */
+typedef struct sen5x_hygro_s
+{
+    float inverse_growth[SEN5X_HYGRO_TABLE_SIZE];        /**< dry to wet mass ratio per table step */
+    float kappa;                                         /**< hygroscopicity parameter */
+    float density;                                       /**< dry particle density relative to water */
+    float max_humidity;                                  /**< humidity limit in percentage */
+    uint8_t inited;                                      /**< inited flag */
+} sen5x_hygro_t;
+
+/**
+ * @brief sen5x hygro result structure definition
+ */
+typedef struct sen5x_hygro_result_s
+{
+    float pm1p0_ug_m3;              /**< corrected mass concentration pm1.0 [μg/m3] */
+    float pm2p5_ug_m3;              /**< corrected mass concentration pm2.5 [μg/m3] */
+    float pm4p0_ug_m3;              /**< corrected mass concentration pm4.0 [μg/m3] */
+    float pm10_ug_m3;               /**< corrected mass concentration pm10 [μg/m3] */
+    float growth_factor;            /**< wet to dry mass ratio */
+    uint8_t valid;                  /**< 1 when pm and humidity are valid */
+} sen5x_hygro_result_t;
+
+/**
+ * @brief sen5x hygro corrected column structure definition
+ */
+typedef struct sen5x_hygro_columns_s
+{
+    float *pm1p0_ug_m3;             /**< corrected mass concentration pm1.0 column [μg/m3] */
+    float *pm2p5_ug_m3;             /**< corrected mass concentration pm2.5 column [μg/m3] */
+    float *pm4p0_ug_m3;             /**< corrected mass concentration pm4.0 column [μg/m3] */
+    float *pm10_ug_m3;              /**< corrected mass concentration pm10 column [μg/m3] */
+    float *growth_factor;           /**< wet to dry mass ratio column, NULL to skip */
+} sen5x_hygro_columns_t;
+
+/**
+ * @brief     init the hygro correction and build its table
+ * @param[in] *hygro pointer to a hygro structure
+ * @param[in] kappa hygroscopicity parameter
+ * @param[in] density dry particle density relative to water
+ * @param[in] max_humidity humidity limit in percentage
+ * @return    status code
+ *            - 0 success
+ *            - 2 hygro is NULL
+ *            - 4 kappa is invalid
+ *            - 5 density is invalid
+ *            - 6 max humidity is invalid
+ * @note      kappa >= 0, density > 0, 0 < max_humidity < 100,
+ *            the growth factor is 1 + kappa / density * aw / (1 - aw) with aw = humidity / 100
+ */
+uint8_t sen5x_hygro_init(sen5x_hygro_t *hygro, float kappa, float density, float max_humidity);
+
+/**
+ * @brief      get the growth factor at a humidity
+ * @param[in]  *hygro pointer to a hygro structure
+ * @param[in]  humidity relative humidity in percentage
+ * @param[out] *factor pointer to a growth factor buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 hygro or factor is NULL
+ *             - 3 hygro is not initialized
+ *             - 4 humidity is nan
+ * @note       humidity above max_humidity uses the factor at max_humidity
+ */
+uint8_t sen5x_hygro_get_factor(sen5x_hygro_t *hygro, float humidity, float *factor);
+
+/**
+ * @brief      correct the pm mass concentrations of a sen55 sample
+ * @param[in]  *hygro pointer to a hygro structure
+ * @param[in]  *data pointer to a sen55 data structure
+ * @param[out] *result pointer to a hygro result structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 hygro, data or result is NULL
+ *             - 3 hygro is not initialized
+ * @note       the sample keeps the raw values, a sample without pm_valid or with a nan humidity
+ *             gives nan outputs and valid 0
+ */
+uint8_t sen5x_hygro_correct_sen55(sen5x_hygro_t *hygro, const sen55_data_t *data, sen5x_hygro_result_t *result);
+
+/**
+ * @brief      correct the pm mass concentrations of decoded columns
+ * @param[in]  *hygro pointer to a hygro structure
+ * @param[in]  *columns pointer to a sen5x batch measured structure
+ * @param[in]  count sample count
+ * @param[out] *corrected pointer to a hygro columns structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 hygro, columns, corrected or a pm column is NULL
+ *             - 3 hygro is not initialized
+ * @note       runs after sen5x_batch_decode_measured_values, the raw columns are kept,
+ *             a sample without pm_valid or with a nan humidity gives nan outputs
+ */
+uint8_t sen5x_hygro_correct_columns(sen5x_hygro_t *hygro, const sen5x_batch_measured_t *columns,
+                                    uint32_t count, sen5x_hygro_columns_t *corrected);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,652 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_log.c
+ * @brief     driver sen5x log source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_log.h"
+#include "driver_sen5x_archive.h"
+
+/**
+ * @brief     write a little endian u16
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_sen5x_log_put_u16(uint8_t *buf, uint16_t v)
+{
+    buf[0] = (uint8_t)((v >> 0) & 0xFF);        /* byte 0 */
+    buf[1] = (uint8_t)((v >> 8) & 0xFF);        /* byte 1 */
+}
+
+/**
+ * @brief     write a little endian u32
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_sen5x_log_put_u32(uint8_t *buf, uint32_t v)
+{
+    a_sen5x_log_put_u16(&buf[0], (uint16_t)(v >> 0));         /* low half */
+    a_sen5x_log_put_u16(&buf[2], (uint16_t)(v >> 16));        /* high half */
+}
+
+/**
+ * @brief     read a little endian u16
+ * @param[in] *buf pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint16_t a_sen5x_log_get_u16(const uint8_t *buf)
+{
+    return (uint16_t)(((uint16_t)(buf[1]) << 8) | ((uint16_t)(buf[0]) << 0));        /* get the value */
+}
+
+/**
+ * @brief     read a little endian u32
+ * @param[in] *buf pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint32_t a_sen5x_log_get_u32(const uint8_t *buf)
+{
+    return ((uint32_t)a_sen5x_log_get_u16(&buf[2]) << 16) | a_sen5x_log_get_u16(&buf[0]);        /* get the value */
+}
+
+/**
+ * @brief      frame a sample record
+ * @param[in]  sequence record sequence
+ * @param[in]  *sample pointer to a sample structure
+ * @param[out] *buf pointer to a record buffer
+ * @note       sequence, timestamp, 8 words and the crc32 of the previous 28 bytes
+ */
+static void a_sen5x_log_pack(uint32_t sequence, const sen5x_store_sample_t *sample, uint8_t *buf)
+{
+    uint8_t i;
+
+    a_sen5x_log_put_u32(&buf[0], sequence);                                                 /* set the sequence */
+    a_sen5x_log_put_u32(&buf[4], (uint32_t)(sample->timestamp_ms >> 0));                    /* set the timestamp low */
+    a_sen5x_log_put_u32(&buf[8], (uint32_t)(sample->timestamp_ms >> 32));                   /* set the timestamp high */
+    for (i = 0; i < 8; i++)                                                                 /* run all words */
+    {
+        a_sen5x_log_put_u16(&buf[12 + i * 2], sample->word[i]);                             /* set the word */
+    }
+    a_sen5x_log_put_u32(&buf[28], sen5x_archive_crc32(0, buf, SEN5X_LOG_RECORD_LENGTH - 4));        /* set the crc */
+}
+
+/**
+ * @brief      check and unframe a sample record
+ * @param[in]  sequence expected sequence
+ * @param[in]  *buf pointer to a record buffer
+ * @param[out] *sample pointer to a sample structure
+ * @return     1 if the record is valid, else 0
+ * @note       none
+ */
+static uint8_t a_sen5x_log_unpack(uint32_t sequence, const uint8_t *buf, sen5x_store_sample_t *sample)
+{
+    uint8_t i;
+
+    if ((a_sen5x_log_get_u32(&buf[28]) != sen5x_archive_crc32(0, buf, SEN5X_LOG_RECORD_LENGTH - 4)) ||
+        (a_sen5x_log_get_u32(&buf[0]) != sequence))                                          /* check the crc and sequence */
+    {
+        return 0;                                                                            /* invalid */
+    }
+    sample->timestamp_ms = ((uint64_t)a_sen5x_log_get_u32(&buf[8]) << 32) |
+                           a_sen5x_log_get_u32(&buf[4]);                                     /* get the timestamp */
+    for (i = 0; i < 8; i++)                                                                  /* run all words */
+    {
+        sample->word[i] = a_sen5x_log_get_u16(&buf[12 + i * 2]);                             /* get the word */
+    }
+
+    return 1;                                                                                /* valid */
+}
+
+/**
+ * @brief     write and sync the pending records
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 commit failed
+ * @note      the records stay pending after a failure and are written again by the next commit
+ */
+static uint8_t a_sen5x_log_commit(sen5x_log_handle_t *handle)
+{
+    uint32_t len;
+    uint32_t us;
+    uint32_t span;
+    uint8_t bucket;
+    uint64_t start;
+
+    if (handle->pending == 0)                                                                     /* nothing pending */
+    {
+        return 0;                                                                                 /* success return 0 */
+    }
+
+    len = handle->pending * SEN5X_LOG_RECORD_LENGTH;                                              /* get the length */
+    if (handle->file_write(handle->size, handle->buf, len) != 0)                                  /* write the records */
+    {
+        handle->debug_print("sen5x: file write failed.\n");                                       /* file write failed */
+
+        return 1;                                                                                 /* return error */
+    }
+    start = handle->timestamp_us();                                                               /* sync start */
+    if (handle->file_sync() != 0)                                                                 /* sync the file */
+    {
+        handle->debug_print("sen5x: file sync failed.\n");                                        /* file sync failed */
+
+        return 1;                                                                                 /* return error */
+    }
+    us = (uint32_t)(handle->timestamp_us() - start);                                              /* sync latency */
+
+    handle->report.commits++;                                                                     /* count the commit */
+    handle->report.written_bytes += len;                                                          /* count the bytes */
+    handle->report.page_bytes += (uint64_t)((handle->size + len - 1) / handle->page_size -
+                                            handle->size / handle->page_size + 1) *
+                                 handle->page_size;                                               /* count the touched pages */
+    handle->report.sync_us_total += us;                                                           /* sum the latency */
+    if (us > handle->report.sync_us_max)                                                          /* check the max */
+    {
+        handle->report.sync_us_max = us;                                                          /* update the max */
+    }
+    bucket = 0;                                                                                   /* first bucket */
+    while (((us >> 1) != 0) && (bucket < (SEN5X_LOG_HISTOGRAM_BUCKETS - 1)))                      /* floor of log2 */
+    {
+        us >>= 1;                                                                                 /* next power */
+        bucket++;                                                                                 /* next bucket */
+    }
+    handle->report.sync_us_histogram[bucket]++;                                                   /* count the latency */
+    if (handle->pending > handle->report.max_pending_samples)                                     /* check the max */
+    {
+        handle->report.max_pending_samples = handle->pending;                                     /* update the max */
+    }
+    span = (uint32_t)(handle->pending_last_ms - handle->pending_first_ms);                        /* pending time span */
+    if (span > handle->report.max_pending_ms)                                                     /* check the max */
+    {
+        handle->report.max_pending_ms = span;                                                     /* update the max */
+    }
+    handle->size += len;                                                                          /* update the size */
+    handle->pending = 0;                                                                          /* clear the pending */
+
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     init the log and recover the file
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] *buf pointer to a group commit buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 file operation failed
+ *            - 2 handle or buf is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 buffer is too small
+ * @note      records after the first torn or corrupt record are truncated,
+ *            the buffer holds len / SEN5X_LOG_RECORD_LENGTH samples
+ */
+uint8_t sen5x_log_init(sen5x_log_handle_t *handle, uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+    uint32_t n;
+    uint32_t read_len;
+    uint64_t size;
+    uint64_t good;
+    uint8_t torn;
+    sen5x_store_sample_t sample;
+
+    if ((handle == NULL) || (buf == NULL))                                                         /* check the params */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->debug_print == NULL)                                                               /* check debug_print */
+    {
+        return 3;                                                                                  /* return error */
+    }
+    if (handle->file_read == NULL)                                                                 /* check file_read */
+    {
+        handle->debug_print("sen5x: file_read is null.\n");                                        /* file_read is null */
+
+        return 3;                                                                                  /* return error */
+    }
+    if (handle->file_write == NULL)                                                                /* check file_write */
+    {
+        handle->debug_print("sen5x: file_write is null.\n");                                       /* file_write is null */
+
+        return 3;                                                                                  /* return error */
+    }
+    if (handle->file_sync == NULL)                                                                 /* check file_sync */
+    {
+        handle->debug_print("sen5x: file_sync is null.\n");                                        /* file_sync is null */
+
+        return 3;                                                                                  /* return error */
+    }
+    if (handle->file_truncate == NULL)                                                             /* check file_truncate */
+    {
+        handle->debug_print("sen5x: file_truncate is null.\n");                                    /* file_truncate is null */
+
+        return 3;                                                                                  /* return error */
+    }
+    if (handle->file_size == NULL)                                                                 /* check file_size */
+    {
+        handle->debug_print("sen5x: file_size is null.\n");                                        /* file_size is null */
+
+        return 3;                                                                                  /* return error */
+    }
+    if (handle->timestamp_us == NULL)                                                              /* check timestamp_us */
+    {
+        handle->debug_print("sen5x: timestamp_us is null.\n");                                     /* timestamp_us is null */
+
+        return 3;                                                                                  /* return error */
+    }
+    if (len < SEN5X_LOG_RECORD_LENGTH)                                                             /* check the length */
+    {
+        handle->debug_print("sen5x: buffer is too small.\n");                                      /* buffer is too small */
+
+        return 4;                                                                                  /* return error */
+    }
+
+    if (handle->file_size(&size) != 0)                                                             /* get the file size */
+    {
+        handle->debug_print("sen5x: file size failed.\n");                                         /* file size failed */
+
+        return 1;                                                                                  /* return error */
+    }
+    handle->buf = buf;                                                                             /* set the buffer */
+    handle->capacity = len / SEN5X_LOG_RECORD_LENGTH;                                              /* records per buffer */
+    good = 0;                                                                                      /* init 0 */
+    torn = 0;                                                                                      /* no torn record */
+    while ((torn == 0) && ((good + 1) * SEN5X_LOG_RECORD_LENGTH <= size))                          /* scan whole records */
+    {
+        n = handle->capacity;                                                                      /* chunk records */
+        if ((uint64_t)n > (size / SEN5X_LOG_RECORD_LENGTH - good))                                 /* check the rest */
+        {
+            n = (uint32_t)(size / SEN5X_LOG_RECORD_LENGTH - good);                                 /* last chunk */
+        }
+        if ((handle->file_read(good * SEN5X_LOG_RECORD_LENGTH, buf, n * SEN5X_LOG_RECORD_LENGTH,
+                               &read_len) != 0))                                                   /* read a chunk */
+        {
+            handle->debug_print("sen5x: file read failed.\n");                                     /* file read failed */
+
+            return 1;                                                                              /* return error */
+        }
+        n = read_len / SEN5X_LOG_RECORD_LENGTH;                                                    /* whole records read */
+        if (n == 0)                                                                                /* short read */
+        {
+            break;                                                                                 /* break */
+        }
+        for (i = 0; i < n; i++)                                                                    /* check all records */
+        {
+            if (a_sen5x_log_unpack((uint32_t)good, &buf[i * SEN5X_LOG_RECORD_LENGTH], &sample) == 0)   /* check the record */
+            {
+                torn = 1;                                                                          /* torn tail */
+
+                break;                                                                             /* break */
+            }
+            good++;                                                                                /* next record */
+        }
+    }
+    memset(&handle->report, 0, sizeof(sen5x_log_report_t));                                        /* clear the report */
+    handle->report.recovered_samples = good;                                                       /* set the recovered samples */
+    handle->report.truncated_bytes = size - good * SEN5X_LOG_RECORD_LENGTH;                        /* set the dropped bytes */
+    if (size != good * SEN5X_LOG_RECORD_LENGTH)                                                    /* torn tail */
+    {
+        if ((handle->file_truncate(good * SEN5X_LOG_RECORD_LENGTH) != 0) ||
+            (handle->file_sync() != 0))                                                            /* truncate the tail */
+        {
+            handle->debug_print("sen5x: file truncate failed.\n");                                 /* file truncate failed */
+
+            return 1;                                                                              /* return error */
+        }
+    }
+    handle->size = good * SEN5X_LOG_RECORD_LENGTH;                                                 /* set the size */
+    handle->sequence = (uint32_t)good;                                                             /* set the sequence */
+    handle->commit_samples = handle->capacity;                                                     /* commit a full buffer */
+    handle->commit_ms = 0;                                                                         /* no time limit */
+    handle->page_size = 4096;                                                                      /* default page size */
+    handle->pending = 0;                                                                           /* init 0 */
+    handle->pending_first_ms = 0;                                                                  /* init 0 */
+    handle->pending_last_ms = 0;                                                                   /* init 0 */
+    handle->inited = 1;                                                                            /* flag finish initialization */
+
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     commit the pending samples and close the log
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 commit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t sen5x_log_deinit(sen5x_log_handle_t *handle)
+{
+    if (handle == NULL)                               /* check handle */
+    {
+        return 2;                                     /* return error */
+    }
+    if (handle->inited != 1)                          /* check handle initialization */
+    {
+        return 3;                                     /* return error */
+    }
+
+    if (a_sen5x_log_commit(handle) != 0)              /* commit the pending */
+    {
+        return 1;                                     /* return error */
+    }
+    handle->inited = 0;                               /* flag close */
+
+    return 0;                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the group commit policy
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] samples commit after the samples, 1 syncs every sample
+ * @param[in] ms commit after the time span of the pending samples, 0 disables it
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 samples is invalid
+ * @note      samples must be 1 - buffer records, the default is a full buffer without a time limit
+ */
+uint8_t sen5x_log_set_group_commit(sen5x_log_handle_t *handle, uint32_t samples, uint32_t ms)
+{
+    if (handle == NULL)                                                  /* check handle */
+    {
+        return 2;                                                        /* return error */
+    }
+    if (handle->inited != 1)                                             /* check handle initialization */
+    {
+        return 3;                                                        /* return error */
+    }
+    if ((samples == 0) || (samples > handle->capacity))                  /* check the samples */
+    {
+        handle->debug_print("sen5x: samples is invalid.\n");             /* samples is invalid */
+
+        return 4;                                                        /* return error */
+    }
+
+    handle->commit_samples = samples;                                    /* set the samples */
+    handle->commit_ms = ms;                                              /* set the time span */
+
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief     set the flash page size of the report
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] size page size
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 size is invalid
+ * @note      every commit is counted as programming each page it touches, the default is 4096
+ */
+uint8_t sen5x_log_set_page_size(sen5x_log_handle_t *handle, uint32_t size)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    if (handle->inited != 1)                                          /* check handle initialization */
+    {
+        return 3;                                                     /* return error */
+    }
+    if (size == 0)                                                    /* check the size */
+    {
+        handle->debug_print("sen5x: size is invalid.\n");             /* size is invalid */
+
+        return 4;                                                     /* return error */
+    }
+
+    handle->page_size = size;                                         /* set the page size */
+
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     append a sample
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 commit of the full buffer failed, the sample isn't queued
+ *            - 2 handle or sample is NULL
+ *            - 3 handle is not initialized
+ *            - 5 the sample is queued but its group commit failed
+ * @note      the sample is durable after the next commit, after 1 append the sample again,
+ *            after 5 don't append it again but retry with sen5x_log_commit
+ */
+uint8_t sen5x_log_append(sen5x_log_handle_t *handle, const sen5x_store_sample_t *sample)
+{
+    if ((handle == NULL) || (sample == NULL))                                                      /* check the params */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (handle->inited != 1)                                                                       /* check handle initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+
+    if (handle->pending >= handle->capacity)                                                       /* buffer is full */
+    {
+        if (a_sen5x_log_commit(handle) != 0)                                                       /* commit first */
+        {
+            return 1;                                                                              /* return error */
+        }
+    }
+    a_sen5x_log_pack(handle->sequence, sample, &handle->buf[handle->pending * SEN5X_LOG_RECORD_LENGTH]);   /* frame the record */
+    if (handle->pending == 0)                                                                      /* first pending */
+    {
+        handle->pending_first_ms = sample->timestamp_ms;                                           /* set the first timestamp */
+    }
+    handle->pending_last_ms = sample->timestamp_ms;                                                /* set the last timestamp */
+    handle->pending++;                                                                             /* count the pending */
+    handle->sequence++;                                                                            /* next sequence */
+    handle->report.samples++;                                                                      /* count the sample */
+    handle->report.payload_bytes += SEN5X_LOG_PAYLOAD_LENGTH;                                      /* count the payload */
+    if ((handle->pending >= handle->commit_samples) ||
+        ((handle->commit_ms != 0) &&
+         ((sample->timestamp_ms - handle->pending_first_ms) >= handle->commit_ms)))                /* check the policy */
+    {
+        if (a_sen5x_log_commit(handle) != 0)                                                       /* group commit */
+        {
+            return 5;                                                                              /* queued, commit failed */
+        }
+    }
+
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     commit the pending samples if the time span is over
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] now_ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 commit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it periodically when samples may stop arriving
+ */
+uint8_t sen5x_log_poll(sen5x_log_handle_t *handle, uint64_t now_ms)
+{
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (handle->inited != 1)                                                        /* check handle initialization */
+    {
+        return 3;                                                                   /* return error */
+    }
+
+    if ((handle->pending != 0) && (handle->commit_ms != 0) &&
+        (now_ms >= handle->pending_first_ms) &&
+        ((now_ms - handle->pending_first_ms) >= handle->commit_ms))                 /* check the time span */
+    {
+        handle->pending_last_ms = now_ms;                                           /* the window is open until now */
+
+        return a_sen5x_log_commit(handle);                                          /* group commit */
+    }
+
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     write and sync the pending samples
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 commit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t sen5x_log_commit(sen5x_log_handle_t *handle)
+{
+    if (handle == NULL)                          /* check handle */
+    {
+        return 2;                                /* return error */
+    }
+    if (handle->inited != 1)                     /* check handle initialization */
+    {
+        return 3;                                /* return error */
+    }
+
+    return a_sen5x_log_commit(handle);           /* commit */
+}
+
+/**
+ * @brief      get the committed sample count
+ * @param[in]  *handle pointer to a sen5x log handle structure
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle or count is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sen5x_log_get_count(sen5x_log_handle_t *handle, uint64_t *count)
+{
+    if ((handle == NULL) || (count == NULL))                     /* check the params */
+    {
+        return 2;                                                /* return error */
+    }
+    if (handle->inited != 1)                                     /* check handle initialization */
+    {
+        return 3;                                                /* return error */
+    }
+
+    *count = handle->size / SEN5X_LOG_RECORD_LENGTH;             /* get the count */
+
+    return 0;                                                    /* success return 0 */
+}
+
+/**
+ * @brief      read a committed sample
+ * @param[in]  *handle pointer to a sen5x log handle structure
+ * @param[in]  index sample index
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle or sample is NULL
+ *             - 3 handle is not initialized
+ *             - 4 index is out of range
+ * @note       use it to replay the log after a restart
+ */
+uint8_t sen5x_log_read(sen5x_log_handle_t *handle, uint64_t index, sen5x_store_sample_t *sample)
+{
+    uint8_t buf[SEN5X_LOG_RECORD_LENGTH];
+    uint32_t read_len;
+
+    if ((handle == NULL) || (sample == NULL))                                                   /* check the params */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if (handle->inited != 1)                                                                    /* check handle initialization */
+    {
+        return 3;                                                                               /* return error */
+    }
+    if (index >= (handle->size / SEN5X_LOG_RECORD_LENGTH))                                      /* check the index */
+    {
+        return 4;                                                                               /* return error */
+    }
+
+    if ((handle->file_read(index * SEN5X_LOG_RECORD_LENGTH, buf, SEN5X_LOG_RECORD_LENGTH,
+                           &read_len) != 0) || (read_len != SEN5X_LOG_RECORD_LENGTH))           /* read the record */
+    {
+        handle->debug_print("sen5x: file read failed.\n");                                      /* file read failed */
+
+        return 1;                                                                               /* return error */
+    }
+    if (a_sen5x_log_unpack((uint32_t)index, buf, sample) == 0)                                  /* check the record */
+    {
+        handle->debug_print("sen5x: record is corrupt.\n");                                     /* record is corrupt */
+
+        return 1;                                                                               /* return error */
+    }
+
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief      get the report
+ * @param[in]  *handle pointer to a sen5x log handle structure
+ * @param[out] *report pointer to a report structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle or report is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sen5x_log_get_report(sen5x_log_handle_t *handle, sen5x_log_report_t *report)
+{
+    if ((handle == NULL) || (report == NULL))                  /* check the params */
+    {
+        return 2;                                              /* return error */
+    }
+    if (handle->inited != 1)                                   /* check handle initialization */
+    {
+        return 3;                                              /* return error */
+    }
+
+    *report = handle->report;                                  /* copy the report */
+
+    return 0;                                                  /* success return 0 */
+}
@@ -0,0 +1,331 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_log.h
+ * @brief     driver sen5x log header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_LOG_H
+#define DRIVER_SEN5X_LOG_H
+
+#include "driver_sen5x_store.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_log_driver sen5x log driver function
+ * @brief    sen5x log driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x log definition
+ */
+#define SEN5X_LOG_RECORD_LENGTH          32        /**< framed record length */
+#define SEN5X_LOG_PAYLOAD_LENGTH         24        /**< sample payload length */
+#define SEN5X_LOG_HISTOGRAM_BUCKETS      24        /**< sync latency histogram buckets */
+
+/**
+ * @brief sen5x log report structure definition
+ */
+typedef struct sen5x_log_report_s
+{
+    uint64_t samples;                                        /**< appended samples */
+    uint64_t commits;                                        /**< group commits */
+    uint64_t payload_bytes;                                  /**< sample payload bytes */
+    uint64_t written_bytes;                                  /**< framed bytes written to the file */
+    uint64_t page_bytes;                                     /**< bytes of the flash pages programmed by the commits */
+    uint64_t sync_us_total;                                  /**< total sync latency in us */
+    uint32_t sync_us_max;                                    /**< max sync latency in us */
+    uint32_t sync_us_histogram[SEN5X_LOG_HISTOGRAM_BUCKETS]; /**< sync latency histogram, bucket n counts 2^n - 2^(n+1) us */
+    uint32_t max_pending_samples;                            /**< max samples waiting for a commit */
+    uint32_t max_pending_ms;                                 /**< max time span waiting for a commit */
+    uint64_t recovered_samples;                              /**< valid samples found by the recovery */
+    uint64_t truncated_bytes;                                /**< torn tail bytes dropped by the recovery */
+} sen5x_log_report_t;
+
+/**
+ * @brief sen5x log handle structure definition
+ */
+typedef struct sen5x_log_handle_s
+{
+    uint8_t (*file_read)(uint64_t offset, uint8_t *buf, uint32_t len, uint32_t *read_len);        /**< point to a file_read function address */
+    uint8_t (*file_write)(uint64_t offset, const uint8_t *buf, uint32_t len);                     /**< point to a file_write function address */
+    uint8_t (*file_sync)(void);                                                                   /**< point to a file_sync function address */
+    uint8_t (*file_truncate)(uint64_t len);                                                       /**< point to a file_truncate function address */
+    uint8_t (*file_size)(uint64_t *size);                                                         /**< point to a file_size function address */
+    uint64_t (*timestamp_us)(void);                                                               /**< point to a timestamp_us function address */
+    void (*debug_print)(const char *const fmt, ...);                                              /**< point to a debug_print function address */
+    uint8_t *buf;                                                                                 /**< group commit buffer */
+    uint32_t capacity;                                                                            /**< records per buffer */
+    uint32_t commit_samples;                                                                      /**< commit after the samples */
+    uint32_t commit_ms;                                                                           /**< commit after the time span */
+    uint32_t page_size;                                                                           /**< flash page size */
+    uint32_t pending;                                                                             /**< samples waiting for a commit */
+    uint64_t pending_first_ms;                                                                    /**< first timestamp waiting for a commit */
+    uint64_t pending_last_ms;                                                                     /**< last timestamp waiting for a commit */
+    uint64_t size;                                                                                /**< committed file size */
+    uint32_t sequence;                                                                            /**< next record sequence */
+    sen5x_log_report_t report;                                                                    /**< report */
+    uint8_t inited;                                                                               /**< inited flag */
+} sen5x_log_handle_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup sen5x_log_link_driver sen5x log link driver function
+ * @brief    sen5x log link driver modules
+ * @ingroup  sen5x_log_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize sen5x_log_handle_t structure
+ * @param[in] HANDLE pointer to a sen5x log handle structure
+ * @param[in] STRUCTURE sen5x_log_handle_t
+ * @note      none
+ */
+#define DRIVER_SEN5X_LOG_LINK_INIT(HANDLE, STRUCTURE)          memset(HANDLE, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link file_read function
+ * @param[in] HANDLE pointer to a sen5x log handle structure
+ * @param[in] FUC pointer to a file_read function address
+ * @note      none
+ */
+#define DRIVER_SEN5X_LOG_LINK_FILE_READ(HANDLE, FUC)           (HANDLE)->file_read = FUC
+
+/**
+ * @brief     link file_write function
+ * @param[in] HANDLE pointer to a sen5x log handle structure
+ * @param[in] FUC pointer to a file_write function address
+ * @note      none
+ */
+#define DRIVER_SEN5X_LOG_LINK_FILE_WRITE(HANDLE, FUC)          (HANDLE)->file_write = FUC
+
+/**
+ * @brief     link file_sync function
+ * @param[in] HANDLE pointer to a sen5x log handle structure
+ * @param[in] FUC pointer to a file_sync function address
+ * @note      none
+ */
+#define DRIVER_SEN5X_LOG_LINK_FILE_SYNC(HANDLE, FUC)           (HANDLE)->file_sync = FUC
+
+/**
+ * @brief     link file_truncate function
+ * @param[in] HANDLE pointer to a sen5x log handle structure
+ * @param[in] FUC pointer to a file_truncate function address
+ * @note      none
+ */
+#define DRIVER_SEN5X_LOG_LINK_FILE_TRUNCATE(HANDLE, FUC)       (HANDLE)->file_truncate = FUC
+
+/**
+ * @brief     link file_size function
+ * @param[in] HANDLE pointer to a sen5x log handle structure
+ * @param[in] FUC pointer to a file_size function address
+ * @note      none
+ */
+#define DRIVER_SEN5X_LOG_LINK_FILE_SIZE(HANDLE, FUC)           (HANDLE)->file_size = FUC
+
+/**
+ * @brief     link timestamp_us function
+ * @param[in] HANDLE pointer to a sen5x log handle structure
+ * @param[in] FUC pointer to a timestamp_us function address
+ * @note      none
+ */
+#define DRIVER_SEN5X_LOG_LINK_TIMESTAMP_US(HANDLE, FUC)        (HANDLE)->timestamp_us = FUC
+
+/**
+ * @brief     link debug_print function
+ * @param[in] HANDLE pointer to a sen5x log handle structure
+ * @param[in] FUC pointer to a debug_print function address
+ * @note      none
+ */
+#define DRIVER_SEN5X_LOG_LINK_DEBUG_PRINT(HANDLE, FUC)         (HANDLE)->debug_print = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @addtogroup sen5x_log_driver
+ * @{
+ */
+
+/**
+ * @brief     init the log and recover the file
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] *buf pointer to a group commit buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 file operation failed
+ *            - 2 handle or buf is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 buffer is too small
+ * @note      records after the first torn or corrupt record are truncated,
+ *            the buffer holds len / SEN5X_LOG_RECORD_LENGTH samples
+ */
+uint8_t sen5x_log_init(sen5x_log_handle_t *handle, uint8_t *buf, uint32_t len);
+
+/**
+ * @brief     commit the pending samples and close the log
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 commit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t sen5x_log_deinit(sen5x_log_handle_t *handle);
+
+/**
+ * @brief     set the group commit policy
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] samples commit after the samples, 1 syncs every sample
+ * @param[in] ms commit after the time span of the pending samples, 0 disables it
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 samples is invalid
+ * @note      samples must be 1 - buffer records, the default is a full buffer without a time limit
+ */
+uint8_t sen5x_log_set_group_commit(sen5x_log_handle_t *handle, uint32_t samples, uint32_t ms);
+
+/**
+ * @brief     set the flash page size of the report
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] size page size
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 size is invalid
+ * @note      every commit is counted as programming each page it touches, the default is 4096
+ */
+uint8_t sen5x_log_set_page_size(sen5x_log_handle_t *handle, uint32_t size);
+
+/**
+ * @brief     append a sample
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 commit of the full buffer failed, the sample isn't queued
+ *            - 2 handle or sample is NULL
+ *            - 3 handle is not initialized
+ *            - 5 the sample is queued but its group commit failed
+ * @note      the sample is durable after the next commit, after 1 append the sample again,
+ *            after 5 don't append it again but retry with sen5x_log_commit
+ */
+uint8_t sen5x_log_append(sen5x_log_handle_t *handle, const sen5x_store_sample_t *sample);
+
+/**
+ * @brief     commit the pending samples if the time span is over
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] now_ms current timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 1 commit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      call it periodically when samples may stop arriving
+ */
+uint8_t sen5x_log_poll(sen5x_log_handle_t *handle, uint64_t now_ms);
+
+/**
+ * @brief     write and sync the pending samples
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 commit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t sen5x_log_commit(sen5x_log_handle_t *handle);
+
+/**
+ * @brief      get the committed sample count
+ * @param[in]  *handle pointer to a sen5x log handle structure
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle or count is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sen5x_log_get_count(sen5x_log_handle_t *handle, uint64_t *count);
+
+/**
+ * @brief      read a committed sample
+ * @param[in]  *handle pointer to a sen5x log handle structure
+ * @param[in]  index sample index
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 handle or sample is NULL
+ *             - 3 handle is not initialized
+ *             - 4 index is out of range
+ * @note       use it to replay the log after a restart
+ */
+uint8_t sen5x_log_read(sen5x_log_handle_t *handle, uint64_t index, sen5x_store_sample_t *sample);
+
+/**
+ * @brief      get the report
+ * @param[in]  *handle pointer to a sen5x log handle structure
+ * @param[out] *report pointer to a report structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle or report is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t sen5x_log_get_report(sen5x_log_handle_t *handle, sen5x_log_report_t *report);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
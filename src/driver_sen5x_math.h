@@ -0,0 +1,187 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      math_body.h
+ * @brief     driver sen5x internal fast math header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_MATH_H
+#define DRIVER_SEN5X_MATH_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_math_driver sen5x math driver function
+ * @brief    sen5x internal fast math modules shared by the float batch paths
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief fast math constant definition
+ */
+#define SEN5X_MATH_LOG2E          1.44269504f           /**< 1 / ln(2) */
+#define SEN5X_MATH_LN2_HI         0.693145752f          /**< high part of ln(2) */
+#define SEN5X_MATH_LN2_LO         1.42860677e-6f        /**< low part of ln(2) */
+#define SEN5X_MATH_SHIFTER        12582912.0f           /**< 1.5 * 2^23 rounds to an integer */
+#define SEN5X_MATH_SQRT2          1.41421356f           /**< sqrt(2) */
+
+/**
+ * @brief float bits union definition
+ */
+typedef union sen5x_math_bits_u
+{
+    float f;            /**< float */
+    uint32_t u;         /**< bits */
+} sen5x_math_bits_t;
+
+/**
+ * @brief     select one of two floats without a branch
+ * @param[in] c condition, 0 or 1
+ * @param[in] a float taken when the condition is 1
+ * @param[in] b float taken when the condition is 0
+ * @return    selected float
+ * @note      a bit mask keeps the compiler from turning the select into a branch
+ */
+static inline float a_sen5x_math_select(uint32_t c, float a, float b)
+{
+    sen5x_math_bits_t x;
+    sen5x_math_bits_t y;
+    uint32_t m;
+
+    m = 0U - c;                                                                                /* all ones or zero */
+    x.f = a;                                                                                   /* first bits */
+    y.f = b;                                                                                   /* second bits */
+    x.u = (x.u & m) | (y.u & ~m);                                                              /* select */
+
+    return x.f;                                                                                /* return the float */
+}
+
+/**
+ * @brief     limit a float to a range
+ * @param[in] x input
+ * @param[in] lo lower limit
+ * @param[in] hi upper limit
+ * @return    limited float
+ * @note      none
+ */
+static inline float a_sen5x_math_limit(float x, float lo, float hi)
+{
+    x = a_sen5x_math_select((uint32_t)(x < lo), lo, x);                                        /* lower limit */
+
+    return a_sen5x_math_select((uint32_t)(x > hi), hi, x);                                     /* upper limit */
+}
+
+/**
+ * @brief     fast natural exponential
+ * @param[in] x input
+ * @return    e^x
+ * @note      cody-waite reduction to |r| <= ln(2) / 2 and a degree 6 polynomial, relative error below 3e-7
+ */
+static inline float a_sen5x_math_exp(float x)
+{
+    float k;
+    float r;
+    float p;
+    sen5x_math_bits_t scale;
+
+    x = a_sen5x_math_limit(x, -87.0f, 88.0f);                                                  /* limit the range */
+    k = (x * SEN5X_MATH_LOG2E + SEN5X_MATH_SHIFTER) - SEN5X_MATH_SHIFTER;                      /* round to the nearest */
+    r = x - k * SEN5X_MATH_LN2_HI - k * SEN5X_MATH_LN2_LO;                                     /* reduce the range */
+    p = 1.0f + r * (1.0f + r * (0.5f + r * (1.0f / 6.0f + r * (1.0f / 24.0f +
+        r * (1.0f / 120.0f + r * (1.0f / 720.0f))))));                                        /* e^r */
+    scale.u = (uint32_t)((int32_t)k + 127) << 23;                                              /* 2^k */
+
+    return p * scale.f;                                                                        /* return e^x */
+}
+
+/**
+ * @brief     fast natural logarithm
+ * @param[in] x positive normal input
+ * @return    ln(x)
+ * @note      mantissa reduced to sqrt(0.5) - sqrt(2) and the atanh series up to s^9, absolute error below 3e-7
+ */
+static inline float a_sen5x_math_log(float x)
+{
+    float e;
+    float s;
+    float s2;
+    float p;
+    float h;
+    sen5x_math_bits_t m;
+
+    m.f = x;                                                                                   /* get the bits */
+    e = (float)((int32_t)((m.u >> 23) & 0xFF) - 127);                                          /* get the exponent */
+    m.u = (m.u & 0x007FFFFFU) | 0x3F800000U;                                                   /* mantissa in 1 - 2 */
+    h = a_sen5x_math_select((uint32_t)(m.f > SEN5X_MATH_SQRT2), 1.0f, 0.0f);                   /* upper half */
+    m.f *= 1.0f - 0.5f * h;                                                                    /* halve the upper half */
+    e += h;                                                                                    /* one more */
+    s = (m.f - 1.0f) / (m.f + 1.0f);                                                           /* atanh argument */
+    s2 = s * s;                                                                                /* square */
+    p = 2.0f * s * (1.0f + s2 * (1.0f / 3.0f + s2 * (1.0f / 5.0f + s2 * (1.0f / 7.0f +
+        s2 * (1.0f / 9.0f)))));                                                                /* ln of the mantissa */
+
+    return e * SEN5X_MATH_LN2_HI + (p + e * SEN5X_MATH_LN2_LO);                                /* return ln(x) */
+}
+
+/**
+ * @brief     fast square root
+ * @param[in] x non negative input
+ * @return    sqrt(x)
+ * @note      inverse square root seed and three newton steps, zero gives zero
+ */
+static inline float a_sen5x_math_sqrt(float x)
+{
+    sen5x_math_bits_t y;
+
+    y.f = x;                                                                                   /* get the bits */
+    y.u = 0x5F3759DFU - (y.u >> 1);                                                            /* seed */
+    y.f = y.f * (1.5f - 0.5f * x * y.f * y.f);                                                 /* newton step */
+    y.f = y.f * (1.5f - 0.5f * x * y.f * y.f);                                                 /* newton step */
+    y.f = y.f * (1.5f - 0.5f * x * y.f * y.f);                                                 /* newton step */
+
+    return x * y.f;                                                                            /* return sqrt(x) */
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
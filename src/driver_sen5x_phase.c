@@ -0,0 +1,310 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_phase.c
+ * @brief     driver sen5x phase source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_phase.h"
+
+/**
+ * @brief sen5x phase definition
+ */
+#define SEN5X_PHASE_ACQUIRE_DRIFT_PPM        5000.0        /**< period uncertainty before the first estimate in ppm */
+#define SEN5X_PHASE_FIRST_SPAN               4             /**< edges between the first two period estimates */
+#define SEN5X_PHASE_MAX_SPAN                 1024          /**< longest baseline of a period estimate */
+
+/**
+ * @brief     start a new sample bracket
+ * @param[in] *phase pointer to a phase structure
+ * @param[in] lo_ms the edge is after this time
+ * @param[in] hi_ms the edge is at or before this time
+ * @return    none
+ * @note      none
+ */
+static void a_sen5x_phase_bracket(sen5x_phase_t *phase, double lo_ms, double hi_ms)
+{
+    phase->lo_ms = lo_ms;                                                              /* set the lower bound */
+    phase->hi_ms = hi_ms;                                                              /* set the upper bound */
+    phase->probed = 0;                                                                 /* no probe yet */
+}
+
+/**
+ * @brief     restart the acquisition
+ * @param[in] *phase pointer to a phase structure
+ * @param[in] t_ms poll time
+ * @return    none
+ * @note      the period estimate is kept with the acquisition uncertainty, the next edge is within one period
+ */
+static void a_sen5x_phase_restart(sen5x_phase_t *phase, double t_ms)
+{
+    a_sen5x_phase_bracket(phase, t_ms, t_ms + phase->period_ms);                       /* edge within a period */
+    phase->sigma_ms = phase->nominal_ms * SEN5X_PHASE_ACQUIRE_DRIFT_PPM * 1e-6;        /* coarse period */
+    phase->anchored = 0;                                                               /* no anchor */
+    phase->span = SEN5X_PHASE_FIRST_SPAN;                                              /* short first span */
+}
+
+/**
+ * @brief     init the data ready phase tracker
+ * @param[in] *phase pointer to a phase structure
+ * @param[in] period_ms nominal sample period in ms
+ * @param[in] tolerance_ms edge uncertainty that starts a probe in ms
+ * @param[in] drift_ppm clock drift left after the period estimate in ppm
+ * @return    status code
+ *            - 0 success
+ *            - 2 phase is NULL
+ *            - 4 period is invalid
+ *            - 5 tolerance is invalid
+ *            - 6 drift is invalid
+ * @note      period_ms > 0, 0 < tolerance_ms < period_ms, 0 <= drift_ppm <= 100000
+ */
+uint8_t sen5x_phase_init(sen5x_phase_t *phase, float period_ms, float tolerance_ms, float drift_ppm)
+{
+    if (phase == NULL)                                                                 /* check the phase */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (!(period_ms > 0.0f))                                                           /* check the period */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if (!((tolerance_ms > 0.0f) && (tolerance_ms < period_ms)))                        /* check the tolerance */
+    {
+        return 5;                                                                      /* return error */
+    }
+    if (!((drift_ppm >= 0.0f) && (drift_ppm <= 100000.0f)))                            /* check the drift */
+    {
+        return 6;                                                                      /* return error */
+    }
+
+    memset(phase, 0, sizeof(sen5x_phase_t));                                           /* clear the phase */
+    phase->period_ms = period_ms;                                                      /* start at the nominal period */
+    phase->nominal_ms = period_ms;                                                     /* save the nominal period */
+    phase->tolerance_ms = tolerance_ms;                                                /* save the tolerance */
+    phase->drift_ppm = drift_ppm;                                                      /* save the drift */
+    phase->inited = 1;                                                                 /* set the inited */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the time of the next data ready poll
+ * @param[in]  *phase pointer to a phase structure
+ * @param[in]  now_ms current time in ms
+ * @param[out] *poll_ms pointer to a poll time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 phase or poll_ms is NULL
+ *             - 3 phase is not initialized
+ * @note       the poll lands just after the latest possible edge, when the edge is not known well enough
+ *             it lands in the middle of the bracket once per sample, a poll time in the past means poll now
+ */
+uint8_t sen5x_phase_next_poll(sen5x_phase_t *phase, uint64_t now_ms, uint64_t *poll_ms)
+{
+    double t;
+
+    if ((phase == NULL) || (poll_ms == NULL))                                          /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (phase->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    if (phase->started == 0)                                                           /* nothing known */
+    {
+        *poll_ms = now_ms;                                                             /* poll now */
+
+        return 0;                                                                      /* success return 0 */
+    }
+    if ((phase->hi_ms - phase->lo_ms) > phase->tolerance_ms)                           /* edge too uncertain */
+    {
+        t = floor(0.5 * (phase->lo_ms + phase->hi_ms) + 0.5);                          /* bisect the bracket */
+    }
+    else
+    {
+        t = ceil(phase->hi_ms);                                                        /* just after the latest edge */
+    }
+    *poll_ms = (t > 0.0) ? (uint64_t)t : 0;                                            /* set the poll time */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     feed the result of a data ready poll
+ * @param[in] *phase pointer to a phase structure
+ * @param[in] poll_ms time of the poll in ms
+ * @param[in] flag data ready flag read by sen5x_read_data_flag
+ * @return    status code
+ *            - 0 success
+ *            - 2 phase is NULL
+ *            - 3 phase is not initialized
+ * @note      the caller reads the measured values after every ready poll, which clears the flag,
+ *            a late ready poll skips the missed samples and keeps the phase, a poll that finds the flag off
+ *            far after the bracket restarts the acquisition
+ */
+uint8_t sen5x_phase_update(sen5x_phase_t *phase, uint64_t poll_ms, sen5x_data_ready_flag_t flag)
+{
+    double t;
+    double c;
+    double grow;
+
+    if (phase == NULL)                                                                 /* check the phase */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (phase->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    t = (double)poll_ms;                                                               /* poll time */
+    phase->polls++;                                                                    /* one more poll */
+    if (flag != SEN5X_DATA_READY_FLAG_AVAILABLE)                                       /* the edge is later */
+    {
+        phase->misses++;                                                               /* one more miss */
+        if (phase->started == 0)                                                       /* first poll */
+        {
+            phase->started = 1;                                                        /* started */
+            a_sen5x_phase_restart(phase, t);                                           /* start the acquisition */
+        }
+        else if (t < phase->hi_ms)                                                     /* inside the bracket */
+        {
+            phase->lo_ms = (t > phase->lo_ms) ? t : phase->lo_ms;                      /* raise the lower bound */
+            phase->probed = 1;                                                         /* probe done */
+        }
+        else if (t <= phase->hi_ms + phase->tolerance_ms)                              /* the edge drifted late */
+        {
+            phase->lo_ms = t;                                                          /* edge after the poll */
+            phase->hi_ms = t + phase->tolerance_ms;                                    /* search just after it */
+            phase->anchored = 0;                                                       /* drop the anchor */
+        }
+        else                                                                           /* lost the phase */
+        {
+            a_sen5x_phase_restart(phase, t);                                           /* restart the acquisition */
+        }
+
+        return 0;                                                                      /* success return 0 */
+    }
+
+    phase->samples++;                                                                  /* one more sample */
+    if (phase->started == 0)                                                           /* first poll, maybe stale */
+    {
+        phase->started = 1;                                                            /* started */
+        phase->last_read_ms = t;                                                       /* save the read */
+        a_sen5x_phase_restart(phase, t);                                               /* start the acquisition */
+
+        return 0;                                                                      /* success return 0 */
+    }
+    if (t <= phase->lo_ms)                                                             /* the edge drifted early */
+    {
+        phase->lo_ms = (phase->last_read_ms > t - phase->period_ms) ?
+                       phase->last_read_ms : (t - phase->period_ms);                   /* after the last read */
+        phase->hi_ms = t;                                                              /* at or before the poll */
+        phase->anchored = 0;                                                           /* drop the anchor */
+    }
+    else if (t <= phase->hi_ms)                                                        /* inside the bracket */
+    {
+        phase->probed = (t < phase->hi_ms - 0.5) ? 1 : phase->probed;                  /* a probe hit */
+        phase->hi_ms = t;                                                              /* lower the upper bound */
+    }
+    else if (t >= phase->hi_ms + phase->period_ms)                                     /* a late read */
+    {
+        while (phase->hi_ms + phase->period_ms <= t)                                   /* skip the missed samples */
+        {
+            phase->lo_ms += phase->period_ms;                                          /* next lower bound */
+            phase->hi_ms += phase->period_ms;                                          /* next upper bound */
+            phase->edge++;                                                             /* next edge */
+        }
+        phase->probed = 0;                                                             /* no information */
+    }
+    phase->last_read_ms = t;                                                           /* save the read */
+
+    if ((phase->probed != 0) && ((phase->hi_ms - phase->lo_ms) <= phase->tolerance_ms))   /* a measured edge */
+    {
+        c = 0.5 * (phase->lo_ms + phase->hi_ms);                                       /* edge estimate */
+        if (phase->anchored == 0)                                                      /* no anchor */
+        {
+            phase->anchor_ms = c;                                                      /* set the anchor */
+            phase->anchor_edge = phase->edge;                                          /* set the anchor edge */
+            phase->anchored = 1;                                                       /* anchored */
+        }
+        else if (phase->edge - phase->anchor_edge >= phase->span)                      /* long enough baseline */
+        {
+            phase->period_ms = (c - phase->anchor_ms) / (double)(phase->edge - phase->anchor_edge);   /* measure the period */
+            phase->sigma_ms = phase->tolerance_ms / (double)(phase->edge - phase->anchor_edge);   /* period uncertainty */
+            phase->anchor_ms = c;                                                      /* move the anchor */
+            phase->anchor_edge = phase->edge;                                          /* move the anchor edge */
+            phase->span = (phase->span < SEN5X_PHASE_MAX_SPAN) ? (phase->span * 2) : phase->span;   /* longer baseline */
+        }
+    }
+    grow = phase->nominal_ms * phase->drift_ppm * 1e-6 + phase->sigma_ms;              /* uncertainty per sample */
+    a_sen5x_phase_bracket(phase, phase->lo_ms + phase->period_ms - grow,
+                          phase->hi_ms + phase->period_ms + grow);                     /* next sample */
+    phase->edge++;                                                                     /* next edge */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      get the tracker statistics
+ * @param[in]  *phase pointer to a phase structure
+ * @param[out] *stats pointer to a phase stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 phase or stats is NULL
+ *             - 3 phase is not initialized
+ * @note       none
+ */
+uint8_t sen5x_phase_get_stats(sen5x_phase_t *phase, sen5x_phase_stats_t *stats)
+{
+    if ((phase == NULL) || (stats == NULL))                                            /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (phase->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    stats->polls = phase->polls;                                                       /* save the polls */
+    stats->samples = phase->samples;                                                   /* save the samples */
+    stats->misses = phase->misses;                                                     /* save the misses */
+    stats->polls_per_sample = (phase->samples != 0) ?
+                              (float)((double)phase->polls / (double)phase->samples) : 0.0f;   /* polls per sample */
+    stats->period_ms = (float)phase->period_ms;                                        /* save the period */
+    stats->drift_ppm = (float)((phase->period_ms / phase->nominal_ms - 1.0) * 1e6);    /* save the drift */
+    stats->uncertainty_ms = (float)(phase->hi_ms - phase->lo_ms);                      /* save the width */
+
+    return 0;                                                                          /* success return 0 */
+}
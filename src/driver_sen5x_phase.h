@@ -0,0 +1,166 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_phase.h
+ * @brief     driver sen5x phase header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_PHASE_H
+#define DRIVER_SEN5X_PHASE_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_phase_driver sen5x phase driver function
+ * @brief    sen5x phase driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x phase definition
+ */
+#define SEN5X_PHASE_DEFAULT_PERIOD_MS          1000.0f        /**< nominal sample period in ms */
+#define SEN5X_PHASE_DEFAULT_TOLERANCE_MS       4.0f           /**< ready edge uncertainty that starts a probe in ms */
+#define SEN5X_PHASE_DEFAULT_DRIFT_PPM          100.0f         /**< clock drift left after the period estimate in ppm */
+
+/**
+ * @brief sen5x phase structure definition
+ * @note  the edge is the time the data ready flag of the next sample turns on
+ */
+typedef struct sen5x_phase_s
+{
+    double lo_ms;                       /**< the edge is after this time */
+    double hi_ms;                       /**< the edge is at or before this time */
+    double last_read_ms;                /**< last poll that found the flag on */
+    double period_ms;                   /**< estimated sample period */
+    double nominal_ms;                  /**< nominal sample period */
+    double sigma_ms;                    /**< uncertainty of the period estimate */
+    double anchor_ms;                   /**< measured edge the period is estimated from */
+    uint64_t anchor_edge;               /**< edge index of the anchor */
+    uint64_t edge;                      /**< edge index of the pending sample */
+    uint32_t span;                      /**< edges between two period estimates */
+    float tolerance_ms;                 /**< edge uncertainty that starts a probe */
+    float drift_ppm;                    /**< uncertainty growth per sample in ppm */
+    uint8_t probed;                     /**< probe done for the pending sample */
+    uint8_t anchored;                   /**< anchor valid */
+    uint8_t started;                    /**< first poll seen */
+    uint64_t polls;                     /**< polls */
+    uint64_t samples;                   /**< samples */
+    uint64_t misses;                    /**< polls that found the flag off */
+    uint8_t inited;                     /**< inited flag */
+} sen5x_phase_t;
+
+/**
+ * @brief sen5x phase stats structure definition
+ */
+typedef struct sen5x_phase_stats_s
+{
+    uint64_t polls;                     /**< polls */
+    uint64_t samples;                   /**< samples */
+    uint64_t misses;                    /**< polls that found the flag off */
+    float polls_per_sample;             /**< polls per sample */
+    float period_ms;                    /**< estimated sample period */
+    float drift_ppm;                    /**< estimated clock drift against the nominal period */
+    float uncertainty_ms;               /**< current width of the edge bracket */
+} sen5x_phase_stats_t;
+
+/**
+ * @brief     init the data ready phase tracker
+ * @param[in] *phase pointer to a phase structure
+ * @param[in] period_ms nominal sample period in ms
+ * @param[in] tolerance_ms edge uncertainty that starts a probe in ms
+ * @param[in] drift_ppm clock drift left after the period estimate in ppm
+ * @return    status code
+ *            - 0 success
+ *            - 2 phase is NULL
+ *            - 4 period is invalid
+ *            - 5 tolerance is invalid
+ *            - 6 drift is invalid
+ * @note      period_ms > 0, 0 < tolerance_ms < period_ms, 0 <= drift_ppm <= 100000
+ */
+uint8_t sen5x_phase_init(sen5x_phase_t *phase, float period_ms, float tolerance_ms, float drift_ppm);
+
+/**
+ * @brief      get the time of the next data ready poll
+ * @param[in]  *phase pointer to a phase structure
+ * @param[in]  now_ms current time in ms
+ * @param[out] *poll_ms pointer to a poll time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 phase or poll_ms is NULL
+ *             - 3 phase is not initialized
+ * @note       the poll lands just after the latest possible edge, when the edge is not known well enough
+ *             it lands in the middle of the bracket, a poll time in the past means poll now
+ */
+uint8_t sen5x_phase_next_poll(sen5x_phase_t *phase, uint64_t now_ms, uint64_t *poll_ms);
+
+/**
+ * @brief     feed the result of a data ready poll
+ * @param[in] *phase pointer to a phase structure
+ * @param[in] poll_ms time of the poll in ms
+ * @param[in] flag data ready flag read by sen5x_read_data_flag
+ * @return    status code
+ *            - 0 success
+ *            - 2 phase is NULL
+ *            - 3 phase is not initialized
+ * @note      the caller reads the measured values after every ready poll, which clears the flag,
+ *            a late ready poll skips the missed samples and keeps the phase, a poll that finds the flag off
+ *            far after the bracket restarts the acquisition
+ */
+uint8_t sen5x_phase_update(sen5x_phase_t *phase, uint64_t poll_ms, sen5x_data_ready_flag_t flag);
+
+/**
+ * @brief      get the tracker statistics
+ * @param[in]  *phase pointer to a phase structure
+ * @param[out] *stats pointer to a phase stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 phase or stats is NULL
+ *             - 3 phase is not initialized
+ * @note       none
+ */
+uint8_t sen5x_phase_get_stats(sen5x_phase_t *phase, sen5x_phase_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,419 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_psd.c
+ * @brief     driver sen5x psd source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_psd.h"
+#include "driver_sen5x_math.h"
+
+/**
+ * @brief psd constant definition
+ */
+#define SEN5X_PSD_CHUNK              32                /**< samples of one work chunk, about 7 kbytes of stack */
+#define SEN5X_PSD_EDGES              6                 /**< bin edges */
+#define SEN5X_PSD_MIN_LOG_GSD        0.0487902f        /**< ln(1.05) */
+#define SEN5X_PSD_MAX_LOG_GSD        1.3862944f        /**< ln(4.0) */
+#define SEN5X_PSD_MIN_LOG_CMD        -3.9120230f       /**< ln(0.02) */
+#define SEN5X_PSD_MAX_LOG_CMD        2.3025851f        /**< ln(10.0) */
+#define SEN5X_PSD_DAMPING            1e-3f             /**< levenberg damping of the normal equations */
+#define SEN5X_PSD_PI_6               0.52359878f       /**< pi / 6 */
+
+/**
+ * @brief bin edge tables
+ */
+static const float gs_log_edge[SEN5X_PSD_EDGES] =
+{
+    -1.2039728f, -0.6931472f, 0.0f, 0.9162907f, 1.3862944f, 2.3025851f,
+};
+static const float gs_edge_cube[SEN5X_PSD_EDGES] =
+{
+    0.027f, 0.125f, 1.0f, 15.625f, 64.0f, 1000.0f,
+};
+static const float gs_inv_log10_width[SEN5X_PSD_BINS] =
+{
+    4.5076597f, 3.3219281f, 2.5129415f, 4.8990818f, 2.5129415f,
+};
+
+/**
+ * @brief     standard normal density
+ * @param[in] z input
+ * @return    density
+ * @note      none
+ */
+static inline float a_sen5x_psd_pdf(float z)
+{
+    return 0.39894228f * a_sen5x_math_exp(-0.5f * z * z);                                       /* return the density */
+}
+
+/**
+ * @brief     standard normal cumulative distribution
+ * @param[in] z input
+ * @return    probability
+ * @note      abramowitz and stegun 7.1.26, absolute error below 1e-7
+ */
+static inline float a_sen5x_psd_cdf(float z)
+{
+    float x;
+    float t;
+    float y;
+
+    x = fabsf(z) * 0.70710678f;                                                                /* erfc argument */
+    t = 1.0f / (1.0f + 0.3275911f * x);                                                        /* rational variable */
+    y = t * (0.254829592f + t * (-0.284496736f + t * (1.421413741f + t * (-1.453152027f +
+        t * 1.061405429f)))) * a_sen5x_math_exp(-x * x);                                        /* erfc */
+
+    return a_sen5x_math_select((uint32_t)(z < 0.0f), 0.5f * y, 1.0f - 0.5f * y);                /* return the probability */
+}
+
+/**
+ * @brief     inverse standard normal cumulative distribution
+ * @param[in] p probability in 0 - 1, exclusive
+ * @return    quantile
+ * @note      abramowitz and stegun 26.2.23, absolute error below 4.5e-4, only used as the fit start
+ */
+static inline float a_sen5x_psd_probit(float p)
+{
+    float q;
+    float t;
+    float x;
+
+    q = a_sen5x_math_select((uint32_t)(p < 0.5f), p, 1.0f - p);                                 /* lower tail */
+    t = a_sen5x_math_sqrt(-2.0f * a_sen5x_math_log(q));                                          /* tail variable */
+    x = t - (2.515517f + t * (0.802853f + t * 0.010328f)) /
+        (1.0f + t * (1.432788f + t * (0.189269f + t * 0.001308f)));                            /* upper quantile */
+
+    return a_sen5x_math_select((uint32_t)(p < 0.5f), -x, x);                                    /* return the quantile */
+}
+
+/**
+ * @brief psd chunk work structure definition
+ */
+typedef struct sen5x_psd_work_s
+{
+    float number[SEN5X_PSD_BINS][SEN5X_PSD_CHUNK];        /**< differential counts */
+    float fc[SEN5X_PSD_BINS - 1][SEN5X_PSD_CHUNK];        /**< counted fraction below the inner edges */
+    float z[SEN5X_PSD_EDGES][SEN5X_PSD_CHUNK];            /**< standard scores of the edges */
+    float pc[SEN5X_PSD_EDGES][SEN5X_PSD_CHUNK];           /**< probabilities of the edges */
+    float pd[SEN5X_PSD_EDGES][SEN5X_PSD_CHUNK];           /**< densities or third moment probabilities of the edges */
+    float total[SEN5X_PSD_CHUNK];                         /**< total count */
+    float nan[SEN5X_PSD_CHUNK];                           /**< zero, or nan for an unusable sample */
+    float sum[5][SEN5X_PSD_CHUNK];                        /**< regression sums */
+    float mu[SEN5X_PSD_CHUNK];                            /**< log cmd */
+    float s[SEN5X_PSD_CHUNK];                             /**< log gsd */
+    float den[SEN5X_PSD_CHUNK];                           /**< counted probability */
+    float dden_mu[SEN5X_PSD_CHUNK];                       /**< counted probability derivative by mu */
+    float dden_s[SEN5X_PSD_CHUNK];                        /**< counted probability derivative by s */
+    float mass[SEN5X_PSD_BINS][SEN5X_PSD_CHUNK];          /**< bin masses */
+} sen5x_psd_work_t;
+
+/**
+ * @brief      reconstruct a chunk of samples
+ * @param[in]  **cum pointer to the five cumulative number columns
+ * @param[in]  *pm_valid pointer to a pm valid column
+ * @param[in]  n sample count, no more than SEN5X_PSD_CHUNK
+ * @param[in]  density particle density in g/cm3
+ * @param[out] *psd pointer to a psd buffer of n elements
+ * @note       every step runs over the samples in its inner loop without branches so that it vectorizes
+ */
+static void a_sen5x_psd_chunk(const float *const *cum, const uint8_t *pm_valid, uint32_t n,
+                              float density, sen5x_psd_t *psd)
+{
+    uint32_t j;
+    uint32_t k;
+    uint32_t it;
+    float nb;
+    float f;
+    float y;
+    float w;
+    float b;
+    float num;
+    float r;
+    float j0;
+    float j1;
+    float a00;
+    float a01;
+    float a11;
+    float g0;
+    float g1;
+    float det;
+    float m3;
+    sen5x_psd_work_t work;
+
+    /* differential bins of the monotonic cumulative counts */
+    for (j = 0; j < n; j++)                                                                    /* run all samples */
+    {
+        work.total[j] = 0.0f;                                                                  /* clear the total */
+    }
+    for (k = 0; k < SEN5X_PSD_BINS; k++)                                                       /* run all bins */
+    {
+        for (j = 0; j < n; j++)                                                                /* run all samples */
+        {
+            nb = cum[k][j] - ((k != 0) ? cum[k - 1][j] : 0.0f);                                /* difference */
+            nb = a_sen5x_math_select((uint32_t)(nb > 0.0f), nb, 0.0f);                          /* no negative bins, nan to zero */
+            work.number[k][j] = nb;                                                            /* save the bin */
+            work.total[j] += nb;                                                               /* cumulate */
+            if (k < SEN5X_PSD_BINS - 1)                                                        /* inner edge */
+            {
+                work.fc[k][j] = work.total[j];                                                 /* monotonic cumulative */
+            }
+        }
+    }
+    for (j = 0; j < n; j++)                                                                    /* run all samples */
+    {
+        work.nan[j] = a_sen5x_math_select((uint32_t)((pm_valid[j] != 0) & (work.total[j] > 0.0f)), 0.0f, NAN);   /* usable sample */
+        work.den[j] = 1.0f / a_sen5x_math_select((uint32_t)(work.total[j] > 0.0f), work.total[j], 1.0f);        /* inverse total */
+        for (k = 0; k < 5; k++)                                                                /* run all sums */
+        {
+            work.sum[k][j] = 0.0f;                                                             /* clear the sum */
+        }
+    }
+
+    /* weighted probit regression as the start */
+    for (k = 0; k < SEN5X_PSD_BINS - 1; k++)                                                   /* run the inner edges */
+    {
+        for (j = 0; j < n; j++)                                                                /* run all samples */
+        {
+            work.fc[k][j] *= work.den[j];                                                      /* fraction */
+            f = a_sen5x_math_limit(work.fc[k][j], 1e-4f, 1.0f - 1e-4f);                         /* keep the quantile finite */
+            y = a_sen5x_psd_probit(f);                                                         /* quantile */
+            w = a_sen5x_psd_pdf(y);                                                            /* density */
+            w = w * w / (f * (1.0f - f));                                                      /* inverse variance */
+            work.sum[0][j] += w;                                                               /* sum */
+            work.sum[1][j] += w * gs_log_edge[k + 1];                                          /* sum */
+            work.sum[2][j] += w * y;                                                           /* sum */
+            work.sum[3][j] += w * gs_log_edge[k + 1] * gs_log_edge[k + 1];                     /* sum */
+            work.sum[4][j] += w * gs_log_edge[k + 1] * y;                                      /* sum */
+        }
+    }
+    for (j = 0; j < n; j++)                                                                    /* run all samples */
+    {
+        b = (work.sum[0][j] * work.sum[4][j] - work.sum[1][j] * work.sum[2][j]) /
+            (work.sum[0][j] * work.sum[3][j] - work.sum[1][j] * work.sum[1][j]);               /* slope */
+        b = a_sen5x_math_limit(b, 1.0f / SEN5X_PSD_MAX_LOG_GSD, 1.0f / SEN5X_PSD_MIN_LOG_GSD);  /* limit the slope */
+        work.s[j] = 1.0f / b;                                                                  /* log gsd */
+        work.mu[j] = a_sen5x_math_limit((work.sum[1][j] - work.sum[2][j] * work.s[j]) / work.sum[0][j],
+                                       SEN5X_PSD_MIN_LOG_CMD, SEN5X_PSD_MAX_LOG_CMD);          /* log cmd */
+    }
+
+    /* gauss-newton on the cumulative fractions truncated to 0.3 - 10 um */
+    for (it = 0; it < SEN5X_PSD_FIT_ITERATIONS; it++)                                          /* fixed iterations */
+    {
+        for (k = 0; k < SEN5X_PSD_EDGES; k++)                                                  /* run all edges */
+        {
+            for (j = 0; j < n; j++)                                                            /* run all samples */
+            {
+                work.z[k][j] = (gs_log_edge[k] - work.mu[j]) / work.s[j];                      /* standard score */
+                work.pc[k][j] = a_sen5x_psd_cdf(work.z[k][j]);                                 /* probability */
+                work.pd[k][j] = a_sen5x_psd_pdf(work.z[k][j]);                                 /* density */
+            }
+        }
+        for (j = 0; j < n; j++)                                                                /* run all samples */
+        {
+            work.den[j] = work.pc[SEN5X_PSD_EDGES - 1][j] - work.pc[0][j];                     /* counted probability */
+            work.den[j] = a_sen5x_math_select((uint32_t)(work.den[j] > 1e-12f), work.den[j], 1e-12f);   /* keep the division finite */
+            work.dden_mu[j] = (work.pd[0][j] - work.pd[SEN5X_PSD_EDGES - 1][j]) / work.s[j];   /* derivative by mu */
+            work.dden_s[j] = (work.pd[0][j] * work.z[0][j] -
+                              work.pd[SEN5X_PSD_EDGES - 1][j] * work.z[SEN5X_PSD_EDGES - 1][j]) / work.s[j];   /* derivative by s */
+            a00 = 0.0f;                                                                        /* clear the normal equations */
+            a01 = 0.0f;                                                                        /* clear the normal equations */
+            a11 = 0.0f;                                                                        /* clear the normal equations */
+            g0 = 0.0f;                                                                         /* clear the gradient */
+            g1 = 0.0f;                                                                         /* clear the gradient */
+            for (k = 1; k < SEN5X_PSD_EDGES - 1; k++)                                          /* run the inner edges */
+            {
+                num = work.pc[k][j] - work.pc[0][j];                                           /* probability below the edge */
+                r = num / work.den[j] - work.fc[k - 1][j];                                     /* residual */
+                j0 = ((work.pd[0][j] - work.pd[k][j]) / work.s[j] * work.den[j] - num * work.dden_mu[j]) /
+                     (work.den[j] * work.den[j]);                                              /* jacobian by mu */
+                j1 = ((work.pd[0][j] * work.z[0][j] - work.pd[k][j] * work.z[k][j]) / work.s[j] * work.den[j] -
+                      num * work.dden_s[j]) / (work.den[j] * work.den[j]);                     /* jacobian by s */
+                w = work.fc[k - 1][j] * (1.0f - work.fc[k - 1][j]);                            /* binomial variance */
+                w = 1.0f / a_sen5x_math_select((uint32_t)(w > 1e-4f), w, 1e-4f);               /* weight */
+                a00 += w * j0 * j0;                                                            /* normal equations */
+                a01 += w * j0 * j1;                                                            /* normal equations */
+                a11 += w * j1 * j1;                                                            /* normal equations */
+                g0 += w * j0 * r;                                                              /* gradient */
+                g1 += w * j1 * r;                                                              /* gradient */
+            }
+            a00 *= 1.0f + SEN5X_PSD_DAMPING;                                                   /* damping */
+            a11 *= 1.0f + SEN5X_PSD_DAMPING;                                                   /* damping */
+            det = a00 * a11 - a01 * a01;                                                       /* determinant */
+            det = 1.0f / a_sen5x_math_select((uint32_t)(det > 1e-30f), det, 1e30f);             /* no step on a singular system */
+            work.mu[j] -= (a11 * g0 - a01 * g1) * det;                                         /* step mu */
+            work.s[j] -= (a00 * g1 - a01 * g0) * det;                                          /* step s */
+            work.mu[j] = a_sen5x_math_limit(work.mu[j], SEN5X_PSD_MIN_LOG_CMD, SEN5X_PSD_MAX_LOG_CMD);   /* limit mu */
+            work.s[j] = a_sen5x_math_limit(work.s[j], SEN5X_PSD_MIN_LOG_GSD, SEN5X_PSD_MAX_LOG_GSD);     /* limit s */
+        }
+    }
+
+    /* residual and bin masses of the fitted distribution */
+    for (k = 0; k < SEN5X_PSD_EDGES; k++)                                                      /* run all edges */
+    {
+        for (j = 0; j < n; j++)                                                                /* run all samples */
+        {
+            work.z[k][j] = (gs_log_edge[k] - work.mu[j]) / work.s[j];                          /* standard score */
+            work.pc[k][j] = a_sen5x_psd_cdf(work.z[k][j]);                                     /* probability */
+            work.pd[k][j] = a_sen5x_psd_cdf(work.z[k][j] - 3.0f * work.s[j]);                  /* third moment probability */
+        }
+    }
+    for (k = 0; k < SEN5X_PSD_BINS; k++)                                                       /* run all bins */
+    {
+        for (j = 0; j < n; j++)                                                                /* run all samples */
+        {
+            num = work.pc[k + 1][j] - work.pc[k][j];                                           /* bin probability */
+            m3 = a_sen5x_math_exp(3.0f * work.mu[j] + 4.5f * work.s[j] * work.s[j]) *
+                 (work.pd[k + 1][j] - work.pd[k][j]) /
+                 a_sen5x_math_select((uint32_t)(num > 1e-7f), num, 1.0f);                       /* mean cube in the bin */
+            m3 = a_sen5x_math_select((uint32_t)(num > 1e-7f), m3,
+                                    a_sen5x_math_sqrt(gs_edge_cube[k] * gs_edge_cube[k + 1]));  /* geometric middle far from the mode */
+            m3 = a_sen5x_math_limit(m3, gs_edge_cube[k], gs_edge_cube[k + 1]);                  /* inside the bin */
+            work.mass[k][j] = work.number[k][j] * density * SEN5X_PSD_PI_6 * m3 + work.nan[j]; /* bin mass */
+        }
+    }
+    for (j = 0; j < n; j++)                                                                    /* run all samples */
+    {
+        work.den[j] = work.pc[SEN5X_PSD_EDGES - 1][j] - work.pc[0][j];                         /* counted probability */
+        work.den[j] = a_sen5x_math_select((uint32_t)(work.den[j] > 1e-12f), work.den[j], 1e-12f);   /* keep the division finite */
+        r = 0.0f;                                                                              /* clear the residual */
+        for (k = 1; k < SEN5X_PSD_EDGES - 1; k++)                                              /* run the inner edges */
+        {
+            f = (work.pc[k][j] - work.pc[0][j]) / work.den[j] - work.fc[k - 1][j];             /* residual */
+            r += f * f;                                                                        /* sum */
+        }
+        work.dden_s[j] = a_sen5x_math_sqrt(r * 0.25f);                                          /* rms residual */
+    }
+
+    /* copy the results */
+    for (j = 0; j < n; j++)                                                                    /* run all samples */
+    {
+        psd[j].total_number_cm3 = work.total[j] + work.nan[j];                                 /* copy the number */
+        psd[j].total_mass_ug_m3 = 0.0f;                                                        /* clear the mass */
+        for (k = 0; k < SEN5X_PSD_BINS; k++)                                                   /* run all bins */
+        {
+            psd[j].number_cm3[k] = work.number[k][j] + work.nan[j];                            /* copy the number */
+            psd[j].dn_dlogdp[k] = psd[j].number_cm3[k] * gs_inv_log10_width[k];                /* per decade */
+            psd[j].mass_ug_m3[k] = work.mass[k][j];                                            /* copy the mass */
+            psd[j].total_mass_ug_m3 += work.mass[k][j];                                        /* cumulate */
+        }
+        psd[j].cmd_um = a_sen5x_math_exp(work.mu[j]) + work.nan[j];                             /* copy the cmd */
+        psd[j].gsd = a_sen5x_math_exp(work.s[j]) + work.nan[j];                                 /* copy the gsd */
+        psd[j].fit_residual = work.dden_s[j] + work.nan[j];                                    /* copy the residual */
+        psd[j].valid = (work.nan[j] == 0.0f) ? 1 : 0;                                          /* copy the flag */
+    }
+}
+
+/**
+ * @brief      reconstruct the size distribution of a pm sample
+ * @param[in]  *pm pointer to a sen5x pm structure
+ * @param[in]  density particle density in g/cm3
+ * @param[out] *psd pointer to a psd structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 pm or psd is NULL
+ *             - 4 density is invalid
+ * @note       the cumulative counts are made monotonic before they are differenced, the log-normal is
+ *             fitted to the counts truncated to 0.3 - 10 um and the bin masses use its third moment
+ *             inside every bin; when less than about 10 % of the counted particles are above 0.5 um
+ *             the bins do not resolve the shape and the fit is not reliable, a sample without pm_valid
+ *             or without particles gives nan outputs and valid 0
+ */
+uint8_t sen5x_psd_calculate(const sen5x_pm_t *pm, float density, sen5x_psd_t *psd)
+{
+    const float *cum[SEN5X_PSD_BINS];
+
+    if ((pm == NULL) || (psd == NULL))                                                 /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (!((density > 0.0f) && (density < 100.0f)))                                     /* check the density */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    cum[0] = &pm->pm0p5_cm3;                                                           /* pm0.5 */
+    cum[1] = &pm->pm1p0_cm3;                                                           /* pm1.0 */
+    cum[2] = &pm->pm2p5_cm3;                                                           /* pm2.5 */
+    cum[3] = &pm->pm4p0_cm3;                                                           /* pm4.0 */
+    cum[4] = &pm->pm10_cm3;                                                            /* pm10 */
+    a_sen5x_psd_chunk(cum, &pm->pm_valid, 1, density, psd);                            /* reconstruct */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      reconstruct the size distributions of decoded pm columns
+ * @param[in]  *columns pointer to a sen5x batch pm structure
+ * @param[in]  count sample count
+ * @param[in]  density particle density in g/cm3
+ * @param[out] *psd pointer to a psd buffer of count elements
+ * @return     status code
+ *             - 0 success
+ *             - 2 columns, a number column, pm_valid or psd is NULL
+ *             - 4 density is invalid
+ * @note       runs after sen5x_batch_decode_pm_values, the results are bit identical to
+ *             sen5x_psd_calculate and the loop is written to be vectorized by the compiler
+ */
+uint8_t sen5x_psd_calculate_batch(const sen5x_batch_pm_t *columns, uint32_t count, float density, sen5x_psd_t *psd)
+{
+    uint32_t i;
+    uint32_t n;
+    const float *cum[SEN5X_PSD_BINS];
+
+    if ((columns == NULL) || (psd == NULL))                                            /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((columns->pm0p5_cm3 == NULL) || (columns->pm1p0_cm3 == NULL) || (columns->pm2p5_cm3 == NULL) ||
+        (columns->pm4p0_cm3 == NULL) || (columns->pm10_cm3 == NULL) || (columns->pm_valid == NULL))   /* check the columns */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (!((density > 0.0f) && (density < 100.0f)))                                     /* check the density */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    for (i = 0; i < count; i += n)                                                     /* run all chunks */
+    {
+        n = ((count - i) < SEN5X_PSD_CHUNK) ? (count - i) : SEN5X_PSD_CHUNK;           /* chunk length */
+        cum[0] = &columns->pm0p5_cm3[i];                                               /* pm0.5 */
+        cum[1] = &columns->pm1p0_cm3[i];                                               /* pm1.0 */
+        cum[2] = &columns->pm2p5_cm3[i];                                               /* pm2.5 */
+        cum[3] = &columns->pm4p0_cm3[i];                                               /* pm4.0 */
+        cum[4] = &columns->pm10_cm3[i];                                                /* pm10 */
+        a_sen5x_psd_chunk(cum, &columns->pm_valid[i], n, density, &psd[i]);            /* reconstruct */
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_psd.h
+ * @brief     driver sen5x psd header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_PSD_H
+#define DRIVER_SEN5X_PSD_H
+
+#include "driver_sen5x.h"
+#include "driver_sen5x_batch.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_psd_driver sen5x psd driver function
+ * @brief    sen5x psd driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x psd definition
+ */
+#define SEN5X_PSD_BINS                     5            /**< 0.3 - 0.5, 0.5 - 1.0, 1.0 - 2.5, 2.5 - 4.0 and 4.0 - 10 um */
+#define SEN5X_PSD_MIN_DIAMETER             0.3f         /**< smallest counted diameter in um */
+#define SEN5X_PSD_FIT_ITERATIONS           8            /**< gauss-newton iterations of the log-normal fit */
+#define SEN5X_PSD_DEFAULT_DENSITY          1.65f        /**< typical ambient particle density in g/cm3 */
+
+/**
+ * @brief sen5x psd structure definition
+ */
+typedef struct sen5x_psd_s
+{
+    float number_cm3[SEN5X_PSD_BINS];        /**< differential number concentration per bin [#/cm3] */
+    float dn_dlogdp[SEN5X_PSD_BINS];         /**< number concentration per decade of diameter [#/cm3] */
+    float mass_ug_m3[SEN5X_PSD_BINS];        /**< mass concentration per bin estimated from the number [μg/m3] */
+    float total_number_cm3;                  /**< number concentration from 0.3 um to 10 um [#/cm3] */
+    float total_mass_ug_m3;                  /**< mass concentration from 0.3 um to 10 um [μg/m3] */
+    float cmd_um;                            /**< count median diameter of the fitted log-normal [um] */
+    float gsd;                               /**< geometric standard deviation of the fitted log-normal */
+    float fit_residual;                      /**< rms difference of the fitted and counted cumulative fractions */
+    uint8_t valid;                           /**< 1 when the sample has pm_valid and counted particles */
+} sen5x_psd_t;
+
+/**
+ * @brief      reconstruct the size distribution of a pm sample
+ * @param[in]  *pm pointer to a sen5x pm structure
+ * @param[in]  density particle density in g/cm3
+ * @param[out] *psd pointer to a psd structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 pm or psd is NULL
+ *             - 4 density is invalid
+ * @note       the cumulative counts are made monotonic before they are differenced, the log-normal is
+ *             fitted to the counts truncated to 0.3 - 10 um and the bin masses use its third moment
+ *             inside every bin; when less than about 10 % of the counted particles are above 0.5 um
+ *             the bins do not resolve the shape and the fit is not reliable, a sample without pm_valid
+ *             or without particles gives nan outputs and valid 0
+ */
+uint8_t sen5x_psd_calculate(const sen5x_pm_t *pm, float density, sen5x_psd_t *psd);
+
+/**
+ * @brief      reconstruct the size distributions of decoded pm columns
+ * @param[in]  *columns pointer to a sen5x batch pm structure
+ * @param[in]  count sample count
+ * @param[in]  density particle density in g/cm3
+ * @param[out] *psd pointer to a psd buffer of count elements
+ * @return     status code
+ *             - 0 success
+ *             - 2 columns, a number column, pm_valid or psd is NULL
+ *             - 4 density is invalid
+ * @note       runs after sen5x_batch_decode_pm_values, the results are bit identical to
+ *             sen5x_psd_calculate and the loop is written to be vectorized by the compiler
+ */
+uint8_t sen5x_psd_calculate_batch(const sen5x_batch_pm_t *columns, uint32_t count, float density, sen5x_psd_t *psd);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
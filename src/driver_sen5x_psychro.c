@@ -0,0 +1,204 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_psychro.c
+ * @brief     driver sen5x psychro source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_psychro.h"
+#include "driver_sen5x_math.h"
+
+/**
+ * @brief psychro constant definition
+ */
+#define SEN5X_PSYCHRO_AH_FACTOR      216.74f               /**< hPa to g/m3 over the water vapour gas constant */
+#define SEN5X_PSYCHRO_CHUNK          64                    /**< batch samples computed before the outputs are copied */
+
+/**
+ * @brief      calculate the derived metrics of one sample
+ * @param[in]  t temperature in degree
+ * @param[in]  rh humidity in percentage
+ * @param[out] *dp pointer to a dew point buffer
+ * @param[out] *ah pointer to an absolute humidity buffer
+ * @param[out] *hi pointer to a heat index buffer
+ * @note       written without branches so that the batch loop vectorizes
+ */
+static inline void a_sen5x_psychro_sample(float t, float rh, float *dp, float *ah, float *hi)
+{
+    float a;
+    float g;
+    float f;
+    float h;
+    float r;
+    float s;
+    float d;
+    float nan;
+    float dry;
+    float humid;
+    float warm;
+
+    nan = (t - t) + (rh - rh);                                                                 /* zero, or nan for a nan sample */
+    t = a_sen5x_math_select((uint32_t)(t == t), t, 0.0f);                                   /* keep the math finite */
+    rh = a_sen5x_math_select((uint32_t)(rh == rh), rh, 0.0f);                               /* keep the math finite */
+    rh = a_sen5x_math_select((uint32_t)(rh < SEN5X_PSYCHRO_MIN_HUMIDITY),
+                                SEN5X_PSYCHRO_MIN_HUMIDITY, rh);                               /* lower limit */
+    rh = a_sen5x_math_select((uint32_t)(rh > 100.0f), 100.0f, rh);                          /* upper limit */
+
+    /* dew point and absolute humidity */
+    a = SEN5X_PSYCHRO_MAGNUS_B * t / (SEN5X_PSYCHRO_MAGNUS_C + t);                             /* magnus exponent */
+    g = a_sen5x_math_log(rh * 0.01f) + a;                                                   /* ln of the vapour pressure ratio */
+    *dp = SEN5X_PSYCHRO_MAGNUS_C * g / (SEN5X_PSYCHRO_MAGNUS_B - g) + nan;                     /* dew point */
+    *ah = SEN5X_PSYCHRO_MAGNUS_E0 * a_sen5x_math_exp(a) * rh * 0.01f *
+          SEN5X_PSYCHRO_AH_FACTOR / (t + 273.15f) + nan;                                       /* absolute humidity */
+
+    /* heat index */
+    f = t * 1.8f + 32.0f;                                                                      /* fahrenheit */
+    h = 0.5f * (f + 61.0f + (f - 68.0f) * 1.2f + rh * 0.094f);                                 /* steadman */
+    r = -42.379f + 2.04901523f * f + 10.14333127f * rh - 0.22475541f * f * rh -
+        6.83783e-3f * f * f - 5.481717e-2f * rh * rh + 1.22874e-3f * f * f * rh +
+        8.5282e-4f * f * rh * rh - 1.99e-6f * f * f * rh * rh;                                 /* rothfusz regression */
+    d = f - 95.0f;                                                                             /* distance to 95 °F */
+    s = (17.0f - fabsf(d)) / 17.0f;                                                            /* root argument */
+    s = a_sen5x_math_select((uint32_t)(s < 0.0f), 0.0f, s);                                 /* outside the dry range */
+    dry = (13.0f - rh) * 0.25f * a_sen5x_math_sqrt(s);                                      /* dry adjustment */
+    warm = a_sen5x_math_select((uint32_t)(f >= 80.0f), 1.0f, 0.0f);                         /* at least 80 °F */
+    dry *= a_sen5x_math_select((uint32_t)(rh < 13.0f), warm, 0.0f);                         /* only below 13 % */
+    dry *= a_sen5x_math_select((uint32_t)(f <= 112.0f), 1.0f, 0.0f);                        /* only up to 112 °F */
+    humid = (rh - 85.0f) * 0.1f * (87.0f - f) * 0.2f;                                          /* humid adjustment */
+    humid *= a_sen5x_math_select((uint32_t)(rh > 85.0f), warm, 0.0f);                       /* only above 85 % */
+    humid *= a_sen5x_math_select((uint32_t)(f <= 87.0f), 1.0f, 0.0f);                       /* only up to 87 °F */
+    r = r - dry + humid;                                                                       /* adjust */
+    h = a_sen5x_math_select((uint32_t)((h + f) * 0.5f >= 80.0f), r, h);                     /* rothfusz range */
+    *hi = (h - 32.0f) / 1.8f + nan;                                                            /* back to degree */
+}
+
+/**
+ * @brief     fast natural exponential
+ * @param[in] x input in -87.0 - 88.0
+ * @return    e^x
+ * @note      relative error below 3e-7 in the input range
+ */
+float sen5x_psychro_fast_exp(float x)
+{
+    return a_sen5x_math_exp(x);        /* return e^x */
+}
+
+/**
+ * @brief     fast natural logarithm
+ * @param[in] x positive normal input
+ * @return    ln(x)
+ * @note      absolute error below 3e-7 for x in 0.001 - 1.0
+ */
+float sen5x_psychro_fast_log(float x)
+{
+    return a_sen5x_math_log(x);        /* return ln(x) */
+}
+
+/**
+ * @brief      calculate the derived metrics of one sample
+ * @param[in]  temperature ambient temperature in degree
+ * @param[in]  humidity relative humidity in percentage
+ * @param[out] *psychro pointer to a psychro structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 psychro is NULL
+ *             - 4 temperature or humidity is nan
+ * @note       see sen5x_psychro_calculate_batch for the accuracy
+ */
+uint8_t sen5x_psychro_calculate(float temperature, float humidity, sen5x_psychro_t *psychro)
+{
+    if (psychro == NULL)                                                               /* check the psychro */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((isnan(temperature) != 0) || (isnan(humidity) != 0))                           /* check the sample */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    a_sen5x_psychro_sample(temperature, humidity, &psychro->dew_point_degree,
+                           &psychro->absolute_humidity_g_m3, &psychro->heat_index_degree);   /* calculate */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      calculate the derived metrics of sample arrays
+ * @param[in]  *temperature pointer to an ambient temperature buffer in degree
+ * @param[in]  *humidity pointer to a relative humidity buffer in percentage
+ * @param[in]  len sample count
+ * @param[out] *dew_point pointer to a dew point buffer, NULL to skip
+ * @param[out] *absolute_humidity pointer to an absolute humidity buffer, NULL to skip
+ * @param[out] *heat_index pointer to a heat index buffer, NULL to skip
+ * @return     status code
+ *             - 0 success
+ *             - 2 temperature or humidity is NULL
+ * @note       see the header for the accuracy bounds
+ */
+uint8_t sen5x_psychro_calculate_batch(const float *temperature, const float *humidity, uint32_t len,
+                                      float *dew_point, float *absolute_humidity, float *heat_index)
+{
+    uint32_t i;
+    uint32_t j;
+    uint32_t n;
+    float dp[SEN5X_PSYCHRO_CHUNK];
+    float ah[SEN5X_PSYCHRO_CHUNK];
+    float hi[SEN5X_PSYCHRO_CHUNK];
+
+    if ((temperature == NULL) || (humidity == NULL))                                   /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+
+    for (i = 0; i < len; i += n)                                                       /* run all chunks */
+    {
+        n = ((len - i) < SEN5X_PSYCHRO_CHUNK) ? (len - i) : SEN5X_PSYCHRO_CHUNK;       /* chunk length */
+        for (j = 0; j < n; j++)                                                        /* branch free inner loop */
+        {
+            a_sen5x_psychro_sample(temperature[i + j], humidity[i + j], &dp[j], &ah[j], &hi[j]);   /* calculate */
+        }
+        if (dew_point != NULL)                                                         /* dew point wanted */
+        {
+            memcpy(&dew_point[i], dp, sizeof(float) * n);                              /* save the dew point */
+        }
+        if (absolute_humidity != NULL)                                                 /* absolute humidity wanted */
+        {
+            memcpy(&absolute_humidity[i], ah, sizeof(float) * n);                      /* save the absolute humidity */
+        }
+        if (heat_index != NULL)                                                        /* heat index wanted */
+        {
+            memcpy(&heat_index[i], hi, sizeof(float) * n);                             /* save the heat index */
+        }
+    }
+
+    return 0;                                                                          /* success return 0 */
+}
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_psychro.h
+ * @brief     driver sen5x psychro header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_PSYCHRO_H
+#define DRIVER_SEN5X_PSYCHRO_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_psychro_driver sen5x psychro driver function
+ * @brief    sen5x psychro driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x psychro definition
+ */
+#define SEN5X_PSYCHRO_MAGNUS_B            17.62f        /**< magnus coefficient over water */
+#define SEN5X_PSYCHRO_MAGNUS_C            243.12f       /**< magnus coefficient over water in degree */
+#define SEN5X_PSYCHRO_MAGNUS_E0           6.112f        /**< saturation vapour pressure at 0 degree in hPa */
+#define SEN5X_PSYCHRO_MIN_HUMIDITY        0.1f          /**< lower humidity limit in percentage */
+
+/**
+ * @brief sen5x psychro structure definition
+ */
+typedef struct sen5x_psychro_s
+{
+    float dew_point_degree;                 /**< dew point [°C] */
+    float absolute_humidity_g_m3;           /**< absolute humidity [g/m3] */
+    float heat_index_degree;                /**< heat index [°C] */
+} sen5x_psychro_t;
+
+/**
+ * @brief     fast natural exponential
+ * @param[in] x input in -87.0 - 88.0
+ * @return    e^x
+ * @note      relative error below 3e-7 in the input range
+ */
+float sen5x_psychro_fast_exp(float x);
+
+/**
+ * @brief     fast natural logarithm
+ * @param[in] x positive normal input
+ * @return    ln(x)
+ * @note      absolute error below 3e-7 for x in 0.001 - 1.0
+ */
+float sen5x_psychro_fast_log(float x);
+
+/**
+ * @brief      calculate the derived metrics of one sample
+ * @param[in]  temperature ambient temperature in degree
+ * @param[in]  humidity relative humidity in percentage
+ * @param[out] *psychro pointer to a psychro structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 psychro is NULL
+ *             - 4 temperature or humidity is nan
+ * @note       see sen5x_psychro_calculate_batch for the accuracy
+ */
+uint8_t sen5x_psychro_calculate(float temperature, float humidity, sen5x_psychro_t *psychro);
+
+/**
+ * @brief      calculate the derived metrics of sample arrays
+ * @param[in]  *temperature pointer to an ambient temperature buffer in degree
+ * @param[in]  *humidity pointer to a relative humidity buffer in percentage
+ * @param[in]  len sample count
+ * @param[out] *dew_point pointer to a dew point buffer, NULL to skip
+ * @param[out] *absolute_humidity pointer to an absolute humidity buffer, NULL to skip
+ * @param[out] *heat_index pointer to a heat index buffer, NULL to skip
+ * @return     status code
+ *             - 0 success
+ *             - 2 temperature or humidity is NULL
+ * @note       dew point uses magnus over water (b = 17.62, c = 243.12 °C), its formula error against
+ *             the wmo saturation curve stays within 0.35 % of vapour pressure from -45 °C to 60 °C,
+ *             against the same formula in double precision the fast path stays within 0.001 °C;
+ *             absolute humidity uses the same saturation curve and the ideal gas law, within 0.001 %
+ *             of the double precision formula; heat index is the nws rothfusz regression with its
+ *             low and high humidity adjustments and the steadman formula below 80 °F, within 0.001 °C;
+ *             humidity is limited to 0.1 % - 100 %, nan samples give nan outputs
+ */
+uint8_t sen5x_psychro_calculate_batch(const float *temperature, const float *humidity, uint32_t len,
+                                      float *dew_point, float *absolute_humidity, float *heat_index);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,567 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_query.c
+ * @brief     driver sen5x query source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_query.h"
+
+/**
+ * @brief index entry flag definition
+ */
+#define SEN5X_QUERY_ENTRY_FLAG_VALID        (1 << 0)        /**< block header is valid */
+
+/**
+ * @brief     write a little endian u16
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_sen5x_query_put_u16(uint8_t *buf, uint16_t v)
+{
+    buf[0] = (uint8_t)((v >> 0) & 0xFF);        /* byte 0 */
+    buf[1] = (uint8_t)((v >> 8) & 0xFF);        /* byte 1 */
+}
+
+/**
+ * @brief     write a little endian u32
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_sen5x_query_put_u32(uint8_t *buf, uint32_t v)
+{
+    a_sen5x_query_put_u16(&buf[0], (uint16_t)(v >> 0));         /* low half */
+    a_sen5x_query_put_u16(&buf[2], (uint16_t)(v >> 16));        /* high half */
+}
+
+/**
+ * @brief     write a little endian u64
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] v value
+ * @note      none
+ */
+static void a_sen5x_query_put_u64(uint8_t *buf, uint64_t v)
+{
+    a_sen5x_query_put_u32(&buf[0], (uint32_t)(v >> 0));         /* low half */
+    a_sen5x_query_put_u32(&buf[4], (uint32_t)(v >> 32));        /* high half */
+}
+
+/**
+ * @brief     read a little endian u16
+ * @param[in] *buf pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint16_t a_sen5x_query_get_u16(const uint8_t *buf)
+{
+    return (uint16_t)(((uint16_t)(buf[1]) << 8) | ((uint16_t)(buf[0]) << 0));        /* get the value */
+}
+
+/**
+ * @brief     read a little endian u32
+ * @param[in] *buf pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint32_t a_sen5x_query_get_u32(const uint8_t *buf)
+{
+    return ((uint32_t)a_sen5x_query_get_u16(&buf[2]) << 16) | a_sen5x_query_get_u16(&buf[0]);        /* get the value */
+}
+
+/**
+ * @brief     read a little endian u64
+ * @param[in] *buf pointer to a data buffer
+ * @return    value
+ * @note      none
+ */
+static uint64_t a_sen5x_query_get_u64(const uint8_t *buf)
+{
+    return ((uint64_t)a_sen5x_query_get_u32(&buf[4]) << 32) | a_sen5x_query_get_u32(&buf[0]);        /* get the value */
+}
+
+/**
+ * @brief     get the block count of an archive
+ * @param[in] archive_size archive size
+ * @param[in] block_size block size
+ * @return    block count
+ * @note      a trailing partial block is ignored
+ */
+static uint32_t a_sen5x_query_blocks(uint64_t archive_size, uint32_t block_size)
+{
+    uint64_t blocks;
+
+    blocks = archive_size / block_size;        /* whole blocks */
+    if (blocks > 0xFFFFFFFFULL)                /* check the range */
+    {
+        blocks = 0xFFFFFFFFULL;                /* limit */
+    }
+
+    return (uint32_t)blocks;                   /* return the blocks */
+}
+
+/**
+ * @brief      get the last timestamp of a block
+ * @param[in]  *query pointer to a query structure
+ * @param[in]  block block number
+ * @param[out] *last_ms pointer to a last timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 block is corrupt
+ * @note       only one index entry or one block header is touched, the index keeps corrupt blocks in order
+ */
+static uint8_t a_sen5x_query_last_ms(sen5x_query_t *query, uint32_t block, uint64_t *last_ms)
+{
+    sen5x_archive_header_t header;
+
+    if (query->index != NULL)                                                                       /* from the index */
+    {
+        *last_ms = a_sen5x_query_get_u64(&query->index[SEN5X_QUERY_INDEX_HEADER_LENGTH +
+                                                       (uint64_t)block * SEN5X_QUERY_INDEX_ENTRY_LENGTH + 8]);   /* get the last timestamp */
+
+        return 0;                                                                                   /* success return 0 */
+    }
+    if (sen5x_archive_parse_header(&query->archive[(uint64_t)block * query->block_size],
+                                   query->block_size, &header) != 0)                                /* parse the header */
+    {
+        return 1;                                                                                   /* corrupt block */
+    }
+    *last_ms = header.last_ms;                                                                      /* set the last timestamp */
+
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     build the sparse index of an archive
+ * @param[in] *archive pointer to an archive buffer
+ * @param[in] archive_size archive size
+ * @param[in] block_size archive block size
+ * @param[in] *index pointer to an index buffer
+ * @param[in] index_size index buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 2 archive or index is NULL
+ *            - 4 block size is invalid
+ *            - 5 index buffer is too small
+ * @note      only the block headers are read, SEN5X_QUERY_INDEX_SIZE gives the index size
+ */
+uint8_t sen5x_query_build_index(const uint8_t *archive, uint64_t archive_size, uint32_t block_size,
+                                uint8_t *index, uint64_t index_size)
+{
+    uint8_t ch;
+    uint8_t *entry;
+    uint32_t i;
+    uint32_t blocks;
+    uint64_t last_ms;
+    sen5x_archive_header_t header;
+
+    if ((archive == NULL) || (index == NULL))                                                   /* check the params */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if ((block_size < 128) || (block_size > 1048576))                                           /* check the block size */
+    {
+        return 4;                                                                               /* return error */
+    }
+    blocks = a_sen5x_query_blocks(archive_size, block_size);                                    /* get the blocks */
+    if (index_size < SEN5X_QUERY_INDEX_SIZE(blocks))                                            /* check the index size */
+    {
+        return 5;                                                                               /* return error */
+    }
+
+    memset(index, 0, SEN5X_QUERY_INDEX_HEADER_LENGTH);                                          /* clear the header */
+    a_sen5x_query_put_u32(&index[0], SEN5X_QUERY_INDEX_MAGIC);                                  /* set the magic */
+    index[4] = SEN5X_QUERY_INDEX_VERSION;                                                       /* set the version */
+    a_sen5x_query_put_u32(&index[8], block_size);                                               /* set the block size */
+    a_sen5x_query_put_u32(&index[12], blocks);                                                  /* set the blocks */
+    last_ms = 0;                                                                                /* init 0 */
+    for (i = 0; i < blocks; i++)                                                                /* run all blocks */
+    {
+        entry = &index[SEN5X_QUERY_INDEX_HEADER_LENGTH + (uint64_t)i * SEN5X_QUERY_INDEX_ENTRY_LENGTH];  /* get the entry */
+        memset(entry, 0, SEN5X_QUERY_INDEX_ENTRY_LENGTH);                                       /* clear the entry */
+        if (sen5x_archive_parse_header(&archive[(uint64_t)i * block_size], block_size,
+                                       &header) != 0)                                           /* parse the header */
+        {
+            a_sen5x_query_put_u64(&entry[0], last_ms);                                          /* keep the order */
+            a_sen5x_query_put_u64(&entry[8], last_ms);                                          /* keep the order */
+
+            continue;                                                                           /* next block */
+        }
+        if (header.last_ms > last_ms)                                                           /* check the order */
+        {
+            last_ms = header.last_ms;                                                           /* update the last timestamp */
+        }
+        a_sen5x_query_put_u64(&entry[0], header.first_ms);                                      /* set the first timestamp */
+        a_sen5x_query_put_u64(&entry[8], last_ms);                                              /* set the last timestamp */
+        a_sen5x_query_put_u16(&entry[16], header.count);                                        /* set the count */
+        a_sen5x_query_put_u16(&entry[18], header.valid_mask);                                   /* set the valid mask */
+        entry[20] = header.layout;                                                              /* set the layout */
+        entry[21] = header.channels;                                                            /* set the channels */
+        entry[22] = SEN5X_QUERY_ENTRY_FLAG_VALID;                                               /* set the flag */
+        for (ch = 0; ch < header.channels; ch++)                                                /* run all channels */
+        {
+            a_sen5x_query_put_u16(&entry[24 + ch * 4 + 0], (uint16_t)header.min[ch]);           /* set the min */
+            a_sen5x_query_put_u16(&entry[24 + ch * 4 + 2], (uint16_t)header.max[ch]);           /* set the max */
+        }
+    }
+
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     init the query over an archive
+ * @param[in] *query pointer to a query structure
+ * @param[in] *archive pointer to an archive buffer
+ * @param[in] archive_size archive size
+ * @param[in] block_size archive block size
+ * @param[in] *index pointer to an index buffer, NULL to read the block headers
+ * @param[in] index_size index buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 2 query or archive is NULL
+ *            - 4 block size is invalid
+ *            - 5 index doesn't match the archive
+ * @note      the archive and the index are read in place and may be memory mapped
+ */
+uint8_t sen5x_query_init(sen5x_query_t *query, const uint8_t *archive, uint64_t archive_size, uint32_t block_size,
+                         const uint8_t *index, uint64_t index_size)
+{
+    uint32_t blocks;
+
+    if ((query == NULL) || (archive == NULL))                                              /* check the params */
+    {
+        return 2;                                                                          /* return error */
+    }
+    if ((block_size < 128) || (block_size > 1048576))                                      /* check the block size */
+    {
+        return 4;                                                                          /* return error */
+    }
+    blocks = a_sen5x_query_blocks(archive_size, block_size);                               /* get the blocks */
+    if (index != NULL)                                                                     /* check the index */
+    {
+        if ((index_size < SEN5X_QUERY_INDEX_SIZE(blocks)) ||
+            (a_sen5x_query_get_u32(&index[0]) != SEN5X_QUERY_INDEX_MAGIC) ||
+            (index[4] != SEN5X_QUERY_INDEX_VERSION) ||
+            (a_sen5x_query_get_u32(&index[8]) != block_size) ||
+            (a_sen5x_query_get_u32(&index[12]) != blocks))                                 /* check the header */
+        {
+            return 5;                                                                      /* return error */
+        }
+    }
+
+    query->archive = archive;                                                              /* set the archive */
+    query->archive_size = archive_size;                                                    /* set the archive size */
+    query->block_size = block_size;                                                        /* set the block size */
+    query->blocks = blocks;                                                                /* set the blocks */
+    query->index = index;                                                                  /* set the index */
+    query->inited = 1;                                                                     /* flag inited */
+
+    return 0;                                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the summary of a block
+ * @param[in]  *query pointer to a query structure
+ * @param[in]  block block number
+ * @param[out] *header pointer to a header structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 block is invalid
+ *             - 2 query or header is NULL
+ *             - 3 query is not initialized
+ *             - 4 block is out of range
+ * @note       the length and crc are 0 when read from the index
+ */
+uint8_t sen5x_query_get_block(sen5x_query_t *query, uint32_t block, sen5x_archive_header_t *header)
+{
+    uint8_t ch;
+    const uint8_t *entry;
+
+    if ((query == NULL) || (header == NULL))                                                    /* check the params */
+    {
+        return 2;                                                                               /* return error */
+    }
+    if (query->inited != 1)                                                                     /* check the query */
+    {
+        return 3;                                                                               /* return error */
+    }
+    if (block >= query->blocks)                                                                 /* check the block */
+    {
+        return 4;                                                                               /* return error */
+    }
+
+    if (query->index == NULL)                                                                   /* no index */
+    {
+        if (sen5x_archive_parse_header(&query->archive[(uint64_t)block * query->block_size],
+                                       query->block_size, header) != 0)                         /* parse the header */
+        {
+            return 1;                                                                           /* return error */
+        }
+
+        return 0;                                                                               /* success return 0 */
+    }
+
+    entry = &query->index[SEN5X_QUERY_INDEX_HEADER_LENGTH +
+                          (uint64_t)block * SEN5X_QUERY_INDEX_ENTRY_LENGTH];                    /* get the entry */
+    if ((entry[22] & SEN5X_QUERY_ENTRY_FLAG_VALID) == 0)                                        /* check the flag */
+    {
+        return 1;                                                                               /* return error */
+    }
+    header->first_ms = a_sen5x_query_get_u64(&entry[0]);                                        /* get the first timestamp */
+    header->last_ms = a_sen5x_query_get_u64(&entry[8]);                                         /* get the last timestamp */
+    header->count = a_sen5x_query_get_u16(&entry[16]);                                          /* get the count */
+    header->valid_mask = a_sen5x_query_get_u16(&entry[18]);                                     /* get the valid mask */
+    header->layout = entry[20];                                                                 /* get the layout */
+    header->channels = entry[21];                                                               /* get the channels */
+    header->length = 0;                                                                         /* not indexed */
+    header->crc = 0;                                                                            /* not indexed */
+    if ((header->channels == 0) ||
+        (header->channels != sen5x_archive_layout_channels((sen5x_archive_layout_t)header->layout)))   /* check the layout */
+    {
+        return 1;                                                                               /* return error */
+    }
+    for (ch = 0; ch < SEN5X_ARCHIVE_MAX_CHANNELS; ch++)                                         /* run all channels */
+    {
+        header->min[ch] = 0;                                                                    /* no min */
+        header->max[ch] = 0;                                                                    /* no max */
+        if ((ch < header->channels) && ((header->valid_mask & (1U << ch)) != 0))                /* valid channel */
+        {
+            (void)sen5x_archive_get_value((sen5x_archive_layout_t)header->layout, ch,
+                                          a_sen5x_query_get_u16(&entry[24 + ch * 4 + 0]),
+                                          &header->min[ch]);                                    /* get the min */
+            (void)sen5x_archive_get_value((sen5x_archive_layout_t)header->layout, ch,
+                                          a_sen5x_query_get_u16(&entry[24 + ch * 4 + 2]),
+                                          &header->max[ch]);                                    /* get the max */
+        }
+    }
+
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     begin a range query
+ * @param[in] *query pointer to a query structure
+ * @param[in] start_ms first timestamp
+ * @param[in] end_ms last timestamp
+ * @param[in] *filter pointer to a filter structure, NULL to return every sample
+ * @param[in] *iterator pointer to an iterator structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 query or iterator is NULL
+ *            - 3 query is not initialized
+ *            - 4 start_ms is later than end_ms
+ * @note      the first block is found with a binary search, a corrupt block probes the next valid block of the
+ *            search window so that it can't break the order
+ */
+uint8_t sen5x_query_begin(sen5x_query_t *query, uint64_t start_ms, uint64_t end_ms,
+                          const sen5x_query_filter_t *filter, sen5x_query_iterator_t *iterator)
+{
+    uint32_t lo;
+    uint32_t hi;
+    uint32_t mid;
+    uint32_t probe;
+    uint64_t last_ms;
+
+    if ((query == NULL) || (iterator == NULL))                             /* check the params */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (query->inited != 1)                                                /* check the query */
+    {
+        return 3;                                                          /* return error */
+    }
+    if (start_ms > end_ms)                                                 /* check the range */
+    {
+        return 4;                                                          /* return error */
+    }
+
+    lo = 0;                                                                /* first block */
+    hi = query->blocks;                                                    /* past the last block */
+    while (lo < hi)                                                        /* binary search */
+    {
+        mid = lo + (hi - lo) / 2;                                          /* middle block */
+        probe = mid;                                                       /* start at the middle */
+        last_ms = 0;                                                       /* no valid block yet */
+        while ((probe < hi) &&
+               (a_sen5x_query_last_ms(query, probe, &last_ms) != 0))       /* skip corrupt blocks */
+        {
+            probe++;                                                       /* next block */
+        }
+        if (probe >= hi)                                                   /* only corrupt blocks on the right */
+        {
+            hi = mid;                                                      /* search left */
+        }
+        else if (last_ms < start_ms)                                       /* block ends before the range */
+        {
+            lo = probe + 1;                                                /* search right */
+        }
+        else
+        {
+            hi = mid;                                                      /* search left */
+        }
+    }
+
+    iterator->start_ms = start_ms;                                         /* set the first timestamp */
+    iterator->end_ms = end_ms;                                             /* set the last timestamp */
+    if (filter != NULL)                                                    /* set the filter */
+    {
+        iterator->filter = *filter;                                        /* copy the filter */
+        iterator->filter_enable = 1;                                       /* enable */
+    }
+    else
+    {
+        memset(&iterator->filter, 0, sizeof(sen5x_query_filter_t));        /* clear the filter */
+        iterator->filter_enable = 0;                                       /* disable */
+    }
+    iterator->open = 0;                                                    /* no block open */
+    iterator->done = 0;                                                    /* not done */
+    iterator->block = lo;                                                  /* first block */
+    iterator->blocks_read = 0;                                             /* init 0 */
+    iterator->blocks_skipped = 0;                                          /* init 0 */
+    iterator->blocks_corrupt = 0;                                          /* init 0 */
+
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the next sample of a range query
+ * @param[in]  *query pointer to a query structure
+ * @param[in]  *iterator pointer to an iterator structure
+ * @param[out] *timestamp_ms pointer to a timestamp buffer
+ * @param[out] *word pointer to a raw word buffer of the block layout
+ * @return     status code
+ *             - 0 success
+ *             - 2 query, iterator, timestamp_ms or word is NULL
+ *             - 3 query is not initialized
+ *             - 4 no more samples
+ * @note       blocks whose min and max miss the filter are skipped without decoding,
+ *             corrupt blocks are skipped and counted
+ */
+uint8_t sen5x_query_next(sen5x_query_t *query, sen5x_query_iterator_t *iterator,
+                         uint64_t *timestamp_ms, uint16_t *word)
+{
+    uint8_t res;
+    int32_t value;
+    sen5x_archive_header_t header;
+
+    if ((query == NULL) || (iterator == NULL) || (timestamp_ms == NULL) || (word == NULL))        /* check the params */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (query->inited != 1)                                                                        /* check the query */
+    {
+        return 3;                                                                                  /* return error */
+    }
+
+    while (iterator->done == 0)                                                                    /* until done */
+    {
+        if (iterator->open == 0)                                                                   /* open the next block */
+        {
+            if (iterator->block >= query->blocks)                                                  /* check the block */
+            {
+                iterator->done = 1;                                                                /* no more blocks */
+
+                break;                                                                             /* break */
+            }
+            if (sen5x_query_get_block(query, iterator->block, &header) != 0)                       /* get the summary */
+            {
+                iterator->blocks_corrupt++;                                                        /* count corrupt */
+                iterator->block++;                                                                 /* next block */
+
+                continue;                                                                          /* continue */
+            }
+            if (header.first_ms > iterator->end_ms)                                                /* past the range */
+            {
+                iterator->done = 1;                                                                /* done */
+
+                break;                                                                             /* break */
+            }
+            if ((iterator->filter_enable != 0) &&
+                ((iterator->filter.channel >= header.channels) ||
+                 ((header.valid_mask & (1U << iterator->filter.channel)) == 0) ||
+                 (header.max[iterator->filter.channel] < iterator->filter.min) ||
+                 (header.min[iterator->filter.channel] > iterator->filter.max)))                   /* summary misses the filter */
+            {
+                iterator->blocks_skipped++;                                                        /* count skipped */
+                iterator->block++;                                                                 /* next block */
+
+                continue;                                                                          /* continue */
+            }
+            if (sen5x_archive_decoder_init(&iterator->decoder,
+                                           &query->archive[(uint64_t)iterator->block * query->block_size],
+                                           query->block_size) != 0)                                /* open the block in place */
+            {
+                iterator->blocks_corrupt++;                                                        /* count corrupt */
+                iterator->block++;                                                                 /* next block */
+
+                continue;                                                                          /* continue */
+            }
+            iterator->blocks_read++;                                                               /* count read */
+            iterator->open = 1;                                                                    /* block open */
+        }
+
+        res = sen5x_archive_decode(&iterator->decoder, timestamp_ms, word);                        /* decode a sample */
+        if (res != 0)                                                                              /* end of block */
+        {
+            if (res == 1)                                                                          /* corrupt payload */
+            {
+                iterator->blocks_corrupt++;                                                        /* count corrupt */
+            }
+            iterator->open = 0;                                                                    /* close the block */
+            iterator->block++;                                                                     /* next block */
+
+            continue;                                                                              /* continue */
+        }
+        if (*timestamp_ms < iterator->start_ms)                                                    /* before the range */
+        {
+            continue;                                                                              /* continue */
+        }
+        if (*timestamp_ms > iterator->end_ms)                                                      /* past the range */
+        {
+            iterator->done = 1;                                                                    /* done */
+
+            break;                                                                                 /* break */
+        }
+        if ((iterator->filter_enable != 0) &&
+            ((sen5x_archive_get_value((sen5x_archive_layout_t)iterator->decoder.header.layout,
+                                      iterator->filter.channel, word[iterator->filter.channel], &value) != 0) ||
+             (value < iterator->filter.min) || (value > iterator->filter.max)))                    /* sample misses the filter */
+        {
+            continue;                                                                              /* continue */
+        }
+
+        return 0;                                                                                  /* success return 0 */
+    }
+
+    return 4;                                                                                      /* no more samples */
+}
@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_query.h
+ * @brief     driver sen5x query header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_QUERY_H
+#define DRIVER_SEN5X_QUERY_H
+
+#include "driver_sen5x_archive.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_query_driver sen5x query driver function
+ * @brief    sen5x query driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x query definition
+ */
+#define SEN5X_QUERY_INDEX_MAGIC              0x49583553U        /**< index magic "S5XI" */
+#define SEN5X_QUERY_INDEX_VERSION            0x01               /**< index format version */
+#define SEN5X_QUERY_INDEX_HEADER_LENGTH      64                 /**< index header length */
+#define SEN5X_QUERY_INDEX_ENTRY_LENGTH       64                 /**< index entry length per block */
+
+/**
+ * @brief     query index size definition
+ * @param[in] blocks archive block count
+ * @note      none
+ */
+#define SEN5X_QUERY_INDEX_SIZE(blocks)       (SEN5X_QUERY_INDEX_HEADER_LENGTH + \
+                                              (uint64_t)(blocks) * SEN5X_QUERY_INDEX_ENTRY_LENGTH)
+
+/**
+ * @brief sen5x query filter structure definition
+ */
+typedef struct sen5x_query_filter_s
+{
+    uint8_t channel;        /**< layout channel */
+    int32_t min;            /**< min natural value */
+    int32_t max;            /**< max natural value */
+} sen5x_query_filter_t;
+
+/**
+ * @brief sen5x query structure definition
+ */
+typedef struct sen5x_query_s
+{
+    const uint8_t *archive;        /**< archive of fixed size blocks */
+    uint64_t archive_size;         /**< archive size */
+    uint32_t block_size;           /**< block size */
+    uint32_t blocks;               /**< block count */
+    const uint8_t *index;          /**< sparse block index, NULL to read the block headers */
+    uint8_t inited;                /**< inited flag */
+} sen5x_query_t;
+
+/**
+ * @brief sen5x query iterator structure definition
+ */
+typedef struct sen5x_query_iterator_s
+{
+    uint64_t start_ms;                       /**< first timestamp */
+    uint64_t end_ms;                         /**< last timestamp */
+    sen5x_query_filter_t filter;             /**< value filter */
+    uint8_t filter_enable;                   /**< filter enable flag */
+    uint8_t open;                            /**< block open flag */
+    uint8_t done;                            /**< done flag */
+    uint32_t block;                          /**< current block */
+    sen5x_archive_decoder_t decoder;         /**< block decoder */
+    uint32_t blocks_read;                    /**< decoded blocks */
+    uint32_t blocks_skipped;                 /**< blocks skipped by the summary */
+    uint32_t blocks_corrupt;                 /**< corrupt blocks */
+} sen5x_query_iterator_t;
+
+/**
+ * @brief     build the sparse index of an archive
+ * @param[in] *archive pointer to an archive buffer
+ * @param[in] archive_size archive size
+ * @param[in] block_size archive block size
+ * @param[in] *index pointer to an index buffer
+ * @param[in] index_size index buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 2 archive or index is NULL
+ *            - 4 block size is invalid
+ *            - 5 index buffer is too small
+ * @note      only the block headers are read, SEN5X_QUERY_INDEX_SIZE gives the index size
+ */
+uint8_t sen5x_query_build_index(const uint8_t *archive, uint64_t archive_size, uint32_t block_size,
+                                uint8_t *index, uint64_t index_size);
+
+/**
+ * @brief     init the query over an archive
+ * @param[in] *query pointer to a query structure
+ * @param[in] *archive pointer to an archive buffer
+ * @param[in] archive_size archive size
+ * @param[in] block_size archive block size
+ * @param[in] *index pointer to an index buffer, NULL to read the block headers
+ * @param[in] index_size index buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 2 query or archive is NULL
+ *            - 4 block size is invalid
+ *            - 5 index doesn't match the archive
+ * @note      the archive and the index are read in place and may be memory mapped
+ */
+uint8_t sen5x_query_init(sen5x_query_t *query, const uint8_t *archive, uint64_t archive_size, uint32_t block_size,
+                         const uint8_t *index, uint64_t index_size);
+
+/**
+ * @brief      get the summary of a block
+ * @param[in]  *query pointer to a query structure
+ * @param[in]  block block number
+ * @param[out] *header pointer to a header structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 block is invalid
+ *             - 2 query or header is NULL
+ *             - 3 query is not initialized
+ *             - 4 block is out of range
+ * @note       the length and crc are 0 when read from the index
+ */
+uint8_t sen5x_query_get_block(sen5x_query_t *query, uint32_t block, sen5x_archive_header_t *header);
+
+/**
+ * @brief     begin a range query
+ * @param[in] *query pointer to a query structure
+ * @param[in] start_ms first timestamp
+ * @param[in] end_ms last timestamp
+ * @param[in] *filter pointer to a filter structure, NULL to return every sample
+ * @param[in] *iterator pointer to an iterator structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 query or iterator is NULL
+ *            - 3 query is not initialized
+ *            - 4 start_ms is later than end_ms
+ * @note      the first block is found with a binary search
+ */
+uint8_t sen5x_query_begin(sen5x_query_t *query, uint64_t start_ms, uint64_t end_ms,
+                          const sen5x_query_filter_t *filter, sen5x_query_iterator_t *iterator);
+
+/**
+ * @brief      get the next sample of a range query
+ * @param[in]  *query pointer to a query structure
+ * @param[in]  *iterator pointer to an iterator structure
+ * @param[out] *timestamp_ms pointer to a timestamp buffer
+ * @param[out] *word pointer to a raw word buffer of the block layout
+ * @return     status code
+ *             - 0 success
+ *             - 2 query, iterator, timestamp_ms or word is NULL
+ *             - 3 query is not initialized
+ *             - 4 no more samples
+ * @note       blocks whose min and max miss the filter are skipped without decoding,
+ *             corrupt blocks are skipped and counted
+ */
+uint8_t sen5x_query_next(sen5x_query_t *query, sen5x_query_iterator_t *iterator,
+                         uint64_t *timestamp_ms, uint16_t *word);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,405 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_resample.c
+ * @brief     driver sen5x resample source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_resample.h"
+
+/**
+ * @brief sen5x resample definition
+ */
+#define SEN5X_RESAMPLE_NO_SAMPLE        0xFFFFFFFFFFFFFFFFULL        /**< no sample in a segment slot */
+
+/**
+ * @brief     get the time of the newest sample of a stream
+ * @param[in] *resample pointer to a resample structure
+ * @param[in] s stream index
+ * @return    newest time
+ * @note      the stream must hold a sample
+ */
+static uint64_t a_sen5x_resample_latest(const sen5x_resample_t *resample, uint8_t s)
+{
+    return resample->time_ms[s][(resample->head[s] + resample->count[s] - 1) % SEN5X_RESAMPLE_DEPTH];   /* newest sample */
+}
+
+/**
+ * @brief     check if the next tick can be emitted
+ * @param[in] *resample pointer to a resample structure
+ * @return    1 ready, 0 not ready
+ * @note      a stream lagging more than max_delay_ms behind the newest sample is not waited for
+ */
+static uint8_t a_sen5x_resample_ready(const sen5x_resample_t *resample)
+{
+    uint8_t s;
+
+    if ((resample->started == 0) || (resample->newest_ms < resample->tick_ms))         /* no sample after the tick */
+    {
+        return 0;                                                                      /* not ready */
+    }
+    for (s = 0; s < resample->streams; s++)                                            /* run all streams */
+    {
+        if ((resample->count[s] != 0) && (a_sen5x_resample_latest(resample, s) >= resample->tick_ms))   /* stream passed the tick */
+        {
+            continue;                                                                  /* next stream */
+        }
+        if (resample->newest_ms - resample->tick_ms >= resample->max_delay_ms)           /* stream is too far behind */
+        {
+            continue;                                                                  /* don't wait */
+        }
+
+        return 0;                                                                      /* wait for the stream */
+    }
+
+    return 1;                                                                          /* ready */
+}
+
+/**
+ * @brief     copy a buffered sample into a segment slot
+ * @param[in] *resample pointer to a resample structure
+ * @param[in] s stream index
+ * @param[in] i buffer slot
+ * @param[out] *seg pointer to the lo or hi table
+ * @note      the tables are stored channel by channel
+ */
+static void a_sen5x_resample_load(sen5x_resample_t *resample, uint8_t s, uint8_t i,
+                                  float seg[SEN5X_RESAMPLE_MAX_CHANNELS][SEN5X_RESAMPLE_MAX_STREAMS])
+{
+    uint8_t c;
+
+    for (c = 0; c < resample->channels; c++)                                           /* run all channels */
+    {
+        seg[c][s] = resample->sample[s][i][c];                                         /* copy the value */
+    }
+}
+
+/**
+ * @brief     emit the row of the next tick
+ * @param[in] *resample pointer to a resample structure
+ * @param[in] forced 1 when a full buffer forces the row
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ * @note      each stream first picks its segment around the tick, only a changed segment end is copied,
+ *            then one loop per channel interpolates all streams at once so the compiler can vectorise it
+ */
+static uint8_t a_sen5x_resample_emit(sen5x_resample_t *resample, uint8_t forced)
+{
+    uint8_t s;
+    uint8_t c;
+    uint8_t a;
+    uint8_t b;
+    uint8_t ok;
+    uint8_t res;
+    uint64_t t;
+    uint64_t ta;
+    uint64_t tb;
+    uint32_t valid;
+    float *v;
+    const float *lo;
+    const float *hi;
+    const float *w;
+
+    t = resample->tick_ms;                                                             /* tick */
+    valid = 0;                                                                         /* init 0 */
+    for (s = 0; s < resample->streams; s++)                                            /* run all streams */
+    {
+        while ((resample->count[s] >= 2) &&
+               (resample->time_ms[s][(resample->head[s] + 1) % SEN5X_RESAMPLE_DEPTH] <= t))   /* next sample is not later */
+        {
+            resample->head[s] = (resample->head[s] + 1) % SEN5X_RESAMPLE_DEPTH;        /* drop the oldest */
+            resample->count[s]--;                                                      /* one less */
+        }
+        a = resample->head[s];                                                         /* sample at or before the tick */
+        b = a;                                                                         /* held value by default */
+        ta = resample->time_ms[s][a];                                                  /* segment start */
+        tb = ta;                                                                       /* held value by default */
+        ok = 0;                                                                        /* init 0 */
+        resample->w[s] = 0.0f;                                                         /* init 0 */
+        if ((resample->count[s] != 0) && (ta <= t))                                    /* sample at or before the tick */
+        {
+            if (resample->mode == SEN5X_RESAMPLE_MODE_LAST)                            /* last value */
+            {
+                ok = (t - ta <= resample->max_gap_ms) ? 1 : 0;                         /* not too old */
+            }
+            else if (ta == t)                                                          /* exact hit */
+            {
+                ok = 1;                                                                /* use the sample */
+            }
+            else if ((resample->count[s] >= 2) &&
+                     (resample->time_ms[s][(a + 1) % SEN5X_RESAMPLE_DEPTH] - ta <= resample->max_gap_ms))   /* usable sample after the tick */
+            {
+                b = (a + 1) % SEN5X_RESAMPLE_DEPTH;                                    /* sample after the tick */
+                tb = resample->time_ms[s][b];                                          /* segment end */
+                resample->w[s] = (float)((double)(t - ta) / (double)(tb - ta));        /* tick weight */
+                ok = 1;                                                                /* interpolate */
+            }
+        }
+        if (ok == 0)                                                                   /* no value */
+        {
+            for (c = 0; c < resample->channels; c++)                                   /* run all channels */
+            {
+                resample->lo[c][s] = NAN;                                              /* no value */
+            }
+            resample->lo_ms[s] = SEN5X_RESAMPLE_NO_SAMPLE;                             /* reload next time */
+            resample->stats.missing++;                                                 /* count the miss */
+
+            continue;                                                                  /* next stream */
+        }
+        if (resample->lo_ms[s] != ta)                                                  /* new segment start */
+        {
+            a_sen5x_resample_load(resample, s, a, resample->lo);                       /* copy the start */
+            resample->lo_ms[s] = ta;                                                   /* save the time */
+        }
+        if (resample->hi_ms[s] != tb)                                                  /* new segment end */
+        {
+            a_sen5x_resample_load(resample, s, b, resample->hi);                       /* copy the end */
+            resample->hi_ms[s] = tb;                                                   /* save the time */
+        }
+        valid |= 1UL << s;                                                             /* flag the value */
+    }
+
+    w = resample->w;                                                                   /* weights */
+    for (c = 0; c < resample->channels; c++)                                           /* run all channels */
+    {
+        v = resample->row.value[c];                                                    /* row channel */
+        lo = resample->lo[c];                                                          /* segment starts */
+        hi = resample->hi[c];                                                          /* segment ends */
+        for (s = 0; s < resample->streams; s++)                                        /* run all streams */
+        {
+            v[s] = lo[s] + w[s] * (hi[s] - lo[s]);                                     /* interpolate */
+        }
+    }
+    resample->row.tick_ms = t;                                                         /* set the tick */
+    resample->row.valid = valid;                                                       /* set the mask */
+    res = resample->emit(&resample->row);                                              /* emit the row */
+    resample->tick_ms += resample->period_ms;                                          /* next tick */
+    resample->stats.rows++;                                                            /* count the row */
+    resample->stats.forced += forced;                                                  /* count the forced row */
+
+    return (res != 0) ? 1 : 0;                                                         /* return the result */
+}
+
+/**
+ * @brief     init the resampler
+ * @param[in] *resample pointer to a resample structure
+ * @param[in] streams stream count
+ * @param[in] channels channel count per stream
+ * @param[in] mode resample mode
+ * @param[in] period_ms grid period in ms
+ * @param[in] max_gap_ms max sample spacing bridged in ms
+ * @param[in] max_delay_ms max wait for a late stream in ms
+ * @param[in] *emit pointer to an emit function address called with every row
+ * @return    status code
+ *            - 0 success
+ *            - 2 resample or emit is NULL
+ *            - 4 streams or channels is invalid
+ *            - 5 mode is invalid
+ *            - 6 period, gap or delay is invalid
+ * @note      1 <= streams <= 32, 1 <= channels <= 10, period_ms > 0, max_gap_ms >= period_ms,
+ *            max_delay_ms >= period_ms
+ */
+uint8_t sen5x_resample_init(sen5x_resample_t *resample, uint8_t streams, uint8_t channels, sen5x_resample_mode_t mode,
+                            uint32_t period_ms, uint32_t max_gap_ms, uint32_t max_delay_ms,
+                            uint8_t (*emit)(const sen5x_resample_row_t *row))
+{
+    uint8_t s;
+
+    if ((resample == NULL) || (emit == NULL))                                          /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if ((streams == 0) || (streams > SEN5X_RESAMPLE_MAX_STREAMS) ||
+        (channels == 0) || (channels > SEN5X_RESAMPLE_MAX_CHANNELS))                   /* check the streams and channels */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if ((mode != SEN5X_RESAMPLE_MODE_LINEAR) && (mode != SEN5X_RESAMPLE_MODE_LAST))    /* check the mode */
+    {
+        return 5;                                                                      /* return error */
+    }
+    if ((period_ms == 0) || (max_gap_ms < period_ms) || (max_delay_ms < period_ms))    /* check the period, gap and delay */
+    {
+        return 6;                                                                      /* return error */
+    }
+
+    memset(resample, 0, sizeof(sen5x_resample_t));                                     /* clear the resample */
+    resample->emit = emit;                                                             /* set the emit function */
+    resample->mode = (uint8_t)mode;                                                    /* set the mode */
+    resample->streams = streams;                                                       /* set the streams */
+    resample->channels = channels;                                                     /* set the channels */
+    resample->period_ms = period_ms;                                                   /* set the period */
+    resample->max_gap_ms = max_gap_ms;                                                 /* set the gap */
+    resample->max_delay_ms = max_delay_ms;                                             /* set the delay */
+    for (s = 0; s < SEN5X_RESAMPLE_MAX_STREAMS; s++)                                   /* run all streams */
+    {
+        resample->lo_ms[s] = SEN5X_RESAMPLE_NO_SAMPLE;                                 /* no segment start */
+        resample->hi_ms[s] = SEN5X_RESAMPLE_NO_SAMPLE;                                 /* no segment end */
+    }
+    resample->row.streams = streams;                                                   /* set the row streams */
+    resample->row.channels = channels;                                                 /* set the row channels */
+    resample->inited = 1;                                                              /* flag inited */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     push a sample of a stream
+ * @param[in] *resample pointer to a resample structure
+ * @param[in] stream stream index
+ * @param[in] timestamp_ms sample time in ms
+ * @param[in] *value pointer to the channel values
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 resample or value is NULL
+ *            - 3 resample is not initialized
+ *            - 4 stream is invalid
+ *            - 5 timestamp is older than the last sample of the stream
+ * @note      a row is emitted once every stream has a sample at or after its tick, a stream more than
+ *            max_delay_ms behind the newest sample is not waited for and a full stream buffer emits the
+ *            rows it holds back early
+ */
+uint8_t sen5x_resample_push(sen5x_resample_t *resample, uint8_t stream, uint64_t timestamp_ms, const float *value)
+{
+    uint8_t res;
+    uint8_t i;
+    uint64_t next;
+
+    if ((resample == NULL) || (value == NULL))                                         /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (resample->inited != 1)                                                         /* check the resample */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (stream >= resample->streams)                                                   /* check the stream */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if ((resample->count[stream] != 0) && (timestamp_ms < a_sen5x_resample_latest(resample, stream)))   /* check the timestamp */
+    {
+        return 5;                                                                      /* return error */
+    }
+
+    res = 0;                                                                           /* init 0 */
+    if (resample->started == 0)                                                        /* first sample */
+    {
+        resample->tick_ms = (timestamp_ms + resample->period_ms - 1) / resample->period_ms * resample->period_ms;   /* first tick on the grid */
+        resample->started = 1;                                                         /* flag started */
+    }
+    while (resample->count[stream] == SEN5X_RESAMPLE_DEPTH)                            /* buffer is full */
+    {
+        next = resample->time_ms[stream][(resample->head[stream] + 1) % SEN5X_RESAMPLE_DEPTH];   /* second oldest sample */
+        if (resample->tick_ms < next)                                                  /* the oldest is still needed */
+        {
+            res |= a_sen5x_resample_emit(resample, 1);                                 /* emit the row early */
+        }
+        else
+        {
+            resample->head[stream] = (resample->head[stream] + 1) % SEN5X_RESAMPLE_DEPTH;   /* drop the oldest */
+            resample->count[stream]--;                                                 /* one less */
+        }
+    }
+    i = (resample->head[stream] + resample->count[stream]) % SEN5X_RESAMPLE_DEPTH;     /* free slot */
+    resample->time_ms[stream][i] = timestamp_ms;                                       /* save the time */
+    memcpy(resample->sample[stream][i], value, sizeof(float) * resample->channels);    /* save the values */
+    resample->count[stream]++;                                                         /* one more */
+    resample->newest_ms = (timestamp_ms > resample->newest_ms) ? timestamp_ms : resample->newest_ms;   /* newest time */
+    resample->stats.samples++;                                                         /* count the sample */
+    while (a_sen5x_resample_ready(resample) != 0)                                      /* emit the ready rows */
+    {
+        res |= a_sen5x_resample_emit(resample, 0);                                     /* emit the row */
+    }
+
+    return res;                                                                        /* return the result */
+}
+
+/**
+ * @brief     emit the rows up to the newest sample
+ * @param[in] *resample pointer to a resample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 resample is NULL
+ *            - 3 resample is not initialized
+ * @note      streams without a sample after a tick get no value in linear mode
+ */
+uint8_t sen5x_resample_flush(sen5x_resample_t *resample)
+{
+    uint8_t res;
+
+    if (resample == NULL)                                                              /* check the resample */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (resample->inited != 1)                                                         /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    res = 0;                                                                           /* init 0 */
+    while ((resample->started != 0) && (resample->tick_ms <= resample->newest_ms))     /* ticks up to the newest sample */
+    {
+        res |= a_sen5x_resample_emit(resample, 0);                                     /* emit the row */
+    }
+
+    return res;                                                                        /* return the result */
+}
+
+/**
+ * @brief      get the resample stats
+ * @param[in]  *resample pointer to a resample structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 resample or stats is NULL
+ *             - 3 resample is not initialized
+ * @note       none
+ */
+uint8_t sen5x_resample_get_stats(sen5x_resample_t *resample, sen5x_resample_stats_t *stats)
+{
+    if ((resample == NULL) || (stats == NULL))                                         /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (resample->inited != 1)                                                         /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+
+    *stats = resample->stats;                                                          /* copy the stats */
+
+    return 0;                                                                          /* success return 0 */
+}
@@ -0,0 +1,196 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_resample.h
+ * @brief     driver sen5x resample header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_RESAMPLE_H
+#define DRIVER_SEN5X_RESAMPLE_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_resample_driver sen5x resample driver function
+ * @brief    sen5x resample driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x resample definition
+ */
+#define SEN5X_RESAMPLE_MAX_STREAMS         32        /**< max streams */
+#define SEN5X_RESAMPLE_MAX_CHANNELS        10        /**< max channels per stream */
+#define SEN5X_RESAMPLE_DEPTH               8         /**< samples buffered per stream */
+
+/**
+ * @brief sen5x resample mode enumeration definition
+ */
+typedef enum
+{
+    SEN5X_RESAMPLE_MODE_LINEAR = 0x00,        /**< linear interpolation between the samples around the tick */
+    SEN5X_RESAMPLE_MODE_LAST   = 0x01,        /**< last sample at or before the tick */
+} sen5x_resample_mode_t;
+
+/**
+ * @brief sen5x resample row structure definition
+ * @note  the values are stored channel by channel so a channel of all streams is contiguous
+ */
+typedef struct sen5x_resample_row_s
+{
+    uint64_t tick_ms;                                                               /**< grid tick */
+    uint32_t valid;                                                                 /**< streams with a value, bit n is stream n */
+    uint8_t streams;                                                                /**< stream count */
+    uint8_t channels;                                                               /**< channel count */
+    float value[SEN5X_RESAMPLE_MAX_CHANNELS][SEN5X_RESAMPLE_MAX_STREAMS];           /**< values, nan for a stream without a value */
+} sen5x_resample_row_t;
+
+/**
+ * @brief sen5x resample stats structure definition
+ */
+typedef struct sen5x_resample_stats_s
+{
+    uint64_t samples;                   /**< pushed samples */
+    uint64_t rows;                      /**< emitted rows */
+    uint64_t forced;                    /**< rows emitted early because a stream buffer was full */
+    uint64_t missing;                   /**< stream values left out of the rows */
+} sen5x_resample_stats_t;
+
+/**
+ * @brief sen5x resample structure definition
+ */
+typedef struct sen5x_resample_s
+{
+    uint8_t (*emit)(const sen5x_resample_row_t *row);                                      /**< point to an emit function address */
+    uint8_t mode;                                                                          /**< resample mode */
+    uint8_t streams;                                                                       /**< stream count */
+    uint8_t channels;                                                                      /**< channel count */
+    uint8_t started;                                                                       /**< first sample seen */
+    uint32_t period_ms;                                                                    /**< grid period */
+    uint32_t max_gap_ms;                                                                   /**< max sample spacing bridged */
+    uint32_t max_delay_ms;                                                                 /**< max wait for a late stream */
+    uint64_t tick_ms;                                                                      /**< next grid tick */
+    uint64_t newest_ms;                                                                    /**< newest timestamp of all streams */
+    uint64_t time_ms[SEN5X_RESAMPLE_MAX_STREAMS][SEN5X_RESAMPLE_DEPTH];                    /**< buffered sample times */
+    float sample[SEN5X_RESAMPLE_MAX_STREAMS][SEN5X_RESAMPLE_DEPTH][SEN5X_RESAMPLE_MAX_CHANNELS];   /**< buffered samples */
+    uint8_t head[SEN5X_RESAMPLE_MAX_STREAMS];                                              /**< oldest buffered sample */
+    uint8_t count[SEN5X_RESAMPLE_MAX_STREAMS];                                             /**< buffered samples */
+    uint64_t lo_ms[SEN5X_RESAMPLE_MAX_STREAMS];                                            /**< time of the sample in lo */
+    uint64_t hi_ms[SEN5X_RESAMPLE_MAX_STREAMS];                                            /**< time of the sample in hi */
+    float lo[SEN5X_RESAMPLE_MAX_CHANNELS][SEN5X_RESAMPLE_MAX_STREAMS];                     /**< segment start values */
+    float hi[SEN5X_RESAMPLE_MAX_CHANNELS][SEN5X_RESAMPLE_MAX_STREAMS];                     /**< segment end values */
+    float w[SEN5X_RESAMPLE_MAX_STREAMS];                                                   /**< tick weights */
+    sen5x_resample_row_t row;                                                              /**< row buffer */
+    sen5x_resample_stats_t stats;                                                          /**< stats */
+    uint8_t inited;                                                                        /**< inited flag */
+} sen5x_resample_t;
+
+/**
+ * @brief     init the resampler
+ * @param[in] *resample pointer to a resample structure
+ * @param[in] streams stream count
+ * @param[in] channels channel count per stream
+ * @param[in] mode resample mode
+ * @param[in] period_ms grid period in ms
+ * @param[in] max_gap_ms max sample spacing bridged in ms
+ * @param[in] max_delay_ms max wait for a late stream in ms
+ * @param[in] *emit pointer to an emit function address called with every row
+ * @return    status code
+ *            - 0 success
+ *            - 2 resample or emit is NULL
+ *            - 4 streams or channels is invalid
+ *            - 5 mode is invalid
+ *            - 6 period, gap or delay is invalid
+ * @note      1 <= streams <= 32, 1 <= channels <= 10, period_ms > 0, max_gap_ms >= period_ms,
+ *            max_delay_ms >= period_ms
+ */
+uint8_t sen5x_resample_init(sen5x_resample_t *resample, uint8_t streams, uint8_t channels, sen5x_resample_mode_t mode,
+                            uint32_t period_ms, uint32_t max_gap_ms, uint32_t max_delay_ms,
+                            uint8_t (*emit)(const sen5x_resample_row_t *row));
+
+/**
+ * @brief     push a sample of a stream
+ * @param[in] *resample pointer to a resample structure
+ * @param[in] stream stream index
+ * @param[in] timestamp_ms sample time in ms
+ * @param[in] *value pointer to the channel values
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 resample or value is NULL
+ *            - 3 resample is not initialized
+ *            - 4 stream is invalid
+ *            - 5 timestamp is older than the last sample of the stream
+ * @note      a row is emitted once every stream has a sample at or after its tick, a stream more than
+ *            max_delay_ms behind the newest sample is not waited for and a full stream buffer emits the
+ *            rows it holds back early
+ */
+uint8_t sen5x_resample_push(sen5x_resample_t *resample, uint8_t stream, uint64_t timestamp_ms, const float *value);
+
+/**
+ * @brief     emit the rows up to the newest sample
+ * @param[in] *resample pointer to a resample structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 resample is NULL
+ *            - 3 resample is not initialized
+ * @note      streams without a sample after a tick get no value in linear mode
+ */
+uint8_t sen5x_resample_flush(sen5x_resample_t *resample);
+
+/**
+ * @brief      get the resample stats
+ * @param[in]  *resample pointer to a resample structure
+ * @param[out] *stats pointer to a stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 resample or stats is NULL
+ *             - 3 resample is not initialized
+ * @note       none
+ */
+uint8_t sen5x_resample_get_stats(sen5x_resample_t *resample, sen5x_resample_stats_t *stats);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,505 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_rollup.c
+ * @brief     driver sen5x rollup source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_rollup.h"
+
+/**
+ * @brief layout pm channel mask table
+ */
+static const uint16_t gs_pm_mask[2] = {0x000F, 0x03FF};
+
+/**
+ * @brief layout signed channel mask table
+ */
+static const uint16_t gs_signed_mask[2] = {0x00F0, 0x0000};
+
+/**
+ * @brief layout raw word scale table
+ */
+static const float gs_scale[2][SEN5X_ROLLUP_MAX_CHANNELS] =
+{
+    {10.0f, 10.0f, 10.0f, 10.0f, 100.0f, 200.0f, 10.0f, 10.0f, 1.0f, 1.0f},
+    {10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 1000.0f},
+};
+
+/**
+ * @brief default level period table
+ */
+static const uint32_t gs_default_period_s[SEN5X_ROLLUP_MAX_LEVELS] = {60, 900, 3600, 86400};
+
+/**
+ * @brief     clear a bucket
+ * @param[in] *bucket pointer to a bucket structure
+ * @param[in] start_ms bucket start
+ * @param[in] period_s bucket period
+ * @note      none
+ */
+static void a_sen5x_rollup_reset(sen5x_rollup_bucket_t *bucket, uint64_t start_ms, uint32_t period_s)
+{
+    memset(bucket, 0, sizeof(sen5x_rollup_bucket_t));        /* clear the bucket */
+    bucket->start_ms = start_ms;                             /* set the start */
+    bucket->period_s = period_s;                             /* set the period */
+}
+
+/**
+ * @brief     merge a closed bucket into the next level
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] level next level
+ * @param[in] *from pointer to a closed bucket
+ * @note      the next level bucket must cover the closed bucket
+ */
+static void a_sen5x_rollup_merge(sen5x_rollup_t *rollup, uint8_t level, const sen5x_rollup_bucket_t *from)
+{
+    uint8_t ch;
+    uint64_t period_ms;
+    sen5x_rollup_bucket_t *to;
+
+    to = &rollup->bucket[level];                                                           /* get the bucket */
+    if (rollup->open[level] == 0)                                                          /* open a bucket */
+    {
+        period_ms = (uint64_t)rollup->period_s[level] * 1000;                              /* period in ms */
+        a_sen5x_rollup_reset(to, from->start_ms - from->start_ms % period_ms,
+                             rollup->period_s[level]);                                     /* aligned start */
+        rollup->open[level] = 1;                                                           /* flag open */
+    }
+    to->samples += from->samples;                                                          /* add the samples */
+    for (ch = 0; ch < rollup->channels; ch++)                                              /* run all channels */
+    {
+        if (from->count[ch] == 0)                                                          /* empty channel */
+        {
+            continue;                                                                      /* next channel */
+        }
+        if ((to->count[ch] == 0) || (from->min[ch] < to->min[ch]))                         /* check the min */
+        {
+            to->min[ch] = from->min[ch];                                                   /* update the min */
+        }
+        if ((to->count[ch] == 0) || (from->max[ch] > to->max[ch]))                         /* check the max */
+        {
+            to->max[ch] = from->max[ch];                                                   /* update the max */
+        }
+        to->count[ch] += from->count[ch];                                                  /* add the count */
+        to->sum[ch] += from->sum[ch];                                                      /* add the sum */
+        to->last[ch] = from->last[ch];                                                     /* update the last */
+    }
+}
+
+/**
+ * @brief     close the buckets that a timestamp has left
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] all 1 closes every open bucket
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ * @note      lower levels close first so each bucket is merged before its parent closes
+ */
+static uint8_t a_sen5x_rollup_close(sen5x_rollup_t *rollup, uint64_t timestamp_ms, uint8_t all)
+{
+    uint8_t res;
+    uint8_t level;
+    uint64_t period_ms;
+
+    res = 0;                                                                                  /* init 0 */
+    for (level = 0; level < rollup->levels; level++)                                          /* run all levels */
+    {
+        if (rollup->open[level] == 0)                                                         /* not open */
+        {
+            continue;                                                                         /* next level */
+        }
+        period_ms = (uint64_t)rollup->period_s[level] * 1000;                                 /* period in ms */
+        if ((all == 0) && ((timestamp_ms - timestamp_ms % period_ms) == rollup->bucket[level].start_ms))   /* still open */
+        {
+            break;                                                                            /* higher levels are open too */
+        }
+        if (rollup->emit(level, &rollup->bucket[level]) != 0)                                 /* emit the bucket */
+        {
+            res = 1;                                                                          /* flag error */
+        }
+        if ((level + 1) < rollup->levels)                                                     /* has a parent */
+        {
+            a_sen5x_rollup_merge(rollup, level + 1, &rollup->bucket[level]);                  /* merge into the parent */
+        }
+        rollup->open[level] = 0;                                                              /* flag closed */
+    }
+
+    return res;                                                                               /* return the result */
+}
+
+/**
+ * @brief     init the rollup
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] layout SEN5X_ARCHIVE_LAYOUT_MEASURED or SEN5X_ARCHIVE_LAYOUT_PM
+ * @param[in] *period_s pointer to the level periods in seconds, NULL for 60, 900, 3600 and 86400
+ * @param[in] levels level count
+ * @param[in] *emit pointer to an emit function address called with every closed bucket
+ * @return    status code
+ *            - 0 success
+ *            - 2 rollup or emit is NULL
+ *            - 4 layout is invalid
+ *            - 5 periods are invalid
+ * @note      every period must be a multiple of the previous one
+ */
+uint8_t sen5x_rollup_init(sen5x_rollup_t *rollup, sen5x_archive_layout_t layout, const uint32_t *period_s, uint8_t levels,
+                          uint8_t (*emit)(uint8_t level, const sen5x_rollup_bucket_t *bucket))
+{
+    uint8_t i;
+
+    if ((rollup == NULL) || (emit == NULL))                                                   /* check the params */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if ((layout != SEN5X_ARCHIVE_LAYOUT_MEASURED) && (layout != SEN5X_ARCHIVE_LAYOUT_PM))     /* check the layout */
+    {
+        return 4;                                                                             /* return error */
+    }
+    if (period_s == NULL)                                                                     /* use the default */
+    {
+        period_s = gs_default_period_s;                                                       /* default periods */
+        levels = SEN5X_ROLLUP_MAX_LEVELS;                                                     /* all levels */
+    }
+    if ((levels == 0) || (levels > SEN5X_ROLLUP_MAX_LEVELS))                                  /* check the levels */
+    {
+        return 5;                                                                             /* return error */
+    }
+    for (i = 0; i < levels; i++)                                                              /* check the periods */
+    {
+        if ((period_s[i] == 0) || ((i != 0) && ((period_s[i] <= period_s[i - 1]) ||
+            ((period_s[i] % period_s[i - 1]) != 0))))                                         /* check the multiple */
+        {
+            return 5;                                                                         /* return error */
+        }
+    }
+
+    memset(rollup, 0, sizeof(sen5x_rollup_t));                                                /* clear the rollup */
+    rollup->emit = emit;                                                                      /* set the emit function */
+    rollup->layout = (uint8_t)layout;                                                         /* set the layout */
+    rollup->channels = sen5x_archive_layout_channels(layout);                                 /* set the channels */
+    rollup->levels = levels;                                                                  /* set the levels */
+    for (i = 0; i < levels; i++)                                                              /* copy the periods */
+    {
+        rollup->period_s[i] = period_s[i];                                                    /* set the period */
+    }
+    rollup->inited = 1;                                                                       /* flag inited */
+
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     push a sample
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] *value pointer to the channel values of the layout
+ * @param[in] pm_valid pm valid flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 rollup or value is NULL
+ *            - 3 rollup is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      nan values are skipped, the pm channels are skipped when pm_valid is 0
+ */
+uint8_t sen5x_rollup_push(sen5x_rollup_t *rollup, uint64_t timestamp_ms, const float *value, uint8_t pm_valid)
+{
+    uint8_t res;
+    uint8_t ch;
+    uint16_t skip;
+    uint64_t period_ms;
+    sen5x_rollup_bucket_t *bucket;
+
+    if ((rollup == NULL) || (value == NULL))                                                  /* check the params */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (rollup->inited != 1)                                                                  /* check the rollup */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if (timestamp_ms < rollup->last_ms)                                                       /* check the timestamp */
+    {
+        return 4;                                                                             /* return error */
+    }
+
+    res = a_sen5x_rollup_close(rollup, timestamp_ms, 0);                                      /* close the left buckets */
+    bucket = &rollup->bucket[0];                                                              /* finest bucket */
+    if (rollup->open[0] == 0)                                                                 /* open a bucket */
+    {
+        period_ms = (uint64_t)rollup->period_s[0] * 1000;                                     /* period in ms */
+        a_sen5x_rollup_reset(bucket, timestamp_ms - timestamp_ms % period_ms,
+                             rollup->period_s[0]);                                            /* aligned start */
+        rollup->open[0] = 1;                                                                  /* flag open */
+    }
+    skip = (pm_valid != 0) ? 0 : gs_pm_mask[rollup->layout];                                  /* pm channels to skip */
+    bucket->samples++;                                                                        /* count the sample */
+    for (ch = 0; ch < rollup->channels; ch++)                                                 /* run all channels */
+    {
+        if (((skip & (1U << ch)) != 0) || (isnan(value[ch]) != 0))                            /* invalid value */
+        {
+            continue;                                                                         /* next channel */
+        }
+        if ((bucket->count[ch] == 0) || (value[ch] < bucket->min[ch]))                        /* check the min */
+        {
+            bucket->min[ch] = value[ch];                                                      /* update the min */
+        }
+        if ((bucket->count[ch] == 0) || (value[ch] > bucket->max[ch]))                        /* check the max */
+        {
+            bucket->max[ch] = value[ch];                                                      /* update the max */
+        }
+        bucket->count[ch]++;                                                                  /* count the value */
+        bucket->sum[ch] += value[ch];                                                         /* add the value */
+        bucket->last[ch] = value[ch];                                                         /* set the last */
+    }
+    rollup->last_ms = timestamp_ms;                                                           /* update the last timestamp */
+
+    return res;                                                                               /* return the result */
+}
+
+/**
+ * @brief     push a sen55 sample
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] *data pointer to a sen55 data structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 rollup or data is NULL
+ *            - 3 rollup is not initialized
+ *            - 4 layout isn't measured or timestamp is older than the last sample
+ * @note      none
+ */
+uint8_t sen5x_rollup_push_sen55(sen5x_rollup_t *rollup, uint64_t timestamp_ms, const sen55_data_t *data)
+{
+    float value[8];
+
+    if ((rollup == NULL) || (data == NULL))                                     /* check the params */
+    {
+        return 2;                                                               /* return error */
+    }
+    if (rollup->inited != 1)                                                    /* check the rollup */
+    {
+        return 3;                                                               /* return error */
+    }
+    if (rollup->layout != SEN5X_ARCHIVE_LAYOUT_MEASURED)                        /* check the layout */
+    {
+        return 4;                                                               /* return error */
+    }
+
+    value[0] = data->pm1p0_ug_m3;                                               /* set pm1.0 */
+    value[1] = data->pm2p5_ug_m3;                                               /* set pm2.5 */
+    value[2] = data->pm4p0_ug_m3;                                               /* set pm4.0 */
+    value[3] = data->pm10_ug_m3;                                                /* set pm10 */
+    value[4] = data->compensated_ambient_humidity_percentage;                   /* set humidity */
+    value[5] = data->compensated_ambient_temperature_degree;                    /* set temperature */
+    value[6] = data->voc_index;                                                 /* set voc */
+    value[7] = data->nox_index;                                                 /* set nox */
+
+    return sen5x_rollup_push(rollup, timestamp_ms, value, data->pm_valid);      /* push the values */
+}
+
+/**
+ * @brief     push a pm sample
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] *pm pointer to a sen5x pm structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 rollup or pm is NULL
+ *            - 3 rollup is not initialized
+ *            - 4 layout isn't pm or timestamp is older than the last sample
+ * @note      none
+ */
+uint8_t sen5x_rollup_push_pm(sen5x_rollup_t *rollup, uint64_t timestamp_ms, const sen5x_pm_t *pm)
+{
+    float value[10];
+
+    if ((rollup == NULL) || (pm == NULL))                                     /* check the params */
+    {
+        return 2;                                                             /* return error */
+    }
+    if (rollup->inited != 1)                                                  /* check the rollup */
+    {
+        return 3;                                                             /* return error */
+    }
+    if (rollup->layout != SEN5X_ARCHIVE_LAYOUT_PM)                            /* check the layout */
+    {
+        return 4;                                                             /* return error */
+    }
+
+    value[0] = pm->pm1p0_ug_m3;                                               /* set pm1.0 mass */
+    value[1] = pm->pm2p5_ug_m3;                                               /* set pm2.5 mass */
+    value[2] = pm->pm4p0_ug_m3;                                               /* set pm4.0 mass */
+    value[3] = pm->pm10_ug_m3;                                                /* set pm10 mass */
+    value[4] = pm->pm0p5_cm3;                                                 /* set pm0.5 number */
+    value[5] = pm->pm1p0_cm3;                                                 /* set pm1.0 number */
+    value[6] = pm->pm2p5_cm3;                                                 /* set pm2.5 number */
+    value[7] = pm->pm4p0_cm3;                                                 /* set pm4.0 number */
+    value[8] = pm->pm10_cm3;                                                  /* set pm10 number */
+    value[9] = pm->typical_particle_um;                                       /* set typical particle size */
+
+    return sen5x_rollup_push(rollup, timestamp_ms, value, pm->pm_valid);      /* push the values */
+}
+
+/**
+ * @brief     close and emit all open buckets
+ * @param[in] *rollup pointer to a rollup structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 rollup is NULL
+ *            - 3 rollup is not initialized
+ * @note      the emitted buckets may be partial
+ */
+uint8_t sen5x_rollup_flush(sen5x_rollup_t *rollup)
+{
+    if (rollup == NULL)                                   /* check the rollup */
+    {
+        return 2;                                         /* return error */
+    }
+    if (rollup->inited != 1)                              /* check the rollup */
+    {
+        return 3;                                         /* return error */
+    }
+
+    return a_sen5x_rollup_close(rollup, 0, 1);            /* close all */
+}
+
+/**
+ * @brief      get the open bucket of a level
+ * @param[in]  *rollup pointer to a rollup structure
+ * @param[in]  level resolution level
+ * @param[out] *bucket pointer to a bucket structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 rollup or bucket is NULL
+ *             - 3 rollup is not initialized
+ *             - 4 level is invalid
+ *             - 5 no open bucket
+ * @note       a higher level bucket holds the closed lower level buckets,
+ *             add the open lower level buckets for the live total
+ */
+uint8_t sen5x_rollup_get_bucket(sen5x_rollup_t *rollup, uint8_t level, sen5x_rollup_bucket_t *bucket)
+{
+    if ((rollup == NULL) || (bucket == NULL))              /* check the params */
+    {
+        return 2;                                          /* return error */
+    }
+    if (rollup->inited != 1)                               /* check the rollup */
+    {
+        return 3;                                          /* return error */
+    }
+    if (level >= rollup->levels)                           /* check the level */
+    {
+        return 4;                                          /* return error */
+    }
+    if (rollup->open[level] == 0)                          /* check the bucket */
+    {
+        return 5;                                          /* return error */
+    }
+
+    *bucket = rollup->bucket[level];                       /* copy the bucket */
+
+    return 0;                                              /* success return 0 */
+}
+
+/**
+ * @brief      convert a bucket statistic to archive words
+ * @param[in]  *rollup pointer to a rollup structure
+ * @param[in]  *bucket pointer to a bucket structure
+ * @param[in]  stat statistic
+ * @param[out] *word pointer to a raw word buffer of the layout
+ * @return     status code
+ *             - 0 success
+ *             - 2 rollup, bucket or word is NULL
+ *             - 3 rollup is not initialized
+ *             - 4 stat is invalid
+ * @note       empty channels get the invalid word, the words can be appended to an archive encoder
+ */
+uint8_t sen5x_rollup_get_words(sen5x_rollup_t *rollup, const sen5x_rollup_bucket_t *bucket,
+                               sen5x_rollup_stat_t stat, uint16_t *word)
+{
+    uint8_t ch;
+    uint8_t sign;
+    float v;
+    float lo;
+    float hi;
+
+    if ((rollup == NULL) || (bucket == NULL) || (word == NULL))                                   /* check the params */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (rollup->inited != 1)                                                                      /* check the rollup */
+    {
+        return 3;                                                                                 /* return error */
+    }
+    if ((uint32_t)stat > (uint32_t)SEN5X_ROLLUP_STAT_LAST)                                        /* check the stat */
+    {
+        return 4;                                                                                 /* return error */
+    }
+
+    for (ch = 0; ch < rollup->channels; ch++)                                                     /* run all channels */
+    {
+        sign = ((gs_signed_mask[rollup->layout] & (1U << ch)) != 0) ? 1 : 0;                      /* signed channel */
+        if (bucket->count[ch] == 0)                                                               /* empty channel */
+        {
+            word[ch] = (sign != 0) ? 0x7FFFU : 0xFFFFU;                                           /* invalid word */
+
+            continue;                                                                             /* next channel */
+        }
+        if (stat == SEN5X_ROLLUP_STAT_MEAN)                                                       /* mean */
+        {
+            v = (float)(bucket->sum[ch] / bucket->count[ch]);                                     /* get the mean */
+        }
+        else if (stat == SEN5X_ROLLUP_STAT_MIN)                                                   /* min */
+        {
+            v = bucket->min[ch];                                                                  /* get the min */
+        }
+        else if (stat == SEN5X_ROLLUP_STAT_MAX)                                                   /* max */
+        {
+            v = bucket->max[ch];                                                                  /* get the max */
+        }
+        else                                                                                      /* last */
+        {
+            v = bucket->last[ch];                                                                 /* get the last */
+        }
+        v = floorf(v * gs_scale[rollup->layout][ch] + 0.5f);                                      /* scale and round */
+        lo = (sign != 0) ? -32768.0f : 0.0f;                                                      /* low limit */
+        hi = (sign != 0) ? 32766.0f : 65534.0f;                                                   /* high limit below invalid */
+        v = (v < lo) ? lo : ((v > hi) ? hi : v);                                                  /* clamp */
+        word[ch] = (sign != 0) ? (uint16_t)(int16_t)v : (uint16_t)v;                              /* set the word */
+    }
+
+    return 0;                                                                                     /* success return 0 */
+}
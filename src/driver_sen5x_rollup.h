@@ -0,0 +1,216 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_rollup.h
+ * @brief     driver sen5x rollup header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_ROLLUP_H
+#define DRIVER_SEN5X_ROLLUP_H
+
+#include "driver_sen5x_archive.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_rollup_driver sen5x rollup driver function
+ * @brief    sen5x rollup driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x rollup definition
+ */
+#define SEN5X_ROLLUP_MAX_LEVELS        4         /**< max resolution levels */
+#define SEN5X_ROLLUP_MAX_CHANNELS      10        /**< max channels */
+
+/**
+ * @brief sen5x rollup statistic enumeration definition
+ */
+typedef enum
+{
+    SEN5X_ROLLUP_STAT_MEAN = 0x00,        /**< mean of the valid samples */
+    SEN5X_ROLLUP_STAT_MIN  = 0x01,        /**< min of the valid samples */
+    SEN5X_ROLLUP_STAT_MAX  = 0x02,        /**< max of the valid samples */
+    SEN5X_ROLLUP_STAT_LAST = 0x03,        /**< last valid sample */
+} sen5x_rollup_stat_t;
+
+/**
+ * @brief sen5x rollup bucket structure definition
+ */
+typedef struct sen5x_rollup_bucket_s
+{
+    uint64_t start_ms;                                /**< bucket start, aligned to the period */
+    uint32_t period_s;                                /**< bucket period in seconds */
+    uint32_t samples;                                 /**< pushed samples including the invalid ones */
+    uint32_t count[SEN5X_ROLLUP_MAX_CHANNELS];        /**< valid samples per channel */
+    double sum[SEN5X_ROLLUP_MAX_CHANNELS];            /**< sum of the valid samples */
+    float min[SEN5X_ROLLUP_MAX_CHANNELS];             /**< min of the valid samples */
+    float max[SEN5X_ROLLUP_MAX_CHANNELS];             /**< max of the valid samples */
+    float last[SEN5X_ROLLUP_MAX_CHANNELS];            /**< last valid sample */
+} sen5x_rollup_bucket_t;
+
+/**
+ * @brief sen5x rollup structure definition
+ */
+typedef struct sen5x_rollup_s
+{
+    uint8_t (*emit)(uint8_t level, const sen5x_rollup_bucket_t *bucket);        /**< point to an emit function address */
+    uint8_t layout;                                                             /**< archive layout of the channels */
+    uint8_t channels;                                                           /**< channel count */
+    uint8_t levels;                                                             /**< resolution levels */
+    uint32_t period_s[SEN5X_ROLLUP_MAX_LEVELS];                                 /**< level periods in seconds */
+    sen5x_rollup_bucket_t bucket[SEN5X_ROLLUP_MAX_LEVELS];                      /**< open buckets */
+    uint8_t open[SEN5X_ROLLUP_MAX_LEVELS];                                      /**< bucket open flags */
+    uint64_t last_ms;                                                           /**< last timestamp */
+    uint8_t inited;                                                             /**< inited flag */
+} sen5x_rollup_t;
+
+/**
+ * @brief     init the rollup
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] layout SEN5X_ARCHIVE_LAYOUT_MEASURED or SEN5X_ARCHIVE_LAYOUT_PM
+ * @param[in] *period_s pointer to the level periods in seconds, NULL for 60, 900, 3600 and 86400
+ * @param[in] levels level count
+ * @param[in] *emit pointer to an emit function address called with every closed bucket
+ * @return    status code
+ *            - 0 success
+ *            - 2 rollup or emit is NULL
+ *            - 4 layout is invalid
+ *            - 5 periods are invalid
+ * @note      every period must be a multiple of the previous one
+ */
+uint8_t sen5x_rollup_init(sen5x_rollup_t *rollup, sen5x_archive_layout_t layout, const uint32_t *period_s, uint8_t levels,
+                          uint8_t (*emit)(uint8_t level, const sen5x_rollup_bucket_t *bucket));
+
+/**
+ * @brief     push a sample
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] *value pointer to the channel values of the layout
+ * @param[in] pm_valid pm valid flag
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 rollup or value is NULL
+ *            - 3 rollup is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      nan values are skipped, the pm channels are skipped when pm_valid is 0
+ */
+uint8_t sen5x_rollup_push(sen5x_rollup_t *rollup, uint64_t timestamp_ms, const float *value, uint8_t pm_valid);
+
+/**
+ * @brief     push a sen55 sample
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] *data pointer to a sen55 data structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 rollup or data is NULL
+ *            - 3 rollup is not initialized
+ *            - 4 layout isn't measured or timestamp is older than the last sample
+ * @note      none
+ */
+uint8_t sen5x_rollup_push_sen55(sen5x_rollup_t *rollup, uint64_t timestamp_ms, const sen55_data_t *data);
+
+/**
+ * @brief     push a pm sample
+ * @param[in] *rollup pointer to a rollup structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] *pm pointer to a sen5x pm structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 rollup or pm is NULL
+ *            - 3 rollup is not initialized
+ *            - 4 layout isn't pm or timestamp is older than the last sample
+ * @note      none
+ */
+uint8_t sen5x_rollup_push_pm(sen5x_rollup_t *rollup, uint64_t timestamp_ms, const sen5x_pm_t *pm);
+
+/**
+ * @brief     close and emit all open buckets
+ * @param[in] *rollup pointer to a rollup structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ *            - 2 rollup is NULL
+ *            - 3 rollup is not initialized
+ * @note      the emitted buckets may be partial
+ */
+uint8_t sen5x_rollup_flush(sen5x_rollup_t *rollup);
+
+/**
+ * @brief      get the open bucket of a level
+ * @param[in]  *rollup pointer to a rollup structure
+ * @param[in]  level resolution level
+ * @param[out] *bucket pointer to a bucket structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 rollup or bucket is NULL
+ *             - 3 rollup is not initialized
+ *             - 4 level is invalid
+ *             - 5 no open bucket
+ * @note       a higher level bucket holds the closed lower level buckets,
+ *             add the open lower level buckets for the live total
+ */
+uint8_t sen5x_rollup_get_bucket(sen5x_rollup_t *rollup, uint8_t level, sen5x_rollup_bucket_t *bucket);
+
+/**
+ * @brief      convert a bucket statistic to archive words
+ * @param[in]  *rollup pointer to a rollup structure
+ * @param[in]  *bucket pointer to a bucket structure
+ * @param[in]  stat statistic
+ * @param[out] *word pointer to a raw word buffer of the layout
+ * @return     status code
+ *             - 0 success
+ *             - 2 rollup, bucket or word is NULL
+ *             - 3 rollup is not initialized
+ *             - 4 stat is invalid
+ * @note       empty channels get the invalid word, the words can be appended to an archive encoder
+ */
+uint8_t sen5x_rollup_get_words(sen5x_rollup_t *rollup, const sen5x_rollup_bucket_t *bucket,
+                               sen5x_rollup_stat_t stat, uint16_t *word);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
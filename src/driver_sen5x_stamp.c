@@ -0,0 +1,253 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_stamp.c
+ * @brief     driver sen5x stamp source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_stamp.h"
+
+/**
+ * @brief sen5x stamp definition
+ */
+#define SEN5X_STAMP_ACQUIRE_PPM        5000.0        /**< period uncertainty before the fit in ppm */
+#define SEN5X_STAMP_NO_BOUND           -1e18         /**< lower bound not known */
+
+/**
+ * @brief      add a sample to the skew fit
+ * @param[in]  *stamp pointer to a stamp structure
+ * @param[in]  dk index step from the last sample
+ * @param[in]  dt time step from the last sample in us
+ * @return     none
+ * @note       the sums are moved so the new sample is the origin, which keeps the doubles small,
+ *             then the old samples are weighted down and the period is refitted
+ */
+static void a_sen5x_stamp_fit(sen5x_stamp_t *stamp, double dk, double dt)
+{
+    double s0;
+    double sk;
+    double st;
+    double w;
+    double vkk;
+    double vkt;
+    double vtt;
+    double b;
+    double sse;
+
+    s0 = stamp->s0;                                                                    /* old weight sum */
+    sk = stamp->sk;                                                                    /* old index sum */
+    st = stamp->st;                                                                    /* old time sum */
+    stamp->stt = stamp->stt - 2.0 * dt * st + dt * dt * s0;                            /* move the time square sum */
+    stamp->skt = stamp->skt - dk * st - dt * sk + dk * dt * s0;                        /* move the product sum */
+    stamp->skk = stamp->skk - 2.0 * dk * sk + dk * dk * s0;                            /* move the index square sum */
+    stamp->sk = sk - dk * s0;                                                          /* move the index sum */
+    stamp->st = st - dt * s0;                                                          /* move the time sum */
+    w = pow(stamp->forget, dk);                                                        /* forget the old samples */
+    stamp->s0 = s0 * w + 1.0;                                                          /* add the new sample */
+    stamp->sk *= w;                                                                    /* weight down */
+    stamp->st *= w;                                                                    /* weight down */
+    stamp->skk *= w;                                                                   /* weight down */
+    stamp->skt *= w;                                                                   /* weight down */
+    stamp->stt *= w;                                                                   /* weight down */
+    if (stamp->s0 < 3.0)                                                               /* too few samples */
+    {
+        return;                                                                        /* keep the period */
+    }
+
+    vkk = stamp->skk - stamp->sk * stamp->sk / stamp->s0;                              /* index variance */
+    vkt = stamp->skt - stamp->sk * stamp->st / stamp->s0;                              /* covariance */
+    vtt = stamp->stt - stamp->st * stamp->st / stamp->s0;                              /* time variance */
+    if (!(vkk > 0.0))                                                                  /* no index spread */
+    {
+        return;                                                                        /* keep the period */
+    }
+    b = vkt / vkk;                                                                     /* fitted period */
+    if ((b < 0.5 * stamp->nominal_us) || (b > 1.5 * stamp->nominal_us))                /* not a plausible period */
+    {
+        return;                                                                        /* keep the period */
+    }
+    sse = vtt - b * vkt;                                                               /* residual sum of squares */
+    sse = (sse > 0.0) ? sse : 0.0;                                                     /* rounding guard */
+    stamp->period_us = b;                                                              /* save the period */
+    stamp->sigma_us = sqrt(sse / (stamp->s0 - 2.0) / vkk);                             /* period standard error */
+}
+
+/**
+ * @brief     init the sample timestamping
+ * @param[in] *stamp pointer to a stamp structure
+ * @param[in] period_ms nominal sample period in ms
+ * @param[in] window_s time constant of the skew fit in seconds
+ * @param[in] drift_ppm clock wander the fit can't follow in ppm
+ * @return    status code
+ *            - 0 success
+ *            - 2 stamp is NULL
+ *            - 4 period is invalid
+ *            - 5 window is invalid
+ *            - 6 drift is invalid
+ * @note      period_ms > 0, window_s >= 10 * period_ms / 1000, 0 <= drift_ppm <= 10000
+ */
+uint8_t sen5x_stamp_init(sen5x_stamp_t *stamp, float period_ms, float window_s, float drift_ppm)
+{
+    if (stamp == NULL)                                                                 /* check the stamp */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (!(period_ms > 0.0f))                                                           /* check the period */
+    {
+        return 4;                                                                      /* return error */
+    }
+    if (!(window_s >= 10.0f * period_ms / 1000.0f))                                    /* check the window */
+    {
+        return 5;                                                                      /* return error */
+    }
+    if (!((drift_ppm >= 0.0f) && (drift_ppm <= 10000.0f)))                             /* check the drift */
+    {
+        return 6;                                                                      /* return error */
+    }
+
+    memset(stamp, 0, sizeof(sen5x_stamp_t));                                           /* clear the stamp */
+    stamp->nominal_us = (double)period_ms * 1000.0;                                    /* nominal period */
+    stamp->period_us = stamp->nominal_us;                                              /* start at the nominal period */
+    stamp->sigma_us = stamp->nominal_us * SEN5X_STAMP_ACQUIRE_PPM * 1e-6;              /* coarse period */
+    stamp->wander_us = stamp->nominal_us * (double)drift_ppm * 1e-6;                   /* wander per sample */
+    stamp->forget = 1.0 - (double)period_ms / 1000.0 / (double)window_s;               /* weight kept per sample */
+    stamp->next_lo_us = SEN5X_STAMP_NO_BOUND;                                          /* no bound yet */
+    stamp->inited = 1;                                                                 /* set the inited */
+
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      push one data ready poll or read transaction
+ * @param[in]  *stamp pointer to a stamp structure
+ * @param[in]  before_us monotonic time just before the transaction
+ * @param[in]  after_us monotonic time just after the transaction
+ * @param[in]  flag SEN5X_DATA_READY_FLAG_AVAILABLE when a new sample was read, else the poll found no sample
+ * @param[out] *result pointer to a stamp result structure, filled only for a new sample
+ * @return     status code
+ *             - 0 success
+ *             - 2 stamp or result is NULL
+ *             - 3 stamp is not initialized
+ *             - 4 after_us is before before_us
+ * @note       a new sample was produced before after_us, within one period before before_us and after
+ *             the previous read or empty poll started, these brackets are carried from sample to sample
+ *             with the fitted period, add the offset of CLOCK_REALTIME to CLOCK_MONOTONIC for wall time
+ */
+uint8_t sen5x_stamp_push(sen5x_stamp_t *stamp, uint64_t before_us, uint64_t after_us,
+                         sen5x_data_ready_flag_t flag, sen5x_stamp_result_t *result)
+{
+    double before;
+    double after;
+    double mid;
+    double dk;
+    double g;
+    double lo;
+    double hi;
+    double lo_carry;
+    double hi_carry;
+    double t;
+
+    if ((stamp == NULL) || (result == NULL))                                           /* check the params */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (stamp->inited != 1)                                                            /* check the inited */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (after_us < before_us)                                                          /* check the times */
+    {
+        return 4;                                                                      /* return error */
+    }
+
+    before = (double)before_us;                                                        /* transaction start */
+    after = (double)after_us;                                                          /* transaction end */
+    if (flag != SEN5X_DATA_READY_FLAG_AVAILABLE)                                       /* no sample yet */
+    {
+        stamp->next_lo_us = (before > stamp->next_lo_us) ? before : stamp->next_lo_us;   /* the next sample is later */
+
+        return 0;                                                                      /* success return 0 */
+    }
+
+    mid = 0.5 * (before + after);                                                      /* transaction middle */
+    g = 3.0 * stamp->sigma_us + stamp->wander_us;                                      /* bracket growth per sample */
+    if (stamp->started == 0)                                                           /* first sample */
+    {
+        dk = 1.0;                                                                      /* no step */
+        lo = before - stamp->period_us;                                                /* at most one period old */
+        lo = (stamp->next_lo_us > lo) ? stamp->next_lo_us : lo;                        /* after the empty polls */
+        hi = after;                                                                    /* before the read ended */
+        stamp->index = 0;                                                              /* first index */
+        stamp->s0 = 1.0;                                                               /* first fit sample */
+        stamp->started = 1;                                                            /* started */
+    }
+    else
+    {
+        if (stamp->hi_us - stamp->lo_us < 0.5 * stamp->period_us)                         /* last instant is known */
+        {
+            dk = floor((mid - 0.5 * (stamp->lo_us + stamp->hi_us)) / stamp->period_us);   /* latest sample before the read */
+        }
+        else
+        {
+            dk = floor((mid - stamp->last_mid_us) / stamp->period_us + 0.5);           /* periods since the last read */
+        }
+        dk = (dk < 1.0) ? 1.0 : dk;                                                    /* at least the next sample */
+        lo = before - stamp->period_us - g;                                            /* at most one period old */
+        t = stamp->next_lo_us + (dk - 1.0) * (stamp->period_us - g);                   /* after the last poll */
+        lo = (t > lo) ? t : lo;                                                        /* tighter bound */
+        hi = after;                                                                    /* before the read ended */
+        lo_carry = stamp->lo_us + dk * (stamp->period_us - g);                         /* carried lower bound */
+        hi_carry = stamp->hi_us + dk * (stamp->period_us + g);                         /* carried upper bound */
+        if ((lo_carry < hi) && (hi_carry > lo))                                        /* brackets agree */
+        {
+            lo = (lo_carry > lo) ? lo_carry : lo;                                      /* intersect */
+            hi = (hi_carry < hi) ? hi_carry : hi;                                      /* intersect */
+        }
+        stamp->index += (uint64_t)dk;                                                  /* next index */
+        a_sen5x_stamp_fit(stamp, dk, mid - stamp->last_mid_us);                        /* refit the period */
+    }
+    stamp->lo_us = lo;                                                                 /* save the lower bound */
+    stamp->hi_us = hi;                                                                 /* save the upper bound */
+    stamp->next_lo_us = before;                                                        /* the next sample is later */
+    stamp->last_mid_us = mid;                                                          /* save the middle */
+    stamp->samples++;                                                                  /* one more sample */
+
+    t = 0.5 * (lo + hi);                                                               /* corrected instant */
+    result->timestamp_us = (t > 0.0) ? (uint64_t)(t + 0.5) : 0;                        /* round */
+    result->uncertainty_us = (uint32_t)ceil(0.5 * (hi - lo));                          /* half width */
+    result->latency_us = (uint32_t)(after - (double)result->timestamp_us);             /* read latency */
+    result->index = stamp->index;                                                      /* sample index */
+    result->skipped = (uint32_t)(dk - 1.0);                                            /* missed samples */
+    result->skew_ppm = (float)((stamp->period_us / stamp->nominal_us - 1.0) * 1e6);    /* skew */
+
+    return 0;                                                                          /* success return 0 */
+}
@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_stamp.h
+ * @brief     driver sen5x stamp header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_STAMP_H
+#define DRIVER_SEN5X_STAMP_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_stamp_driver sen5x stamp driver function
+ * @brief    sen5x stamp driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x stamp definition
+ */
+#define SEN5X_STAMP_DEFAULT_PERIOD_MS        1000.0f        /**< nominal sample period in ms */
+#define SEN5X_STAMP_DEFAULT_WINDOW_S         3600.0f        /**< time constant of the skew fit in seconds */
+#define SEN5X_STAMP_DEFAULT_DRIFT_PPM        10.0f          /**< clock wander the fit can't follow in ppm */
+
+/**
+ * @brief sen5x stamp structure definition
+ * @note  all times are in us of the caller's monotonic clock, the fit sums are relative to the last sample
+ */
+typedef struct sen5x_stamp_s
+{
+    double lo_us;                       /**< the last sample is after this time */
+    double hi_us;                       /**< the last sample is at or before this time */
+    double next_lo_us;                  /**< the next sample is after this time */
+    double last_mid_us;                 /**< middle of the last read transaction */
+    double nominal_us;                  /**< nominal sample period */
+    double period_us;                   /**< fitted sample period */
+    double sigma_us;                    /**< standard error of the fitted period */
+    double wander_us;                   /**< clock wander per sample */
+    double forget;                      /**< fit weight kept per sample */
+    double s0;                          /**< fit weight sum */
+    double sk;                          /**< fit index sum */
+    double st;                          /**< fit time sum */
+    double skk;                         /**< fit index square sum */
+    double skt;                         /**< fit index time product sum */
+    double stt;                         /**< fit time square sum */
+    uint64_t index;                     /**< index of the last sample */
+    uint64_t samples;                   /**< samples read */
+    uint8_t started;                    /**< first sample seen */
+    uint8_t inited;                     /**< inited flag */
+} sen5x_stamp_t;
+
+/**
+ * @brief sen5x stamp result structure definition
+ */
+typedef struct sen5x_stamp_result_s
+{
+    uint64_t timestamp_us;              /**< corrected sample instant */
+    uint32_t uncertainty_us;            /**< the sample instant is within timestamp_us +- uncertainty_us */
+    uint32_t latency_us;                /**< read completion after the corrected instant */
+    uint64_t index;                     /**< sample index since the first sample */
+    uint32_t skipped;                   /**< samples missed before this one */
+    float skew_ppm;                     /**< sensor clock rate against the caller's clock */
+} sen5x_stamp_result_t;
+
+/**
+ * @brief     init the sample timestamping
+ * @param[in] *stamp pointer to a stamp structure
+ * @param[in] period_ms nominal sample period in ms
+ * @param[in] window_s time constant of the skew fit in seconds
+ * @param[in] drift_ppm clock wander the fit can't follow in ppm
+ * @return    status code
+ *            - 0 success
+ *            - 2 stamp is NULL
+ *            - 4 period is invalid
+ *            - 5 window is invalid
+ *            - 6 drift is invalid
+ * @note      period_ms > 0, window_s >= 10 * period_ms / 1000, 0 <= drift_ppm <= 10000
+ */
+uint8_t sen5x_stamp_init(sen5x_stamp_t *stamp, float period_ms, float window_s, float drift_ppm);
+
+/**
+ * @brief      push one data ready poll or read transaction
+ * @param[in]  *stamp pointer to a stamp structure
+ * @param[in]  before_us monotonic time just before the transaction
+ * @param[in]  after_us monotonic time just after the transaction
+ * @param[in]  flag SEN5X_DATA_READY_FLAG_AVAILABLE when a new sample was read, else the poll found no sample
+ * @param[out] *result pointer to a stamp result structure, filled only for a new sample
+ * @return     status code
+ *             - 0 success
+ *             - 2 stamp or result is NULL
+ *             - 3 stamp is not initialized
+ *             - 4 after_us is before before_us
+ * @note       a new sample was produced before after_us, within one period before before_us and after
+ *             the previous read or empty poll started, these brackets are carried from sample to sample
+ *             with the fitted period, add the offset of CLOCK_REALTIME to CLOCK_MONOTONIC for wall time
+ */
+uint8_t sen5x_stamp_push(sen5x_stamp_t *stamp, uint64_t before_us, uint64_t after_us,
+                         sen5x_data_ready_flag_t flag, sen5x_stamp_result_t *result);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,428 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_stats.c
+ * @brief     driver sen5x stats source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_stats.h"
+
+/**
+ * @brief sketch constant definition
+ */
+#define SEN5X_STATS_LN_GAMMA        0.0400053346f        /**< ln((1 + alpha) / (1 - alpha)) */
+#define SEN5X_STATS_INV_LN_GAMMA    24.9966663f          /**< 1 / ln((1 + alpha) / (1 - alpha)) */
+
+/**
+ * @brief     wrap a slot position
+ * @param[in] *stats pointer to a stats structure
+ * @param[in] pos position below twice the capacity
+ * @return    wrapped position
+ * @note      none
+ */
+static inline uint32_t a_sen5x_stats_wrap(const sen5x_stats_t *stats, uint32_t pos)
+{
+    return (pos >= stats->capacity) ? (pos - stats->capacity) : pos;        /* wrap the position */
+}
+
+/**
+ * @brief     get the sketch bin of a value
+ * @param[in] value sample value
+ * @return    bin index, positive bins first, -1 for the zero bin
+ * @note      bin k of a sign covers the magnitudes min * gamma^k - min * gamma^(k + 1)
+ */
+static inline int32_t a_sen5x_stats_bin(float value)
+{
+    int32_t k;
+    float mag;
+
+    mag = fabsf(value);                                                                       /* get the magnitude */
+    if (mag <= SEN5X_STATS_SKETCH_MIN)                                                        /* zero bin */
+    {
+        return -1;                                                                            /* return zero bin */
+    }
+    k = (int32_t)ceilf(logf(mag * (1.0f / SEN5X_STATS_SKETCH_MIN)) *
+                       SEN5X_STATS_INV_LN_GAMMA) - 1;                                         /* get the bin */
+    if (k < 0)                                                                                /* rounding below */
+    {
+        k = 0;                                                                                /* first bin */
+    }
+    if (k >= SEN5X_STATS_SKETCH_BINS)                                                         /* above the range */
+    {
+        k = SEN5X_STATS_SKETCH_BINS - 1;                                                      /* last bin */
+    }
+
+    return (value < 0.0f) ? (k + SEN5X_STATS_SKETCH_BINS) : k;                                /* return the bin */
+}
+
+/**
+ * @brief     remove the oldest sample
+ * @param[in] *stats pointer to a stats structure
+ * @note      the window must not be empty
+ */
+static void a_sen5x_stats_evict(sen5x_stats_t *stats)
+{
+    int32_t k;
+    double d;
+    float value;
+
+    value = stats->slot[stats->head].value;                                                   /* get the value */
+    if ((stats->min_count != 0) && (stats->slot[stats->min_head].min_slot == stats->head))    /* oldest is the min */
+    {
+        stats->min_head = a_sen5x_stats_wrap(stats, stats->min_head + 1);                     /* pop the front */
+        stats->min_count--;                                                                   /* one less */
+    }
+    if ((stats->max_count != 0) && (stats->slot[stats->max_head].max_slot == stats->head))    /* oldest is the max */
+    {
+        stats->max_head = a_sen5x_stats_wrap(stats, stats->max_head + 1);                     /* pop the front */
+        stats->max_count--;                                                                   /* one less */
+    }
+    k = a_sen5x_stats_bin(value);                                                             /* get the bin */
+    if (k < 0)                                                                                /* zero bin */
+    {
+        stats->zero--;                                                                        /* remove from the zero bin */
+    }
+    else
+    {
+        stats->bin[k]--;                                                                      /* remove from the bin */
+    }
+    stats->head = a_sen5x_stats_wrap(stats, stats->head + 1);                                 /* next oldest */
+    stats->count--;                                                                           /* one less */
+    if (stats->count == 0)                                                                    /* window is empty */
+    {
+        stats->mean = 0.0;                                                                    /* reset the mean */
+        stats->m2 = 0.0;                                                                      /* reset the m2 */
+    }
+    else
+    {
+        d = (double)value - stats->mean;                                                      /* deviation from the old mean */
+        stats->mean -= d / stats->count;                                                      /* remove from the mean */
+        stats->m2 -= d * ((double)value - stats->mean);                                       /* remove from the m2 */
+        if (stats->m2 < 0.0)                                                                  /* rounding below zero */
+        {
+            stats->m2 = 0.0;                                                                  /* clamp */
+        }
+    }
+}
+
+/**
+ * @brief     remove the samples that left the window
+ * @param[in] *stats pointer to a stats structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @note      none
+ */
+static void a_sen5x_stats_expire(sen5x_stats_t *stats, uint64_t timestamp_ms)
+{
+    uint32_t now;
+
+    now = (uint32_t)timestamp_ms;                                                             /* low 32 bits */
+    while ((stats->count != 0) &&
+           ((uint32_t)(now - stats->slot[stats->head].timestamp) >= stats->window_ms))        /* left the window */
+    {
+        a_sen5x_stats_evict(stats);                                                           /* remove the oldest */
+    }
+    stats->last_ms = timestamp_ms;                                                            /* save the timestamp */
+}
+
+/**
+ * @brief     init the window statistics
+ * @param[in] *stats pointer to a stats structure
+ * @param[in] window_ms window length in ms
+ * @param[in] *slot pointer to a slot buffer
+ * @param[in] capacity slot count
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats or slot is NULL
+ *            - 4 window is invalid
+ *            - 5 capacity is invalid
+ * @note      the capacity should hold the samples of a whole window,
+ *            the window must be shorter than 2^31 ms
+ */
+uint8_t sen5x_stats_init(sen5x_stats_t *stats, uint32_t window_ms, sen5x_stats_slot_t *slot, uint32_t capacity)
+{
+    if ((stats == NULL) || (slot == NULL))                                                    /* check the params */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if ((window_ms == 0) || (window_ms >= 0x80000000U))                                       /* check the window */
+    {
+        return 4;                                                                             /* return error */
+    }
+    if ((capacity == 0) || (capacity > SEN5X_STATS_MAX_CAPACITY))                             /* check the capacity */
+    {
+        return 5;                                                                             /* return error */
+    }
+
+    memset(stats, 0, sizeof(sen5x_stats_t));                                                  /* clear the stats */
+    stats->slot = slot;                                                                       /* set the slots */
+    stats->capacity = capacity;                                                               /* set the capacity */
+    stats->window_ms = window_ms;                                                             /* set the window */
+    stats->inited = 1;                                                                        /* flag inited */
+
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     push a sample
+ * @param[in] *stats pointer to a stats structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] value sample value
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 3 stats is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      nan values only move the window forward,
+ *            the oldest sample is dropped early when the window is full
+ */
+uint8_t sen5x_stats_push(sen5x_stats_t *stats, uint64_t timestamp_ms, float value)
+{
+    int32_t k;
+    uint32_t pos;
+    uint32_t back;
+    double d;
+
+    if (stats == NULL)                                                                        /* check the stats */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (stats->inited != 1)                                                                   /* check the stats */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if (timestamp_ms < stats->last_ms)                                                        /* check the timestamp */
+    {
+        return 4;                                                                             /* return error */
+    }
+
+    a_sen5x_stats_expire(stats, timestamp_ms);                                                /* remove the old samples */
+    if (isnan(value) != 0)                                                                    /* invalid value */
+    {
+        return 0;                                                                             /* success return 0 */
+    }
+    if (stats->count == stats->capacity)                                                      /* window is full */
+    {
+        a_sen5x_stats_evict(stats);                                                           /* drop the oldest */
+        stats->overflow++;                                                                    /* count the drop */
+    }
+    pos = a_sen5x_stats_wrap(stats, stats->head + stats->count);                              /* new slot */
+    stats->slot[pos].value = value;                                                           /* set the value */
+    stats->slot[pos].timestamp = (uint32_t)timestamp_ms;                                      /* set the timestamp */
+    while ((stats->min_count != 0) &&
+           (stats->slot[stats->slot[a_sen5x_stats_wrap(stats, stats->min_head + stats->min_count - 1)].min_slot].value >= value))    /* not a future min */
+    {
+        stats->min_count--;                                                                   /* pop the back */
+    }
+    back = a_sen5x_stats_wrap(stats, stats->min_head + stats->min_count);                     /* min deque back */
+    stats->slot[back].min_slot = pos;                                                         /* push the back */
+    stats->min_count++;                                                                       /* one more */
+    while ((stats->max_count != 0) &&
+           (stats->slot[stats->slot[a_sen5x_stats_wrap(stats, stats->max_head + stats->max_count - 1)].max_slot].value <= value))    /* not a future max */
+    {
+        stats->max_count--;                                                                   /* pop the back */
+    }
+    back = a_sen5x_stats_wrap(stats, stats->max_head + stats->max_count);                     /* max deque back */
+    stats->slot[back].max_slot = pos;                                                         /* push the back */
+    stats->max_count++;                                                                       /* one more */
+    k = a_sen5x_stats_bin(value);                                                             /* get the bin */
+    if (k < 0)                                                                                /* zero bin */
+    {
+        stats->zero++;                                                                        /* add to the zero bin */
+    }
+    else
+    {
+        stats->bin[k]++;                                                                      /* add to the bin */
+    }
+    stats->count++;                                                                           /* one more */
+    d = (double)value - stats->mean;                                                          /* deviation from the old mean */
+    stats->mean += d / stats->count;                                                          /* add to the mean */
+    stats->m2 += d * ((double)value - stats->mean);                                           /* add to the m2 */
+
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     move the window forward without a sample
+ * @param[in] *stats pointer to a stats structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 3 stats is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      none
+ */
+uint8_t sen5x_stats_expire(sen5x_stats_t *stats, uint64_t timestamp_ms)
+{
+    if (stats == NULL)                                                                        /* check the stats */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (stats->inited != 1)                                                                   /* check the stats */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if (timestamp_ms < stats->last_ms)                                                        /* check the timestamp */
+    {
+        return 4;                                                                             /* return error */
+    }
+
+    a_sen5x_stats_expire(stats, timestamp_ms);                                                /* remove the old samples */
+
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      get a quantile of the window
+ * @param[in]  *stats pointer to a stats structure
+ * @param[in]  q quantile in 0.0 - 1.0
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or value is NULL
+ *             - 3 stats is not initialized
+ *             - 4 q is invalid
+ *             - 5 window is empty
+ * @note       the relative error is SEN5X_STATS_SKETCH_ALPHA,
+ *             magnitudes below SEN5X_STATS_SKETCH_MIN read as zero
+ */
+uint8_t sen5x_stats_get_quantile(sen5x_stats_t *stats, float q, float *value)
+{
+    int32_t i;
+    int32_t k;
+    uint32_t rank;
+    uint32_t seen;
+    float v;
+    float lo;
+    float hi;
+
+    if ((stats == NULL) || (value == NULL))                                                   /* check the params */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (stats->inited != 1)                                                                   /* check the stats */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if (!((q >= 0.0f) && (q <= 1.0f)))                                                        /* check the q */
+    {
+        return 4;                                                                             /* return error */
+    }
+    if (stats->count == 0)                                                                    /* check the window */
+    {
+        return 5;                                                                             /* return error */
+    }
+
+    rank = (uint32_t)(q * (float)(stats->count - 1) + 0.5f);                                  /* nearest rank */
+    seen = 0;                                                                                 /* init 0 */
+    v = 0.0f;                                                                                 /* init 0 */
+    for (i = 0; i <= 2 * SEN5X_STATS_SKETCH_BINS; i++)                                        /* run from the most negative */
+    {
+        if (i < SEN5X_STATS_SKETCH_BINS)                                                      /* negative bins */
+        {
+            k = SEN5X_STATS_SKETCH_BINS - 1 - i;                                              /* magnitude bin */
+            seen += stats->bin[k + SEN5X_STATS_SKETCH_BINS];                                  /* add the bin */
+        }
+        else if (i == SEN5X_STATS_SKETCH_BINS)                                                /* zero bin */
+        {
+            k = -1;                                                                           /* no magnitude */
+            seen += stats->zero;                                                              /* add the bin */
+        }
+        else                                                                                  /* positive bins */
+        {
+            k = i - SEN5X_STATS_SKETCH_BINS - 1;                                              /* magnitude bin */
+            seen += stats->bin[k];                                                            /* add the bin */
+        }
+        if (seen > rank)                                                                      /* found */
+        {
+            if (k >= 0)                                                                       /* not the zero bin */
+            {
+                v = SEN5X_STATS_SKETCH_MIN * (1.0f - SEN5X_STATS_SKETCH_ALPHA) *
+                    expf((float)(k + 1) * SEN5X_STATS_LN_GAMMA);                              /* bin estimate */
+                v = (i < SEN5X_STATS_SKETCH_BINS) ? -v : v;                                   /* set the sign */
+            }
+            break;                                                                            /* stop */
+        }
+    }
+    lo = stats->slot[stats->slot[stats->min_head].min_slot].value;                            /* window min */
+    hi = stats->slot[stats->slot[stats->max_head].max_slot].value;                            /* window max */
+    *value = (v < lo) ? lo : ((v > hi) ? hi : v);                                             /* clamp to the window */
+
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      get the window statistics
+ * @param[in]  *stats pointer to a stats structure
+ * @param[out] *result pointer to a result structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or result is NULL
+ *             - 3 stats is not initialized
+ *             - 5 window is empty
+ * @note       none
+ */
+uint8_t sen5x_stats_get_result(sen5x_stats_t *stats, sen5x_stats_result_t *result)
+{
+    uint8_t res;
+
+    if ((stats == NULL) || (result == NULL))                                                  /* check the params */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (stats->inited != 1)                                                                   /* check the stats */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if (stats->count == 0)                                                                    /* check the window */
+    {
+        return 5;                                                                             /* return error */
+    }
+
+    result->count = stats->count;                                                             /* set the count */
+    result->mean = (float)stats->mean;                                                        /* set the mean */
+    result->variance = (stats->count > 1) ? (float)(stats->m2 / (stats->count - 1)) : 0.0f;   /* set the variance */
+    result->min = stats->slot[stats->slot[stats->min_head].min_slot].value;                   /* set the min */
+    result->max = stats->slot[stats->slot[stats->max_head].max_slot].value;                   /* set the max */
+    res = sen5x_stats_get_quantile(stats, 0.50f, &result->p50);                               /* get the median */
+    if (res != 0)                                                                             /* check the result */
+    {
+        return res;                                                                           /* return the error */
+    }
+    res = sen5x_stats_get_quantile(stats, 0.95f, &result->p95);                               /* get the 95th percentile */
+    if (res != 0)                                                                             /* check the result */
+    {
+        return res;                                                                           /* return the error */
+    }
+
+    return 0;                                                                                 /* success return 0 */
+}
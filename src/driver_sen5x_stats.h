@@ -0,0 +1,190 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_stats.h
+ * @brief     driver sen5x stats header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_STATS_H
+#define DRIVER_SEN5X_STATS_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_stats_driver sen5x stats driver function
+ * @brief    sen5x stats driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x stats definition
+ */
+#define SEN5X_STATS_SKETCH_BINS          512            /**< sketch bins per sign */
+#define SEN5X_STATS_SKETCH_ALPHA         0.02f          /**< sketch relative accuracy */
+#define SEN5X_STATS_SKETCH_MIN           0.01f          /**< smallest magnitude apart from zero */
+#define SEN5X_STATS_MAX_CAPACITY         65535          /**< max samples in a window */
+
+/**
+ * @brief sen5x stats slot structure definition
+ */
+typedef struct sen5x_stats_slot_s
+{
+    float value;              /**< sample value */
+    uint32_t timestamp;       /**< low 32 bits of the sample timestamp in ms */
+    uint32_t min_slot;        /**< min deque entry */
+    uint32_t max_slot;        /**< max deque entry */
+} sen5x_stats_slot_t;
+
+/**
+ * @brief sen5x stats result structure definition
+ */
+typedef struct sen5x_stats_result_s
+{
+    uint32_t count;           /**< samples in the window */
+    float mean;               /**< mean */
+    float variance;           /**< sample variance */
+    float min;                /**< min */
+    float max;                /**< max */
+    float p50;                /**< median within the sketch accuracy */
+    float p95;                /**< 95th percentile within the sketch accuracy */
+} sen5x_stats_result_t;
+
+/**
+ * @brief sen5x stats structure definition
+ */
+typedef struct sen5x_stats_s
+{
+    sen5x_stats_slot_t *slot;                          /**< window slots */
+    uint32_t capacity;                                 /**< slot count */
+    uint32_t window_ms;                                /**< window length in ms */
+    uint32_t head;                                     /**< oldest slot */
+    uint32_t count;                                    /**< samples in the window */
+    uint32_t min_head;                                 /**< min deque front */
+    uint32_t min_count;                                /**< min deque length */
+    uint32_t max_head;                                 /**< max deque front */
+    uint32_t max_count;                                /**< max deque length */
+    double mean;                                       /**< running mean */
+    double m2;                                         /**< running sum of squared deviations */
+    uint32_t zero;                                     /**< sketch zero bin */
+    uint16_t bin[2 * SEN5X_STATS_SKETCH_BINS];         /**< sketch bins, positive then negative */
+    uint32_t overflow;                                 /**< samples dropped early because the window was full */
+    uint64_t last_ms;                                  /**< last timestamp */
+    uint8_t inited;                                    /**< inited flag */
+} sen5x_stats_t;
+
+/**
+ * @brief     init the window statistics
+ * @param[in] *stats pointer to a stats structure
+ * @param[in] window_ms window length in ms
+ * @param[in] *slot pointer to a slot buffer
+ * @param[in] capacity slot count
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats or slot is NULL
+ *            - 4 window is invalid
+ *            - 5 capacity is invalid
+ * @note      the capacity should hold the samples of a whole window,
+ *            the window must be shorter than 2^31 ms
+ */
+uint8_t sen5x_stats_init(sen5x_stats_t *stats, uint32_t window_ms, sen5x_stats_slot_t *slot, uint32_t capacity);
+
+/**
+ * @brief     push a sample
+ * @param[in] *stats pointer to a stats structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] value sample value
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 3 stats is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      nan values only move the window forward,
+ *            the oldest sample is dropped early when the window is full
+ */
+uint8_t sen5x_stats_push(sen5x_stats_t *stats, uint64_t timestamp_ms, float value);
+
+/**
+ * @brief     move the window forward without a sample
+ * @param[in] *stats pointer to a stats structure
+ * @param[in] timestamp_ms timestamp in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 stats is NULL
+ *            - 3 stats is not initialized
+ *            - 4 timestamp is older than the last sample
+ * @note      none
+ */
+uint8_t sen5x_stats_expire(sen5x_stats_t *stats, uint64_t timestamp_ms);
+
+/**
+ * @brief      get a quantile of the window
+ * @param[in]  *stats pointer to a stats structure
+ * @param[in]  q quantile in 0.0 - 1.0
+ * @param[out] *value pointer to a value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or value is NULL
+ *             - 3 stats is not initialized
+ *             - 4 q is invalid
+ *             - 5 window is empty
+ * @note       the relative error is SEN5X_STATS_SKETCH_ALPHA,
+ *             magnitudes below SEN5X_STATS_SKETCH_MIN read as zero
+ */
+uint8_t sen5x_stats_get_quantile(sen5x_stats_t *stats, float q, float *value);
+
+/**
+ * @brief      get the window statistics
+ * @param[in]  *stats pointer to a stats structure
+ * @param[out] *result pointer to a result structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 stats or result is NULL
+ *             - 3 stats is not initialized
+ *             - 5 window is empty
+ * @note       none
+ */
+uint8_t sen5x_stats_get_result(sen5x_stats_t *stats, sen5x_stats_result_t *result);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,683 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_store.c
+ * @brief     driver sen5x store source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_store.h"
+
+/**
+ * @brief     get the validity flags of raw words
+ * @param[in] *word pointer to 8 raw words
+ * @return    flags
+ * @note      none
+ */
+static uint8_t a_sen5x_store_flag(const uint16_t *word)
+{
+    uint8_t flag;
+
+    flag = 0;                                                                          /* init 0 */
+    if ((word[SEN5X_STORE_WORD_PM1P0] != 0xFFFFU) && (word[SEN5X_STORE_WORD_PM2P5] != 0xFFFFU) &&
+        (word[SEN5X_STORE_WORD_PM4P0] != 0xFFFFU) && (word[SEN5X_STORE_WORD_PM10] != 0xFFFFU))        /* check pm */
+    {
+        flag |= SEN5X_STORE_FLAG_PM_VALID;                                             /* pm valid */
+    }
+    if (word[SEN5X_STORE_WORD_HUMIDITY] != 0x7FFFU)                                    /* check humidity */
+    {
+        flag |= SEN5X_STORE_FLAG_HUMIDITY_VALID;                                       /* humidity valid */
+    }
+    if (word[SEN5X_STORE_WORD_TEMPERATURE] != 0x7FFFU)                                 /* check temperature */
+    {
+        flag |= SEN5X_STORE_FLAG_TEMPERATURE_VALID;                                    /* temperature valid */
+    }
+    if (word[SEN5X_STORE_WORD_VOC] != 0x7FFFU)                                         /* check voc */
+    {
+        flag |= SEN5X_STORE_FLAG_VOC_VALID;                                            /* voc valid */
+    }
+    if (word[SEN5X_STORE_WORD_NOX] != 0x7FFFU)                                         /* check nox */
+    {
+        flag |= SEN5X_STORE_FLAG_NOX_VALID;                                            /* nox valid */
+    }
+
+    return flag;                                                                       /* return the flags */
+}
+
+/**
+ * @brief     get the physical block of a logical block
+ * @param[in] *store pointer to a store structure
+ * @param[in] k block counted from the oldest
+ * @return    physical block
+ * @note      none
+ */
+static uint32_t a_sen5x_store_block(sen5x_store_t *store, uint32_t k)
+{
+    return (store->head + store->blocks - store->filled + 1 + k) % store->blocks;        /* oldest + k */
+}
+
+/**
+ * @brief     find the first slot at or after an offset
+ * @param[in] *offset pointer to the offset column of a block
+ * @param[in] n used slots
+ * @param[in] anchor_ms block anchor
+ * @param[in] ms timestamp
+ * @return    slot
+ * @note      returns n when every slot is before ms
+ */
+static uint32_t a_sen5x_store_lower_bound(const uint16_t *offset, uint32_t n, uint64_t anchor_ms, uint64_t ms)
+{
+    uint32_t lo;
+    uint32_t hi;
+    uint32_t mid;
+    uint16_t target;
+
+    if (ms <= anchor_ms)                              /* before the block */
+    {
+        return 0;                                     /* first slot */
+    }
+    if ((ms - anchor_ms) > 0xFFFFU)                   /* after the block */
+    {
+        return n;                                     /* no slot */
+    }
+    target = (uint16_t)(ms - anchor_ms);              /* offset target */
+    lo = 0;                                           /* init lo */
+    hi = n;                                           /* init hi */
+    while (lo < hi)                                   /* binary search */
+    {
+        mid = (lo + hi) / 2;                          /* middle */
+        if (offset[mid] < target)                     /* check offset */
+        {
+            lo = mid + 1;                             /* search upper half */
+        }
+        else
+        {
+            hi = mid;                                 /* search lower half */
+        }
+    }
+
+    return lo;                                        /* return the slot */
+}
+
+/**
+ * @brief      convert sen55 data to a sample
+ * @param[in]  *data pointer to a sen55 data structure
+ * @param[in]  timestamp_ms timestamp in ms
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 data or sample is NULL
+ * @note       none
+ */
+uint8_t sen5x_store_sample_from_sen55(const sen55_data_t *data, uint64_t timestamp_ms, sen5x_store_sample_t *sample)
+{
+    if ((data == NULL) || (sample == NULL))                                                                  /* check the params */
+    {
+        return 2;                                                                                            /* return error */
+    }
+
+    sample->timestamp_ms = timestamp_ms;                                                                     /* set the timestamp */
+    sample->word[SEN5X_STORE_WORD_PM1P0] = data->pm1p0_raw;                                                  /* copy pm1.0 */
+    sample->word[SEN5X_STORE_WORD_PM2P5] = data->pm2p5_raw;                                                  /* copy pm2.5 */
+    sample->word[SEN5X_STORE_WORD_PM4P0] = data->pm4p0_raw;                                                  /* copy pm4.0 */
+    sample->word[SEN5X_STORE_WORD_PM10] = data->pm10_raw;                                                    /* copy pm10 */
+    sample->word[SEN5X_STORE_WORD_HUMIDITY] = (uint16_t)data->compensated_ambient_humidity_raw;              /* copy humidity */
+    sample->word[SEN5X_STORE_WORD_TEMPERATURE] = (uint16_t)data->compensated_ambient_temperature_raw;        /* copy temperature */
+    sample->word[SEN5X_STORE_WORD_VOC] = (uint16_t)data->voc_raw;                                            /* copy voc */
+    sample->word[SEN5X_STORE_WORD_NOX] = (uint16_t)data->nox_raw;                                            /* copy nox */
+
+    return 0;                                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      convert sen54 data to a sample
+ * @param[in]  *data pointer to a sen54 data structure
+ * @param[in]  timestamp_ms timestamp in ms
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 data or sample is NULL
+ * @note       nox is stored as the invalid word 0x7FFF
+ */
+uint8_t sen5x_store_sample_from_sen54(const sen54_data_t *data, uint64_t timestamp_ms, sen5x_store_sample_t *sample)
+{
+    if ((data == NULL) || (sample == NULL))                                                                  /* check the params */
+    {
+        return 2;                                                                                            /* return error */
+    }
+
+    sample->timestamp_ms = timestamp_ms;                                                                     /* set the timestamp */
+    sample->word[SEN5X_STORE_WORD_PM1P0] = data->pm1p0_raw;                                                  /* copy pm1.0 */
+    sample->word[SEN5X_STORE_WORD_PM2P5] = data->pm2p5_raw;                                                  /* copy pm2.5 */
+    sample->word[SEN5X_STORE_WORD_PM4P0] = data->pm4p0_raw;                                                  /* copy pm4.0 */
+    sample->word[SEN5X_STORE_WORD_PM10] = data->pm10_raw;                                                    /* copy pm10 */
+    sample->word[SEN5X_STORE_WORD_HUMIDITY] = (uint16_t)data->compensated_ambient_humidity_raw;              /* copy humidity */
+    sample->word[SEN5X_STORE_WORD_TEMPERATURE] = (uint16_t)data->compensated_ambient_temperature_raw;        /* copy temperature */
+    sample->word[SEN5X_STORE_WORD_VOC] = (uint16_t)data->voc_raw;                                            /* copy voc */
+    sample->word[SEN5X_STORE_WORD_NOX] = 0x7FFFU;                                                            /* no nox */
+
+    return 0;                                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      convert sen50 data to a sample
+ * @param[in]  *data pointer to a sen50 data structure
+ * @param[in]  timestamp_ms timestamp in ms
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 data or sample is NULL
+ * @note       humidity, temperature, voc and nox are stored as the invalid word 0x7FFF
+ */
+uint8_t sen5x_store_sample_from_sen50(const sen50_data_t *data, uint64_t timestamp_ms, sen5x_store_sample_t *sample)
+{
+    if ((data == NULL) || (sample == NULL))                         /* check the params */
+    {
+        return 2;                                                   /* return error */
+    }
+
+    sample->timestamp_ms = timestamp_ms;                            /* set the timestamp */
+    sample->word[SEN5X_STORE_WORD_PM1P0] = data->pm1p0_raw;         /* copy pm1.0 */
+    sample->word[SEN5X_STORE_WORD_PM2P5] = data->pm2p5_raw;         /* copy pm2.5 */
+    sample->word[SEN5X_STORE_WORD_PM4P0] = data->pm4p0_raw;         /* copy pm4.0 */
+    sample->word[SEN5X_STORE_WORD_PM10] = data->pm10_raw;           /* copy pm10 */
+    sample->word[SEN5X_STORE_WORD_HUMIDITY] = 0x7FFFU;              /* no humidity */
+    sample->word[SEN5X_STORE_WORD_TEMPERATURE] = 0x7FFFU;           /* no temperature */
+    sample->word[SEN5X_STORE_WORD_VOC] = 0x7FFFU;                   /* no voc */
+    sample->word[SEN5X_STORE_WORD_NOX] = 0x7FFFU;                   /* no nox */
+
+    return 0;                                                       /* success return 0 */
+}
+
+/**
+ * @brief      convert a sample to sen55 data
+ * @param[in]  *sample pointer to a sample structure
+ * @param[out] *data pointer to a sen55 data structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 sample or data is NULL
+ * @note       the floats are the same as sen55_read returns
+ */
+uint8_t sen5x_store_sample_to_sen55(const sen5x_store_sample_t *sample, sen55_data_t *data)
+{
+    uint8_t flag;
+
+    if ((sample == NULL) || (data == NULL))                                                                  /* check the params */
+    {
+        return 2;                                                                                            /* return error */
+    }
+
+    flag = a_sen5x_store_flag(sample->word);                                                                 /* get the flags */
+    data->pm1p0_raw = sample->word[SEN5X_STORE_WORD_PM1P0];                                                  /* copy pm1.0 */
+    data->pm2p5_raw = sample->word[SEN5X_STORE_WORD_PM2P5];                                                  /* copy pm2.5 */
+    data->pm4p0_raw = sample->word[SEN5X_STORE_WORD_PM4P0];                                                  /* copy pm4.0 */
+    data->pm10_raw = sample->word[SEN5X_STORE_WORD_PM10];                                                    /* copy pm10 */
+    data->compensated_ambient_humidity_raw = (int16_t)sample->word[SEN5X_STORE_WORD_HUMIDITY];              /* copy humidity */
+    data->compensated_ambient_temperature_raw = (int16_t)sample->word[SEN5X_STORE_WORD_TEMPERATURE];        /* copy temperature */
+    data->voc_raw = (int16_t)sample->word[SEN5X_STORE_WORD_VOC];                                            /* copy voc */
+    data->nox_raw = (int16_t)sample->word[SEN5X_STORE_WORD_NOX];                                            /* copy nox */
+    if ((flag & SEN5X_STORE_FLAG_PM_VALID) != 0)                                                             /* check pm */
+    {
+        data->pm1p0_ug_m3 = (float)(data->pm1p0_raw) / 10.0f;                                                /* convert pm1.0 */
+        data->pm2p5_ug_m3 = (float)(data->pm2p5_raw) / 10.0f;                                                /* convert pm2.5 */
+        data->pm4p0_ug_m3 = (float)(data->pm4p0_raw) / 10.0f;                                                /* convert pm4.0 */
+        data->pm10_ug_m3 = (float)(data->pm10_raw) / 10.0f;                                                  /* convert pm10 */
+        data->pm_valid = 1;                                                                                  /* set valid */
+    }
+    else
+    {
+        data->pm1p0_ug_m3 = NAN;                                                                             /* set nan */
+        data->pm2p5_ug_m3 = NAN;                                                                             /* set nan */
+        data->pm4p0_ug_m3 = NAN;                                                                             /* set nan */
+        data->pm10_ug_m3 = NAN;                                                                              /* set nan */
+        data->pm_valid = 0;                                                                                  /* set invalid */
+    }
+    data->compensated_ambient_humidity_percentage = ((flag & SEN5X_STORE_FLAG_HUMIDITY_VALID) != 0) ?
+        ((float)(data->compensated_ambient_humidity_raw) / 100.0f) : NAN;                                    /* convert humidity */
+    data->compensated_ambient_temperature_degree = ((flag & SEN5X_STORE_FLAG_TEMPERATURE_VALID) != 0) ?
+        ((float)(data->compensated_ambient_temperature_raw) / 200.0f) : NAN;                                 /* convert temperature */
+    data->voc_index = ((flag & SEN5X_STORE_FLAG_VOC_VALID) != 0) ? ((float)(data->voc_raw) / 10.0f) : NAN;  /* convert voc */
+    data->nox_index = ((flag & SEN5X_STORE_FLAG_NOX_VALID) != 0) ? ((float)(data->nox_raw) / 10.0f) : NAN;  /* convert nox */
+
+    return 0;                                                                                                /* success return 0 */
+}
+
+/**
+ * @brief      get the validity flags of a sample
+ * @param[in]  *sample pointer to a sample structure
+ * @param[out] *flag pointer to a flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sample or flag is NULL
+ * @note       the flags are derived from the invalid words 0xFFFF and 0x7FFF
+ */
+uint8_t sen5x_store_sample_get_flag(const sen5x_store_sample_t *sample, uint8_t *flag)
+{
+    if ((sample == NULL) || (flag == NULL))              /* check the params */
+    {
+        return 2;                                        /* return error */
+    }
+
+    *flag = a_sen5x_store_flag(sample->word);            /* get the flags */
+
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief         pack a sample into a record
+ * @param[in]     *sample pointer to a sample structure
+ * @param[in,out] *prev_ms pointer to the unpacked timestamp of the previous record
+ * @param[out]    *buf pointer to a SEN5X_STORE_RECORD_LENGTH bytes buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 sample, prev_ms or buf is NULL
+ *                - 4 timestamp is older than prev_ms
+ * @note          the record is 8 little endian words, a little endian delta and a flag byte,
+ *                the delta is in ms below 65536 ms, in seconds below 65536 s, else the resync flag is set,
+ *                a seconds delta drops up to 999 ms, prev_ms is set to the timestamp unpack_record returns
+ *                so the dropped ms are carried into the next delta and the error doesn't accumulate
+ */
+uint8_t sen5x_store_pack_record(const sen5x_store_sample_t *sample, uint64_t *prev_ms, uint8_t *buf)
+{
+    uint8_t i;
+    uint8_t flag;
+    uint16_t delta;
+    uint64_t diff;
+
+    if ((sample == NULL) || (prev_ms == NULL) || (buf == NULL))          /* check the params */
+    {
+        return 2;                                                        /* return error */
+    }
+    if (sample->timestamp_ms < (*prev_ms))                               /* check the timestamp */
+    {
+        return 4;                                                        /* return error */
+    }
+
+    flag = a_sen5x_store_flag(sample->word);                             /* get the flags */
+    diff = sample->timestamp_ms - (*prev_ms);                            /* get the delta */
+    if (diff <= 0xFFFFU)                                                 /* ms delta */
+    {
+        delta = (uint16_t)diff;                                          /* set the delta */
+        *prev_ms += delta;                                               /* exact timestamp */
+    }
+    else if ((diff / 1000) <= 0xFFFFU)                                   /* second delta */
+    {
+        delta = (uint16_t)(diff / 1000);                                 /* set the delta */
+        flag |= SEN5X_STORE_FLAG_DELTA_SECOND;                           /* set the unit */
+        *prev_ms += (uint64_t)delta * 1000;                              /* carry the dropped ms */
+    }
+    else                                                                 /* overflow */
+    {
+        delta = 0xFFFFU;                                                 /* set the max delta */
+        flag |= SEN5X_STORE_FLAG_DELTA_SECOND | SEN5X_STORE_FLAG_RESYNC; /* set resync */
+        *prev_ms += (uint64_t)delta * 1000;                              /* lower bound */
+    }
+    for (i = 0; i < 8; i++)                                              /* copy all words */
+    {
+        buf[i * 2 + 0] = (uint8_t)((sample->word[i] >> 0) & 0xFF);       /* set lsb */
+        buf[i * 2 + 1] = (uint8_t)((sample->word[i] >> 8) & 0xFF);       /* set msb */
+    }
+    buf[16] = (uint8_t)((delta >> 0) & 0xFF);                            /* set delta lsb */
+    buf[17] = (uint8_t)((delta >> 8) & 0xFF);                            /* set delta msb */
+    buf[18] = flag;                                                      /* set the flags */
+
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief         unpack a record into a sample
+ * @param[in]     *buf pointer to a SEN5X_STORE_RECORD_LENGTH bytes buffer
+ * @param[in,out] *prev_ms pointer to the previous record timestamp
+ * @param[out]    *sample pointer to a sample structure
+ * @param[out]    *flag pointer to a flag buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 buf, prev_ms, sample or flag is NULL
+ * @note          when the resync flag is set the timestamp is only a lower bound
+ */
+uint8_t sen5x_store_unpack_record(const uint8_t *buf, uint64_t *prev_ms, sen5x_store_sample_t *sample, uint8_t *flag)
+{
+    uint8_t i;
+    uint64_t delta;
+
+    if ((buf == NULL) || (prev_ms == NULL) || (sample == NULL) || (flag == NULL))                  /* check the params */
+    {
+        return 2;                                                                                  /* return error */
+    }
+
+    for (i = 0; i < 8; i++)                                                                        /* copy all words */
+    {
+        sample->word[i] = (uint16_t)(((uint16_t)(buf[i * 2 + 1]) << 8) | ((uint16_t)(buf[i * 2 + 0]) << 0));  /* get the word */
+    }
+    delta = (uint64_t)(((uint16_t)(buf[17]) << 8) | ((uint16_t)(buf[16]) << 0));                   /* get the delta */
+    *flag = buf[18];                                                                               /* get the flags */
+    if (((*flag) & SEN5X_STORE_FLAG_DELTA_SECOND) != 0)                                            /* second delta */
+    {
+        delta *= 1000;                                                                             /* convert to ms */
+    }
+    *prev_ms += delta;                                                                             /* update the timestamp */
+    sample->timestamp_ms = *prev_ms;                                                               /* set the timestamp */
+
+    return 0;                                                                                      /* success return 0 */
+}
+
+/**
+ * @brief     init the columnar ring store
+ * @param[in] *store pointer to a store structure
+ * @param[in] *buffer pointer to an 8 bytes aligned buffer
+ * @param[in] size buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 2 store or buffer is NULL
+ *            - 4 buffer is not aligned or smaller than one block
+ * @note      use SEN5X_STORE_BUFFER_SIZE to size the buffer
+ */
+uint8_t sen5x_store_init(sen5x_store_t *store, void *buffer, uint32_t size)
+{
+    uint8_t i;
+    uint32_t blocks;
+
+    if ((store == NULL) || (buffer == NULL))                                                        /* check the params */
+    {
+        return 2;                                                                                   /* return error */
+    }
+    blocks = size / SEN5X_STORE_BLOCK_SIZE;                                                         /* get the block count */
+    if ((blocks == 0) || ((((size_t)buffer) & 0x07) != 0))                                          /* check the buffer */
+    {
+        return 4;                                                                                   /* return error */
+    }
+
+    store->anchor_ms = (uint64_t *)buffer;                                                          /* anchor column */
+    store->offset_ms = (uint16_t *)(void *)(store->anchor_ms + blocks);                             /* offset column */
+    for (i = 0; i < 8; i++)                                                                         /* word columns */
+    {
+        store->word[i] = store->offset_ms + (uint32_t)(i + 1) * blocks * SEN5X_STORE_BLOCK_SLOTS;   /* set the column */
+    }
+    store->used = (uint8_t *)(void *)(store->word[7] + blocks * SEN5X_STORE_BLOCK_SLOTS);           /* used column */
+    memset(store->used, 0, blocks);                                                                 /* clear the used slots */
+    store->blocks = blocks;                                                                         /* set the block count */
+    store->head = 0;                                                                                /* init 0 */
+    store->filled = 0;                                                                              /* init 0 */
+    store->samples = 0;                                                                             /* init 0 */
+    store->last_ms = 0;                                                                             /* init 0 */
+    store->inited = 1;                                                                              /* flag finish initialization */
+
+    return 0;                                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     append a sample
+ * @param[in] *store pointer to a store structure
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 store or sample is NULL
+ *            - 3 store is not initialized
+ *            - 4 timestamp is older than the latest sample
+ * @note      a full store drops its oldest block, a block is closed early
+ *            when the sample is more than 65535 ms after the block anchor
+ */
+uint8_t sen5x_store_append(sen5x_store_t *store, const sen5x_store_sample_t *sample)
+{
+    uint8_t i;
+    uint32_t head;
+    uint32_t slot;
+
+    if ((store == NULL) || (sample == NULL))                                                                   /* check the params */
+    {
+        return 2;                                                                                              /* return error */
+    }
+    if (store->inited != 1)                                                                                    /* check the initialization */
+    {
+        return 3;                                                                                              /* return error */
+    }
+    if ((store->filled != 0) && (sample->timestamp_ms < store->last_ms))                                       /* check the timestamp */
+    {
+        return 4;                                                                                              /* return error */
+    }
+
+    head = store->head;                                                                                        /* get the head */
+    if (store->filled == 0)                                                                                    /* first sample */
+    {
+        store->filled = 1;                                                                                     /* one block */
+        store->anchor_ms[head] = sample->timestamp_ms;                                                         /* set the anchor */
+        store->used[head] = 0;                                                                                 /* no sample */
+    }
+    else if ((store->used[head] == SEN5X_STORE_BLOCK_SLOTS) ||
+             ((sample->timestamp_ms - store->anchor_ms[head]) > 0xFFFFU))                                      /* close the block */
+    {
+        head = (head + 1) % store->blocks;                                                                     /* next block */
+        if (store->filled < store->blocks)                                                                     /* check full */
+        {
+            store->filled++;                                                                                   /* one more block */
+        }
+        else
+        {
+            store->samples -= store->used[head];                                                               /* drop the oldest block */
+        }
+        store->head = head;                                                                                    /* set the head */
+        store->anchor_ms[head] = sample->timestamp_ms;                                                         /* set the anchor */
+        store->used[head] = 0;                                                                                 /* no sample */
+    }
+    slot = head * SEN5X_STORE_BLOCK_SLOTS + store->used[head];                                                 /* get the slot */
+    store->offset_ms[slot] = (uint16_t)(sample->timestamp_ms - store->anchor_ms[head]);                        /* set the offset */
+    for (i = 0; i < 8; i++)                                                                                    /* copy all words */
+    {
+        store->word[i][slot] = sample->word[i];                                                                /* set the word */
+    }
+    store->used[head]++;                                                                                       /* one more slot */
+    store->samples++;                                                                                          /* one more sample */
+    store->last_ms = sample->timestamp_ms;                                                                     /* set the last timestamp */
+
+    return 0;                                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      get the latest sample
+ * @param[in]  *store pointer to a store structure
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 store or sample is NULL
+ *             - 3 store is not initialized
+ *             - 4 store is empty
+ * @note       none
+ */
+uint8_t sen5x_store_latest(sen5x_store_t *store, sen5x_store_sample_t *sample)
+{
+    uint8_t i;
+    uint32_t slot;
+
+    if ((store == NULL) || (sample == NULL))                                                      /* check the params */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (store->inited != 1)                                                                       /* check the initialization */
+    {
+        return 3;                                                                                 /* return error */
+    }
+    if (store->filled == 0)                                                                       /* check empty */
+    {
+        return 4;                                                                                 /* return error */
+    }
+
+    slot = store->head * SEN5X_STORE_BLOCK_SLOTS + store->used[store->head] - 1;                  /* get the slot */
+    sample->timestamp_ms = store->anchor_ms[store->head] + store->offset_ms[slot];                /* get the timestamp */
+    for (i = 0; i < 8; i++)                                                                       /* copy all words */
+    {
+        sample->word[i] = store->word[i][slot];                                                   /* get the word */
+    }
+
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      get the stored sample count
+ * @param[in]  *store pointer to a store structure
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 store or count is NULL
+ *             - 3 store is not initialized
+ * @note       none
+ */
+uint8_t sen5x_store_count(sen5x_store_t *store, uint32_t *count)
+{
+    if ((store == NULL) || (count == NULL))        /* check the params */
+    {
+        return 2;                                  /* return error */
+    }
+    if (store->inited != 1)                        /* check the initialization */
+    {
+        return 3;                                  /* return error */
+    }
+
+    *count = store->samples;                       /* get the count */
+
+    return 0;                                      /* success return 0 */
+}
+
+/**
+ * @brief      begin a range scan
+ * @param[in]  *store pointer to a store structure
+ * @param[in]  start_ms first timestamp
+ * @param[in]  end_ms last timestamp
+ * @param[out] *iterator pointer to an iterator structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 store or iterator is NULL
+ *             - 3 store is not initialized
+ * @note       the range is inclusive, the first block is found by binary search, equal timestamps may
+ *             span blocks so the scan starts one block before the first anchor at or after start
+ */
+uint8_t sen5x_store_scan_begin(sen5x_store_t *store, uint64_t start_ms, uint64_t end_ms, sen5x_store_iterator_t *iterator)
+{
+    uint32_t lo;
+    uint32_t hi;
+    uint32_t mid;
+
+    if ((store == NULL) || (iterator == NULL))                                              /* check the params */
+    {
+        return 2;                                                                           /* return error */
+    }
+    if (store->inited != 1)                                                                 /* check the initialization */
+    {
+        return 3;                                                                           /* return error */
+    }
+
+    lo = 0;                                                                                 /* init lo */
+    hi = store->filled;                                                                     /* init hi */
+    while (lo < hi)                                                                         /* find the first block at or after start */
+    {
+        mid = (lo + hi) / 2;                                                                /* middle */
+        if (store->anchor_ms[a_sen5x_store_block(store, mid)] < start_ms)                   /* check the anchor */
+        {
+            lo = mid + 1;                                                                   /* search upper half */
+        }
+        else
+        {
+            hi = mid;                                                                       /* search lower half */
+        }
+    }
+    iterator->start_ms = start_ms;                                                          /* set the start */
+    iterator->end_ms = end_ms;                                                              /* set the end */
+    iterator->block = (lo > 0) ? (lo - 1) : 0;                                              /* the block before may end at start */
+
+    return 0;                                                                               /* success return 0 */
+}
+
+/**
+ * @brief         get the next span of a range scan
+ * @param[in]     *store pointer to a store structure
+ * @param[in,out] *iterator pointer to an iterator structure
+ * @param[out]    *span pointer to a span structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 store, iterator or span is NULL
+ *                - 3 store is not initialized
+ *                - 4 no more data
+ * @note          the span points into the store, appending may overwrite it
+ */
+uint8_t sen5x_store_scan_next(sen5x_store_t *store, sen5x_store_iterator_t *iterator, sen5x_store_span_t *span)
+{
+    uint8_t i;
+    uint32_t block;
+    uint32_t base;
+    uint32_t first;
+    uint32_t last;
+
+    if ((store == NULL) || (iterator == NULL) || (span == NULL))                                   /* check the params */
+    {
+        return 2;                                                                                  /* return error */
+    }
+    if (store->inited != 1)                                                                        /* check the initialization */
+    {
+        return 3;                                                                                  /* return error */
+    }
+
+    while (iterator->block < store->filled)                                                        /* run all blocks */
+    {
+        block = a_sen5x_store_block(store, iterator->block);                                       /* get the block */
+        if (store->anchor_ms[block] > iterator->end_ms)                                            /* after the range */
+        {
+            iterator->block = store->filled;                                                       /* finish */
+
+            break;                                                                                 /* break */
+        }
+        iterator->block++;                                                                         /* next block */
+        base = block * SEN5X_STORE_BLOCK_SLOTS;                                                    /* block base */
+        first = a_sen5x_store_lower_bound(&store->offset_ms[base], store->used[block],
+                                          store->anchor_ms[block], iterator->start_ms);            /* first slot */
+        if (iterator->end_ms == UINT64_MAX)                                                        /* open range */
+        {
+            last = store->used[block];                                                             /* all slots */
+        }
+        else
+        {
+            last = a_sen5x_store_lower_bound(&store->offset_ms[base], store->used[block],
+                                             store->anchor_ms[block], iterator->end_ms + 1);       /* after the last slot */
+        }
+        if (first < last)                                                                          /* check the span */
+        {
+            span->anchor_ms = store->anchor_ms[block];                                             /* set the anchor */
+            span->offset_ms = &store->offset_ms[base + first];                                     /* set the offset slice */
+            for (i = 0; i < 8; i++)                                                                /* set all word slices */
+            {
+                span->word[i] = &store->word[i][base + first];                                     /* set the word slice */
+            }
+            span->count = last - first;                                                            /* set the count */
+
+            return 0;                                                                              /* success return 0 */
+        }
+    }
+
+    return 4;                                                                                      /* no more data */
+}
@@ -0,0 +1,340 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_store.h
+ * @brief     driver sen5x store header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_SEN5X_STORE_H
+#define DRIVER_SEN5X_STORE_H
+
+#include "driver_sen5x.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup sen5x_store_driver sen5x store driver function
+ * @brief    sen5x store driver modules
+ * @ingroup  sen5x_driver
+ * @{
+ */
+
+/**
+ * @brief sen5x store definition
+ */
+#define SEN5X_STORE_RECORD_LENGTH        19        /**< packed record length */
+#define SEN5X_STORE_BLOCK_SLOTS          64        /**< samples per store block */
+#define SEN5X_STORE_BLOCK_SIZE           (8 + 1 + 9 * 2 * SEN5X_STORE_BLOCK_SLOTS)        /**< bytes per store block */
+
+/**
+ * @brief     store buffer size definition
+ * @param[in] blocks block count
+ * @note      the buffer must be 8 bytes aligned
+ */
+#define SEN5X_STORE_BUFFER_SIZE(blocks)        ((blocks) * SEN5X_STORE_BLOCK_SIZE)
+
+/**
+ * @brief sen5x store word enumeration definition
+ */
+typedef enum
+{
+    SEN5X_STORE_WORD_PM1P0       = 0x00,        /**< mass concentration pm1.0 raw */
+    SEN5X_STORE_WORD_PM2P5       = 0x01,        /**< mass concentration pm2.5 raw */
+    SEN5X_STORE_WORD_PM4P0       = 0x02,        /**< mass concentration pm4.0 raw */
+    SEN5X_STORE_WORD_PM10        = 0x03,        /**< mass concentration pm10 raw */
+    SEN5X_STORE_WORD_HUMIDITY    = 0x04,        /**< compensated ambient humidity raw */
+    SEN5X_STORE_WORD_TEMPERATURE = 0x05,        /**< compensated ambient temperature raw */
+    SEN5X_STORE_WORD_VOC         = 0x06,        /**< voc raw */
+    SEN5X_STORE_WORD_NOX         = 0x07,        /**< nox raw */
+} sen5x_store_word_t;
+
+/**
+ * @brief sen5x store record flag enumeration definition
+ */
+typedef enum
+{
+    SEN5X_STORE_FLAG_PM_VALID          = (1 << 0),        /**< pm valid */
+    SEN5X_STORE_FLAG_HUMIDITY_VALID    = (1 << 1),        /**< humidity valid */
+    SEN5X_STORE_FLAG_TEMPERATURE_VALID = (1 << 2),        /**< temperature valid */
+    SEN5X_STORE_FLAG_VOC_VALID         = (1 << 3),        /**< voc valid */
+    SEN5X_STORE_FLAG_NOX_VALID         = (1 << 4),        /**< nox valid */
+    SEN5X_STORE_FLAG_DELTA_SECOND      = (1 << 6),        /**< the delta is in seconds */
+    SEN5X_STORE_FLAG_RESYNC            = (1 << 7),        /**< the delta overflowed, the time must be resynced */
+} sen5x_store_flag_t;
+
+/**
+ * @brief sen5x store sample structure definition
+ */
+typedef struct sen5x_store_sample_s
+{
+    uint64_t timestamp_ms;        /**< timestamp in ms */
+    uint16_t word[8];             /**< raw words in read measured values order */
+} sen5x_store_sample_t;
+
+/**
+ * @brief sen5x store structure definition
+ */
+typedef struct sen5x_store_s
+{
+    uint64_t *anchor_ms;         /**< block anchor timestamp column */
+    uint8_t *used;               /**< block used slots column */
+    uint16_t *offset_ms;         /**< sample offset from the block anchor column */
+    uint16_t *word[8];           /**< raw word columns */
+    uint32_t blocks;             /**< block count */
+    uint32_t head;               /**< current block */
+    uint32_t filled;             /**< blocks in use */
+    uint32_t samples;            /**< stored samples */
+    uint64_t last_ms;            /**< last timestamp */
+    uint8_t inited;              /**< inited flag */
+} sen5x_store_t;
+
+/**
+ * @brief sen5x store span structure definition
+ */
+typedef struct sen5x_store_span_s
+{
+    uint64_t anchor_ms;                /**< anchor timestamp, sample time is anchor_ms + offset_ms[i] */
+    const uint16_t *offset_ms;         /**< offset column slice */
+    const uint16_t *word[8];           /**< raw word column slices */
+    uint32_t count;                    /**< samples in the span */
+} sen5x_store_span_t;
+
+/**
+ * @brief sen5x store iterator structure definition
+ */
+typedef struct sen5x_store_iterator_s
+{
+    uint64_t start_ms;        /**< first timestamp */
+    uint64_t end_ms;          /**< last timestamp */
+    uint32_t block;           /**< next block counted from the oldest */
+} sen5x_store_iterator_t;
+
+/**
+ * @defgroup sen5x_store_record_driver sen5x store record driver function
+ * @brief    sen5x store record driver modules
+ * @ingroup  sen5x_store_driver
+ * @{
+ */
+
+/**
+ * @brief      convert sen55 data to a sample
+ * @param[in]  *data pointer to a sen55 data structure
+ * @param[in]  timestamp_ms timestamp in ms
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 data or sample is NULL
+ * @note       none
+ */
+uint8_t sen5x_store_sample_from_sen55(const sen55_data_t *data, uint64_t timestamp_ms, sen5x_store_sample_t *sample);
+
+/**
+ * @brief      convert sen54 data to a sample
+ * @param[in]  *data pointer to a sen54 data structure
+ * @param[in]  timestamp_ms timestamp in ms
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 data or sample is NULL
+ * @note       nox is stored as the invalid word 0x7FFF
+ */
+uint8_t sen5x_store_sample_from_sen54(const sen54_data_t *data, uint64_t timestamp_ms, sen5x_store_sample_t *sample);
+
+/**
+ * @brief      convert sen50 data to a sample
+ * @param[in]  *data pointer to a sen50 data structure
+ * @param[in]  timestamp_ms timestamp in ms
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 data or sample is NULL
+ * @note       humidity, temperature, voc and nox are stored as the invalid word 0x7FFF
+ */
+uint8_t sen5x_store_sample_from_sen50(const sen50_data_t *data, uint64_t timestamp_ms, sen5x_store_sample_t *sample);
+
+/**
+ * @brief      convert a sample to sen55 data
+ * @param[in]  *sample pointer to a sample structure
+ * @param[out] *data pointer to a sen55 data structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 sample or data is NULL
+ * @note       the floats are the same as sen55_read returns
+ */
+uint8_t sen5x_store_sample_to_sen55(const sen5x_store_sample_t *sample, sen55_data_t *data);
+
+/**
+ * @brief      get the validity flags of a sample
+ * @param[in]  *sample pointer to a sample structure
+ * @param[out] *flag pointer to a flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 sample or flag is NULL
+ * @note       the flags are derived from the invalid words 0xFFFF and 0x7FFF
+ */
+uint8_t sen5x_store_sample_get_flag(const sen5x_store_sample_t *sample, uint8_t *flag);
+
+/**
+ * @brief         pack a sample into a record
+ * @param[in]     *sample pointer to a sample structure
+ * @param[in,out] *prev_ms pointer to the unpacked timestamp of the previous record
+ * @param[out]    *buf pointer to a SEN5X_STORE_RECORD_LENGTH bytes buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 sample, prev_ms or buf is NULL
+ *                - 4 timestamp is older than prev_ms
+ * @note          the record is 8 little endian words, a little endian delta and a flag byte,
+ *                the delta is in ms below 65536 ms, in seconds below 65536 s, else the resync flag is set,
+ *                a seconds delta drops up to 999 ms, prev_ms is set to the timestamp unpack_record returns
+ *                so the dropped ms are carried into the next delta and the error doesn't accumulate
+ */
+uint8_t sen5x_store_pack_record(const sen5x_store_sample_t *sample, uint64_t *prev_ms, uint8_t *buf);
+
+/**
+ * @brief         unpack a record into a sample
+ * @param[in]     *buf pointer to a SEN5X_STORE_RECORD_LENGTH bytes buffer
+ * @param[in,out] *prev_ms pointer to the previous record timestamp
+ * @param[out]    *sample pointer to a sample structure
+ * @param[out]    *flag pointer to a flag buffer
+ * @return        status code
+ *                - 0 success
+ *                - 2 buf, prev_ms, sample or flag is NULL
+ * @note          when the resync flag is set the timestamp is only a lower bound
+ */
+uint8_t sen5x_store_unpack_record(const uint8_t *buf, uint64_t *prev_ms, sen5x_store_sample_t *sample, uint8_t *flag);
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup sen5x_store_ring_driver sen5x store ring driver function
+ * @brief    sen5x store ring driver modules
+ * @ingroup  sen5x_store_driver
+ * @{
+ */
+
+/**
+ * @brief     init the columnar ring store
+ * @param[in] *store pointer to a store structure
+ * @param[in] *buffer pointer to an 8 bytes aligned buffer
+ * @param[in] size buffer size
+ * @return    status code
+ *            - 0 success
+ *            - 2 store or buffer is NULL
+ *            - 4 buffer is not aligned or smaller than one block
+ * @note      use SEN5X_STORE_BUFFER_SIZE to size the buffer
+ */
+uint8_t sen5x_store_init(sen5x_store_t *store, void *buffer, uint32_t size);
+
+/**
+ * @brief     append a sample
+ * @param[in] *store pointer to a store structure
+ * @param[in] *sample pointer to a sample structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 store or sample is NULL
+ *            - 3 store is not initialized
+ *            - 4 timestamp is older than the latest sample
+ * @note      a full store drops its oldest block, a block is closed early
+ *            when the sample is more than 65535 ms after the block anchor
+ */
+uint8_t sen5x_store_append(sen5x_store_t *store, const sen5x_store_sample_t *sample);
+
+/**
+ * @brief      get the latest sample
+ * @param[in]  *store pointer to a store structure
+ * @param[out] *sample pointer to a sample structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 store or sample is NULL
+ *             - 3 store is not initialized
+ *             - 4 store is empty
+ * @note       none
+ */
+uint8_t sen5x_store_latest(sen5x_store_t *store, sen5x_store_sample_t *sample);
+
+/**
+ * @brief      get the stored sample count
+ * @param[in]  *store pointer to a store structure
+ * @param[out] *count pointer to a count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 store or count is NULL
+ *             - 3 store is not initialized
+ * @note       none
+ */
+uint8_t sen5x_store_count(sen5x_store_t *store, uint32_t *count);
+
+/**
+ * @brief      begin a range scan
+ * @param[in]  *store pointer to a store structure
+ * @param[in]  start_ms first timestamp
+ * @param[in]  end_ms last timestamp
+ * @param[out] *iterator pointer to an iterator structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 store or iterator is NULL
+ *             - 3 store is not initialized
+ * @note       the range is inclusive, the first block is found by binary search
+ */
+uint8_t sen5x_store_scan_begin(sen5x_store_t *store, uint64_t start_ms, uint64_t end_ms, sen5x_store_iterator_t *iterator);
+
+/**
+ * @brief         get the next span of a range scan
+ * @param[in]     *store pointer to a store structure
+ * @param[in,out] *iterator pointer to an iterator structure
+ * @param[out]    *span pointer to a span structure
+ * @return        status code
+ *                - 0 success
+ *                - 2 store, iterator or span is NULL
+ *                - 3 store is not initialized
+ *                - 4 no more data
+ * @note          the span points into the store, appending may overwrite it
+ */
+uint8_t sen5x_store_scan_next(sen5x_store_t *store, sen5x_store_iterator_t *iterator, sen5x_store_span_t *span);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,382 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_aqi_test.c
+ * @brief     driver sen5x aqi test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_aqi_test.h"
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_AQI_TEST_SAMPLES        (2 * 86400)             /**< two days at 1 Hz */
+#define SEN5X_AQI_TEST_START_MS       1760000001234ULL        /**< unaligned first timestamp */
+
+/**
+ * @brief aqi test reference structure definition
+ */
+typedef struct sen5x_aqi_test_reference_s
+{
+    sen5x_aqi_standard_t standard;         /**< standard */
+    sen5x_aqi_pollutant_t pollutant;       /**< pollutant */
+    float concentration;                   /**< concentration */
+    uint16_t index;                        /**< expected index */
+} sen5x_aqi_test_reference_t;
+
+/**
+ * @brief breakpoint reference table
+ */
+static const sen5x_aqi_test_reference_t gs_reference[] =
+{
+    {SEN5X_AQI_STANDARD_US_EPA_2024, SEN5X_AQI_POLLUTANT_PM2P5, 9.0f, 50},
+    {SEN5X_AQI_STANDARD_US_EPA_2024, SEN5X_AQI_POLLUTANT_PM2P5, 9.09f, 50},
+    {SEN5X_AQI_STANDARD_US_EPA_2024, SEN5X_AQI_POLLUTANT_PM2P5, 9.1f, 51},
+    {SEN5X_AQI_STANDARD_US_EPA_2024, SEN5X_AQI_POLLUTANT_PM2P5, 35.4f, 100},
+    {SEN5X_AQI_STANDARD_US_EPA_2024, SEN5X_AQI_POLLUTANT_PM2P5, 55.5f, 151},
+    {SEN5X_AQI_STANDARD_US_EPA_2024, SEN5X_AQI_POLLUTANT_PM2P5, 325.4f, 500},
+    {SEN5X_AQI_STANDARD_US_EPA_2024, SEN5X_AQI_POLLUTANT_PM10, 154.9f, 100},
+    {SEN5X_AQI_STANDARD_US_EPA_2012, SEN5X_AQI_POLLUTANT_PM2P5, 12.0f, 50},
+    {SEN5X_AQI_STANDARD_US_EPA_2012, SEN5X_AQI_POLLUTANT_PM2P5, 150.4f, 200},
+    {SEN5X_AQI_STANDARD_US_EPA_2012, SEN5X_AQI_POLLUTANT_PM10, 505.0f, 401},
+    {SEN5X_AQI_STANDARD_INDIA_NAQI, SEN5X_AQI_POLLUTANT_PM2P5, 60.0f, 100},
+    {SEN5X_AQI_STANDARD_INDIA_NAQI, SEN5X_AQI_POLLUTANT_PM10, 251.0f, 201},
+    {SEN5X_AQI_STANDARD_EU_CAQI, SEN5X_AQI_POLLUTANT_PM2P5, 110.0f, 100},
+    {SEN5X_AQI_STANDARD_EU_CAQI, SEN5X_AQI_POLLUTANT_PM10, 70.0f, 63},
+};
+
+static float gs_pm[SEN5X_AQI_TEST_SAMPLES][2];        /**< input samples */
+static sen5x_aqi_t gs_aqi[4];                         /**< one aqi per standard */
+static uint32_t gs_seed;                              /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_aqi_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     average an hour by scanning the samples
+ * @param[in] hour_ms hour start
+ * @param[in] p pollutant
+ * @return    hourly average, nan for invalid hours
+ * @note      none
+ */
+static float a_sen5x_aqi_test_hour(uint64_t hour_ms, uint8_t p)
+{
+    uint32_t i;
+    uint32_t n;
+    uint8_t minutes;
+    uint8_t minute[60];
+    uint64_t ms;
+    double sum;
+
+    memset(minute, 0, sizeof(minute));
+    n = 0;
+    sum = 0.0;
+    minutes = 0;
+    i = (hour_ms > SEN5X_AQI_TEST_START_MS) ? (uint32_t)((hour_ms - SEN5X_AQI_TEST_START_MS + 999) / 1000) : 0;
+    for (; i < SEN5X_AQI_TEST_SAMPLES; i++)
+    {
+        ms = SEN5X_AQI_TEST_START_MS + (uint64_t)i * 1000;
+        if (ms >= hour_ms + 3600000)
+        {
+            break;
+        }
+        if (isnan(gs_pm[i][p]) != 0)
+        {
+            continue;
+        }
+        sum += gs_pm[i][p];
+        n++;
+        if (minute[(ms - hour_ms) / 60000] == 0)
+        {
+            minute[(ms - hour_ms) / 60000] = 1;
+            minutes++;
+        }
+    }
+
+    return (minutes >= SEN5X_AQI_MIN_MINUTES) ? (float)(sum / n) : NAN;
+}
+
+/**
+ * @brief     compute a concentration from scratch
+ * @param[in] standard index standard
+ * @param[in] hour_ms start of the last closed hour
+ * @param[in] p pollutant
+ * @param[in] hours closed hours
+ * @return    concentration, nan when there is not enough data
+ * @note      reads back every sample of the averaging period like the old script
+ */
+static float a_sen5x_aqi_test_scratch(sen5x_aqi_standard_t standard, uint64_t hour_ms, uint8_t p, uint32_t hours)
+{
+    uint32_t i;
+    uint32_t n;
+    float c[SEN5X_AQI_HOURS];
+    float min;
+    float max;
+    float w;
+    double num;
+    double den;
+
+    n = (standard == SEN5X_AQI_STANDARD_INDIA_NAQI) ? SEN5X_AQI_HOURS :
+        ((standard == SEN5X_AQI_STANDARD_EU_CAQI) ? 1 : SEN5X_AQI_NOWCAST_HOURS);
+    n = (hours < n) ? hours : n;
+    for (i = 0; i < n; i++)
+    {
+        c[i] = a_sen5x_aqi_test_hour(hour_ms - (uint64_t)i * 3600000, p);
+    }
+    if (standard == SEN5X_AQI_STANDARD_EU_CAQI)
+    {
+        return c[0];
+    }
+    num = 0.0;
+    den = 0.0;
+    if (standard == SEN5X_AQI_STANDARD_INDIA_NAQI)
+    {
+        for (i = 0; i < n; i++)
+        {
+            if (isnan(c[i]) == 0)
+            {
+                num += c[i];
+                den += 1.0;
+            }
+        }
+
+        return (den >= SEN5X_AQI_MIN_DAY_HOURS) ? (float)(num / den) : NAN;
+    }
+    if ((n < 2) || (((isnan(c[0]) != 0) + (isnan(c[1]) != 0) + ((n > 2) ? (isnan(c[2]) != 0) : 1)) > 1))
+    {
+        return NAN;
+    }
+    min = INFINITY;
+    max = -INFINITY;
+    for (i = 0; i < n; i++)
+    {
+        if (isnan(c[i]) == 0)
+        {
+            min = (c[i] < min) ? c[i] : min;
+            max = (c[i] > max) ? c[i] : max;
+        }
+    }
+    w = (max > 0.0f) ? (min / max) : 1.0f;
+    w = (w < 0.5f) ? 0.5f : w;
+    for (i = 0; i < n; i++)
+    {
+        if (isnan(c[i]) == 0)
+        {
+            num += pow(w, i) * c[i];
+            den += pow(w, i);
+        }
+    }
+
+    return (float)(num / den);
+}
+
+/**
+ * @brief     aqi test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_aqi_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t s;
+    uint8_t p;
+    uint8_t category;
+    uint16_t index;
+    uint32_t i;
+    uint32_t t;
+    uint32_t hours;
+    uint32_t checked;
+    uint64_t last_hour;
+    float c;
+    float level;
+    clock_t start;
+    double push_s;
+    double scratch_s;
+    sen5x_aqi_result_t result;
+
+    /* start aqi test */
+    sen5x_interface_debug_print("sen5x: start aqi test.\n");
+
+    /* check the breakpoint tables */
+    for (i = 0; i < sizeof(gs_reference) / sizeof(gs_reference[0]); i++)
+    {
+        res = sen5x_aqi_get_index(gs_reference[i].standard, gs_reference[i].pollutant,
+                                  gs_reference[i].concentration, &index, &category);
+        if ((res != 0) || (index != gs_reference[i].index))
+        {
+            sen5x_interface_debug_print("sen5x: standard %d concentration %0.2f gives index %d, expect %d.\n",
+                                        gs_reference[i].standard, gs_reference[i].concentration,
+                                        index, gs_reference[i].index);
+
+            return 1;
+        }
+    }
+    sen5x_interface_debug_print("sen5x: check %d breakpoints ok.\n", i);
+
+    /* make two days of 1 Hz samples with a missing hour and a short hour */
+    gs_seed = 0xA01;
+    level = 12.0f;
+    for (i = 0; i < SEN5X_AQI_TEST_SAMPLES; i++)
+    {
+        level += (float)((int32_t)(a_sen5x_aqi_test_random() % 41) - 20) / 100.0f;
+        level = (level < 1.0f) ? 1.0f : ((level > 180.0f) ? 180.0f : level);
+        gs_pm[i][0] = level;
+        gs_pm[i][1] = level * 1.6f + (float)(a_sen5x_aqi_test_random() % 100) / 10.0f;
+        if ((i < 30) || ((i >= 5 * 3600) && (i < 6 * 3600)) || ((i >= 9 * 3600) && (i < 9 * 3600 + 1800)) ||
+            ((i >= 20 * 3600) && (i < 23 * 3600)))
+        {
+            gs_pm[i][0] = NAN;
+            gs_pm[i][1] = NAN;
+        }
+        else if ((i >= 30 * 3600) && (i < 31 * 3600))
+        {
+            gs_pm[i][1] = NAN;
+        }
+    }
+    if (times == 0)
+    {
+        times = 1;
+    }
+
+    /* check every closed hour of every standard against a recompute from scratch */
+    for (s = 0; s < 4; s++)
+    {
+        if (sen5x_aqi_init(&gs_aqi[s], (sen5x_aqi_standard_t)s) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: aqi init failed.\n");
+
+            return 1;
+        }
+    }
+    last_hour = 0;
+    hours = 0;
+    checked = 0;
+    for (i = 0; i < SEN5X_AQI_TEST_SAMPLES; i++)
+    {
+        for (s = 0; s < 4; s++)
+        {
+            if (sen5x_aqi_push(&gs_aqi[s], SEN5X_AQI_TEST_START_MS + (uint64_t)i * 1000, gs_pm[i][0], gs_pm[i][1]) != 0)
+            {
+                sen5x_interface_debug_print("sen5x: push failed.\n");
+
+                return 1;
+            }
+        }
+        if ((gs_aqi[0].hours == 0) || (gs_aqi[0].result.hour_ms == last_hour))
+        {
+            continue;
+        }
+        last_hour = gs_aqi[0].result.hour_ms;
+        hours++;
+        for (s = 0; s < 4; s++)
+        {
+            res = sen5x_aqi_get_result(&gs_aqi[s], &result);
+            for (p = 0; p < 2; p++)
+            {
+                c = a_sen5x_aqi_test_scratch((sen5x_aqi_standard_t)s, last_hour, p, hours);
+                if ((isnan(c) != 0) != ((res != 0) || ((result.valid & (1 << p)) == 0)))
+                {
+                    sen5x_interface_debug_print("sen5x: standard %d hour %d pollutant %d validity mismatch.\n", s, hours, p);
+
+                    return 1;
+                }
+                if (isnan(c) != 0)
+                {
+                    continue;
+                }
+                (void)sen5x_aqi_get_index((sen5x_aqi_standard_t)s, (sen5x_aqi_pollutant_t)p, c, &index, &category);
+                if ((fabsf(result.concentration[p] - c) > 1e-4f * c) || (abs((int)result.index[p] - (int)index) > 1))
+                {
+                    sen5x_interface_debug_print("sen5x: standard %d hour %d pollutant %d gives %0.3f, expect %0.3f.\n",
+                                                s, hours, p, result.concentration[p], c);
+
+                    return 1;
+                }
+                checked++;
+            }
+        }
+    }
+    sen5x_interface_debug_print("sen5x: check %d hourly results of %d hours ok.\n", checked, hours);
+
+    /* switch the standard at runtime */
+    if ((sen5x_aqi_set_standard(&gs_aqi[0], SEN5X_AQI_STANDARD_EU_CAQI) != 0) ||
+        (sen5x_aqi_get_result(&gs_aqi[0], &result) != 0) ||
+        (memcmp(&result, &gs_aqi[3].result, sizeof(result)) != 0))
+    {
+        sen5x_interface_debug_print("sen5x: set standard failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: caqi %d, dominant %s.\n", result.aqi, (result.dominant == 0) ? "pm2.5" : "pm10");
+
+    /* incremental update speed */
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        (void)sen5x_aqi_init(&gs_aqi[0], SEN5X_AQI_STANDARD_US_EPA_2024);
+        for (i = 0; i < SEN5X_AQI_TEST_SAMPLES; i++)
+        {
+            (void)sen5x_aqi_push(&gs_aqi[0], SEN5X_AQI_TEST_START_MS + (uint64_t)i * 1000, gs_pm[i][0], gs_pm[i][1]);
+        }
+    }
+    push_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / SEN5X_AQI_TEST_SAMPLES;
+
+    /* recompute the nowcast from 12 hours of samples */
+    start = clock();
+    c = 0.0f;
+    for (t = 0; t < 4; t++)
+    {
+        c += a_sen5x_aqi_test_scratch(SEN5X_AQI_STANDARD_US_EPA_2024, SEN5X_AQI_TEST_START_MS + 40 * 3600000ULL, 0, 40);
+    }
+    scratch_s = (double)(clock() - start) / CLOCKS_PER_SEC / 4;
+    sen5x_interface_debug_print("sen5x: incremental %0.1f ns per sample, recompute %0.1f us per update.\n",
+                                push_s * 1e9, scratch_s * 1e6);
+
+    /* finish aqi test */
+    sen5x_interface_debug_print("sen5x: finish aqi test.\n");
+
+    return 0;
+}
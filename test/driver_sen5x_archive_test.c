@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_archive_test.c
+ * @brief     driver sen5x archive test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_archive_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_ARCHIVE_TEST_SAMPLES            86400          /**< one day at 1 Hz */
+#define SEN5X_ARCHIVE_TEST_CHANNELS           8              /**< measured values channels */
+#define SEN5X_ARCHIVE_TEST_ARCHIVE_SIZE       (2 * 1024 * 1024)        /**< archive buffer size */
+
+static uint16_t gs_word[SEN5X_ARCHIVE_TEST_SAMPLES][SEN5X_ARCHIVE_TEST_CHANNELS];        /**< input words */
+static uint64_t gs_timestamp[SEN5X_ARCHIVE_TEST_SAMPLES];                                /**< input timestamps */
+static uint8_t gs_archive[SEN5X_ARCHIVE_TEST_ARCHIVE_SIZE];                              /**< archive buffer */
+static uint8_t gs_block[SEN5X_ARCHIVE_BLOCK_SIZE];                                       /**< block buffer */
+static uint32_t gs_archive_len;                                                          /**< archive length */
+static uint32_t gs_seed;                                                                 /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_archive_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     random walk step
+ * @param[in] value current value
+ * @param[in] step max step
+ * @param[in] min min value
+ * @param[in] max max value
+ * @return    next value
+ * @note      none
+ */
+static int32_t a_sen5x_archive_test_walk(int32_t value, int32_t step, int32_t min, int32_t max)
+{
+    value += (int32_t)(a_sen5x_archive_test_random() % (uint32_t)(2 * step + 1)) - step;
+    if (value < min)
+    {
+        value = min;
+    }
+    if (value > max)
+    {
+        value = max;
+    }
+
+    return value;
+}
+
+/**
+ * @brief     emit block callback
+ * @param[in] *block pointer to a block buffer
+ * @param[in] len block length
+ * @return    status code
+ *            - 0 success
+ *            - 1 archive is full
+ * @note      none
+ */
+static uint8_t a_sen5x_archive_test_emit(const uint8_t *block, uint32_t len)
+{
+    if ((gs_archive_len + len) > SEN5X_ARCHIVE_TEST_ARCHIVE_SIZE)
+    {
+        return 1;
+    }
+    memcpy(&gs_archive[gs_archive_len], block, len);
+    gs_archive_len += len;
+
+    return 0;
+}
+
+/**
+ * @brief     archive test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_archive_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t j;
+    uint32_t t;
+    uint32_t n;
+    uint32_t payload;
+    int32_t pm;
+    int32_t humidity;
+    int32_t temperature;
+    int32_t voc;
+    int32_t nox;
+    uint64_t ms;
+    uint16_t word[SEN5X_ARCHIVE_MAX_CHANNELS];
+    clock_t start;
+    double encode_s;
+    double decode_s;
+    sen5x_archive_encoder_t encoder;
+    sen5x_archive_decoder_t decoder;
+
+    /* start archive test */
+    sen5x_interface_debug_print("sen5x: start archive test.\n");
+
+    /* make one day of 1 Hz samples */
+    gs_seed = 0x5EA5;
+    pm = 80;
+    humidity = 4500;
+    temperature = 4600;
+    voc = 1000;
+    nox = 10;
+    ms = 1760000000000ULL;
+    for (i = 0; i < SEN5X_ARCHIVE_TEST_SAMPLES; i++)
+    {
+        ms += 1000 + (a_sen5x_archive_test_random() % 7) - 3;
+        pm = a_sen5x_archive_test_walk(pm, 3, 0, 10000);
+        humidity = a_sen5x_archive_test_walk(humidity, 4, 1000, 9000);
+        temperature = a_sen5x_archive_test_walk(temperature, 2, -2000, 10000);
+        voc = a_sen5x_archive_test_walk(voc, 3, 10, 5000);
+        nox = a_sen5x_archive_test_walk(nox, 1, 10, 5000);
+        gs_timestamp[i] = ms;
+        gs_word[i][0] = (i < 30) ? 0xFFFFU : (uint16_t)(pm * 8 / 10);
+        gs_word[i][1] = (i < 30) ? 0xFFFFU : (uint16_t)pm;
+        gs_word[i][2] = (i < 30) ? 0xFFFFU : (uint16_t)(pm + pm / 10);
+        gs_word[i][3] = (i < 30) ? 0xFFFFU : (uint16_t)(pm + pm / 8);
+        gs_word[i][4] = (uint16_t)humidity;
+        gs_word[i][5] = (uint16_t)temperature;
+        gs_word[i][6] = (i < 60) ? 0x7FFFU : (uint16_t)voc;
+        gs_word[i][7] = (i < 300) ? 0x7FFFU : (uint16_t)nox;
+    }
+    if (times == 0)
+    {
+        times = 1;
+    }
+
+    /* encode */
+    sen5x_interface_debug_print("sen5x: encode %d samples of %d channels.\n", SEN5X_ARCHIVE_TEST_SAMPLES, SEN5X_ARCHIVE_TEST_CHANNELS);
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        gs_archive_len = 0;
+        res = sen5x_archive_encoder_init(&encoder, SEN5X_ARCHIVE_LAYOUT_MEASURED, gs_block, SEN5X_ARCHIVE_BLOCK_SIZE,
+                                         a_sen5x_archive_test_emit);
+        if (res != 0)
+        {
+            sen5x_interface_debug_print("sen5x: encoder init failed.\n");
+
+            return 1;
+        }
+        for (i = 0; i < SEN5X_ARCHIVE_TEST_SAMPLES; i++)
+        {
+            res = sen5x_archive_encode(&encoder, gs_timestamp[i], gs_word[i]);
+            if (res != 0)
+            {
+                sen5x_interface_debug_print("sen5x: encode failed.\n");
+
+                return 1;
+            }
+        }
+        res = sen5x_archive_flush(&encoder);
+        if (res != 0)
+        {
+            sen5x_interface_debug_print("sen5x: flush failed.\n");
+
+            return 1;
+        }
+    }
+    encode_s = (double)(clock() - start) / CLOCKS_PER_SEC / times;
+
+    /* decode and check */
+    n = 0;
+    payload = 0;
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        n = 0;
+        payload = 0;
+        for (j = 0; j < gs_archive_len; j += SEN5X_ARCHIVE_BLOCK_SIZE)
+        {
+            res = sen5x_archive_decoder_init(&decoder, &gs_archive[j], SEN5X_ARCHIVE_BLOCK_SIZE);
+            if (res != 0)
+            {
+                sen5x_interface_debug_print("sen5x: block %d is invalid.\n", j / SEN5X_ARCHIVE_BLOCK_SIZE);
+
+                return 1;
+            }
+            payload += SEN5X_ARCHIVE_HEADER_LENGTH + decoder.header.length;
+            while (sen5x_archive_decode(&decoder, &ms, word) == 0)
+            {
+                if ((n >= SEN5X_ARCHIVE_TEST_SAMPLES) || (ms != gs_timestamp[n]) ||
+                    (memcmp(word, gs_word[n], sizeof(uint16_t) * SEN5X_ARCHIVE_TEST_CHANNELS) != 0))
+                {
+                    sen5x_interface_debug_print("sen5x: sample %d mismatch.\n", n);
+
+                    return 1;
+                }
+                n++;
+            }
+        }
+    }
+    decode_s = (double)(clock() - start) / CLOCKS_PER_SEC / times;
+    if (n != SEN5X_ARCHIVE_TEST_SAMPLES)
+    {
+        sen5x_interface_debug_print("sen5x: decoded %d samples.\n", n);
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check decode ok.\n");
+
+    /* corrupt one byte */
+    gs_archive[SEN5X_ARCHIVE_HEADER_LENGTH + 7] ^= 0x10;
+    res = sen5x_archive_check_block(gs_archive, SEN5X_ARCHIVE_BLOCK_SIZE);
+    gs_archive[SEN5X_ARCHIVE_HEADER_LENGTH + 7] ^= 0x10;
+    if (res == 0)
+    {
+        sen5x_interface_debug_print("sen5x: check corrupt block failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check corrupt block ok.\n");
+
+    /* print the result */
+    sen5x_interface_debug_print("sen5x: %d blocks, %d bytes.\n", gs_archive_len / SEN5X_ARCHIVE_BLOCK_SIZE, gs_archive_len);
+    sen5x_interface_debug_print("sen5x: %0.3f bytes/channel/sample with padding.\n",
+                                (double)gs_archive_len / SEN5X_ARCHIVE_TEST_SAMPLES / SEN5X_ARCHIVE_TEST_CHANNELS);
+    sen5x_interface_debug_print("sen5x: %0.3f bytes/channel/sample without padding.\n",
+                                (double)payload / SEN5X_ARCHIVE_TEST_SAMPLES / SEN5X_ARCHIVE_TEST_CHANNELS);
+    sen5x_interface_debug_print("sen5x: encode %0.2f Msamples/s.\n", SEN5X_ARCHIVE_TEST_SAMPLES / encode_s / 1e6);
+    sen5x_interface_debug_print("sen5x: decode %0.2f Msamples/s.\n", SEN5X_ARCHIVE_TEST_SAMPLES / decode_s / 1e6);
+
+    /* finish archive test */
+    sen5x_interface_debug_print("sen5x: finish archive test.\n");
+
+    return 0;
+}
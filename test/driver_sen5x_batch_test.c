@@ -0,0 +1,420 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_batch_test.c
+ * @brief     driver sen5x batch test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_batch_test.h"
+#include <time.h>
+
+/**
+ * @brief test frame count definition
+ */
+#define SEN5X_BATCH_TEST_FRAMES        1029        /**< frame count, not a multiple of the simd block */
+
+static uint8_t gs_measured_frames[SEN5X_BATCH_TEST_FRAMES * SEN5X_BATCH_MEASURED_FRAME_LENGTH];        /**< measured values frames */
+static uint8_t gs_pm_frames[SEN5X_BATCH_TEST_FRAMES * SEN5X_BATCH_PM_FRAME_LENGTH];                    /**< pm values frames */
+static float gs_batch[10][SEN5X_BATCH_TEST_FRAMES];                                                    /**< batch columns */
+static float gs_check[10][SEN5X_BATCH_TEST_FRAMES];                                                    /**< reference columns */
+static uint8_t gs_batch_valid[2][SEN5X_BATCH_TEST_FRAMES];                                             /**< batch flags */
+static uint8_t gs_check_valid[2][SEN5X_BATCH_TEST_FRAMES];                                             /**< reference flags */
+static uint32_t gs_seed;                                                                               /**< random seed */
+
+/**
+ * @brief  get a pseudo random word
+ * @return word
+ * @note   none
+ */
+static uint16_t a_sen5x_batch_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return (uint16_t)(gs_seed >> 16);
+}
+
+/**
+ * @brief     crc8 as used by the chip
+ * @param[in] *data pointer to a data buffer
+ * @param[in] count data length
+ * @return    crc
+ * @note      none
+ */
+static uint8_t a_sen5x_batch_test_crc(const uint8_t *data, uint8_t count)
+{
+    uint8_t crc = 0xFF;
+    uint8_t i;
+    uint8_t j;
+
+    for (i = 0; i < count; i++)
+    {
+        crc ^= data[i];
+        for (j = 8; j > 0; --j)
+        {
+            if ((crc & 0x80) != 0)
+            {
+                crc = (uint8_t)((crc << 1) ^ 0x31);
+            }
+            else
+            {
+                crc = (uint8_t)(crc << 1);
+            }
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief     fill a frame with random words
+ * @param[in] *frame pointer to a frame buffer
+ * @param[in] words word count
+ * @param[in] index frame index
+ * @note      some frames get invalid words or a wrong crc
+ */
+static void a_sen5x_batch_test_frame(uint8_t *frame, uint8_t words, uint32_t index)
+{
+    uint8_t i;
+    uint16_t word;
+
+    for (i = 0; i < words; i++)
+    {
+        word = a_sen5x_batch_test_random();
+        if ((index % 37) == (uint32_t)(i % 4 + 1))
+        {
+            word = 0xFFFF;
+        }
+        if ((i >= 4) && ((index % 41) == i))
+        {
+            word = (words == 8) ? 0x7FFF : 0xFFFF;
+        }
+        frame[i * 3 + 0] = (uint8_t)(word >> 8);
+        frame[i * 3 + 1] = (uint8_t)(word & 0xFF);
+        frame[i * 3 + 2] = a_sen5x_batch_test_crc(&frame[i * 3], 2);
+    }
+    if ((index % 53) == 7)
+    {
+        frame[(index % words) * 3 + 2] ^= 0x01;
+    }
+}
+
+/**
+ * @brief     decode the measured values frames like sen55_read
+ * @param[in] count frame count
+ * @note      none
+ */
+static void a_sen5x_batch_test_measured_check(uint32_t count)
+{
+    uint32_t i;
+    uint8_t j;
+    uint8_t *buf;
+    uint16_t pm[4];
+    int16_t env[4];
+
+    for (i = 0; i < count; i++)
+    {
+        buf = &gs_measured_frames[i * SEN5X_BATCH_MEASURED_FRAME_LENGTH];
+        gs_check_valid[1][i] = 1;
+        for (j = 0; j < 8; j++)
+        {
+            if (buf[j * 3 + 2] != a_sen5x_batch_test_crc(&buf[j * 3], 2))
+            {
+                gs_check_valid[1][i] = 0;
+            }
+        }
+        if (gs_check_valid[1][i] == 0)
+        {
+            for (j = 0; j < 8; j++)
+            {
+                gs_check[j][i] = NAN;
+            }
+            gs_check_valid[0][i] = 0;
+
+            continue;
+        }
+        for (j = 0; j < 4; j++)
+        {
+            pm[j] = (uint16_t)(((uint16_t)(buf[j * 3 + 0]) << 8) | ((uint16_t)(buf[j * 3 + 1]) << 0));
+            env[j] = (int16_t)(((uint16_t)(buf[(j + 4) * 3 + 0]) << 8) | ((uint16_t)(buf[(j + 4) * 3 + 1]) << 0));
+        }
+        if ((pm[0] == 0xFFFF) || (pm[1] == 0xFFFF) || (pm[2] == 0xFFFF) || (pm[3] == 0xFFFF))
+        {
+            for (j = 0; j < 4; j++)
+            {
+                gs_check[j][i] = NAN;
+            }
+            gs_check_valid[0][i] = 0;
+        }
+        else
+        {
+            for (j = 0; j < 4; j++)
+            {
+                gs_check[j][i] = (float)(pm[j]) / 10.0f;
+            }
+            gs_check_valid[0][i] = 1;
+        }
+        gs_check[4][i] = (env[0] == 0x7FFF) ? NAN : ((float)(env[0]) / 100.0f);
+        gs_check[5][i] = (env[1] == 0x7FFF) ? NAN : ((float)(env[1]) / 200.0f);
+        gs_check[6][i] = (env[2] == 0x7FFF) ? NAN : ((float)(env[2]) / 10.0f);
+        gs_check[7][i] = (env[3] == 0x7FFF) ? NAN : ((float)(env[3]) / 10.0f);
+    }
+}
+
+/**
+ * @brief     decode the pm values frames like sen5x_read_pm_value
+ * @param[in] count frame count
+ * @note      none
+ */
+static void a_sen5x_batch_test_pm_check(uint32_t count)
+{
+    uint32_t i;
+    uint8_t j;
+    uint8_t invalid;
+    uint8_t *buf;
+    uint16_t word[10];
+
+    for (i = 0; i < count; i++)
+    {
+        buf = &gs_pm_frames[i * SEN5X_BATCH_PM_FRAME_LENGTH];
+        gs_check_valid[1][i] = 1;
+        invalid = 0;
+        for (j = 0; j < 10; j++)
+        {
+            if (buf[j * 3 + 2] != a_sen5x_batch_test_crc(&buf[j * 3], 2))
+            {
+                gs_check_valid[1][i] = 0;
+            }
+            word[j] = (uint16_t)(((uint16_t)(buf[j * 3 + 0]) << 8) | ((uint16_t)(buf[j * 3 + 1]) << 0));
+            if (word[j] == 0xFFFF)
+            {
+                invalid = 1;
+            }
+        }
+        if ((invalid != 0) || (gs_check_valid[1][i] == 0))
+        {
+            for (j = 0; j < 10; j++)
+            {
+                gs_check[j][i] = NAN;
+            }
+            gs_check_valid[0][i] = 0;
+        }
+        else
+        {
+            for (j = 0; j < 9; j++)
+            {
+                gs_check[j][i] = (float)(word[j]) / 10.0f;
+            }
+            gs_check[9][i] = (float)(word[9]) / 1000.0f;
+            gs_check_valid[0][i] = 1;
+        }
+    }
+}
+
+/**
+ * @brief     compare the batch columns with the reference columns
+ * @param[in] columns column count
+ * @return    status code
+ *            - 0 success
+ *            - 1 mismatch
+ * @note      none
+ */
+static uint8_t a_sen5x_batch_test_compare(uint8_t columns)
+{
+    uint8_t j;
+
+    for (j = 0; j < columns; j++)
+    {
+        if (memcmp(gs_batch[j], gs_check[j], sizeof(gs_batch[j])) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: column %d mismatch.\n", j);
+
+            return 1;
+        }
+    }
+    if (memcmp(gs_batch_valid, gs_check_valid, sizeof(gs_batch_valid)) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: valid flags mismatch.\n");
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     batch test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_batch_test(uint32_t times)
+{
+    const char *simd_name[4] = {"none", "ssse3", "avx2", "neon"};
+    uint8_t res;
+    uint32_t i;
+    clock_t start;
+    double scalar_ns;
+    double batch_ns;
+    sen5x_batch_simd_t simd;
+    sen5x_batch_measured_t measured;
+    sen5x_batch_pm_t pm;
+
+    /* start batch test */
+    sen5x_interface_debug_print("sen5x: start batch test.\n");
+
+    /* get the simd */
+    res = sen5x_batch_get_simd(&simd);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: get simd failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: simd is %s.\n", simd_name[simd]);
+
+    /* make frames */
+    gs_seed = 0x5EA5;
+    for (i = 0; i < SEN5X_BATCH_TEST_FRAMES; i++)
+    {
+        a_sen5x_batch_test_frame(&gs_measured_frames[i * SEN5X_BATCH_MEASURED_FRAME_LENGTH], 8, i);
+        a_sen5x_batch_test_frame(&gs_pm_frames[i * SEN5X_BATCH_PM_FRAME_LENGTH], 10, i);
+    }
+    if (times == 0)
+    {
+        times = 1;
+    }
+
+    /* link measured columns */
+    measured.pm1p0_ug_m3 = gs_batch[0];
+    measured.pm2p5_ug_m3 = gs_batch[1];
+    measured.pm4p0_ug_m3 = gs_batch[2];
+    measured.pm10_ug_m3 = gs_batch[3];
+    measured.compensated_ambient_humidity_percentage = gs_batch[4];
+    measured.compensated_ambient_temperature_degree = gs_batch[5];
+    measured.voc_index = gs_batch[6];
+    measured.nox_index = gs_batch[7];
+    measured.pm_valid = gs_batch_valid[0];
+    measured.crc_valid = gs_batch_valid[1];
+
+    /* decode measured values */
+    sen5x_interface_debug_print("sen5x: decode %d measured values frames.\n", SEN5X_BATCH_TEST_FRAMES);
+    memset(gs_batch, 0, sizeof(gs_batch));
+    memset(gs_check, 0, sizeof(gs_check));
+    res = sen5x_batch_decode_measured_values(gs_measured_frames, SEN5X_BATCH_TEST_FRAMES, &measured);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: decode measured values failed.\n");
+
+        return 1;
+    }
+    a_sen5x_batch_test_measured_check(SEN5X_BATCH_TEST_FRAMES);
+    if (a_sen5x_batch_test_compare(8) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: check measured values failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check measured values ok.\n");
+
+    /* measured values benchmark */
+    start = clock();
+    for (i = 0; i < times; i++)
+    {
+        a_sen5x_batch_test_measured_check(SEN5X_BATCH_TEST_FRAMES);
+    }
+    scalar_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / ((double)times * SEN5X_BATCH_TEST_FRAMES);
+    start = clock();
+    for (i = 0; i < times; i++)
+    {
+        (void)sen5x_batch_decode_measured_values(gs_measured_frames, SEN5X_BATCH_TEST_FRAMES, &measured);
+    }
+    batch_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / ((double)times * SEN5X_BATCH_TEST_FRAMES);
+    sen5x_interface_debug_print("sen5x: per sample decode %0.2fns/frame.\n", scalar_ns);
+    sen5x_interface_debug_print("sen5x: batch decode %0.2fns/frame.\n", batch_ns);
+
+    /* link pm columns */
+    pm.pm1p0_ug_m3 = gs_batch[0];
+    pm.pm2p5_ug_m3 = gs_batch[1];
+    pm.pm4p0_ug_m3 = gs_batch[2];
+    pm.pm10_ug_m3 = gs_batch[3];
+    pm.pm0p5_cm3 = gs_batch[4];
+    pm.pm1p0_cm3 = gs_batch[5];
+    pm.pm2p5_cm3 = gs_batch[6];
+    pm.pm4p0_cm3 = gs_batch[7];
+    pm.pm10_cm3 = gs_batch[8];
+    pm.typical_particle_um = gs_batch[9];
+    pm.pm_valid = gs_batch_valid[0];
+    pm.crc_valid = gs_batch_valid[1];
+
+    /* decode pm values */
+    sen5x_interface_debug_print("sen5x: decode %d pm values frames.\n", SEN5X_BATCH_TEST_FRAMES);
+    memset(gs_batch, 0, sizeof(gs_batch));
+    memset(gs_check, 0, sizeof(gs_check));
+    res = sen5x_batch_decode_pm_values(gs_pm_frames, SEN5X_BATCH_TEST_FRAMES, &pm);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: decode pm values failed.\n");
+
+        return 1;
+    }
+    a_sen5x_batch_test_pm_check(SEN5X_BATCH_TEST_FRAMES);
+    if (a_sen5x_batch_test_compare(10) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: check pm values failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check pm values ok.\n");
+
+    /* pm values benchmark */
+    start = clock();
+    for (i = 0; i < times; i++)
+    {
+        a_sen5x_batch_test_pm_check(SEN5X_BATCH_TEST_FRAMES);
+    }
+    scalar_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / ((double)times * SEN5X_BATCH_TEST_FRAMES);
+    start = clock();
+    for (i = 0; i < times; i++)
+    {
+        (void)sen5x_batch_decode_pm_values(gs_pm_frames, SEN5X_BATCH_TEST_FRAMES, &pm);
+    }
+    batch_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / ((double)times * SEN5X_BATCH_TEST_FRAMES);
+    sen5x_interface_debug_print("sen5x: per sample decode %0.2fns/frame.\n", scalar_ns);
+    sen5x_interface_debug_print("sen5x: batch decode %0.2fns/frame.\n", batch_ns);
+
+    /* finish batch test */
+    sen5x_interface_debug_print("sen5x: finish batch test.\n");
+
+    return 0;
+}
@@ -0,0 +1,228 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_calib_test.c
+ * @brief     driver sen5x calib test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_calib_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_CALIB_TEST_SAMPLES          86400          /**< one day at 1 Hz */
+#define SEN5X_CALIB_TEST_OFFSET           -1.8           /**< true temperature offset */
+#define SEN5X_CALIB_TEST_SLOPE            -0.02          /**< true normalized temperature offset slope */
+#define SEN5X_CALIB_TEST_TAU              1200.0         /**< true time constant */
+
+static float gs_sensor[SEN5X_CALIB_TEST_SAMPLES];               /**< sensor temperature column */
+static float gs_reference[SEN5X_CALIB_TEST_SAMPLES];            /**< reference temperature column */
+static sen5x_raw_t gs_raw[SEN5X_CALIB_TEST_SAMPLES];            /**< raw samples */
+static sen5x_calib_t gs_calib;                                  /**< calib */
+static uint32_t gs_seed;                                        /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_calib_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief  get a pseudo random noise
+ * @return noise in -1 - 1
+ * @note   none
+ */
+static double a_sen5x_calib_test_noise(void)
+{
+    return (double)(a_sen5x_calib_test_random() % 20001) / 10000.0 - 1.0;
+}
+
+/**
+ * @brief     check a fit against the true parameters
+ * @param[in] *result pointer to a calib result structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_sen5x_calib_test_check(const sen5x_calib_result_t *result)
+{
+    if ((fabs(result->temperature_offset_degree - SEN5X_CALIB_TEST_OFFSET) > 0.05) ||
+        (fabs(result->normalized_temperature_offset_slope_factor - SEN5X_CALIB_TEST_SLOPE) > 0.002) ||
+        (fabs(result->time_constant_second - SEN5X_CALIB_TEST_TAU) > SEN5X_CALIB_TEST_TAU * 0.05) ||
+        (result->rmse_after_degree > 0.05f))
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     calib test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_calib_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t t;
+    double x;
+    double z;
+    double alpha;
+    double sink;
+    clock_t start;
+    double fit_s;
+    sen5x_calib_result_t result;
+
+    /* start calib test */
+    sen5x_interface_debug_print("sen5x: start calib test.\n");
+
+    /* check the params */
+    if ((sen5x_calib_init(&gs_calib, 0.0f, SEN5X_CALIB_DEFAULT_MAX_TIME_CONSTANT) != 4) ||
+        (sen5x_calib_init(&gs_calib, 1.0f, -1.0f) != 5) ||
+        (sen5x_calib_init(&gs_calib, 1.0f, 70000.0f) != 5))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+    res = sen5x_calib_init(&gs_calib, 1.0f, SEN5X_CALIB_DEFAULT_MAX_TIME_CONSTANT);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: calib init failed.\n");
+
+        return 1;
+    }
+
+    /* one day of a diurnal swing with hvac steps, the reference follows the model plus noise */
+    gs_seed = 0x4040;
+    alpha = 1.0 - exp(-1.0 / SEN5X_CALIB_TEST_TAU);
+    z = 0.0;
+    for (i = 0; i < SEN5X_CALIB_TEST_SAMPLES; i++)
+    {
+        x = 24.0 + 6.0 * sin(2.0 * M_PI * i / 86400.0) + (((i / 7200) % 3 == 1) ? 4.0 : 0.0) +
+            0.02 * a_sen5x_calib_test_noise();
+        x = floor(x * 200.0 + 0.5) / 200.0;
+        z = (i == 0) ? x : (z + alpha * (x - z));
+        gs_sensor[i] = (float)x;
+        gs_reference[i] = (float)(x + SEN5X_CALIB_TEST_SLOPE * z + SEN5X_CALIB_TEST_OFFSET + 0.03 * a_sen5x_calib_test_noise());
+        memset(&gs_raw[i], 0, sizeof(sen5x_raw_t));
+        gs_raw[i].temperature_raw = (int16_t)floor(x * 200.0 + 0.5);
+        gs_raw[i].temperature_degree = (float)x;
+    }
+    gs_sensor[100] = NAN;
+    gs_reference[200] = NAN;
+
+    /* fit the series */
+    res = sen5x_calib_fit(&gs_calib, gs_sensor, gs_reference, SEN5X_CALIB_TEST_SAMPLES, &result);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: calib fit failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: fitted offset %0.3fC, slope %0.4f, time constant %0.0fs from %d samples in %d evaluations.\n",
+                                result.temperature_offset_degree, result.normalized_temperature_offset_slope_factor,
+                                result.time_constant_second, result.samples, result.evaluations);
+    sen5x_interface_debug_print("sen5x: registers %d, %d, %d, rmse %0.3fC before and %0.3fC after.\n",
+                                result.temperature_offset_reg, result.normalized_temperature_offset_slope_reg,
+                                result.time_constant_reg, result.rmse_before_degree, result.rmse_after_degree);
+    if ((a_sen5x_calib_test_check(&result) != 0) || (result.samples != SEN5X_CALIB_TEST_SAMPLES - 2) ||
+        (result.temperature_offset_reg != (int16_t)floor(result.temperature_offset_degree * 200.0f + 0.5f)))
+    {
+        sen5x_interface_debug_print("sen5x: fit differs from the true compensation.\n");
+
+        return 1;
+    }
+
+    /* fit the raw values */
+    res = sen5x_calib_fit_raw(&gs_calib, gs_raw, gs_reference, SEN5X_CALIB_TEST_SAMPLES, &result);
+    if ((res != 0) || (a_sen5x_calib_test_check(&result) != 0))
+    {
+        sen5x_interface_debug_print("sen5x: raw fit differs from the true compensation.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: raw fit offset %0.3fC, slope %0.4f, time constant %0.0fs.\n",
+                                result.temperature_offset_degree, result.normalized_temperature_offset_slope_factor,
+                                result.time_constant_second);
+
+    /* static offset only */
+    (void)sen5x_calib_init(&gs_calib, 1.0f, 0.0f);
+    res = sen5x_calib_fit(&gs_calib, gs_sensor, gs_reference, SEN5X_CALIB_TEST_SAMPLES, &result);
+    if ((res != 0) || (result.time_constant_reg != 0))
+    {
+        sen5x_interface_debug_print("sen5x: static fit failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: static fit rmse %0.3fC.\n", result.rmse_after_degree);
+    if (sen5x_calib_fit(&gs_calib, gs_sensor, gs_reference, 2, &result) != 4)
+    {
+        sen5x_interface_debug_print("sen5x: too few samples not rejected.\n");
+
+        return 1;
+    }
+
+    /* fit speed */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    (void)sen5x_calib_init(&gs_calib, 1.0f, SEN5X_CALIB_DEFAULT_MAX_TIME_CONSTANT);
+    sink = 0.0;
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        (void)sen5x_calib_fit(&gs_calib, gs_sensor, gs_reference, SEN5X_CALIB_TEST_SAMPLES, &result);
+        sink += result.time_constant_second;
+    }
+    fit_s = (double)(clock() - start) / CLOCKS_PER_SEC / times;
+    sen5x_interface_debug_print("sen5x: %0.2f ms per fit of one day at 1 Hz, checksum %0.1f.\n", fit_s * 1e3, sink);
+
+    /* finish calib test */
+    sen5x_interface_debug_print("sen5x: finish calib test.\n");
+
+    return 0;
+}
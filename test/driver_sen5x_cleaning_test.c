@@ -0,0 +1,297 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_cleaning_test.c
+ * @brief     driver sen5x cleaning test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_cleaning_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_CLEANING_TEST_DAYS           28               /**< simulated days at 1 Hz */
+#define SEN5X_CLEANING_TEST_SKEW           1.007            /**< chip clock runs 7000 ppm slow */
+#define SEN5X_CLEANING_TEST_MANUAL_S       907200           /**< manual cleaning at day 10.5 */
+#define SEN5X_CLEANING_TEST_GARBAGE_MS     11000            /**< pm garbage after a cleaning start */
+#define SEN5X_CLEANING_TEST_PM             10.0f            /**< true pm2.5 */
+
+static sen5x_cleaning_t gs_cleaning;          /**< cleaning tracker */
+static uint32_t gs_seed;                      /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_cleaning_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief      run four weeks of one sensor
+ * @param[in]  poll 1 if the status is read when the tracker asks for it
+ * @param[out] *leaked pointer to a buffer of garbage samples left valid
+ * @param[out] *masked pointer to a buffer of good samples masked
+ * @param[out] *hour_err pointer to a buffer of the max hourly pm2.5 error
+ * @param[out] *naive_err pointer to a buffer of the max hourly pm2.5 error without masking
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       the chip cleans at the measurement start plus the skewed interval, the manual cleaning
+ *             restarts the interval
+ */
+static uint8_t a_sen5x_cleaning_test_run(uint8_t poll, uint32_t *leaked, uint32_t *masked,
+                                         float *hour_err, float *naive_err)
+{
+    uint32_t t;
+    uint32_t n;
+    uint32_t n_all;
+    uint8_t want;
+    uint8_t garbage;
+    uint64_t now_ms;
+    uint64_t clean_ms;
+    uint64_t next_ms;
+    double sum;
+    double sum_all;
+    float err;
+    sen55_data_t data;
+
+    gs_seed = 0x434C;
+    if (sen5x_cleaning_init(&gs_cleaning, SEN5X_CLEANING_DEFAULT_INTERVAL_S, SEN5X_CLEANING_DEFAULT_DURATION_MS,
+                            SEN5X_CLEANING_DEFAULT_SETTLE_MS, SEN5X_CLEANING_DEFAULT_DRIFT_PPM) != 0)
+    {
+        return 1;
+    }
+    (void)sen5x_cleaning_measurement_started(&gs_cleaning, 0);
+    clean_ms = UINT64_MAX;
+    next_ms = (uint64_t)(SEN5X_CLEANING_DEFAULT_INTERVAL_S * 1000.0 * SEN5X_CLEANING_TEST_SKEW) + 437;
+    *leaked = 0;
+    *masked = 0;
+    *hour_err = 0.0f;
+    *naive_err = 0.0f;
+    sum = 0.0;
+    sum_all = 0.0;
+    n = 0;
+    n_all = 0;
+    for (t = 0; t < SEN5X_CLEANING_TEST_DAYS * 86400; t++)
+    {
+        now_ms = (uint64_t)t * 1000;
+
+        /* chip side */
+        if (t == SEN5X_CLEANING_TEST_MANUAL_S)
+        {
+            clean_ms = now_ms;
+            next_ms = now_ms + (uint64_t)(SEN5X_CLEANING_DEFAULT_INTERVAL_S * 1000.0 * SEN5X_CLEANING_TEST_SKEW);
+            (void)sen5x_cleaning_started(&gs_cleaning, now_ms);
+        }
+        if (now_ms >= next_ms)
+        {
+            clean_ms = next_ms;
+            next_ms += (uint64_t)(SEN5X_CLEANING_DEFAULT_INTERVAL_S * 1000.0 * SEN5X_CLEANING_TEST_SKEW);
+        }
+
+        /* status read piggybacked on the cycle */
+        if (poll != 0)
+        {
+            (void)sen5x_cleaning_poll(&gs_cleaning, now_ms, &want);
+            if (want != 0)
+            {
+                (void)sen5x_cleaning_update(&gs_cleaning, now_ms,
+                                            ((clean_ms != UINT64_MAX) && (now_ms >= clean_ms) &&
+                                             (now_ms < clean_ms + SEN5X_CLEANING_DEFAULT_DURATION_MS)) ?
+                                            SEN5X_STATUS_FAN_CLEANING_ACTIVE : 0);
+            }
+        }
+
+        /* sample */
+        garbage = ((clean_ms != UINT64_MAX) && (now_ms >= clean_ms) &&
+                   (now_ms < clean_ms + SEN5X_CLEANING_TEST_GARBAGE_MS)) ? 1 : 0;
+        memset(&data, 0, sizeof(data));
+        data.pm_valid = 1;
+        data.pm2p5_ug_m3 = SEN5X_CLEANING_TEST_PM + (float)(a_sen5x_cleaning_test_random() % 200) / 100.0f - 1.0f;
+        if (garbage != 0)
+        {
+            data.pm2p5_ug_m3 = 400.0f;
+        }
+        if (sen5x_cleaning_mask_sen55(&gs_cleaning, now_ms, &data) != 0)
+        {
+            return 1;
+        }
+        *leaked += ((garbage != 0) && (data.pm_valid != 0)) ? 1 : 0;
+        *masked += ((garbage == 0) && (data.pm_valid == 0)) ? 1 : 0;
+
+        /* hourly mean */
+        sum_all += data.pm2p5_ug_m3;
+        n_all++;
+        if (data.pm_valid != 0)
+        {
+            sum += data.pm2p5_ug_m3;
+            n++;
+        }
+        if ((t % 3600) == 3599)
+        {
+            err = (n != 0) ? fabsf((float)(sum / n) - SEN5X_CLEANING_TEST_PM) : 0.0f;
+            *hour_err = (err > *hour_err) ? err : *hour_err;
+            err = fabsf((float)(sum_all / n_all) - SEN5X_CLEANING_TEST_PM);
+            *naive_err = (err > *naive_err) ? err : *naive_err;
+            sum = 0.0;
+            sum_all = 0.0;
+            n = 0;
+            n_all = 0;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     cleaning test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_cleaning_test(uint32_t times)
+{
+    uint8_t poll;
+    uint32_t i;
+    uint32_t leaked;
+    uint32_t masked;
+    float hour_err;
+    float naive_err;
+    clock_t start;
+    double check_s;
+    sen5x_cleaning_tag_t tag;
+    sen5x_cleaning_stats_t stats;
+
+    /* start cleaning test */
+    sen5x_interface_debug_print("sen5x: start cleaning test.\n");
+
+    /* check the params */
+    if ((sen5x_cleaning_init(&gs_cleaning, 9, 10000, 2000, 10000.0f) != 4) ||
+        (sen5x_cleaning_init(&gs_cleaning, 604801, 10000, 2000, 10000.0f) != 4) ||
+        (sen5x_cleaning_init(&gs_cleaning, 604800, 0, 2000, 10000.0f) != 5) ||
+        (sen5x_cleaning_init(&gs_cleaning, 604800, 10000, 2000, -1.0f) != 6) ||
+        (sen5x_cleaning_init(&gs_cleaning, 0, 10000, 2000, 10000.0f) != 0) ||
+        (sen5x_cleaning_set_interval(&gs_cleaning, 5, 0) != 4) ||
+        (sen5x_cleaning_check(&gs_cleaning, 0, NULL) != 2) ||
+        (sen5x_cleaning_mask_pm(&gs_cleaning, 0, NULL) != 2))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+
+    /* status reads in the predicted windows */
+    if (a_sen5x_cleaning_test_run(1, &leaked, &masked, &hour_err, &naive_err) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: cleaning run failed.\n");
+
+        return 1;
+    }
+    (void)sen5x_cleaning_get_stats(&gs_cleaning, &stats);
+    sen5x_interface_debug_print("sen5x: %d status reads in %d days, %d auto cleanings seen, %d started, %d missed.\n",
+                                (uint32_t)stats.polls, SEN5X_CLEANING_TEST_DAYS, stats.observed, stats.started, stats.missed);
+    sen5x_interface_debug_print("sen5x: learned drift %0.0f ppm, next window +-%d s, %d garbage samples leaked, %d good samples masked.\n",
+                                stats.drift_ppm, stats.band_ms / 1000, leaked, masked);
+    sen5x_interface_debug_print("sen5x: max hourly pm2.5 error %0.2f ug/m3 against %0.2f ug/m3 without masking.\n",
+                                hour_err, naive_err);
+    if ((leaked != 0) || (masked > 20) || (stats.observed != 3) || (stats.started != 1) || (stats.missed != 0) ||
+        (fabsf(stats.drift_ppm - 7000.0f) > 50.0f) ||
+        (stats.polls > (uint64_t)SEN5X_CLEANING_TEST_DAYS * 86400 / 100) || (hour_err > 0.1f))
+    {
+        sen5x_interface_debug_print("sen5x: cleaning window is wrong.\n");
+
+        return 1;
+    }
+
+    /* no status reads */
+    if (a_sen5x_cleaning_test_run(0, &leaked, &masked, &hour_err, &naive_err) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: cleaning run failed.\n");
+
+        return 1;
+    }
+    (void)sen5x_cleaning_get_stats(&gs_cleaning, &stats);
+    sen5x_interface_debug_print("sen5x: without status reads %d garbage samples leaked, %d good samples masked, max hourly error %0.2f ug/m3.\n",
+                                leaked, masked, hour_err);
+    if ((leaked != 0) || (stats.observed != 0) || (hour_err > 0.1f))
+    {
+        sen5x_interface_debug_print("sen5x: predicted window is wrong.\n");
+
+        return 1;
+    }
+
+    /* disabled auto cleaning */
+    (void)sen5x_cleaning_init(&gs_cleaning, SEN5X_CLEANING_DEFAULT_INTERVAL_S, SEN5X_CLEANING_DEFAULT_DURATION_MS,
+                              SEN5X_CLEANING_DEFAULT_SETTLE_MS, SEN5X_CLEANING_DEFAULT_DRIFT_PPM);
+    (void)sen5x_cleaning_measurement_started(&gs_cleaning, 0);
+    (void)sen5x_cleaning_set_interval(&gs_cleaning, 0, 1000);
+    (void)sen5x_cleaning_poll(&gs_cleaning, 604800000, &poll);
+    (void)sen5x_cleaning_check(&gs_cleaning, 604800000, &tag);
+    (void)sen5x_cleaning_get_stats(&gs_cleaning, &stats);
+    if ((poll != 0) || (tag != SEN5X_CLEANING_TAG_NONE) || (stats.next_ms != 0))
+    {
+        sen5x_interface_debug_print("sen5x: disabled interval still predicted.\n");
+
+        return 1;
+    }
+
+    /* check speed */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    (void)sen5x_cleaning_init(&gs_cleaning, SEN5X_CLEANING_DEFAULT_INTERVAL_S, SEN5X_CLEANING_DEFAULT_DURATION_MS,
+                              SEN5X_CLEANING_DEFAULT_SETTLE_MS, SEN5X_CLEANING_DEFAULT_DRIFT_PPM);
+    (void)sen5x_cleaning_measurement_started(&gs_cleaning, 0);
+    start = clock();
+    for (i = 0; i < times * 1000000; i++)
+    {
+        (void)sen5x_cleaning_poll(&gs_cleaning, (uint64_t)i * 1000, &poll);
+        (void)sen5x_cleaning_check(&gs_cleaning, (uint64_t)i * 1000, &tag);
+    }
+    check_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / 1000000;
+    sen5x_interface_debug_print("sen5x: %0.1f ns per sample, state %d bytes.\n",
+                                check_s * 1e9, (uint32_t)sizeof(sen5x_cleaning_t));
+
+    /* finish cleaning test */
+    sen5x_interface_debug_print("sen5x: finish cleaning test.\n");
+
+    return 0;
+}
@@ -0,0 +1,351 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_duty_test.c
+ * @brief     driver sen5x duty test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_duty_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_DUTY_TEST_SECONDS          86400            /**< one simulated day at 1 Hz */
+#define SEN5X_DUTY_TEST_EVENTS           4                /**< pollution events */
+#define SEN5X_DUTY_TEST_RAMP_S           300.0f           /**< rise time of an event */
+#define SEN5X_DUTY_TEST_DECAY_S          600.0f           /**< decay time constant of an event */
+#define SEN5X_DUTY_TEST_PM               8.0f             /**< background pm2.5 */
+#define SEN5X_DUTY_TEST_VOC              100.0f           /**< background voc index */
+#define SEN5X_DUTY_TEST_NOX              1.0f             /**< background nox index */
+
+/**
+ * @brief sen5x duty test event structure definition
+ */
+typedef struct sen5x_duty_test_event_s
+{
+    uint32_t start_s;         /**< event start */
+    uint32_t hold_s;          /**< plateau length */
+    float pm;                 /**< pm2.5 rise */
+    float voc;                /**< voc index rise */
+    float nox;                /**< nox index rise */
+} sen5x_duty_test_event_t;
+
+/**
+ * @brief event table, breakfast, vacuuming without gas, dinner and a candle
+ */
+static const sen5x_duty_test_event_t gs_event[SEN5X_DUTY_TEST_EVENTS] =
+{
+    {27450, 2400, 70.0f, 250.0f, 30.0f},
+    {50850, 1200, 30.0f, 0.0f, 0.0f},
+    {66950, 3600, 110.0f, 200.0f, 60.0f},
+    {76100, 1800, 35.0f, 150.0f, 0.0f},
+};
+
+static sen5x_duty_t gs_duty;          /**< duty cycle controller */
+static uint32_t gs_seed;              /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_duty_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     get the shape of an event
+ * @param[in] *event pointer to an event
+ * @param[in] t time in s
+ * @return    level from 0 to 1
+ * @note      linear rise, plateau and exponential decay
+ */
+static float a_sen5x_duty_test_shape(const sen5x_duty_test_event_t *event, uint32_t t)
+{
+    float x;
+
+    if (t < event->start_s)
+    {
+        return 0.0f;
+    }
+    x = (float)(t - event->start_s);
+    if (x < SEN5X_DUTY_TEST_RAMP_S)
+    {
+        return x / SEN5X_DUTY_TEST_RAMP_S;
+    }
+    x -= SEN5X_DUTY_TEST_RAMP_S;
+    if (x < (float)event->hold_s)
+    {
+        return 1.0f;
+    }
+
+    return expf(-(x - (float)event->hold_s) / SEN5X_DUTY_TEST_DECAY_S);
+}
+
+/**
+ * @brief      run one day of one sensor
+ * @param[in]  voc_jump voc index jump of the controller
+ * @param[in]  nox_jump nox index jump of the controller
+ * @param[out] *stats pointer to a duty stats structure
+ * @param[out] *latency_s pointer to a buffer of the first trusted pm after the start of every event
+ * @param[out] *peak pointer to a buffer of the highest trusted pm2.5 rise of every event
+ * @param[out] *bad pointer to a buffer of trusted samples taken before the pm settled
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       the chip reads low while the fan spins up
+ */
+static uint8_t a_sen5x_duty_test_run(float voc_jump, float nox_jump, sen5x_duty_stats_t *stats,
+                                     uint32_t *latency_s, float *peak, uint32_t *bad)
+{
+    uint8_t e;
+    uint8_t pm;
+    uint32_t t;
+    uint32_t pm_start;
+    uint64_t now_ms;
+    float level;
+    float truth;
+    sen5x_duty_action_t action;
+    sen55_data_t data;
+
+    if (sen5x_duty_init(&gs_duty, SEN5X_DUTY_DEFAULT_PERIOD_S, SEN5X_DUTY_DEFAULT_WINDOW_MS,
+                        SEN5X_DUTY_DEFAULT_SETTLE_MS, voc_jump, nox_jump) != 0)
+    {
+        return 1;
+    }
+    gs_seed = 0x5EA5;
+    pm = 0;
+    pm_start = 0;
+    *bad = 0;
+    for (e = 0; e < SEN5X_DUTY_TEST_EVENTS; e++)
+    {
+        latency_s[e] = SEN5X_DUTY_TEST_SECONDS;
+        peak[e] = 0.0f;
+    }
+    for (t = 0; t < SEN5X_DUTY_TEST_SECONDS; t++)
+    {
+        now_ms = (uint64_t)t * 1000;
+        if (sen5x_duty_poll(&gs_duty, now_ms, &action) != 0)
+        {
+            return 1;
+        }
+        if (action != SEN5X_DUTY_ACTION_NONE)
+        {
+            /* sen5x_start_measurement or sen5x_start_measurement_without_pm goes here */
+            if ((action == SEN5X_DUTY_ACTION_PM) && (pm == 0))
+            {
+                pm_start = t;
+            }
+            pm = (action == SEN5X_DUTY_ACTION_PM) ? 1 : 0;
+            if (sen5x_duty_switched(&gs_duty, action, now_ms) != 0)
+            {
+                return 1;
+            }
+        }
+
+        /* one sample of the chip */
+        memset(&data, 0, sizeof(data));
+        truth = SEN5X_DUTY_TEST_PM;
+        data.voc_index = SEN5X_DUTY_TEST_VOC + (float)(a_sen5x_duty_test_random() % 11) - 5.0f;
+        data.nox_index = SEN5X_DUTY_TEST_NOX;
+        for (e = 0; e < SEN5X_DUTY_TEST_EVENTS; e++)
+        {
+            level = a_sen5x_duty_test_shape(&gs_event[e], t);
+            truth += gs_event[e].pm * level;
+            data.voc_index += gs_event[e].voc * level;
+            data.nox_index += gs_event[e].nox * level;
+        }
+        data.pm_valid = pm;
+        data.pm2p5_ug_m3 = (pm != 0) ? truth * fminf((float)(t - pm_start) / 30.0f, 1.0f) : 0.0f;
+        if (sen5x_duty_update_sen55(&gs_duty, now_ms, &data) != 0)
+        {
+            return 1;
+        }
+        if (data.pm_valid == 0)
+        {
+            continue;
+        }
+        if (fabsf(data.pm2p5_ug_m3 - truth) > 0.01f)
+        {
+            (*bad)++;
+        }
+        for (e = 0; e < SEN5X_DUTY_TEST_EVENTS; e++)
+        {
+            if ((t >= gs_event[e].start_s) && (t - gs_event[e].start_s < latency_s[e]))
+            {
+                latency_s[e] = t - gs_event[e].start_s;
+            }
+            if ((t >= gs_event[e].start_s) && (t < gs_event[e].start_s + gs_event[e].hold_s + 600))
+            {
+                peak[e] = fmaxf(peak[e], data.pm2p5_ug_m3 - SEN5X_DUTY_TEST_PM);
+            }
+        }
+    }
+
+    return sen5x_duty_get_stats(&gs_duty, (uint64_t)SEN5X_DUTY_TEST_SECONDS * 1000, stats);
+}
+
+/**
+ * @brief     duty test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_duty_test(uint32_t times)
+{
+    uint8_t e;
+    uint8_t trust;
+    uint32_t i;
+    uint32_t bad;
+    uint32_t sched_bad;
+    uint32_t latency[SEN5X_DUTY_TEST_EVENTS];
+    uint32_t sched_latency[SEN5X_DUTY_TEST_EVENTS];
+    float peak[SEN5X_DUTY_TEST_EVENTS];
+    float sched_peak[SEN5X_DUTY_TEST_EVENTS];
+    clock_t start;
+    double update_s;
+    sen5x_duty_stats_t stats;
+    sen5x_duty_stats_t sched;
+    sen5x_duty_action_t action;
+    sen5x_handle_t handle;
+
+    /* start duty test */
+    sen5x_interface_debug_print("sen5x: start duty test.\n");
+
+    /* check the params */
+    if ((sen5x_duty_init(&gs_duty, 5, 30000, 30000, 50.0f, 20.0f) != 4) ||
+        (sen5x_duty_init(&gs_duty, 900, 0, 30000, 50.0f, 20.0f) != 5) ||
+        (sen5x_duty_init(&gs_duty, 60, 30000, 30001, 50.0f, 20.0f) != 5) ||
+        (sen5x_duty_init(&gs_duty, 900, 30000, 30000, 0.0f, 20.0f) != 6) ||
+        (sen5x_duty_init(&gs_duty, 900, 30000, 30000, 50.0f, -1.0f) != 6) ||
+        (sen5x_duty_init(&gs_duty, 900, 30000, 30000, 50.0f, 20.0f) != 0) ||
+        (sen5x_duty_set_current(&gs_duty, 10.0f, 5.0f) != 4) ||
+        (sen5x_duty_switched(&gs_duty, SEN5X_DUTY_ACTION_NONE, 0) != 4) ||
+        (sen5x_duty_poll(&gs_duty, 0, NULL) != 2))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+
+    /* take the currents of the energy accounting */
+    DRIVER_SEN5X_LINK_INIT(&handle, sen5x_handle_t);
+    if ((sen5x_duty_set_current_from_handle(&gs_duty, NULL) != 2) ||
+        (sen5x_duty_set_current_from_handle(&gs_duty, &handle) != 1))
+    {
+        sen5x_interface_debug_print("sen5x: handle currents not checked.\n");
+
+        return 1;
+    }
+    handle.inited = 1;
+    handle.debug_print = sen5x_interface_debug_print;
+    if ((sen5x_set_power_current(&handle, SEN5X_POWER_MODE_RHT_GAS, 5.5f) != 0) ||
+        (sen5x_set_power_current(&handle, SEN5X_POWER_MODE_MEASUREMENT, 55.0f) != 0) ||
+        (sen5x_duty_set_current_from_handle(&gs_duty, &handle) != 0) ||
+        (gs_duty.gas_ma != 5.5f) || (gs_duty.pm_ma != 55.0f) ||
+        (sen5x_set_power_current(&handle, SEN5X_POWER_MODE_RHT_GAS, 60.0f) != 0) ||
+        (sen5x_duty_set_current_from_handle(&gs_duty, &handle) != 4))
+    {
+        sen5x_interface_debug_print("sen5x: handle currents not taken.\n");
+
+        return 1;
+    }
+
+    /* one day with gas triggers and with the schedule only */
+    if ((a_sen5x_duty_test_run(SEN5X_DUTY_DEFAULT_VOC_JUMP, SEN5X_DUTY_DEFAULT_NOX_JUMP, &stats, latency, peak, &bad) != 0) ||
+        (a_sen5x_duty_test_run(1000.0f, 0.0f, &sched, sched_latency, sched_peak, &sched_bad) != 0))
+    {
+        sen5x_interface_debug_print("sen5x: duty run failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: fan on %0.1f percent of the day, %d scheduled, %d triggered and %d extended windows.\n",
+                                stats.duty * 100.0f, stats.scheduled, stats.triggered, stats.extended);
+    sen5x_interface_debug_print("sen5x: average %0.2fmA, %0.1fmAh and %0.1fmWh per day, %0.1fmAh with the fan always on.\n",
+                                stats.average_ma, stats.charge_mah, stats.energy_mwh, SEN5X_POWER_CURRENT_MEASUREMENT_MA * 24.0f);
+    sen5x_interface_debug_print("sen5x: %d settling samples masked, %d unsettled samples trusted.\n",
+                                (uint32_t)(stats.settle_ms / 1000), bad);
+    for (e = 0; e < SEN5X_DUTY_TEST_EVENTS; e++)
+    {
+        sen5x_interface_debug_print("sen5x: event %d seen after %ds with %0.0f of %0.0fug/m3, schedule only after %ds with %0.0fug/m3.\n",
+                                    e, latency[e], peak[e], gs_event[e].pm, sched_latency[e], sched_peak[e]);
+    }
+    if ((bad != 0) || (sched_bad != 0) || (stats.duty > 0.1f) || (stats.triggered + stats.extended < 3) ||
+        (stats.average_ma > 12.0f) || (sched.triggered != 0))
+    {
+        sen5x_interface_debug_print("sen5x: duty cycle is wrong.\n");
+
+        return 1;
+    }
+    for (e = 0; e < SEN5X_DUTY_TEST_EVENTS; e++)
+    {
+        if ((latency[e] > SEN5X_DUTY_DEFAULT_PERIOD_S + 60) || (peak[e] < 0.9f * gs_event[e].pm) ||
+            ((gs_event[e].voc > 0.0f) && (latency[e] > 240)))
+        {
+            sen5x_interface_debug_print("sen5x: event %d missed.\n", e);
+
+            return 1;
+        }
+    }
+
+    /* update speed */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    (void)sen5x_duty_init(&gs_duty, SEN5X_DUTY_DEFAULT_PERIOD_S, SEN5X_DUTY_DEFAULT_WINDOW_MS,
+                          SEN5X_DUTY_DEFAULT_SETTLE_MS, SEN5X_DUTY_DEFAULT_VOC_JUMP, SEN5X_DUTY_DEFAULT_NOX_JUMP);
+    start = clock();
+    for (i = 0; i < times * 1000000; i++)
+    {
+        (void)sen5x_duty_poll(&gs_duty, (uint64_t)i * 1000, &action);
+        if (action != SEN5X_DUTY_ACTION_NONE)
+        {
+            (void)sen5x_duty_switched(&gs_duty, action, (uint64_t)i * 1000);
+        }
+        (void)sen5x_duty_update(&gs_duty, (uint64_t)i * 1000, 100.0f + (float)(i & 7), 1.0f, &trust);
+    }
+    update_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / 1000000;
+    sen5x_interface_debug_print("sen5x: %0.1f ns per sample, state %d bytes.\n",
+                                update_s * 1e9, (uint32_t)sizeof(sen5x_duty_t));
+
+    /* finish duty test */
+    sen5x_interface_debug_print("sen5x: finish duty test.\n");
+
+    return 0;
+}
@@ -0,0 +1,456 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_energy_test.c
+ * @brief     driver sen5x energy test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_energy_test.h"
+#include <stdarg.h>
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_ENERGY_TEST_SECONDS          86400            /**< simulated day */
+#define SEN5X_ENERGY_TEST_CLEANING_US      10000000ULL      /**< fan cleaning duration of the chip */
+#define SEN5X_ENERGY_TEST_FAIL             16               /**< one in this many commands fails */
+
+/**
+ * @brief energy test sensor structure definition
+ */
+typedef struct sen5x_energy_test_sensor_s
+{
+    uint8_t mode;                  /**< true power mode */
+    uint64_t cleaning_us;          /**< end of the fan cleaning */
+    uint64_t last_us;              /**< time accounted up to */
+    uint64_t time_us[4];           /**< true time in every power mode */
+    uint32_t transitions;          /**< true power mode changes */
+} sen5x_energy_test_sensor_t;
+
+static sen5x_handle_t gs_handle;                       /**< sen5x handle */
+static sen5x_energy_test_sensor_t gs_sensor;           /**< simulated sensor */
+static uint64_t gs_now_us;                             /**< simulated host time */
+static uint8_t gs_fail;                                /**< next command fails */
+static uint32_t gs_seed;                               /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_energy_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief advance the simulated sensor to the host time
+ * @note  a finished fan cleaning returns to the measurement mode
+ */
+static void a_sen5x_energy_test_update(void)
+{
+    if ((gs_sensor.mode == SEN5X_POWER_MODE_FAN_CLEANING) && (gs_now_us >= gs_sensor.cleaning_us))
+    {
+        gs_sensor.time_us[gs_sensor.mode] += gs_sensor.cleaning_us - gs_sensor.last_us;
+        gs_sensor.last_us = gs_sensor.cleaning_us;
+        gs_sensor.mode = SEN5X_POWER_MODE_MEASUREMENT;
+        gs_sensor.transitions++;
+    }
+    gs_sensor.time_us[gs_sensor.mode] += gs_now_us - gs_sensor.last_us;
+    gs_sensor.last_us = gs_now_us;
+}
+
+/**
+ * @brief     switch the simulated sensor
+ * @param[in] mode new power mode
+ * @note      none
+ */
+static void a_sen5x_energy_test_switch(uint8_t mode)
+{
+    if (gs_sensor.mode != mode)
+    {
+        gs_sensor.transitions++;
+    }
+    gs_sensor.mode = mode;
+}
+
+/**
+ * @brief  simulated iic bus init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_sen5x_energy_test_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  simulated iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_sen5x_energy_test_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     simulated iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the chip switches its mode when the command arrives and cleans only while it measures
+ */
+static uint8_t a_sen5x_energy_test_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint16_t command;
+
+    (void)addr;
+    if (len < 2)
+    {
+        return 1;
+    }
+    gs_now_us += 100 + a_sen5x_energy_test_random() % 400;
+    a_sen5x_energy_test_update();
+    if (gs_fail != 0)
+    {
+        gs_fail = 0;
+
+        return 1;
+    }
+    command = (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]);
+    if (command == 0x0021)
+    {
+        a_sen5x_energy_test_switch(SEN5X_POWER_MODE_MEASUREMENT);
+    }
+    else if (command == 0x0037)
+    {
+        a_sen5x_energy_test_switch(SEN5X_POWER_MODE_RHT_GAS);
+    }
+    else if ((command == 0x0104) || (command == 0xD304))
+    {
+        a_sen5x_energy_test_switch(SEN5X_POWER_MODE_IDLE);
+    }
+    else if ((command == 0x5607) && (gs_sensor.mode == SEN5X_POWER_MODE_MEASUREMENT))
+    {
+        a_sen5x_energy_test_switch(SEN5X_POWER_MODE_FAN_CLEANING);
+        gs_sensor.cleaning_us = gs_now_us + SEN5X_ENERGY_TEST_CLEANING_US;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      simulated iic bus read
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 1 read failed
+ * @note       the test only writes commands
+ */
+static uint8_t a_sen5x_energy_test_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    (void)buf;
+    (void)len;
+
+    return 1;
+}
+
+/**
+ * @brief     simulated delay ms
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_sen5x_energy_test_delay_ms(uint32_t ms)
+{
+    gs_now_us += (uint64_t)ms * 1000;
+}
+
+/**
+ * @brief  simulated timestamp
+ * @return host time in us
+ * @note   none
+ */
+static uint64_t a_sen5x_energy_test_timestamp_us(void)
+{
+    return gs_now_us;
+}
+
+/**
+ * @brief     quiet print
+ * @param[in] fmt format data
+ * @note      the driver reports every failed command
+ */
+static void a_sen5x_energy_test_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief     link and start the handle
+ * @param[in] timing 1 links the timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      none
+ */
+static uint8_t a_sen5x_energy_test_start(uint8_t timing)
+{
+    DRIVER_SEN5X_LINK_INIT(&gs_handle, sen5x_handle_t);
+    DRIVER_SEN5X_LINK_IIC_INIT(&gs_handle, a_sen5x_energy_test_iic_init);
+    DRIVER_SEN5X_LINK_IIC_DEINIT(&gs_handle, a_sen5x_energy_test_iic_deinit);
+    DRIVER_SEN5X_LINK_IIC_WRITE_COMMAND(&gs_handle, a_sen5x_energy_test_iic_write_cmd);
+    DRIVER_SEN5X_LINK_IIC_READ_COMMAND(&gs_handle, a_sen5x_energy_test_iic_read_cmd);
+    DRIVER_SEN5X_LINK_DELAY_MS(&gs_handle, a_sen5x_energy_test_delay_ms);
+    DRIVER_SEN5X_LINK_DEBUG_PRINT(&gs_handle, a_sen5x_energy_test_print);
+    if (timing != 0)
+    {
+        DRIVER_SEN5X_LINK_TIMESTAMP_US(&gs_handle, a_sen5x_energy_test_timestamp_us);
+    }
+    memset(&gs_sensor, 0, sizeof(gs_sensor));
+    gs_sensor.last_us = gs_now_us;
+    gs_fail = 0;
+    if ((sen5x_set_type(&gs_handle, SEN55) != 0) || (sen5x_init(&gs_handle) != 0))
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      run one day of random mode changes
+ * @param[in]  timing 1 links the timestamp
+ * @param[out] *energy pointer to a sen5x energy structure
+ * @param[out] *commands pointer to a buffer of the accepted commands
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       every command waits its command delay, a failed command doesn't change the mode
+ */
+static uint8_t a_sen5x_energy_test_run(uint8_t timing, sen5x_energy_t *energy, uint32_t *commands)
+{
+    uint8_t res;
+    uint32_t r;
+    uint64_t end_us;
+
+    gs_now_us = 1000000;
+    gs_seed = 0xE4E4;
+    if (a_sen5x_energy_test_start(timing) != 0)
+    {
+        return 1;
+    }
+    *commands = 0;
+    end_us = gs_now_us + (uint64_t)SEN5X_ENERGY_TEST_SECONDS * 1000000;
+    while (gs_now_us < end_us)
+    {
+        gs_fail = ((a_sen5x_energy_test_random() % SEN5X_ENERGY_TEST_FAIL) == 0) ? 1 : 0;
+        r = a_sen5x_energy_test_random() % 10;
+        if (r < 3)
+        {
+            res = sen5x_start_measurement_without_pm(&gs_handle);
+        }
+        else if (r < 6)
+        {
+            res = sen5x_start_measurement(&gs_handle);
+        }
+        else if (r < 8)
+        {
+            res = sen5x_start_fan_cleaning(&gs_handle);
+        }
+        else if (r < 9)
+        {
+            res = sen5x_stop_measurement(&gs_handle);
+        }
+        else
+        {
+            res = sen5x_reset(&gs_handle);
+        }
+        *commands += (res == 0) ? 1 : 0;
+        gs_now_us += (uint64_t)(a_sen5x_energy_test_random() % 1200000) * 1000 / ((r < 8) ? 1 : 10);
+    }
+    if (sen5x_get_energy(&gs_handle, energy) != 0)
+    {
+        return 1;
+    }
+    a_sen5x_energy_test_update();
+
+    return 0;
+}
+
+/**
+ * @brief     energy test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_energy_test(uint32_t times)
+{
+    uint8_t i;
+    uint32_t n;
+    uint32_t commands;
+    uint64_t err;
+    uint64_t max_err;
+    float current;
+    double truth_mah;
+    clock_t start;
+    double snapshot_s;
+    sen5x_energy_t energy;
+    static const char *const mode_name[4] = {"idle", "rht/gas", "measurement", "fan cleaning"};
+    static const float mode_ma[4] = {SEN5X_POWER_CURRENT_IDLE_MA, SEN5X_POWER_CURRENT_RHT_GAS_MA,
+                                     SEN5X_POWER_CURRENT_MEASUREMENT_MA, SEN5X_POWER_CURRENT_FAN_CLEANING_MA};
+
+    /* start energy test */
+    sen5x_interface_debug_print("sen5x: start energy test.\n");
+
+    /* check the params */
+    DRIVER_SEN5X_LINK_INIT(&gs_handle, sen5x_handle_t);
+    if (sen5x_get_energy(&gs_handle, &energy) != 3)
+    {
+        sen5x_interface_debug_print("sen5x: uninitialized handle not rejected.\n");
+
+        return 1;
+    }
+    gs_now_us = 0;
+    if ((a_sen5x_energy_test_start(1) != 0) ||
+        (sen5x_set_power_current(&gs_handle, (sen5x_power_mode_t)4, 1.0f) != 4) ||
+        (sen5x_set_power_current(&gs_handle, SEN5X_POWER_MODE_IDLE, -1.0f) != 4) ||
+        (sen5x_get_power_current(&gs_handle, SEN5X_POWER_MODE_MEASUREMENT, NULL) != 2) ||
+        (sen5x_get_power_current(&gs_handle, SEN5X_POWER_MODE_MEASUREMENT, &current) != 0) || (current != SEN5X_POWER_CURRENT_MEASUREMENT_MA))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+
+    /* fan cleaning only while measuring */
+    gs_now_us += 5000000;
+    if ((sen5x_start_fan_cleaning(&gs_handle) != 0) || (sen5x_get_energy(&gs_handle, &energy) != 0) ||
+        (energy.mode != SEN5X_POWER_MODE_IDLE) || (energy.transitions != 0))
+    {
+        sen5x_interface_debug_print("sen5x: fan cleaning in the idle mode counted.\n");
+
+        return 1;
+    }
+    (void)sen5x_start_measurement(&gs_handle);
+    (void)sen5x_start_fan_cleaning(&gs_handle);
+    gs_now_us += 60000000;
+    (void)sen5x_get_energy(&gs_handle, &energy);
+    if ((energy.mode != SEN5X_POWER_MODE_MEASUREMENT) || (energy.transitions != 3) ||
+        (energy.time_us[SEN5X_POWER_MODE_FAN_CLEANING] != SEN5X_ENERGY_TEST_CLEANING_US))
+    {
+        sen5x_interface_debug_print("sen5x: fan cleaning end not found.\n");
+
+        return 1;
+    }
+    if ((sen5x_clear_energy(&gs_handle) != 0) || (sen5x_get_energy(&gs_handle, &energy) != 0) ||
+        (energy.time_us[SEN5X_POWER_MODE_MEASUREMENT] != 0) || (energy.transitions != 0) ||
+        (energy.mode != SEN5X_POWER_MODE_MEASUREMENT))
+    {
+        sen5x_interface_debug_print("sen5x: clear energy failed.\n");
+
+        return 1;
+    }
+
+    /* one day of random commands */
+    if (a_sen5x_energy_test_run(1, &energy, &commands) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: energy run failed.\n");
+
+        return 1;
+    }
+    max_err = 0;
+    truth_mah = 0.0;
+    for (i = 0; i < 4; i++)
+    {
+        err = (energy.time_us[i] > gs_sensor.time_us[i]) ? (energy.time_us[i] - gs_sensor.time_us[i]) :
+                                                          (gs_sensor.time_us[i] - energy.time_us[i]);
+        max_err = (err > max_err) ? err : max_err;
+        truth_mah += (double)gs_sensor.time_us[i] * mode_ma[i] / 3600000000.0;
+        sen5x_interface_debug_print("sen5x: %s %0.1fs, %0.2fmAh, error %0.3fs.\n", mode_name[i],
+                                    (double)energy.time_us[i] / 1e6, energy.charge_mah[i], (double)err / 1e6);
+    }
+    sen5x_interface_debug_print("sen5x: %d commands, %d mode changes, %0.2fmAh of %0.2fmAh, average %0.2fmA.\n",
+                                commands, energy.transitions, energy.total_mah, truth_mah, energy.average_ma);
+    if ((energy.transitions != gs_sensor.transitions) || (energy.mode != gs_sensor.mode) ||
+        (max_err > (uint64_t)energy.transitions * 200000) || (fabs(energy.total_mah - truth_mah) > 0.001 * truth_mah))
+    {
+        sen5x_interface_debug_print("sen5x: accounting is wrong.\n");
+
+        return 1;
+    }
+
+    /* the modes without the timestamp */
+    if ((a_sen5x_energy_test_run(0, &energy, &commands) != 0) ||
+        ((energy.mode != gs_sensor.mode) &&
+         ((energy.mode != SEN5X_POWER_MODE_FAN_CLEANING) || (gs_sensor.mode != SEN5X_POWER_MODE_MEASUREMENT))) ||
+        (energy.total_mah != 0.0f))
+    {
+        sen5x_interface_debug_print("sen5x: mode without the timestamp is wrong.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: without the timestamp the mode is %s, no time.\n", mode_name[energy.mode]);
+
+    /* snapshot speed */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    (void)a_sen5x_energy_test_start(1);
+    start = clock();
+    for (n = 0; n < times * 1000000; n++)
+    {
+        gs_now_us += 1000;
+        (void)sen5x_get_energy(&gs_handle, &energy);
+    }
+    snapshot_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / 1000000;
+    sen5x_interface_debug_print("sen5x: %0.1f ns per snapshot, handle %d bytes.\n",
+                                snapshot_s * 1e9, (uint32_t)sizeof(sen5x_handle_t));
+
+    /* finish energy test */
+    sen5x_interface_debug_print("sen5x: finish energy test.\n");
+
+    return 0;
+}
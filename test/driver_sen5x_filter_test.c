@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_filter_test.c
+ * @brief     driver sen5x filter test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_filter_test.h"
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_FILTER_TEST_SAMPLES        20000          /**< test samples */
+#define SEN5X_FILTER_TEST_SPIKE          0.01f          /**< spike probability */
+
+static float gs_in[SEN5X_FILTER_TEST_SAMPLES];               /**< input samples */
+static uint8_t gs_spike[SEN5X_FILTER_TEST_SAMPLES];          /**< spike flags */
+static float gs_sorted[SEN5X_FILTER_MAX_WINDOW];             /**< sorted window */
+static float gs_dev[SEN5X_FILTER_MAX_WINDOW];                /**< sorted deviations */
+static sen5x_filter_t gs_filter;                             /**< filter */
+static sen5x_filter_pm_t gs_bank;                            /**< pm filter bank */
+static uint32_t gs_seed;                                     /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_filter_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     compare two floats
+ * @param[in] *a pointer to the first float
+ * @param[in] *b pointer to the second float
+ * @return    compare result
+ * @note      none
+ */
+static int a_sen5x_filter_test_compare(const void *a, const void *b)
+{
+    float x = *(const float *)a;
+    float y = *(const float *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief     get the middle of a sorted buffer
+ * @param[in] *v pointer to a sorted buffer
+ * @param[in] n length
+ * @return    middle value
+ * @note      none
+ */
+static float a_sen5x_filter_test_middle(const float *v, uint32_t n)
+{
+    if ((n & 1) != 0)
+    {
+        return v[n / 2];
+    }
+
+    return 0.5f * (v[n / 2 - 1] + v[n / 2]);
+}
+
+/**
+ * @brief      filter a sample by sorting the window
+ * @param[in]  i sample index
+ * @param[in]  mode filter mode
+ * @param[in]  window window samples
+ * @param[in]  threshold hampel threshold
+ * @param[in]  min_delta min delta
+ * @param[out] *replaced pointer to a replaced flag buffer
+ * @return     output sample
+ * @note       none
+ */
+static float a_sen5x_filter_test_reference(uint32_t i, sen5x_filter_mode_t mode, uint8_t window,
+                                           float threshold, float min_delta, uint8_t *replaced)
+{
+    uint32_t j;
+    uint32_t n;
+    float m;
+    float limit;
+
+    n = (i + 1 < window) ? (i + 1) : window;
+    for (j = 0; j < n; j++)
+    {
+        gs_sorted[j] = gs_in[i - j];
+    }
+    qsort(gs_sorted, n, sizeof(float), a_sen5x_filter_test_compare);
+    m = a_sen5x_filter_test_middle(gs_sorted, n);
+    if (mode == SEN5X_FILTER_MODE_MEDIAN)
+    {
+        *replaced = (m != gs_in[i]) ? 1 : 0;
+
+        return m;
+    }
+    for (j = 0; j < n; j++)
+    {
+        gs_dev[j] = (gs_sorted[j] < m) ? (m - gs_sorted[j]) : (gs_sorted[j] - m);
+    }
+    qsort(gs_dev, n, sizeof(float), a_sen5x_filter_test_compare);
+    limit = threshold * SEN5X_FILTER_MAD_SCALE * a_sen5x_filter_test_middle(gs_dev, n);
+    limit = (limit < min_delta) ? min_delta : limit;
+    *replaced = (fabsf(gs_in[i] - m) > limit) ? 1 : 0;
+
+    return (*replaced != 0) ? m : gs_in[i];
+}
+
+/**
+ * @brief     filter test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_filter_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t w;
+    uint8_t m;
+    uint8_t replaced;
+    uint8_t replaced_check;
+    uint32_t i;
+    uint32_t t;
+    uint32_t removed;
+    uint32_t false_hits;
+    uint32_t spikes;
+    float out;
+    float check;
+    float level;
+    float sink;
+    clock_t start;
+    double filter_s;
+    double sort_s;
+    sen55_data_t data;
+    static const uint8_t window[] = {1, 2, 5, 8, 11, SEN5X_FILTER_MAX_WINDOW};
+
+    /* start filter test */
+    sen5x_interface_debug_print("sen5x: start filter test.\n");
+
+    /* make a pm stream with ties and single sample spikes */
+    gs_seed = 0xF117;
+    level = 10.0f;
+    spikes = 0;
+    for (i = 0; i < SEN5X_FILTER_TEST_SAMPLES; i++)
+    {
+        level += (float)((int32_t)(a_sen5x_filter_test_random() % 21) - 10) / 50.0f;
+        level = (level < 0.0f) ? 0.0f : level;
+        gs_in[i] = roundf(level * 10.0f) / 10.0f;
+        gs_spike[i] = ((a_sen5x_filter_test_random() % 10000) < (uint32_t)(SEN5X_FILTER_TEST_SPIKE * 10000)) ? 1 : 0;
+        if (gs_spike[i] != 0)
+        {
+            gs_in[i] = gs_in[i] * 5.0f + 20.0f;
+            spikes++;
+        }
+    }
+    if (times == 0)
+    {
+        times = 1;
+    }
+
+    /* check both modes against a sort of the window */
+    for (m = 0; m < 2; m++)
+    {
+        for (w = 0; w < sizeof(window); w++)
+        {
+            res = sen5x_filter_init(&gs_filter, (sen5x_filter_mode_t)m, window[w], 3.0f, 0.5f);
+            if (res != 0)
+            {
+                sen5x_interface_debug_print("sen5x: filter init failed.\n");
+
+                return 1;
+            }
+            for (i = 0; i < SEN5X_FILTER_TEST_SAMPLES; i++)
+            {
+                (void)sen5x_filter_update(&gs_filter, gs_in[i], &out, &replaced);
+                check = a_sen5x_filter_test_reference(i, (sen5x_filter_mode_t)m, window[w], 3.0f, 0.5f, &replaced_check);
+                if ((out != check) || (replaced != replaced_check))
+                {
+                    sen5x_interface_debug_print("sen5x: mode %d window %d sample %d gives %0.3f, expect %0.3f.\n",
+                                                m, window[w], i, out, check);
+
+                    return 1;
+                }
+            }
+        }
+    }
+    sen5x_interface_debug_print("sen5x: check median and hampel with %d windows ok.\n", (uint32_t)sizeof(window));
+
+    /* spike removal of the hampel filter */
+    (void)sen5x_filter_init(&gs_filter, SEN5X_FILTER_MODE_HAMPEL, 11, 3.0f, 0.5f);
+    removed = 0;
+    false_hits = 0;
+    for (i = 0; i < SEN5X_FILTER_TEST_SAMPLES; i++)
+    {
+        (void)sen5x_filter_update(&gs_filter, gs_in[i], &out, &replaced);
+        removed += ((replaced != 0) && (gs_spike[i] != 0)) ? 1 : 0;
+        false_hits += ((replaced != 0) && (gs_spike[i] == 0)) ? 1 : 0;
+    }
+    sen5x_interface_debug_print("sen5x: hampel window 11 removed %d of %d spikes, %d clean samples replaced.\n",
+                                removed, spikes, false_hits);
+    if (removed < spikes * 95 / 100)
+    {
+        sen5x_interface_debug_print("sen5x: too few spikes removed.\n");
+
+        return 1;
+    }
+
+    /* filter a sen55 sample in place */
+    (void)sen5x_filter_pm_init(&gs_bank, SEN5X_FILTER_MODE_HAMPEL, 11, 3.0f, 0.5f);
+    memset(&data, 0, sizeof(data));
+    data.pm_valid = 1;
+    for (i = 0; i < 10; i++)
+    {
+        data.pm1p0_ug_m3 = 5.0f;
+        data.pm2p5_ug_m3 = 6.0f;
+        data.pm4p0_ug_m3 = 7.0f;
+        data.pm10_ug_m3 = 8.0f;
+        (void)sen5x_filter_sen55(&gs_bank, &data);
+    }
+    data.pm2p5_ug_m3 = 300.0f;
+    (void)sen5x_filter_sen55(&gs_bank, &data);
+    if ((data.pm2p5_ug_m3 != 6.0f) || (gs_bank.replaced != 1))
+    {
+        sen5x_interface_debug_print("sen5x: pm bank failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: pm bank replaced a 300.0 ug/m3 spike with %0.1f ug/m3.\n", data.pm2p5_ug_m3);
+
+    /* speed against a sort of the window */
+    sink = 0.0f;
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        (void)sen5x_filter_init(&gs_filter, SEN5X_FILTER_MODE_HAMPEL, SEN5X_FILTER_MAX_WINDOW, 3.0f, 0.5f);
+        for (i = 0; i < SEN5X_FILTER_TEST_SAMPLES; i++)
+        {
+            (void)sen5x_filter_update(&gs_filter, gs_in[i], &out, &replaced);
+            sink += out;
+        }
+    }
+    filter_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / SEN5X_FILTER_TEST_SAMPLES;
+    start = clock();
+    for (i = 0; i < SEN5X_FILTER_TEST_SAMPLES; i++)
+    {
+        sink += a_sen5x_filter_test_reference(i, SEN5X_FILTER_MODE_HAMPEL, SEN5X_FILTER_MAX_WINDOW, 3.0f, 0.5f, &replaced);
+    }
+    sort_s = (double)(clock() - start) / CLOCKS_PER_SEC / SEN5X_FILTER_TEST_SAMPLES;
+    sen5x_interface_debug_print("sen5x: hampel window %d %0.1f ns per sample, window sort %0.1f ns per sample.\n",
+                                SEN5X_FILTER_MAX_WINDOW, filter_s * 1e9, sort_s * 1e9);
+    sen5x_interface_debug_print("sen5x: filter storage %d bytes per channel, checksum %0.1f.\n",
+                                (uint32_t)sizeof(sen5x_filter_t), sink);
+
+    /* finish filter test */
+    sen5x_interface_debug_print("sen5x: finish filter test.\n");
+
+    return 0;
+}
@@ -0,0 +1,342 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_fleet_test.c
+ * @brief     driver sen5x fleet test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_fleet_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_FLEET_TEST_SENSORS          12                /**< sensors in the building */
+#define SEN5X_FLEET_TEST_MIN_VALID        2                 /**< valid sensors a room keeps */
+#define SEN5X_FLEET_TEST_DAYS             35                /**< simulated days at 1 Hz */
+#define SEN5X_FLEET_TEST_FAULT_ON         950400            /**< sensor 5 faulty from day 11 */
+#define SEN5X_FLEET_TEST_FAULT_OFF        993600            /**< sensor 5 valid again at day 11.5 */
+#define SEN5X_FLEET_TEST_DOWN_ON          1503360           /**< host down from day 17.4 */
+#define SEN5X_FLEET_TEST_DOWN_OFF         1516320           /**< host up again at day 17.55 */
+#define SEN5X_FLEET_TEST_EPOCH_MS         1790000000000ULL  /**< wall clock of the plan start */
+
+/**
+ * @brief room table
+ */
+static const uint8_t gs_room[SEN5X_FLEET_TEST_SENSORS] = {10, 10, 10, 10, 20, 20, 20, 30, 30, 30, 30, 30};
+
+static sen5x_fleet_t gs_fleet;                                        /**< fleet scheduler */
+static uint8_t gs_plan[SEN5X_FLEET_PLAN_LENGTH(SEN5X_FLEET_TEST_SENSORS)];   /**< persisted plan */
+static uint32_t gs_plan_len;                                          /**< persisted plan length */
+
+/**
+ * @brief     set up a scheduler after a start
+ * @param[in] *fleet pointer to a fleet structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 set up failed
+ * @note      none
+ */
+static uint8_t a_sen5x_fleet_test_setup(sen5x_fleet_t *fleet)
+{
+    uint8_t s;
+
+    if (sen5x_fleet_init(fleet, SEN5X_FLEET_TEST_SENSORS, SEN5X_FLEET_DEFAULT_PERIOD_S,
+                         SEN5X_FLEET_DEFAULT_SLOT_MS, SEN5X_FLEET_TEST_MIN_VALID) != 0)
+    {
+        return 1;
+    }
+    for (s = 0; s < SEN5X_FLEET_TEST_SENSORS; s++)
+    {
+        if (sen5x_fleet_set_room(fleet, s, gs_room[s]) != 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     fleet test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_fleet_test(uint32_t times)
+{
+    uint8_t s;
+    uint8_t i;
+    uint8_t sensor;
+    uint8_t busy;
+    uint8_t max_busy;
+    uint8_t valid;
+    uint8_t min_valid;
+    uint32_t t;
+    uint32_t count[SEN5X_FLEET_TEST_SENSORS];
+    uint64_t now_ms;
+    uint64_t end_ms[SEN5X_FLEET_TEST_SENSORS];
+    clock_t start;
+    double poll_s;
+    sen5x_fleet_stats_t stats;
+    sen5x_fleet_stats_t before;
+
+    /* start fleet test */
+    sen5x_interface_debug_print("sen5x: start fleet test.\n");
+
+    /* check the params */
+    if ((sen5x_fleet_init(&gs_fleet, 0, 604800, 15000, 2) != 4) ||
+        (sen5x_fleet_init(&gs_fleet, 33, 604800, 15000, 2) != 4) ||
+        (sen5x_fleet_init(&gs_fleet, 12, 604801, 15000, 2) != 5) ||
+        (sen5x_fleet_init(&gs_fleet, 12, 60, 6000, 2) != 6) ||
+        (sen5x_fleet_init(&gs_fleet, 12, 604800, 0, 2) != 6))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+    (void)sen5x_fleet_init(&gs_fleet, 4, 604800, 15000, 2);
+    (void)sen5x_fleet_set_room(&gs_fleet, 3, 1);
+    if ((sen5x_fleet_poll(&gs_fleet, 0, &sensor) != 3) || (sen5x_fleet_plan(&gs_fleet, 0) != 4))
+    {
+        sen5x_interface_debug_print("sen5x: unplanned or too small room not rejected.\n");
+
+        return 1;
+    }
+
+    /* five weeks of a building */
+    if (a_sen5x_fleet_test_setup(&gs_fleet) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: fleet setup failed.\n");
+
+        return 1;
+    }
+    (void)sen5x_fleet_plan(&gs_fleet, SEN5X_FLEET_TEST_EPOCH_MS);
+    memset(count, 0, sizeof(count));
+    memset(end_ms, 0, sizeof(end_ms));
+    max_busy = 0;
+    min_valid = SEN5X_FLEET_TEST_SENSORS;
+    for (t = 0; t < SEN5X_FLEET_TEST_DAYS * 86400; t++)
+    {
+        now_ms = SEN5X_FLEET_TEST_EPOCH_MS + (uint64_t)t * 1000;
+        if (t == SEN5X_FLEET_TEST_DOWN_ON)
+        {
+            /* power loss, the plan survives in storage */
+            (void)sen5x_fleet_get_stats(&gs_fleet, &before);
+            memset(&gs_fleet, 0xA5, sizeof(gs_fleet));
+        }
+        if ((t >= SEN5X_FLEET_TEST_DOWN_ON) && (t < SEN5X_FLEET_TEST_DOWN_OFF))
+        {
+            continue;
+        }
+        if (t == SEN5X_FLEET_TEST_DOWN_OFF)
+        {
+            if ((a_sen5x_fleet_test_setup(&gs_fleet) != 0) || (sen5x_fleet_load(&gs_fleet, gs_plan, gs_plan_len) != 0))
+            {
+                sen5x_interface_debug_print("sen5x: plan load failed.\n");
+
+                return 1;
+            }
+        }
+        (void)sen5x_fleet_set_valid(&gs_fleet, 5, ((t >= SEN5X_FLEET_TEST_FAULT_ON) && (t < SEN5X_FLEET_TEST_FAULT_OFF)) ? 0 : 1);
+        if (sen5x_fleet_poll(&gs_fleet, now_ms, &sensor) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: fleet poll failed.\n");
+
+            return 1;
+        }
+        if (sensor != SEN5X_FLEET_NONE)
+        {
+            /* sen5x_start_fan_cleaning of the sensor goes here */
+            (void)sen5x_fleet_done(&gs_fleet, sensor, now_ms);
+            (void)sen5x_fleet_save(&gs_fleet, gs_plan, sizeof(gs_plan), &gs_plan_len);
+            end_ms[sensor] = now_ms + 12000;
+            count[sensor]++;
+        }
+
+        /* room check with the 10 s cleaning and 2 s settle time */
+        busy = 0;
+        for (s = 0; s < SEN5X_FLEET_TEST_SENSORS; s++)
+        {
+            busy += (end_ms[s] > now_ms) ? 1 : 0;
+        }
+        max_busy = (busy > max_busy) ? busy : max_busy;
+        for (s = 0; s < SEN5X_FLEET_TEST_SENSORS; s++)
+        {
+            valid = 0;
+            for (i = 0; i < SEN5X_FLEET_TEST_SENSORS; i++)
+            {
+                if ((gs_room[i] == gs_room[s]) && (end_ms[i] <= now_ms) &&
+                    ((i != 5) || (t < SEN5X_FLEET_TEST_FAULT_ON) || (t >= SEN5X_FLEET_TEST_FAULT_OFF)))
+                {
+                    valid++;
+                }
+            }
+            min_valid = (valid < min_valid) ? valid : min_valid;
+        }
+    }
+    (void)sen5x_fleet_get_stats(&gs_fleet, &stats);
+    stats.cleanings += before.cleanings;
+    stats.deferred += before.deferred;
+    stats.max_delay_ms = (before.max_delay_ms > stats.max_delay_ms) ? before.max_delay_ms : stats.max_delay_ms;
+    sen5x_interface_debug_print("sen5x: %d cleanings in %d days, at most %d sensor cleaning at once, at least %d valid sensors per room.\n",
+                                (uint32_t)stats.cleanings, SEN5X_FLEET_TEST_DAYS, max_busy, min_valid);
+    sen5x_interface_debug_print("sen5x: %d cleanings deferred by a faulty neighbour, longest wait %d s, plan %d bytes.\n",
+                                (uint32_t)stats.deferred, (uint32_t)(stats.max_delay_ms / 1000), gs_plan_len);
+    for (s = 0; s < SEN5X_FLEET_TEST_SENSORS; s++)
+    {
+        if (count[s] != SEN5X_FLEET_TEST_DAYS / 7)
+        {
+            sen5x_interface_debug_print("sen5x: sensor %d cleaned %d times.\n", s, count[s]);
+
+            return 1;
+        }
+    }
+    if ((max_busy != 1) || (min_valid < SEN5X_FLEET_TEST_MIN_VALID) || (stats.deferred != 1) ||
+        (stats.max_delay_ms / 1000 < 36000 - 60) || (stats.max_delay_ms / 1000 > 36000 + 60))
+    {
+        sen5x_interface_debug_print("sen5x: plan is wrong.\n");
+
+        return 1;
+    }
+
+    /* a backlog after a long outage with a restart inside every slot */
+    (void)a_sen5x_fleet_test_setup(&gs_fleet);
+    (void)sen5x_fleet_plan(&gs_fleet, SEN5X_FLEET_TEST_EPOCH_MS);
+    (void)sen5x_fleet_save(&gs_fleet, gs_plan, sizeof(gs_plan), &gs_plan_len);
+    memset(count, 0, sizeof(count));
+    memset(end_ms, 0, sizeof(end_ms));
+    max_busy = 0;
+    for (t = 0; t < 600; t++)
+    {
+        now_ms = SEN5X_FLEET_TEST_EPOCH_MS + (uint64_t)SEN5X_FLEET_DEFAULT_PERIOD_S * 1000 + (uint64_t)t * 1000;
+        for (s = 0; s < SEN5X_FLEET_TEST_SENSORS; s++)
+        {
+            if (end_ms[s] == now_ms + 7000)
+            {
+                /* power loss 5 s into the cleaning */
+                memset(&gs_fleet, 0xA5, sizeof(gs_fleet));
+                if ((a_sen5x_fleet_test_setup(&gs_fleet) != 0) || (sen5x_fleet_load(&gs_fleet, gs_plan, gs_plan_len) != 0))
+                {
+                    sen5x_interface_debug_print("sen5x: plan load failed.\n");
+
+                    return 1;
+                }
+            }
+        }
+        if (sen5x_fleet_poll(&gs_fleet, now_ms, &sensor) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: fleet poll failed.\n");
+
+            return 1;
+        }
+        if (sensor != SEN5X_FLEET_NONE)
+        {
+            (void)sen5x_fleet_done(&gs_fleet, sensor, now_ms);
+            (void)sen5x_fleet_save(&gs_fleet, gs_plan, sizeof(gs_plan), &gs_plan_len);
+            end_ms[sensor] = now_ms + 12000;
+            count[sensor]++;
+        }
+        busy = 0;
+        for (s = 0; s < SEN5X_FLEET_TEST_SENSORS; s++)
+        {
+            busy += (end_ms[s] > now_ms) ? 1 : 0;
+        }
+        max_busy = (busy > max_busy) ? busy : max_busy;
+    }
+    for (s = 0; s < SEN5X_FLEET_TEST_SENSORS; s++)
+    {
+        if (count[s] != 1)
+        {
+            sen5x_interface_debug_print("sen5x: sensor %d cleaned %d times in the backlog.\n", s, count[s]);
+
+            return 1;
+        }
+    }
+    if (max_busy != 1)
+    {
+        sen5x_interface_debug_print("sen5x: %d sensors cleaned at once after a restart.\n", max_busy);
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: backlog of %d sensors with a restart in every slot cleaned one at a time.\n",
+                                SEN5X_FLEET_TEST_SENSORS);
+
+    /* damaged and stale plans */
+    (void)a_sen5x_fleet_test_setup(&gs_fleet);
+    gs_plan[30] ^= 0x01;
+    if (sen5x_fleet_load(&gs_fleet, gs_plan, gs_plan_len) != 4)
+    {
+        sen5x_interface_debug_print("sen5x: damaged plan not rejected.\n");
+
+        return 1;
+    }
+    gs_plan[30] ^= 0x01;
+    (void)sen5x_fleet_set_room(&gs_fleet, 11, 20);
+    if ((sen5x_fleet_load(&gs_fleet, gs_plan, gs_plan_len) != 5) || (sen5x_fleet_load(&gs_fleet, gs_plan, 20) != 4))
+    {
+        sen5x_interface_debug_print("sen5x: stale plan not rejected.\n");
+
+        return 1;
+    }
+
+    /* poll speed */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    (void)sen5x_fleet_init(&gs_fleet, SEN5X_FLEET_MAX_SENSORS, SEN5X_FLEET_DEFAULT_PERIOD_S, SEN5X_FLEET_DEFAULT_SLOT_MS, 2);
+    for (s = 0; s < SEN5X_FLEET_MAX_SENSORS; s++)
+    {
+        (void)sen5x_fleet_set_room(&gs_fleet, s, s / 4);
+    }
+    (void)sen5x_fleet_plan(&gs_fleet, 0);
+    start = clock();
+    for (t = 0; t < times * 100000; t++)
+    {
+        (void)sen5x_fleet_poll(&gs_fleet, (uint64_t)t * 1000, &sensor);
+        if (sensor != SEN5X_FLEET_NONE)
+        {
+            (void)sen5x_fleet_done(&gs_fleet, sensor, (uint64_t)t * 1000);
+        }
+    }
+    poll_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / 100000;
+    sen5x_interface_debug_print("sen5x: %0.1f ns per poll of %d sensors, state %d bytes.\n",
+                                poll_s * 1e9, SEN5X_FLEET_MAX_SENSORS, (uint32_t)sizeof(sen5x_fleet_t));
+
+    /* finish fleet test */
+    sen5x_interface_debug_print("sen5x: finish fleet test.\n");
+
+    return 0;
+}
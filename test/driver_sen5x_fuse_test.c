@@ -0,0 +1,338 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_fuse_test.c
+ * @brief     driver sen5x fuse test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_fuse_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_FUSE_TEST_SENSORS        6             /**< sensors in the room */
+#define SEN5X_FUSE_TEST_TICKS          21600         /**< six hours at 1 Hz */
+#define SEN5X_FUSE_TEST_SETTLE         3600          /**< ticks left out of the checks */
+#define SEN5X_FUSE_TEST_PM_FAULT       8000          /**< first tick of the pm fault of sensor 2 */
+#define SEN5X_FUSE_TEST_LASER          12000         /**< first tick of the laser error of sensor 4 */
+#define SEN5X_FUSE_TEST_T_FAULT        15000         /**< first tick of the temperature fault of sensor 1 */
+#define SEN5X_FUSE_TEST_FAULT_LEN      1000          /**< fault length in ticks */
+
+/**
+ * @brief true sensor bias table
+ */
+static const float gs_bias[SEN5X_FUSE_TEST_SENSORS][8] =
+{
+    { 2.0f,  2.0f,  2.0f,  2.0f,  1.0f,  0.20f,  5.0f,  1.0f},
+    {-1.5f, -1.5f, -1.5f, -1.5f, -1.0f, -0.10f, -5.0f, -1.0f},
+    { 0.5f,  0.5f,  0.5f,  0.5f,  0.5f,  0.05f,  2.0f,  0.0f},
+    {-2.0f, -2.0f, -2.0f, -2.0f, -0.5f, -0.15f, -3.0f,  0.5f},
+    { 1.0f,  1.0f,  1.0f,  1.0f,  0.0f,  0.10f,  1.0f, -0.5f},
+    { 0.0f,  0.0f,  0.0f,  0.0f,  0.0f, -0.10f,  0.0f,  0.0f},
+};
+
+/**
+ * @brief channel noise table
+ */
+static const float gs_noise[8] = {1.0f, 1.0f, 1.0f, 1.0f, 0.3f, 0.03f, 2.0f, 0.5f};
+
+static sen5x_fuse_t gs_fuse;                  /**< fuse */
+static sen5x_resample_row_t gs_row;           /**< aligned row */
+static uint32_t gs_seed;                      /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_fuse_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief  get a unit gaussian like number
+ * @return number
+ * @note   sum of four uniform numbers
+ */
+static float a_sen5x_fuse_test_gauss(void)
+{
+    uint8_t i;
+    float sum;
+
+    sum = 0.0f;
+    for (i = 0; i < 4; i++)
+    {
+        sum += (float)(a_sen5x_fuse_test_random() & 0xFFFF) / 65535.0f;
+    }
+
+    return (sum - 2.0f) * 1.7320508f;
+}
+
+/**
+ * @brief     get the true room value
+ * @param[in] c channel index
+ * @param[in] t tick
+ * @return    true value
+ * @note      none
+ */
+static float a_sen5x_fuse_test_truth(uint8_t c, uint32_t t)
+{
+    const float base[8] = {10.0f, 12.0f, 13.0f, 14.0f, 45.0f, 23.0f, 100.0f, 1.0f};
+    const float swing[8] = {6.0f, 8.0f, 8.5f, 9.0f, 5.0f, 1.0f, 20.0f, 0.5f};
+
+    return base[c] + swing[c] * sinf(6.2831853f * (float)t / 3600.0f + (float)c);
+}
+
+/**
+ * @brief     fill the row of a tick
+ * @param[in] t tick
+ * @note      sensor 2 reads pm 60 ug/m3 high, sensor 4 reports a laser error with zero pm and
+ *            sensor 1 reads 3 degrees high during their faults
+ */
+static void a_sen5x_fuse_test_fill(uint32_t t)
+{
+    uint8_t s;
+    uint8_t c;
+    float v;
+
+    gs_row.tick_ms = (uint64_t)t * 1000;
+    gs_row.valid = (1UL << SEN5X_FUSE_TEST_SENSORS) - 1;
+    gs_row.streams = SEN5X_FUSE_TEST_SENSORS;
+    gs_row.channels = 8;
+    for (s = 0; s < SEN5X_FUSE_TEST_SENSORS; s++)
+    {
+        for (c = 0; c < 8; c++)
+        {
+            v = a_sen5x_fuse_test_truth(c, t) + gs_bias[s][c] + gs_noise[c] * a_sen5x_fuse_test_gauss();
+            if ((s == 2) && (c < 4) && (t >= SEN5X_FUSE_TEST_PM_FAULT) &&
+                (t < SEN5X_FUSE_TEST_PM_FAULT + SEN5X_FUSE_TEST_FAULT_LEN))
+            {
+                v += 60.0f;
+            }
+            if ((s == 4) && (c < 4) && (t >= SEN5X_FUSE_TEST_LASER) &&
+                (t < SEN5X_FUSE_TEST_LASER + SEN5X_FUSE_TEST_FAULT_LEN))
+            {
+                v = 0.0f;
+            }
+            if ((s == 1) && (c == 5) && (t >= SEN5X_FUSE_TEST_T_FAULT) &&
+                (t < SEN5X_FUSE_TEST_T_FAULT + SEN5X_FUSE_TEST_FAULT_LEN))
+            {
+                v += 3.0f;
+            }
+            gs_row.value[c][s] = v;
+        }
+    }
+    (void)sen5x_fuse_set_status(&gs_fuse, 4, ((t >= SEN5X_FUSE_TEST_LASER) &&
+                                (t < SEN5X_FUSE_TEST_LASER + SEN5X_FUSE_TEST_FAULT_LEN)) ? SEN5X_STATUS_LASER_ERROR : 0);
+}
+
+/**
+ * @brief     fuse test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_fuse_test(uint32_t times)
+{
+    uint8_t i;
+    uint8_t s;
+    uint8_t c;
+    uint32_t t;
+    uint32_t n;
+    uint32_t flagged[2];
+    uint32_t false_flags;
+    uint32_t good_values;
+    float mean_bias[8];
+    float bias[8];
+    float naive;
+    float err;
+    float bias_err;
+    double fused_sq[8];
+    double naive_sq;
+    clock_t start;
+    double update_s;
+    sen5x_fuse_result_t result;
+    sen5x_fuse_stats_t stats;
+    const sen5x_fuse_method_t method[2] = {SEN5X_FUSE_METHOD_MEDIAN, SEN5X_FUSE_METHOD_TRIMMED_MEAN};
+    const char *name[2] = {"median", "trimmed mean"};
+
+    /* start fuse test */
+    sen5x_interface_debug_print("sen5x: start fuse test.\n");
+
+    /* check the params */
+    if ((sen5x_fuse_init(&gs_fuse, SEN5X_ARCHIVE_LAYOUT_RAW, 6, SEN5X_FUSE_METHOD_MEDIAN, 0.2f, 600) != 4) ||
+        (sen5x_fuse_init(&gs_fuse, SEN5X_ARCHIVE_LAYOUT_MEASURED, 33, SEN5X_FUSE_METHOD_MEDIAN, 0.2f, 600) != 5) ||
+        (sen5x_fuse_init(&gs_fuse, SEN5X_ARCHIVE_LAYOUT_MEASURED, 6, (sen5x_fuse_method_t)2, 0.2f, 600) != 6) ||
+        (sen5x_fuse_init(&gs_fuse, SEN5X_ARCHIVE_LAYOUT_MEASURED, 6, SEN5X_FUSE_METHOD_MEDIAN, 0.5f, 600) != 7))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+    (void)sen5x_fuse_init(&gs_fuse, SEN5X_ARCHIVE_LAYOUT_MEASURED, 6, SEN5X_FUSE_METHOD_MEDIAN, 0.2f, 600);
+    a_sen5x_fuse_test_fill(0);
+    gs_row.channels = 10;
+    if (sen5x_fuse_update(&gs_fuse, &gs_row, &result) != 4)
+    {
+        sen5x_interface_debug_print("sen5x: mismatched row not rejected.\n");
+
+        return 1;
+    }
+
+    /* a room with faulty units */
+    for (c = 0; c < 8; c++)
+    {
+        mean_bias[c] = 0.0f;
+        for (s = 0; s < SEN5X_FUSE_TEST_SENSORS; s++)
+        {
+            mean_bias[c] += gs_bias[s][c] / SEN5X_FUSE_TEST_SENSORS;
+        }
+    }
+    for (i = 0; i < 2; i++)
+    {
+        gs_seed = 0x4655;
+        (void)sen5x_fuse_init(&gs_fuse, SEN5X_ARCHIVE_LAYOUT_MEASURED, SEN5X_FUSE_TEST_SENSORS, method[i], 0.2f, 3600);
+        memset(fused_sq, 0, sizeof(fused_sq));
+        naive_sq = 0.0;
+        flagged[0] = 0;
+        flagged[1] = 0;
+        false_flags = 0;
+        good_values = 0;
+        n = 0;
+        for (t = 0; t < SEN5X_FUSE_TEST_TICKS; t++)
+        {
+            a_sen5x_fuse_test_fill(t);
+            if (sen5x_fuse_update(&gs_fuse, &gs_row, &result) != 0)
+            {
+                sen5x_interface_debug_print("sen5x: fuse update failed.\n");
+
+                return 1;
+            }
+            if (t < SEN5X_FUSE_TEST_SETTLE)
+            {
+                continue;
+            }
+            n++;
+            for (c = 0; c < 8; c++)
+            {
+                err = result.value[c] - a_sen5x_fuse_test_truth(c, t) - mean_bias[c];
+                fused_sq[c] += err * err;
+            }
+            naive = 0.0f;
+            for (s = 0; s < SEN5X_FUSE_TEST_SENSORS; s++)
+            {
+                naive += gs_row.value[1][s] / SEN5X_FUSE_TEST_SENSORS;
+            }
+            err = naive - a_sen5x_fuse_test_truth(1, t) - mean_bias[1];
+            naive_sq += err * err;
+            for (s = 0; s < SEN5X_FUSE_TEST_SENSORS; s++)
+            {
+                for (c = 0; c < 8; c++)
+                {
+                    if (((s == 2) && (c < 4) && (t >= SEN5X_FUSE_TEST_PM_FAULT) &&
+                         (t < SEN5X_FUSE_TEST_PM_FAULT + SEN5X_FUSE_TEST_FAULT_LEN)) ||
+                        ((s == 1) && (c == 5) && (t >= SEN5X_FUSE_TEST_T_FAULT) &&
+                         (t < SEN5X_FUSE_TEST_T_FAULT + SEN5X_FUSE_TEST_FAULT_LEN)))
+                    {
+                        flagged[(s == 2) ? 0 : 1] += ((result.outlier[c] >> s) & 1) * ((c == 1) || (c == 5));
+                        continue;
+                    }
+                    if (((result.excluded[c] >> s) & 1) != 0)
+                    {
+                        continue;
+                    }
+                    good_values++;
+                    false_flags += (result.outlier[c] >> s) & 1;
+                }
+            }
+        }
+        bias_err = 0.0f;
+        for (s = 0; s < SEN5X_FUSE_TEST_SENSORS; s++)
+        {
+            (void)sen5x_fuse_get_bias(&gs_fuse, s, bias);
+            for (c = 0; c < 8; c++)
+            {
+                if (((s == 2) && (c < 4)) || ((s == 1) && (c == 5)))
+                {
+                    continue;
+                }
+                err = fabsf(bias[c] - (gs_bias[s][c] - mean_bias[c])) / gs_noise[c];
+                bias_err = (err > bias_err) ? err : bias_err;
+            }
+        }
+        (void)sen5x_fuse_get_stats(&gs_fuse, 4, &stats);
+        sen5x_interface_debug_print("sen5x: %s of %d sensors, pm2.5 rms error %0.2f ug/m3 against %0.2f ug/m3 for the plain mean.\n",
+                                    name[i], SEN5X_FUSE_TEST_SENSORS, sqrt(fused_sq[1] / n), sqrt(naive_sq / n));
+        sen5x_interface_debug_print("sen5x: temperature rms error %0.3f C, humidity %0.2f percent, voc %0.2f, nox %0.2f.\n",
+                                    sqrt(fused_sq[5] / n), sqrt(fused_sq[4] / n), sqrt(fused_sq[6] / n), sqrt(fused_sq[7] / n));
+        sen5x_interface_debug_print("sen5x: pm fault flagged %d of %d ticks, temperature fault %d of %d, %d false flags in %d values.\n",
+                                    flagged[0], SEN5X_FUSE_TEST_FAULT_LEN, flagged[1], SEN5X_FUSE_TEST_FAULT_LEN, false_flags, good_values);
+        sen5x_interface_debug_print("sen5x: %d pm values left out by the laser error, max bias error of the healthy channels %0.2f noise.\n",
+                                    (uint32_t)stats.excluded, bias_err);
+        if ((sqrt(fused_sq[1] / n) > 1.0) || (sqrt(fused_sq[5] / n) > 0.05) ||
+            (flagged[0] < SEN5X_FUSE_TEST_FAULT_LEN * 95 / 100) || (flagged[1] < SEN5X_FUSE_TEST_FAULT_LEN * 95 / 100) ||
+            (false_flags > good_values / 1000) || (stats.excluded != 4 * SEN5X_FUSE_TEST_FAULT_LEN) || (bias_err > 1.0f))
+        {
+            sen5x_interface_debug_print("sen5x: consensus is too loose.\n");
+
+            return 1;
+        }
+    }
+
+    /* update speed */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    (void)sen5x_fuse_init(&gs_fuse, SEN5X_ARCHIVE_LAYOUT_MEASURED, SEN5X_FUSE_TEST_SENSORS, SEN5X_FUSE_METHOD_TRIMMED_MEAN, 0.2f, 600);
+    a_sen5x_fuse_test_fill(0);
+    start = clock();
+    for (t = 0; t < times * 100000; t++)
+    {
+        gs_row.value[1][t % SEN5X_FUSE_TEST_SENSORS] += 0.001f;
+        (void)sen5x_fuse_update(&gs_fuse, &gs_row, &result);
+    }
+    update_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / 100000;
+    sen5x_interface_debug_print("sen5x: %0.1f ns per row of %d sensors and 8 channels, state %d bytes.\n",
+                                update_s * 1e9, SEN5X_FUSE_TEST_SENSORS, (uint32_t)sizeof(sen5x_fuse_t));
+
+    /* finish fuse test */
+    sen5x_interface_debug_print("sen5x: finish fuse test.\n");
+
+    return 0;
+}
@@ -0,0 +1,621 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_gas_test.c
+ * @brief     driver sen5x gas test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_gas_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_GAS_TEST_SAMPLES        (3600 * 12)        /**< twelve hours at one sample per second */
+#define SEN5X_GAS_TEST_TUNINGS        3                  /**< parallel tunings */
+#define SEN5X_GAS_TEST_LEARNING       (3600 * 8)         /**< past the initial learning phases of both gases */
+
+/**
+ * @brief gas test reference structure definition
+ */
+typedef struct sen5x_gas_test_ref_s
+{
+    uint8_t type;                      /**< gas type */
+    double index_offset;               /**< index offset */
+    double sraw_minimum;               /**< sraw minimum */
+    double gating_max_duration;        /**< gating max duration in minutes */
+    double init_duration_mean;         /**< initial mean duration */
+    double init_duration_variance;     /**< initial variance duration */
+    double gating_threshold;           /**< gating threshold */
+    double index_gain;                 /**< index gain */
+    double uptime;                     /**< uptime */
+    double sraw;                       /**< last sraw */
+    double gas_index;                  /**< last gas index */
+    uint8_t mve_initialized;           /**< estimator initialized flag */
+    double mean;                       /**< estimator mean */
+    double offset;                     /**< estimator sraw offset */
+    double std;                        /**< estimator std */
+    double gamma_mean;                 /**< long term mean gain */
+    double gamma_variance;             /**< long term variance gain */
+    double gamma_initial_mean;         /**< initial mean gain */
+    double gamma_initial_variance;     /**< initial variance gain */
+    double uptime_gamma;               /**< learning time */
+    double uptime_gating;              /**< gating time */
+    double gating_duration;            /**< gated minutes */
+    uint8_t lp_initialized;            /**< lowpass initialized flag */
+    double x1;                         /**< fast lowpass state */
+    double x2;                         /**< slow lowpass state */
+    double x3;                         /**< adaptive lowpass state */
+} sen5x_gas_test_ref_t;
+
+/**
+ * @brief voc index of a constant sraw at 1 s and 10 s sampling, derived by hand from the sensirion gas index
+ *        algorithm in float
+ * @note  the 45 s blackout is checked before the uptime grows, the first index runs before the estimator is
+ *        initialized and clamps to 1, then the sigmoid gives 100.14 and the adaptive lowpass with 20 s and
+ *        500 s time constants ramps to it, the value doesn't depend on the sraw
+ */
+static const uint8_t gs_voc_ramp_1s[160] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 3, 6, 9, 13, 17, 20, 24, 28, 31, 34, 37,
+    40, 43, 46, 49, 51, 53, 56, 58, 60, 62, 63, 65, 67, 68, 70, 71, 73, 74, 75, 77,
+    78, 79, 80, 81, 82, 83, 83, 84, 85, 86, 86, 87, 88, 88, 89, 89, 90, 90, 91, 91,
+    92, 92, 92, 93, 93, 93, 94, 94, 94, 95, 95, 95, 95, 96, 96, 96, 96, 96, 97, 97,
+    97, 97, 97, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 99, 99, 99, 99, 99, 99,
+    99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 100, 100, 100, 100, 100, 100, 100,
+};
+static const uint8_t gs_voc_ramp_10s[20] =
+{
+    0, 0, 0, 0, 0, 1, 32, 55, 70, 80, 87, 91, 94, 96, 98, 98, 99, 99, 100, 100,
+};
+
+static sen5x_raw_t gs_raw[SEN5X_GAS_TEST_SAMPLES];                        /**< raw stream */
+static int32_t gs_index[SEN5X_GAS_TEST_TUNINGS][SEN5X_GAS_TEST_SAMPLES];  /**< index streams */
+static sen5x_gas_t gs_gas[SEN5X_GAS_TEST_TUNINGS];                        /**< gas algorithms */
+static sen5x_gas_test_ref_t gs_ref;                                       /**< double reference */
+static uint32_t gs_seed;                                                  /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_gas_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     init the double reference with the default tuning
+ * @param[in] *ref pointer to a reference structure
+ * @param[in] type gas type
+ * @note      one second sampling interval
+ */
+static void a_sen5x_gas_test_ref_init(sen5x_gas_test_ref_t *ref, uint8_t type)
+{
+    double hours;
+
+    memset(ref, 0, sizeof(sen5x_gas_test_ref_t));
+    hours = 1.0 / 3600.0;
+    ref->type = type;
+    ref->index_offset = (type == SEN5X_GAS_TYPE_NOX) ? 1.0 : 100.0;
+    ref->sraw_minimum = (type == SEN5X_GAS_TYPE_NOX) ? 10000.0 : 20000.0;
+    ref->gating_max_duration = (type == SEN5X_GAS_TYPE_NOX) ? 720.0 : 180.0;
+    ref->init_duration_mean = (type == SEN5X_GAS_TYPE_NOX) ? (3600.0 * 4.75) : (3600.0 * 0.75);
+    ref->init_duration_variance = (type == SEN5X_GAS_TYPE_NOX) ? (3600.0 * 5.70) : (3600.0 * 1.45);
+    ref->gating_threshold = (type == SEN5X_GAS_TYPE_NOX) ? 30.0 : 340.0;
+    ref->index_gain = 230.0;
+    ref->std = 50.0;
+    ref->gamma_mean = 512.0 * hours / (12.0 + hours);
+    ref->gamma_variance = 64.0 * hours / (12.0 + hours);
+    ref->gamma_initial_mean = 512.0 / (((type == SEN5X_GAS_TYPE_NOX) ? 1200.0 : 20.0) + 1.0);
+    ref->gamma_initial_variance = 64.0 / (2500.0 + 1.0);
+}
+
+/**
+ * @brief     sigmoid of the reference
+ * @param[in] sample sample
+ * @param[in] x0 center
+ * @param[in] k slope
+ * @return    sigmoid value
+ * @note      none
+ */
+static double a_sen5x_gas_test_sigmoid(double sample, double x0, double k)
+{
+    double x;
+
+    x = k * (sample - x0);
+    if (x < -50.0)
+    {
+        return 1.0;
+    }
+    if (x > 50.0)
+    {
+        return 0.0;
+    }
+
+    return 1.0 / (1.0 + exp(x));
+}
+
+/**
+ * @brief     process one sample with the double reference
+ * @param[in] *ref pointer to a reference structure
+ * @param[in] sraw sraw ticks
+ * @return    gas index
+ * @note      floating point form of the published gas index algorithm
+ */
+static int32_t a_sen5x_gas_test_ref_process(sen5x_gas_test_ref_t *ref, int32_t sraw)
+{
+    double s;
+    double x;
+    double shift;
+    double sgm;
+    double gm;
+    double sgv;
+    double gv;
+    double delta;
+    double c;
+    double scaling;
+    double tau;
+    double a3;
+
+    if (ref->uptime <= 45.0)
+    {
+        ref->uptime += 1.0;
+
+        return (int32_t)(ref->gas_index + 0.5);
+    }
+    if ((sraw > 0) && (sraw < 65000))
+    {
+        s = (double)sraw;
+        s = (s < ref->sraw_minimum + 1.0) ? (ref->sraw_minimum + 1.0) : s;
+        s = (s > ref->sraw_minimum + 32767.0) ? (ref->sraw_minimum + 32767.0) : s;
+        ref->sraw = s - ref->sraw_minimum;
+    }
+    if ((ref->type == SEN5X_GAS_TYPE_VOC) || (ref->mve_initialized != 0))
+    {
+        if (ref->type == SEN5X_GAS_TYPE_NOX)
+        {
+            s = (ref->sraw - (ref->mean + ref->offset)) / 2000.0 * ref->index_gain;
+            x = -0.0101 * (s - 614.0);
+        }
+        else
+        {
+            s = (ref->sraw - (ref->mean + ref->offset)) / (-(ref->std + 220.0)) * ref->index_gain;
+            x = -0.0065 * (s - 213.0);
+        }
+        if (x < -50.0)
+        {
+            ref->gas_index = 500.0;
+        }
+        else if (x > 50.0)
+        {
+            ref->gas_index = 0.0;
+        }
+        else if (s >= 0.0)
+        {
+            shift = (ref->type == SEN5X_GAS_TYPE_NOX) ? ((500.0 / 499.0) * (1.0 - ref->index_offset)) :
+                                                        ((500.0 - 5.0 * ref->index_offset) / 4.0);
+            ref->gas_index = (500.0 + shift) / (1.0 + exp(x)) - shift;
+        }
+        else
+        {
+            ref->gas_index = ref->index_offset / ((ref->type == SEN5X_GAS_TYPE_NOX) ? 1.0 : 100.0) *
+                             (500.0 / (1.0 + exp(x)));
+        }
+    }
+    else
+    {
+        ref->gas_index = ref->index_offset;
+    }
+    if (ref->lp_initialized == 0)
+    {
+        ref->x1 = ref->gas_index;
+        ref->x2 = ref->gas_index;
+        ref->x3 = ref->gas_index;
+        ref->lp_initialized = 1;
+    }
+    ref->x1 += (ref->gas_index - ref->x1) / 21.0;
+    ref->x2 += (ref->gas_index - ref->x2) / 501.0;
+    tau = 480.0 * exp(-0.2 * fabs(ref->x1 - ref->x2)) + 20.0;
+    a3 = 1.0 / (1.0 + tau);
+    ref->x3 = (1.0 - a3) * ref->x3 + a3 * ref->gas_index;
+    ref->gas_index = (ref->x3 < 0.5) ? 0.5 : ref->x3;
+    if (ref->sraw > 0.0)
+    {
+        if (ref->mve_initialized == 0)
+        {
+            ref->mve_initialized = 1;
+            ref->offset = ref->sraw;
+            ref->mean = 0.0;
+        }
+        else
+        {
+            if ((ref->mean >= 100.0) || (ref->mean <= -100.0))
+            {
+                ref->offset += ref->mean;
+                ref->mean = 0.0;
+            }
+            s = ref->sraw - ref->offset;
+            ref->uptime_gamma += (ref->uptime_gamma < 32766.0) ? 1.0 : 0.0;
+            ref->uptime_gating += (ref->uptime_gating < 32766.0) ? 1.0 : 0.0;
+            sgm = a_sen5x_gas_test_sigmoid(ref->uptime_gamma, ref->init_duration_mean, 0.01);
+            gm = ref->gamma_mean + (ref->gamma_initial_mean - ref->gamma_mean) * sgm;
+            x = ref->gating_threshold + (510.0 - ref->gating_threshold) *
+                a_sen5x_gas_test_sigmoid(ref->uptime_gating, ref->init_duration_mean, 0.01);
+            c = a_sen5x_gas_test_sigmoid(ref->gas_index, x, 0.09);
+            gm *= c;
+            sgv = a_sen5x_gas_test_sigmoid(ref->uptime_gamma, ref->init_duration_variance, 0.01);
+            gv = ref->gamma_variance + (ref->gamma_initial_variance - ref->gamma_variance) * (sgv - sgm);
+            x = ref->gating_threshold + (510.0 - ref->gating_threshold) *
+                a_sen5x_gas_test_sigmoid(ref->uptime_gating, ref->init_duration_variance, 0.01);
+            gv *= a_sen5x_gas_test_sigmoid(ref->gas_index, x, 0.09);
+            ref->gating_duration += (1.0 / 60.0) * ((1.0 - c) * 1.3 - 0.3);
+            ref->gating_duration = (ref->gating_duration < 0.0) ? 0.0 : ref->gating_duration;
+            if (ref->gating_duration > ref->gating_max_duration)
+            {
+                ref->uptime_gating = 0.0;
+            }
+            delta = (s - ref->mean) / 64.0;
+            c = ref->std + fabs(delta);
+            scaling = (c > 1440.0) ? ((c / 1440.0) * (c / 1440.0)) : 1.0;
+            ref->std = sqrt(scaling * (64.0 - gv)) *
+                       sqrt(ref->std * (ref->std / (64.0 * scaling)) + gv * delta / scaling * delta);
+            ref->mean += gm * delta / 8.0;
+        }
+    }
+
+    return (int32_t)(ref->gas_index + 0.5);
+}
+
+/**
+ * @brief  check the golden vectors of the reference algorithm
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   the blackout and the first index must match, the ramp may differ by 1 for the fixed point,
+ *         a constant sraw must hold 100 and 1 through the initial learning phases
+ */
+static uint8_t a_sen5x_gas_test_golden(void)
+{
+    static const uint16_t voc_level[4] = {22000, 30000, 40000, 50000};
+    static const uint16_t nox_level[4] = {12000, 15000, 20000, 27500};
+    uint32_t i;
+    uint32_t l;
+    int32_t index;
+    int32_t diff;
+    int32_t max_diff;
+
+    max_diff = 0;
+    for (l = 0; l < 4; l++)
+    {
+        /* voc blackout, ramp and learning phase */
+        (void)sen5x_gas_init(&gs_gas[0], SEN5X_GAS_TYPE_VOC, SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL);
+        for (i = 0; i < SEN5X_GAS_TEST_LEARNING; i++)
+        {
+            (void)sen5x_gas_process(&gs_gas[0], voc_level[l], &index);
+            diff = index - ((i < 160) ? gs_voc_ramp_1s[i] : 100);
+            diff = (diff < 0) ? -diff : diff;
+            max_diff = (diff > max_diff) ? diff : max_diff;
+            if (((i < 47) || (i >= 160)) ? (diff != 0) : (diff > 1))
+            {
+                sen5x_interface_debug_print("sen5x: voc index %d at sraw %d sample %d differs from the golden vector.\n",
+                                            index, voc_level[l], i + 1);
+
+                return 1;
+            }
+        }
+
+        /* invalid sraw is ignored */
+        (void)sen5x_gas_process(&gs_gas[0], 0, &index);
+        if (index != 100)
+        {
+            sen5x_interface_debug_print("sen5x: voc index moved on a zero sraw.\n");
+
+            return 1;
+        }
+        (void)sen5x_gas_process(&gs_gas[0], 65535, &index);
+        if (index != 100)
+        {
+            sen5x_interface_debug_print("sen5x: voc index moved on a saturated sraw.\n");
+
+            return 1;
+        }
+
+        /* a lower voc sraw raises the index */
+        for (i = 0; i < 600; i++)
+        {
+            (void)sen5x_gas_process(&gs_gas[0], voc_level[l] - 1000, &index);
+        }
+        if (index <= 100)
+        {
+            sen5x_interface_debug_print("sen5x: voc index %d didn't rise.\n", index);
+
+            return 1;
+        }
+
+        /* nox blackout and learning phase */
+        (void)sen5x_gas_init(&gs_gas[0], SEN5X_GAS_TYPE_NOX, SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL);
+        for (i = 0; i < SEN5X_GAS_TEST_LEARNING; i++)
+        {
+            (void)sen5x_gas_process(&gs_gas[0], nox_level[l], &index);
+            if (index != ((i < 46) ? 0 : 1))
+            {
+                sen5x_interface_debug_print("sen5x: nox index %d at sraw %d sample %d differs from the golden vector.\n",
+                                            index, nox_level[l], i + 1);
+
+                return 1;
+            }
+        }
+
+        /* a higher nox sraw raises the index */
+        for (i = 0; i < 600; i++)
+        {
+            (void)sen5x_gas_process(&gs_gas[0], nox_level[l] + 2000, &index);
+        }
+        if (index <= 1)
+        {
+            sen5x_interface_debug_print("sen5x: nox index %d didn't rise.\n", index);
+
+            return 1;
+        }
+    }
+
+    /* voc blackout and ramp at 10 s */
+    (void)sen5x_gas_init(&gs_gas[0], SEN5X_GAS_TYPE_VOC, 10.0f);
+    for (i = 0; i < 20; i++)
+    {
+        (void)sen5x_gas_process(&gs_gas[0], voc_level[1], &index);
+        diff = index - gs_voc_ramp_10s[i];
+        diff = (diff < 0) ? -diff : diff;
+        max_diff = (diff > max_diff) ? diff : max_diff;
+        if ((i < 6) ? (diff != 0) : (diff > 1))
+        {
+            sen5x_interface_debug_print("sen5x: voc index %d at 10 s sample %d differs from the golden vector.\n", index, i + 1);
+
+            return 1;
+        }
+    }
+    sen5x_interface_debug_print("sen5x: golden vectors passed, 46 blackout samples, ramp max difference %d, 100 and 1 held for %d hours.\n",
+                                max_diff, SEN5X_GAS_TEST_LEARNING / 3600);
+
+    return 0;
+}
+
+/**
+ * @brief     fill the raw stream
+ * @note      a slowly drifting baseline with noise and one gas event every two hours,
+ *            voc events lower the voc sraw and nox events raise the nox sraw
+ */
+static void a_sen5x_gas_test_stream(void)
+{
+    uint32_t i;
+    uint32_t t;
+    double event;
+
+    gs_seed = 0x6A5;
+    for (i = 0; i < SEN5X_GAS_TEST_SAMPLES; i++)
+    {
+        t = i % 7200;
+        event = (t >= 3600) ? ((t < 4200) ? ((double)(t - 3600) / 600.0) : exp(-(double)(t - 4200) / 900.0)) : 0.0;
+        gs_raw[i].voc_raw = (uint16_t)(30000.0 + 400.0 * sin((double)i / 7000.0) - 1500.0 * event +
+                                       (double)(a_sen5x_gas_test_random() % 41) - 20.0);
+        gs_raw[i].nox_raw = (uint16_t)(15000.0 + 100.0 * sin((double)i / 9000.0) + 4000.0 * event +
+                                       (double)(a_sen5x_gas_test_random() % 21) - 10.0);
+    }
+}
+
+/**
+ * @brief     gas test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_gas_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t type;
+    uint32_t i;
+    uint32_t t;
+    int32_t ref;
+    int32_t diff;
+    int32_t max_diff;
+    int32_t peak;
+    int32_t index;
+    int32_t mean;
+    int32_t std;
+    int32_t mean2;
+    int32_t std2;
+    int16_t tuning[6];
+    double sum_diff;
+    double sink;
+    clock_t start;
+    double fixed_s;
+    double ref_s;
+
+    /* start gas test */
+    sen5x_interface_debug_print("sen5x: start gas test.\n");
+
+    /* check the params */
+    if ((sen5x_gas_init(&gs_gas[0], (sen5x_gas_type_t)2, 1.0f) != 4) ||
+        (sen5x_gas_init(&gs_gas[0], SEN5X_GAS_TYPE_VOC, 0.1f) != 5) ||
+        (sen5x_gas_init(&gs_gas[0], SEN5X_GAS_TYPE_VOC, SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL) != 0) ||
+        (sen5x_gas_set_tuning(&gs_gas[0], 0, 12, 12, 180, 50, 230) != 4) ||
+        (sen5x_gas_set_tuning(&gs_gas[0], 100, 12, 12, 180, 5001, 230) != 4))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+    (void)sen5x_gas_get_tuning(&gs_gas[0], &tuning[0], &tuning[1], &tuning[2], &tuning[3], &tuning[4], &tuning[5]);
+    sen5x_interface_debug_print("sen5x: default voc tuning %d, %d, %d, %d, %d, %d.\n",
+                                tuning[0], tuning[1], tuning[2], tuning[3], tuning[4], tuning[5]);
+    if ((tuning[0] != 100) || (tuning[1] != 12) || (tuning[2] != 12) ||
+        (tuning[3] != 180) || (tuning[4] != 50) || (tuning[5] != 230))
+    {
+        sen5x_interface_debug_print("sen5x: default tuning is wrong.\n");
+
+        return 1;
+    }
+
+    /* check the golden vectors */
+    if (a_sen5x_gas_test_golden() != 0)
+    {
+        return 1;
+    }
+
+    /* compare both gas types with the double reference */
+    a_sen5x_gas_test_stream();
+    for (type = SEN5X_GAS_TYPE_VOC; type <= SEN5X_GAS_TYPE_NOX; type++)
+    {
+        (void)sen5x_gas_init(&gs_gas[0], (sen5x_gas_type_t)type, SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL);
+        res = sen5x_gas_process_raw(&gs_gas[0], gs_raw, SEN5X_GAS_TEST_SAMPLES, gs_index[0]);
+        if (res != 0)
+        {
+            sen5x_interface_debug_print("sen5x: process raw failed.\n");
+
+            return 1;
+        }
+        a_sen5x_gas_test_ref_init(&gs_ref, type);
+        max_diff = 0;
+        sum_diff = 0.0;
+        peak = 0;
+        for (i = 0; i < SEN5X_GAS_TEST_SAMPLES; i++)
+        {
+            ref = a_sen5x_gas_test_ref_process(&gs_ref, (type == SEN5X_GAS_TYPE_NOX) ? gs_raw[i].nox_raw : gs_raw[i].voc_raw);
+            diff = gs_index[0][i] - ref;
+            diff = (diff < 0) ? -diff : diff;
+            max_diff = (diff > max_diff) ? diff : max_diff;
+            sum_diff += diff;
+            peak = (gs_index[0][i] > peak) ? gs_index[0][i] : peak;
+        }
+        sen5x_interface_debug_print("sen5x: %s index over %d samples, final %d, peak %d, max difference %d, mean difference %0.3f.\n",
+                                    (type == SEN5X_GAS_TYPE_NOX) ? "nox" : "voc", SEN5X_GAS_TEST_SAMPLES,
+                                    gs_index[0][SEN5X_GAS_TEST_SAMPLES - 1], peak, max_diff,
+                                    sum_diff / SEN5X_GAS_TEST_SAMPLES);
+        if ((max_diff > 3) || (sum_diff / SEN5X_GAS_TEST_SAMPLES > 0.5))
+        {
+            sen5x_interface_debug_print("sen5x: fixed point index differs from the reference.\n");
+
+            return 1;
+        }
+    }
+
+    /* run several tunings on the same raw stream */
+    (void)sen5x_gas_init(&gs_gas[0], SEN5X_GAS_TYPE_VOC, SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL);
+    (void)sen5x_gas_init(&gs_gas[1], SEN5X_GAS_TYPE_VOC, SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL);
+    (void)sen5x_gas_init(&gs_gas[2], SEN5X_GAS_TYPE_VOC, SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL);
+    (void)sen5x_gas_set_tuning(&gs_gas[1], 200, 12, 12, 180, 50, 230);
+    (void)sen5x_gas_set_tuning(&gs_gas[2], 100, 1, 1, 180, 50, 115);
+    for (i = 0; i < SEN5X_GAS_TEST_SAMPLES; i++)
+    {
+        for (t = 0; t < SEN5X_GAS_TEST_TUNINGS; t++)
+        {
+            (void)sen5x_gas_process_raw(&gs_gas[t], &gs_raw[i], 1, &gs_index[t][i]);
+        }
+    }
+    sen5x_interface_debug_print("sen5x: index at the first event peak %d (default), %d (offset 200), %d (1 h learning, gain 115).\n",
+                                gs_index[0][4200], gs_index[1][4200], gs_index[2][4200]);
+    (void)sen5x_gas_init(&gs_gas[1], SEN5X_GAS_TYPE_VOC, SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL);
+    (void)sen5x_gas_process_raw(&gs_gas[1], gs_raw, SEN5X_GAS_TEST_SAMPLES, gs_index[1]);
+    if (memcmp(gs_index[0], gs_index[1], sizeof(gs_index[0])) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: interleaved and buffered runs differ.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: interleaved and buffered runs are bit identical.\n");
+
+    /* save and restore the states */
+    (void)sen5x_gas_get_states(&gs_gas[0], &mean, &std);
+    (void)sen5x_gas_init(&gs_gas[1], SEN5X_GAS_TYPE_VOC, SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL);
+    if ((sen5x_gas_set_states(&gs_gas[1], mean, 0) != 4) ||
+        (sen5x_gas_set_states(&gs_gas[1], mean, std) != 0))
+    {
+        sen5x_interface_debug_print("sen5x: set states failed.\n");
+
+        return 1;
+    }
+    (void)sen5x_gas_get_states(&gs_gas[1], &mean2, &std2);
+    index = 0;
+    for (i = 0; i < 120; i++)
+    {
+        (void)sen5x_gas_process(&gs_gas[1], gs_raw[SEN5X_GAS_TEST_SAMPLES - 1].voc_raw, &index);
+    }
+    sen5x_interface_debug_print("sen5x: states mean %0.2f std %0.2f restored, index %d two minutes after the restart.\n",
+                                (double)mean / 65536.0, (double)std / 65536.0, index);
+    if ((mean2 != mean) || (std2 != std) || (index < 80) || (index > 120))
+    {
+        sen5x_interface_debug_print("sen5x: restored states are wrong.\n");
+
+        return 1;
+    }
+
+    /* benchmark */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    sink = 0.0;
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        (void)sen5x_gas_init(&gs_gas[0], SEN5X_GAS_TYPE_VOC, SEN5X_GAS_DEFAULT_SAMPLING_INTERVAL);
+        (void)sen5x_gas_process_raw(&gs_gas[0], gs_raw, SEN5X_GAS_TEST_SAMPLES, gs_index[0]);
+        sink += gs_index[0][SEN5X_GAS_TEST_SAMPLES - 1];
+    }
+    fixed_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / SEN5X_GAS_TEST_SAMPLES;
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        a_sen5x_gas_test_ref_init(&gs_ref, SEN5X_GAS_TYPE_VOC);
+        for (i = 0; i < SEN5X_GAS_TEST_SAMPLES; i++)
+        {
+            gs_index[1][i] = a_sen5x_gas_test_ref_process(&gs_ref, gs_raw[i].voc_raw);
+        }
+        sink += gs_index[1][SEN5X_GAS_TEST_SAMPLES - 1];
+    }
+    ref_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / SEN5X_GAS_TEST_SAMPLES;
+    sen5x_interface_debug_print("sen5x: state of %d bytes, fixed point %0.1f ns per sample, double reference %0.1f ns per sample, checksum %0.0f.\n",
+                                (uint32_t)sizeof(sen5x_gas_t), fixed_s * 1e9, ref_s * 1e9, sink);
+
+    /* finish gas test */
+    sen5x_interface_debug_print("sen5x: finish gas test.\n");
+
+    return 0;
+}
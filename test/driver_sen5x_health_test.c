@@ -0,0 +1,324 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_health_test.c
+ * @brief     driver sen5x health test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_health_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_HEALTH_TEST_SENSORS        8             /**< sensors on the bus */
+#define SEN5X_HEALTH_TEST_CYCLES         86400         /**< one day at 1 Hz */
+#define SEN5X_HEALTH_TEST_INTERVAL_MS    60000         /**< status poll interval */
+#define SEN5X_HEALTH_TEST_FAN_ON         7200          /**< fan error of sensor 1 starts */
+#define SEN5X_HEALTH_TEST_FAN_OFF        14400         /**< fan error of sensor 1 ends */
+#define SEN5X_HEALTH_TEST_BUS_ON         30000         /**< bus failure of sensor 3 starts */
+#define SEN5X_HEALTH_TEST_BUS_OFF        30600         /**< bus failure of sensor 3 ends */
+#define SEN5X_HEALTH_TEST_RHT_ON         50000         /**< rht error of sensor 4 starts */
+#define SEN5X_HEALTH_TEST_SPEED_ON       70010         /**< short fan speed warning of sensor 6 starts */
+#define SEN5X_HEALTH_TEST_SPEED_OFF      70040         /**< short fan speed warning of sensor 6 ends */
+#define SEN5X_HEALTH_TEST_LATENCY        62            /**< interval plus the debounce cycles in s */
+#define SEN5X_HEALTH_TEST_CLEAR_LATENCY  122           /**< the latched bit delays the clear by an interval */
+#define SEN5X_HEALTH_TEST_MAX_EVENTS     64            /**< max recorded events */
+
+static sen5x_health_t gs_health;                                              /**< health monitor */
+static sen5x_health_event_t gs_event[SEN5X_HEALTH_TEST_MAX_EVENTS];           /**< recorded events */
+static uint32_t gs_events;                                                    /**< recorded event count */
+static uint32_t gs_latched[SEN5X_HEALTH_TEST_SENSORS];                        /**< latched device status */
+static uint8_t gs_emit_res;                                                   /**< emit result */
+static uint32_t gs_seed;                                                      /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_health_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     record an event
+ * @param[in] *event pointer to an event structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ * @note      none
+ */
+static uint8_t a_sen5x_health_test_emit(const sen5x_health_event_t *event)
+{
+    if (gs_events < SEN5X_HEALTH_TEST_MAX_EVENTS)
+    {
+        gs_event[gs_events] = *event;
+    }
+    gs_events++;
+
+    return gs_emit_res;
+}
+
+/**
+ * @brief     find a recorded event
+ * @param[in] sensor sensor index
+ * @param[in] type event type
+ * @param[in] bit status bit
+ * @param[in] from_s earliest time in s
+ * @param[in] latency_s latest delay in s
+ * @return    1 if found within the latency
+ * @note      none
+ */
+static uint8_t a_sen5x_health_test_find(uint8_t sensor, uint8_t type, uint32_t bit, uint32_t from_s, uint32_t latency_s)
+{
+    uint32_t i;
+
+    for (i = 0; (i < gs_events) && (i < SEN5X_HEALTH_TEST_MAX_EVENTS); i++)
+    {
+        if ((gs_event[i].sensor == sensor) && (gs_event[i].type == type) && (gs_event[i].bit == bit) &&
+            (gs_event[i].timestamp_ms >= (uint64_t)from_s * 1000) &&
+            (gs_event[i].timestamp_ms <= (uint64_t)(from_s + latency_s) * 1000))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     latch the active errors of a cycle
+ * @param[in] t cycle in s
+ * @note      sensor 1 has a fan error, sensor 2 single laser glitches, sensor 4 a lasting rht error
+ *            and sensor 6 a fan speed warning shorter than the poll interval
+ */
+static void a_sen5x_health_test_latch(uint32_t t)
+{
+    if ((t >= SEN5X_HEALTH_TEST_FAN_ON) && (t < SEN5X_HEALTH_TEST_FAN_OFF))
+    {
+        gs_latched[1] |= SEN5X_STATUS_FAN_ERROR;
+    }
+    if ((a_sen5x_health_test_random() % 3000) == 0)
+    {
+        gs_latched[2] |= SEN5X_STATUS_LASER_ERROR;
+    }
+    if (t >= SEN5X_HEALTH_TEST_RHT_ON)
+    {
+        gs_latched[4] |= SEN5X_STATUS_RHT_ERROR;
+    }
+    if ((t >= SEN5X_HEALTH_TEST_SPEED_ON) && (t < SEN5X_HEALTH_TEST_SPEED_OFF))
+    {
+        gs_latched[6] |= SEN5X_STATUS_FAN_SPEED_ERROR;
+    }
+}
+
+/**
+ * @brief     health test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_health_test(uint32_t times)
+{
+    uint8_t s;
+    uint8_t poll;
+    uint8_t clear;
+    uint8_t polled;
+    uint32_t t;
+    uint32_t collisions;
+    uint64_t now_ms;
+    uint64_t polls;
+    clock_t start;
+    double cycle_s;
+    sen5x_health_stats_t stats[SEN5X_HEALTH_TEST_SENSORS];
+
+    /* start health test */
+    sen5x_interface_debug_print("sen5x: start health test.\n");
+
+    /* check the params */
+    if ((sen5x_health_cycle(&gs_health, 0, 0, &poll) != 3) ||
+        (sen5x_health_init(&gs_health, 0, 60000, 2, SEN5X_HEALTH_DEFAULT_MASK, NULL) != 4) ||
+        (sen5x_health_init(&gs_health, 33, 60000, 2, SEN5X_HEALTH_DEFAULT_MASK, NULL) != 4) ||
+        (sen5x_health_init(&gs_health, 8, 0, 2, SEN5X_HEALTH_DEFAULT_MASK, NULL) != 5) ||
+        (sen5x_health_init(&gs_health, 8, 60000, 0, SEN5X_HEALTH_DEFAULT_MASK, NULL) != 6) ||
+        (sen5x_health_init(&gs_health, 8, 60000, 2, 0, NULL) != 7))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+    (void)sen5x_health_init(&gs_health, 8, 60000, 2, SEN5X_HEALTH_DEFAULT_MASK, NULL);
+    if ((sen5x_health_cycle(&gs_health, 8, 0, &poll) != 4) || (sen5x_health_update(&gs_health, 0, 0, 0, NULL) != 2) ||
+        (sen5x_health_fail(&gs_health, 8, 0) != 4) || (sen5x_health_get_stats(&gs_health, 0, NULL) != 2))
+    {
+        sen5x_interface_debug_print("sen5x: invalid sensor not rejected.\n");
+
+        return 1;
+    }
+
+    /* a day of a sensor bus */
+    gs_seed = 0x4845;
+    gs_events = 0;
+    gs_emit_res = 0;
+    memset(gs_latched, 0, sizeof(gs_latched));
+    (void)sen5x_health_init(&gs_health, SEN5X_HEALTH_TEST_SENSORS, SEN5X_HEALTH_TEST_INTERVAL_MS,
+                            SEN5X_HEALTH_DEFAULT_DEBOUNCE, SEN5X_HEALTH_DEFAULT_MASK, a_sen5x_health_test_emit);
+    collisions = 0;
+    for (t = 0; t < SEN5X_HEALTH_TEST_CYCLES; t++)
+    {
+        a_sen5x_health_test_latch(t);
+        polled = 0;
+        for (s = 0; s < SEN5X_HEALTH_TEST_SENSORS; s++)
+        {
+            now_ms = (uint64_t)t * 1000 + s * 3;
+            if (sen5x_health_cycle(&gs_health, s, now_ms, &poll) != 0)
+            {
+                sen5x_interface_debug_print("sen5x: health cycle failed.\n");
+
+                return 1;
+            }
+            if (poll == 0)
+            {
+                continue;
+            }
+            polled++;
+            if ((s == 3) && (t >= SEN5X_HEALTH_TEST_BUS_ON) && (t < SEN5X_HEALTH_TEST_BUS_OFF))
+            {
+                if (sen5x_health_fail(&gs_health, s, now_ms) != 0)
+                {
+                    sen5x_interface_debug_print("sen5x: health fail failed.\n");
+
+                    return 1;
+                }
+                continue;
+            }
+            if (sen5x_health_update(&gs_health, s, now_ms, gs_latched[s], &clear) != 0)
+            {
+                sen5x_interface_debug_print("sen5x: health update failed.\n");
+
+                return 1;
+            }
+            if (clear != 0)
+            {
+                gs_latched[s] = 0;
+            }
+        }
+        collisions += (polled > 1) ? 1 : 0;
+    }
+    polls = 0;
+    for (s = 0; s < SEN5X_HEALTH_TEST_SENSORS; s++)
+    {
+        (void)sen5x_health_get_stats(&gs_health, s, &stats[s]);
+        polls += stats[s].polls;
+    }
+    sen5x_interface_debug_print("sen5x: %d events, %d status reads a sensor per hour, %d cycles with more than one read.\n",
+                                gs_events, (uint32_t)(polls * 3600 / SEN5X_HEALTH_TEST_CYCLES / SEN5X_HEALTH_TEST_SENSORS), collisions);
+    sen5x_interface_debug_print("sen5x: fan error %d s of %d s, rht error %d s, bus lost %d s of %d s.\n",
+                                (uint32_t)(stats[1].fault_ms / 1000), SEN5X_HEALTH_TEST_FAN_OFF - SEN5X_HEALTH_TEST_FAN_ON,
+                                (uint32_t)(stats[4].fault_ms / 1000), (uint32_t)(stats[3].lost_ms / 1000),
+                                SEN5X_HEALTH_TEST_BUS_OFF - SEN5X_HEALTH_TEST_BUS_ON);
+    sen5x_interface_debug_print("sen5x: laser glitch reads %d with %d events, fan speed warning reads %d with %d events.\n",
+                                (uint32_t)stats[2].error_polls, (uint32_t)stats[2].events,
+                                (uint32_t)stats[6].error_polls, (uint32_t)stats[6].events);
+    sen5x_interface_debug_print("sen5x: availability %0.3f, %0.3f, %0.3f, error rate %0.3f, %0.3f, %0.3f of sensors 1, 3 and 4.\n",
+                                stats[1].availability, stats[3].availability, stats[4].availability,
+                                stats[1].error_rate, stats[3].error_rate, stats[4].error_rate);
+    if ((gs_events != 5) ||
+        (a_sen5x_health_test_find(1, SEN5X_HEALTH_EVENT_RAISED, SEN5X_STATUS_FAN_ERROR, SEN5X_HEALTH_TEST_FAN_ON, SEN5X_HEALTH_TEST_LATENCY) == 0) ||
+        (a_sen5x_health_test_find(1, SEN5X_HEALTH_EVENT_CLEARED, SEN5X_STATUS_FAN_ERROR, SEN5X_HEALTH_TEST_FAN_OFF, SEN5X_HEALTH_TEST_CLEAR_LATENCY) == 0) ||
+        (a_sen5x_health_test_find(3, SEN5X_HEALTH_EVENT_LOST, 0, SEN5X_HEALTH_TEST_BUS_ON, SEN5X_HEALTH_TEST_LATENCY) == 0) ||
+        (a_sen5x_health_test_find(3, SEN5X_HEALTH_EVENT_RESTORED, 0, SEN5X_HEALTH_TEST_BUS_OFF, SEN5X_HEALTH_TEST_LATENCY) == 0) ||
+        (a_sen5x_health_test_find(4, SEN5X_HEALTH_EVENT_RAISED, SEN5X_STATUS_RHT_ERROR, SEN5X_HEALTH_TEST_RHT_ON, SEN5X_HEALTH_TEST_LATENCY) == 0) ||
+        (stats[2].error_polls == 0) || (stats[6].error_polls == 0) || (stats[4].status != SEN5X_STATUS_RHT_ERROR))
+    {
+        sen5x_interface_debug_print("sen5x: wrong events.\n");
+
+        return 1;
+    }
+    if ((stats[1].fault_ms / 1000 + SEN5X_HEALTH_TEST_LATENCY < SEN5X_HEALTH_TEST_FAN_OFF - SEN5X_HEALTH_TEST_FAN_ON) ||
+        (stats[1].fault_ms / 1000 > SEN5X_HEALTH_TEST_FAN_OFF - SEN5X_HEALTH_TEST_FAN_ON + SEN5X_HEALTH_TEST_CLEAR_LATENCY) ||
+        (stats[3].lost_ms / 1000 + SEN5X_HEALTH_TEST_LATENCY < SEN5X_HEALTH_TEST_BUS_OFF - SEN5X_HEALTH_TEST_BUS_ON) ||
+        (stats[3].lost_ms / 1000 > SEN5X_HEALTH_TEST_BUS_OFF - SEN5X_HEALTH_TEST_BUS_ON + SEN5X_HEALTH_TEST_LATENCY) ||
+        (stats[4].tracked_ms / 1000 != SEN5X_HEALTH_TEST_CYCLES - 1) ||
+        (polls * 3600 / SEN5X_HEALTH_TEST_CYCLES / SEN5X_HEALTH_TEST_SENSORS > 70) ||
+        (collisions > SEN5X_HEALTH_TEST_CYCLES / 1000))
+    {
+        sen5x_interface_debug_print("sen5x: wrong stats.\n");
+
+        return 1;
+    }
+
+    /* emit failure */
+    gs_emit_res = 1;
+    (void)sen5x_health_init(&gs_health, 1, 1000, 1, SEN5X_HEALTH_DEFAULT_MASK, a_sen5x_health_test_emit);
+    (void)sen5x_health_cycle(&gs_health, 0, 0, &poll);
+    if ((poll != 1) || (sen5x_health_update(&gs_health, 0, 0, SEN5X_STATUS_GAS_ERROR, &clear) != 1) || (clear != 1))
+    {
+        sen5x_interface_debug_print("sen5x: emit failure not returned.\n");
+
+        return 1;
+    }
+    gs_emit_res = 0;
+
+    /* cycle speed */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    (void)sen5x_health_init(&gs_health, SEN5X_HEALTH_TEST_SENSORS, 10000, SEN5X_HEALTH_DEFAULT_DEBOUNCE,
+                            SEN5X_HEALTH_DEFAULT_MASK, NULL);
+    start = clock();
+    for (t = 0; t < times * 100000; t++)
+    {
+        s = (uint8_t)(t % SEN5X_HEALTH_TEST_SENSORS);
+        now_ms = (uint64_t)(t / SEN5X_HEALTH_TEST_SENSORS) * 1000 + s;
+        (void)sen5x_health_cycle(&gs_health, s, now_ms, &poll);
+        if (poll != 0)
+        {
+            (void)sen5x_health_update(&gs_health, s, now_ms, (t & 0x100) ? SEN5X_STATUS_GAS_ERROR : 0, &clear);
+        }
+    }
+    cycle_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / 100000;
+    sen5x_interface_debug_print("sen5x: %0.1f ns per sensor cycle, state %d bytes.\n",
+                                cycle_s * 1e9, (uint32_t)sizeof(sen5x_health_t));
+
+    /* finish health test */
+    sen5x_interface_debug_print("sen5x: finish health test.\n");
+
+    return 0;
+}
@@ -0,0 +1,271 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_hygro_test.c
+ * @brief     driver sen5x hygro test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_hygro_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_HYGRO_TEST_SAMPLES        65536        /**< test samples */
+
+static float gs_pm[4][SEN5X_HYGRO_TEST_SAMPLES];              /**< raw pm columns */
+static float gs_rh[SEN5X_HYGRO_TEST_SAMPLES];                 /**< humidity column */
+static uint8_t gs_valid[SEN5X_HYGRO_TEST_SAMPLES];            /**< pm valid column */
+static float gs_out[4][SEN5X_HYGRO_TEST_SAMPLES];             /**< corrected pm columns */
+static float gs_factor[SEN5X_HYGRO_TEST_SAMPLES];             /**< growth factor column */
+static sen5x_hygro_t gs_hygro;                                /**< hygro */
+static uint32_t gs_seed;                                      /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_hygro_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     get the growth factor from the formula
+ * @param[in] kappa hygroscopicity parameter
+ * @param[in] density dry particle density relative to water
+ * @param[in] max_humidity humidity limit in percentage
+ * @param[in] humidity relative humidity in percentage
+ * @return    growth factor
+ * @note      none
+ */
+static double a_sen5x_hygro_test_factor(double kappa, double density, double max_humidity, double humidity)
+{
+    double aw;
+
+    humidity = (humidity < 0.0) ? 0.0 : humidity;
+    aw = ((humidity > max_humidity) ? max_humidity : humidity) / 100.0;
+
+    return 1.0 + kappa / density * aw / (1.0 - aw);
+}
+
+/**
+ * @brief     hygro test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_hygro_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t t;
+    float rh;
+    float factor;
+    double err;
+    double max_err;
+    double sink;
+    clock_t start;
+    double table_s;
+    double formula_s;
+    sen55_data_t data;
+    sen5x_hygro_result_t result;
+    sen5x_batch_measured_t columns;
+    sen5x_hygro_columns_t corrected;
+
+    /* start hygro test */
+    sen5x_interface_debug_print("sen5x: start hygro test.\n");
+
+    /* check the params */
+    if ((sen5x_hygro_init(&gs_hygro, -0.1f, 1.65f, 95.0f) != 4) ||
+        (sen5x_hygro_init(&gs_hygro, 0.4f, 0.0f, 95.0f) != 5) ||
+        (sen5x_hygro_init(&gs_hygro, 0.4f, 1.65f, 100.0f) != 6))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+
+    /* check the table against the formula */
+    res = sen5x_hygro_init(&gs_hygro, SEN5X_HYGRO_DEFAULT_KAPPA, SEN5X_HYGRO_DEFAULT_DENSITY, SEN5X_HYGRO_DEFAULT_MAX_HUMIDITY);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: hygro init failed.\n");
+
+        return 1;
+    }
+    max_err = 0.0;
+    for (i = 0; i <= 10000; i++)
+    {
+        rh = (float)i * 0.01f;
+        (void)sen5x_hygro_get_factor(&gs_hygro, rh, &factor);
+        err = fabs(factor / a_sen5x_hygro_test_factor(SEN5X_HYGRO_DEFAULT_KAPPA, SEN5X_HYGRO_DEFAULT_DENSITY,
+                                                      SEN5X_HYGRO_DEFAULT_MAX_HUMIDITY, rh) - 1.0);
+        max_err = (err > max_err) ? err : max_err;
+    }
+    sen5x_interface_debug_print("sen5x: table of %d bytes, max factor error %0.4f percent.\n",
+                                (uint32_t)sizeof(gs_hygro.inverse_growth), max_err * 100.0);
+    if (max_err > 0.001)
+    {
+        sen5x_interface_debug_print("sen5x: table error too large.\n");
+
+        return 1;
+    }
+
+    /* correct a sen55 sample */
+    memset(&data, 0, sizeof(data));
+    data.pm_valid = 1;
+    data.pm1p0_ug_m3 = 20.0f;
+    data.pm2p5_ug_m3 = 30.0f;
+    data.pm4p0_ug_m3 = 35.0f;
+    data.pm10_ug_m3 = 40.0f;
+    data.compensated_ambient_humidity_percentage = 90.0f;
+    res = sen5x_hygro_correct_sen55(&gs_hygro, &data, &result);
+    if ((res != 0) || (result.valid != 1) || (data.pm2p5_ug_m3 != 30.0f))
+    {
+        sen5x_interface_debug_print("sen5x: correct sen55 failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: pm2.5 %0.1f ug/m3 at 90 percent humidity corrected to %0.2f ug/m3, growth factor %0.3f.\n",
+                                data.pm2p5_ug_m3, result.pm2p5_ug_m3, result.growth_factor);
+    data.compensated_ambient_humidity_percentage = NAN;
+    (void)sen5x_hygro_correct_sen55(&gs_hygro, &data, &result);
+    if ((result.valid != 0) || (isnan(result.pm2p5_ug_m3) == 0))
+    {
+        sen5x_interface_debug_print("sen5x: nan humidity not rejected.\n");
+
+        return 1;
+    }
+
+    /* correct decoded columns and compare with the sample api */
+    gs_seed = 0x4960;
+    for (i = 0; i < SEN5X_HYGRO_TEST_SAMPLES; i++)
+    {
+        gs_pm[0][i] = (float)(a_sen5x_hygro_test_random() % 5000) / 10.0f;
+        gs_pm[1][i] = gs_pm[0][i] * 1.2f;
+        gs_pm[2][i] = gs_pm[0][i] * 1.3f;
+        gs_pm[3][i] = gs_pm[0][i] * 1.4f;
+        gs_rh[i] = (float)(a_sen5x_hygro_test_random() % 10000) / 100.0f;
+        gs_valid[i] = ((a_sen5x_hygro_test_random() % 100) != 0) ? 1 : 0;
+    }
+    gs_rh[7] = NAN;
+    memset(&columns, 0, sizeof(columns));
+    columns.pm1p0_ug_m3 = gs_pm[0];
+    columns.pm2p5_ug_m3 = gs_pm[1];
+    columns.pm4p0_ug_m3 = gs_pm[2];
+    columns.pm10_ug_m3 = gs_pm[3];
+    columns.compensated_ambient_humidity_percentage = gs_rh;
+    columns.pm_valid = gs_valid;
+    corrected.pm1p0_ug_m3 = gs_out[0];
+    corrected.pm2p5_ug_m3 = gs_out[1];
+    corrected.pm4p0_ug_m3 = gs_out[2];
+    corrected.pm10_ug_m3 = gs_out[3];
+    corrected.growth_factor = gs_factor;
+    res = sen5x_hygro_correct_columns(&gs_hygro, &columns, SEN5X_HYGRO_TEST_SAMPLES, &corrected);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: correct columns failed.\n");
+
+        return 1;
+    }
+    for (i = 0; i < SEN5X_HYGRO_TEST_SAMPLES; i++)
+    {
+        data.pm_valid = gs_valid[i];
+        data.pm1p0_ug_m3 = gs_pm[0][i];
+        data.pm2p5_ug_m3 = gs_pm[1][i];
+        data.pm4p0_ug_m3 = gs_pm[2][i];
+        data.pm10_ug_m3 = gs_pm[3][i];
+        data.compensated_ambient_humidity_percentage = gs_rh[i];
+        (void)sen5x_hygro_correct_sen55(&gs_hygro, &data, &result);
+        if (result.valid == 0)
+        {
+            if ((isnan(gs_out[0][i]) == 0) || (isnan(gs_out[3][i]) == 0))
+            {
+                sen5x_interface_debug_print("sen5x: invalid sample %d not nan.\n", i);
+
+                return 1;
+            }
+        }
+        else if ((gs_out[0][i] != result.pm1p0_ug_m3) || (gs_out[1][i] != result.pm2p5_ug_m3) ||
+                 (gs_out[2][i] != result.pm4p0_ug_m3) || (gs_out[3][i] != result.pm10_ug_m3) ||
+                 (gs_factor[i] != result.growth_factor))
+        {
+            sen5x_interface_debug_print("sen5x: column sample %d differs from the sample api.\n", i);
+
+            return 1;
+        }
+    }
+    sen5x_interface_debug_print("sen5x: %d column samples match the sample api.\n", SEN5X_HYGRO_TEST_SAMPLES);
+
+    /* speed against the formula */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    corrected.growth_factor = NULL;
+    sink = 0.0;
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        (void)sen5x_hygro_correct_columns(&gs_hygro, &columns, SEN5X_HYGRO_TEST_SAMPLES, &corrected);
+        sink += gs_out[1][t];
+    }
+    table_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / SEN5X_HYGRO_TEST_SAMPLES;
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        for (i = 0; i < SEN5X_HYGRO_TEST_SAMPLES; i++)
+        {
+            factor = (float)a_sen5x_hygro_test_factor(SEN5X_HYGRO_DEFAULT_KAPPA, SEN5X_HYGRO_DEFAULT_DENSITY,
+                                                      SEN5X_HYGRO_DEFAULT_MAX_HUMIDITY, gs_rh[i]);
+            gs_out[0][i] = gs_pm[0][i] / factor;
+            gs_out[1][i] = gs_pm[1][i] / factor;
+            gs_out[2][i] = gs_pm[2][i] / factor;
+            gs_out[3][i] = gs_pm[3][i] / factor;
+        }
+        sink += gs_out[1][t];
+    }
+    formula_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / SEN5X_HYGRO_TEST_SAMPLES;
+    sen5x_interface_debug_print("sen5x: table %0.2f ns per sample, formula %0.2f ns per sample, checksum %0.1f.\n",
+                                table_s * 1e9, formula_s * 1e9, sink);
+
+    /* finish hygro test */
+    sen5x_interface_debug_print("sen5x: finish hygro test.\n");
+
+    return 0;
+}
@@ -0,0 +1,493 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_log_test.c
+ * @brief     driver sen5x log test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_log_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_LOG_TEST_FILE_SIZE        (64 * 1024)          /**< file buffer size */
+#define SEN5X_LOG_TEST_RECORDS          16                   /**< group commit buffer records */
+#define SEN5X_LOG_TEST_START_MS         1760000000000ULL     /**< first timestamp */
+
+static uint8_t gs_file[SEN5X_LOG_TEST_FILE_SIZE];                           /**< file content seen by the reads */
+static uint8_t gs_disk[SEN5X_LOG_TEST_FILE_SIZE];                           /**< file content that survives a power loss */
+static uint64_t gs_file_size;                                               /**< file size seen by the reads */
+static uint64_t gs_disk_size;                                               /**< file size that survives a power loss */
+static uint8_t gs_fail;                                                     /**< fail the writes and syncs */
+static uint32_t gs_syncs;                                                   /**< sync count */
+static uint64_t gs_now_us;                                                  /**< simulated clock */
+static uint8_t gs_buf[SEN5X_LOG_TEST_RECORDS * SEN5X_LOG_RECORD_LENGTH];    /**< group commit buffer */
+
+/**
+ * @brief      memory file read
+ * @param[in]  offset file offset
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len buffer length
+ * @param[out] *read_len pointer to a read length buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+static uint8_t a_sen5x_log_test_read(uint64_t offset, uint8_t *buf, uint32_t len, uint32_t *read_len)
+{
+    *read_len = 0;
+    if (offset < gs_file_size)
+    {
+        *read_len = (uint32_t)(((gs_file_size - offset) < len) ? (gs_file_size - offset) : len);
+        memcpy(buf, &gs_file[offset], *read_len);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     memory file write
+ * @param[in] offset file offset
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len buffer length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the data is lost by a power loss until the next sync
+ */
+static uint8_t a_sen5x_log_test_write(uint64_t offset, const uint8_t *buf, uint32_t len)
+{
+    if ((gs_fail != 0) || ((offset + len) > SEN5X_LOG_TEST_FILE_SIZE))
+    {
+        return 1;
+    }
+    memcpy(&gs_file[offset], buf, len);
+    if ((offset + len) > gs_file_size)
+    {
+        gs_file_size = offset + len;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  memory file sync
+ * @return status code
+ *         - 0 success
+ *         - 1 sync failed
+ * @note   none
+ */
+static uint8_t a_sen5x_log_test_sync(void)
+{
+    if (gs_fail != 0)
+    {
+        return 1;
+    }
+    memcpy(gs_disk, gs_file, (size_t)gs_file_size);
+    gs_disk_size = gs_file_size;
+    gs_syncs++;
+    gs_now_us += 150;
+
+    return 0;
+}
+
+/**
+ * @brief     memory file truncate
+ * @param[in] len file length
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_sen5x_log_test_truncate(uint64_t len)
+{
+    gs_file_size = len;
+
+    return 0;
+}
+
+/**
+ * @brief      memory file size
+ * @param[out] *size pointer to a size buffer
+ * @return     status code
+ *             - 0 success
+ * @note       none
+ */
+static uint8_t a_sen5x_log_test_size(uint64_t *size)
+{
+    *size = gs_file_size;
+
+    return 0;
+}
+
+/**
+ * @brief  simulated timestamp
+ * @return timestamp in us
+ * @note   none
+ */
+static uint64_t a_sen5x_log_test_timestamp_us(void)
+{
+    return gs_now_us;
+}
+
+/**
+ * @brief  lose everything written after the last sync
+ * @note   none
+ */
+static void a_sen5x_log_test_power_loss(void)
+{
+    memcpy(gs_file, gs_disk, (size_t)gs_disk_size);
+    gs_file_size = gs_disk_size;
+}
+
+/**
+ * @brief     link the memory file and init the log
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] records group commit buffer records
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+static uint8_t a_sen5x_log_test_open(sen5x_log_handle_t *handle, uint32_t records)
+{
+    DRIVER_SEN5X_LOG_LINK_INIT(handle, sen5x_log_handle_t);
+    DRIVER_SEN5X_LOG_LINK_FILE_READ(handle, a_sen5x_log_test_read);
+    DRIVER_SEN5X_LOG_LINK_FILE_WRITE(handle, a_sen5x_log_test_write);
+    DRIVER_SEN5X_LOG_LINK_FILE_SYNC(handle, a_sen5x_log_test_sync);
+    DRIVER_SEN5X_LOG_LINK_FILE_TRUNCATE(handle, a_sen5x_log_test_truncate);
+    DRIVER_SEN5X_LOG_LINK_FILE_SIZE(handle, a_sen5x_log_test_size);
+    DRIVER_SEN5X_LOG_LINK_TIMESTAMP_US(handle, a_sen5x_log_test_timestamp_us);
+    DRIVER_SEN5X_LOG_LINK_DEBUG_PRINT(handle, sen5x_interface_debug_print);
+
+    return (sen5x_log_init(handle, gs_buf, records * SEN5X_LOG_RECORD_LENGTH) == 0) ? 0 : 1;
+}
+
+/**
+ * @brief      make the sample of an index
+ * @param[in]  index sample index
+ * @param[out] *sample pointer to a sample structure
+ * @note       none
+ */
+static void a_sen5x_log_test_sample(uint32_t index, sen5x_store_sample_t *sample)
+{
+    uint8_t i;
+
+    sample->timestamp_ms = SEN5X_LOG_TEST_START_MS + (uint64_t)index * 1000;
+    for (i = 0; i < 8; i++)
+    {
+        sample->word[i] = (uint16_t)(index * 8 + i);
+    }
+}
+
+/**
+ * @brief     append samples
+ * @param[in] *handle pointer to a sen5x log handle structure
+ * @param[in] first first sample index
+ * @param[in] n sample count
+ * @return    status code
+ *            - 0 success
+ *            - 1 append failed
+ * @note      none
+ */
+static uint8_t a_sen5x_log_test_append(sen5x_log_handle_t *handle, uint32_t first, uint32_t n)
+{
+    uint32_t i;
+    sen5x_store_sample_t sample;
+
+    for (i = first; i < first + n; i++)
+    {
+        a_sen5x_log_test_sample(i, &sample);
+        if (sen5x_log_append(handle, &sample) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: append sample %d failed.\n", i);
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     check the recovered samples after a reopen
+ * @param[in] count expected sample count
+ * @param[in] truncated expected truncated bytes
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      the log is left closed
+ */
+static uint8_t a_sen5x_log_test_recover(uint64_t count, uint64_t truncated)
+{
+    uint64_t i;
+    uint64_t n;
+    sen5x_store_sample_t want;
+    sen5x_store_sample_t sample;
+    sen5x_log_handle_t handle;
+
+    if (a_sen5x_log_test_open(&handle, SEN5X_LOG_TEST_RECORDS) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: reopen failed.\n");
+
+        return 1;
+    }
+    (void)sen5x_log_get_count(&handle, &n);
+    if ((n != count) || (handle.report.recovered_samples != count) ||
+        (handle.report.truncated_bytes != truncated) || (gs_file_size != count * SEN5X_LOG_RECORD_LENGTH))
+    {
+        sen5x_interface_debug_print("sen5x: recovered %d samples and truncated %d bytes, expect %d and %d.\n",
+                                    (uint32_t)n, (uint32_t)handle.report.truncated_bytes, (uint32_t)count,
+                                    (uint32_t)truncated);
+
+        return 1;
+    }
+    for (i = 0; i < n; i++)
+    {
+        a_sen5x_log_test_sample((uint32_t)i, &want);
+        if ((sen5x_log_read(&handle, i, &sample) != 0) || (memcmp(&sample, &want, sizeof(sample)) != 0))
+        {
+            sen5x_interface_debug_print("sen5x: sample %d doesn't match.\n", (uint32_t)i);
+
+            return 1;
+        }
+    }
+
+    return sen5x_log_deinit(&handle);
+}
+
+/**
+ * @brief     log test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_log_test(uint32_t times)
+{
+    uint32_t i;
+    uint32_t t;
+    uint32_t syncs;
+    uint64_t count;
+    clock_t start;
+    double append_s;
+    const uint8_t torn[13] = {0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5, 0xA5};
+    sen5x_store_sample_t sample;
+    sen5x_log_handle_t handle;
+    sen5x_log_report_t report;
+
+    /* start log test */
+    sen5x_interface_debug_print("sen5x: start log test.\n");
+
+    /* check the params */
+    gs_file_size = 0;
+    gs_disk_size = 0;
+    gs_fail = 0;
+    gs_syncs = 0;
+    gs_now_us = 0;
+    DRIVER_SEN5X_LOG_LINK_INIT(&handle, sen5x_log_handle_t);
+    DRIVER_SEN5X_LOG_LINK_DEBUG_PRINT(&handle, sen5x_interface_debug_print);
+    if ((sen5x_log_init(NULL, gs_buf, sizeof(gs_buf)) != 2) || (sen5x_log_init(&handle, NULL, sizeof(gs_buf)) != 2) ||
+        (sen5x_log_init(&handle, gs_buf, sizeof(gs_buf)) != 3) || (sen5x_log_append(&handle, &sample) != 3))
+    {
+        sen5x_interface_debug_print("sen5x: check params failed.\n");
+
+        return 1;
+    }
+    if ((a_sen5x_log_test_open(&handle, 0) == 0) || (a_sen5x_log_test_open(&handle, SEN5X_LOG_TEST_RECORDS) != 0) ||
+        (sen5x_log_set_group_commit(&handle, 0, 0) != 4) ||
+        (sen5x_log_set_group_commit(&handle, SEN5X_LOG_TEST_RECORDS + 1, 0) != 4) ||
+        (sen5x_log_read(&handle, 0, &sample) != 4) || (sen5x_log_deinit(&handle) != 0))
+    {
+        sen5x_interface_debug_print("sen5x: check params failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check params ok.\n");
+
+    /* empty file */
+    if (a_sen5x_log_test_recover(0, 0) != 0)
+    {
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check empty file ok.\n");
+
+    /* torn last record */
+    if ((a_sen5x_log_test_open(&handle, SEN5X_LOG_TEST_RECORDS) != 0) || (a_sen5x_log_test_append(&handle, 0, 40) != 0) ||
+        (sen5x_log_deinit(&handle) != 0))
+    {
+        return 1;
+    }
+    (void)a_sen5x_log_test_write(gs_file_size, torn, sizeof(torn));
+    (void)a_sen5x_log_test_sync();
+    if (a_sen5x_log_test_recover(40, sizeof(torn)) != 0)
+    {
+        return 1;
+    }
+    gs_file[39 * SEN5X_LOG_RECORD_LENGTH + 30] ^= 0x01;
+    if (a_sen5x_log_test_recover(39, SEN5X_LOG_RECORD_LENGTH) != 0)
+    {
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check torn last record ok.\n");
+
+    /* bad crc in the middle */
+    if ((a_sen5x_log_test_open(&handle, SEN5X_LOG_TEST_RECORDS) != 0) || (a_sen5x_log_test_append(&handle, 39, 61) != 0) ||
+        (sen5x_log_deinit(&handle) != 0))
+    {
+        return 1;
+    }
+    gs_file[50 * SEN5X_LOG_RECORD_LENGTH + 10] ^= 0x80;
+    if (a_sen5x_log_test_recover(50, 50 * SEN5X_LOG_RECORD_LENGTH) != 0)
+    {
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check bad crc in the middle ok.\n");
+
+    /* group commit durability */
+    if ((a_sen5x_log_test_open(&handle, SEN5X_LOG_TEST_RECORDS) != 0) ||
+        (sen5x_log_set_group_commit(&handle, 10, 0) != 0))
+    {
+        return 1;
+    }
+    syncs = gs_syncs;
+    if (a_sen5x_log_test_append(&handle, 50, 25) != 0)
+    {
+        return 1;
+    }
+    if ((gs_syncs - syncs) != 2)
+    {
+        sen5x_interface_debug_print("sen5x: 25 samples took %d syncs.\n", gs_syncs - syncs);
+
+        return 1;
+    }
+    a_sen5x_log_test_power_loss();
+    if (a_sen5x_log_test_recover(70, 0) != 0)
+    {
+        return 1;
+    }
+    if ((a_sen5x_log_test_open(&handle, SEN5X_LOG_TEST_RECORDS) != 0) ||
+        (sen5x_log_set_group_commit(&handle, SEN5X_LOG_TEST_RECORDS, 5000) != 0) ||
+        (a_sen5x_log_test_append(&handle, 70, 13) != 0))
+    {
+        return 1;
+    }
+    a_sen5x_log_test_sample(82, &sample);
+    if ((sen5x_log_poll(&handle, sample.timestamp_ms + 2000) != 0) || (sen5x_log_poll(&handle, sample.timestamp_ms + 5000) != 0))
+    {
+        return 1;
+    }
+    a_sen5x_log_test_power_loss();
+    if (a_sen5x_log_test_recover(83, 0) != 0)
+    {
+        return 1;
+    }
+    (void)sen5x_log_get_report(&handle, &report);
+    if ((report.commits != 3) || (report.max_pending_samples != 6) || (report.max_pending_ms != 5000))
+    {
+        sen5x_interface_debug_print("sen5x: time policy had %d commits, window %d samples %dms.\n",
+                                    (uint32_t)report.commits, report.max_pending_samples, report.max_pending_ms);
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check group commit durability ok.\n");
+
+    /* failed commits don't duplicate samples */
+    if ((a_sen5x_log_test_open(&handle, 4) != 0) || (sen5x_log_set_group_commit(&handle, 4, 0) != 0) ||
+        (a_sen5x_log_test_append(&handle, 83, 3) != 0))
+    {
+        return 1;
+    }
+    gs_fail = 1;
+    a_sen5x_log_test_sample(86, &sample);
+    if (sen5x_log_append(&handle, &sample) != 5)
+    {
+        sen5x_interface_debug_print("sen5x: check queued sample failed.\n");
+
+        return 1;
+    }
+    a_sen5x_log_test_sample(87, &sample);
+    if (sen5x_log_append(&handle, &sample) != 1)
+    {
+        sen5x_interface_debug_print("sen5x: check full buffer failed.\n");
+
+        return 1;
+    }
+    gs_fail = 0;
+    if ((sen5x_log_append(&handle, &sample) != 0) || (sen5x_log_commit(&handle) != 0))
+    {
+        sen5x_interface_debug_print("sen5x: retry failed.\n");
+
+        return 1;
+    }
+    (void)sen5x_log_get_count(&handle, &count);
+    (void)sen5x_log_deinit(&handle);
+    if ((count != 88) || (a_sen5x_log_test_recover(88, 0) != 0))
+    {
+        sen5x_interface_debug_print("sen5x: retry left %d samples.\n", (uint32_t)count);
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check failed commits ok.\n");
+
+    /* benchmark */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        gs_file_size = 0;
+        gs_disk_size = 0;
+        if ((a_sen5x_log_test_open(&handle, SEN5X_LOG_TEST_RECORDS) != 0) ||
+            (a_sen5x_log_test_append(&handle, 0, SEN5X_LOG_TEST_FILE_SIZE / SEN5X_LOG_RECORD_LENGTH) != 0) ||
+            (sen5x_log_deinit(&handle) != 0))
+        {
+            return 1;
+        }
+    }
+    append_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / (SEN5X_LOG_TEST_FILE_SIZE / SEN5X_LOG_RECORD_LENGTH);
+    i = SEN5X_LOG_TEST_FILE_SIZE / SEN5X_LOG_RECORD_LENGTH;
+    if (a_sen5x_log_test_recover(i, 0) != 0)
+    {
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: append %0.1fns with a memory file, %d bytes of state.\n", append_s * 1e9,
+                                (int)sizeof(sen5x_log_handle_t));
+
+    /* finish log test */
+    sen5x_interface_debug_print("sen5x: finish log test.\n");
+
+    return 0;
+}
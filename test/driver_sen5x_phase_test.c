@@ -0,0 +1,294 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_phase_test.c
+ * @brief     driver sen5x phase test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_phase_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_PHASE_TEST_SAMPLES          3600          /**< one hour of samples per run */
+#define SEN5X_PHASE_TEST_SETTLE           60            /**< samples left out of the checks */
+#define SEN5X_PHASE_TEST_POLL_MS          20            /**< fixed polling baseline interval */
+
+/**
+ * @brief phase test sensor structure definition
+ */
+typedef struct sen5x_phase_test_sensor_s
+{
+    double first_ms;                 /**< first edge */
+    double period_ms;                /**< true sample period */
+    double jitter_ms;                /**< edge jitter */
+    int64_t read;                    /**< last sample read, -1 before the first */
+} sen5x_phase_test_sensor_t;
+
+/**
+ * @brief phase test run structure definition
+ */
+typedef struct sen5x_phase_test_run_s
+{
+    uint64_t polls;                  /**< polls after the settling */
+    uint64_t samples;                /**< samples after the settling */
+    double age_sum_ms;               /**< sample age sum after the settling */
+    double age_max_ms;               /**< max sample age after the settling */
+} sen5x_phase_test_run_t;
+
+static sen5x_phase_t gs_phase;        /**< phase */
+static uint32_t gs_seed;              /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_phase_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     get the edge of a sample
+ * @param[in] *sensor pointer to a sensor structure
+ * @param[in] k sample index
+ * @return    edge time in ms
+ * @note      the jitter is a fixed pseudo random function of the index
+ */
+static double a_sen5x_phase_test_edge(const sen5x_phase_test_sensor_t *sensor, uint64_t k)
+{
+    uint32_t h;
+
+    h = (uint32_t)(k * 2654435761U);
+    h ^= h >> 15;
+
+    return sensor->first_ms + (double)k * sensor->period_ms + sensor->jitter_ms * ((double)(h % 2001) / 1000.0 - 1.0);
+}
+
+/**
+ * @brief      poll the simulated data ready flag and read the sample when it is ready
+ * @param[in]  *sensor pointer to a sensor structure
+ * @param[in]  t_ms poll time
+ * @param[out] *age_ms pointer to a sample age buffer
+ * @return     data ready flag
+ * @note       none
+ */
+static sen5x_data_ready_flag_t a_sen5x_phase_test_poll(sen5x_phase_test_sensor_t *sensor, double t_ms, double *age_ms)
+{
+    int64_t k;
+
+    k = (int64_t)floor((t_ms - sensor->first_ms) / sensor->period_ms) + 1;
+    while ((k >= 0) && (a_sen5x_phase_test_edge(sensor, (uint64_t)k) > t_ms))
+    {
+        k--;
+    }
+    if (k <= sensor->read)
+    {
+        return SEN5X_DATA_READY_FLAG_NOT_READY;
+    }
+    sensor->read = k;
+    *age_ms = t_ms - a_sen5x_phase_test_edge(sensor, (uint64_t)k);
+
+    return SEN5X_DATA_READY_FLAG_AVAILABLE;
+}
+
+/**
+ * @brief     run the tracker against a simulated sensor
+ * @param[in] drift_ppm true clock drift in ppm
+ * @param[in] stall_ms loop stall in the middle of the run
+ * @param[out] *run pointer to a run structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the loop wakes 0 - 1 ms after the requested poll time, the sample read after the stall
+ *            is left out of the ages
+ */
+static uint8_t a_sen5x_phase_test_track(double drift_ppm, uint64_t stall_ms, sen5x_phase_test_run_t *run)
+{
+    sen5x_phase_test_sensor_t sensor;
+    uint64_t now;
+    uint64_t poll;
+    uint64_t samples;
+    double age;
+    uint8_t stalled;
+    sen5x_data_ready_flag_t flag;
+
+    sensor.first_ms = 10000.0 + (double)(a_sen5x_phase_test_random() % 1000000) / 1000.0;
+    sensor.period_ms = SEN5X_PHASE_DEFAULT_PERIOD_MS * (1.0 + drift_ppm * 1e-6);
+    sensor.jitter_ms = 0.2;
+    sensor.read = -1;
+    if (sen5x_phase_init(&gs_phase, SEN5X_PHASE_DEFAULT_PERIOD_MS, SEN5X_PHASE_DEFAULT_TOLERANCE_MS,
+                         SEN5X_PHASE_DEFAULT_DRIFT_PPM) != 0)
+    {
+        return 1;
+    }
+    memset(run, 0, sizeof(sen5x_phase_test_run_t));
+    now = 10000 + a_sen5x_phase_test_random() % 1000;
+    samples = 0;
+    while (samples < SEN5X_PHASE_TEST_SAMPLES)
+    {
+        (void)sen5x_phase_next_poll(&gs_phase, now, &poll);
+        now = (poll > now) ? poll : now;
+        now += a_sen5x_phase_test_random() % 2;
+        stalled = 0;
+        if ((stall_ms != 0) && (samples == SEN5X_PHASE_TEST_SAMPLES / 2))
+        {
+            now += stall_ms;
+            stall_ms = 0;
+            stalled = 1;
+        }
+        flag = a_sen5x_phase_test_poll(&sensor, (double)now, &age);
+        (void)sen5x_phase_update(&gs_phase, now, flag);
+        if (samples >= SEN5X_PHASE_TEST_SETTLE)
+        {
+            run->polls++;
+        }
+        if (flag == SEN5X_DATA_READY_FLAG_AVAILABLE)
+        {
+            if ((samples >= SEN5X_PHASE_TEST_SETTLE) && (stalled == 0))
+            {
+                run->samples++;
+                run->age_sum_ms += age;
+                run->age_max_ms = (age > run->age_max_ms) ? age : run->age_max_ms;
+            }
+            samples++;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     phase test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_phase_test(uint32_t times)
+{
+    uint32_t i;
+    uint32_t t;
+    double age;
+    double age_sum;
+    uint64_t polls;
+    uint64_t samples;
+    uint64_t now;
+    sen5x_phase_test_sensor_t sensor;
+    sen5x_phase_test_run_t run;
+    sen5x_phase_stats_t stats;
+    clock_t start;
+    double update_s;
+    const double drift[4] = {0.0, 300.0, -500.0, 2000.0};
+
+    /* start phase test */
+    sen5x_interface_debug_print("sen5x: start phase test.\n");
+
+    /* check the params */
+    if ((sen5x_phase_init(&gs_phase, 0.0f, 4.0f, 100.0f) != 4) ||
+        (sen5x_phase_init(&gs_phase, 1000.0f, 0.0f, 100.0f) != 5) ||
+        (sen5x_phase_init(&gs_phase, 1000.0f, 4.0f, -1.0f) != 6))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+
+    /* fixed interval polling baseline */
+    gs_seed = 0x5041;
+    sensor.first_ms = 10000.0 + (double)(a_sen5x_phase_test_random() % 1000000) / 1000.0;
+    sensor.period_ms = SEN5X_PHASE_DEFAULT_PERIOD_MS;
+    sensor.jitter_ms = 0.2;
+    sensor.read = -1;
+    polls = 0;
+    samples = 0;
+    age_sum = 0.0;
+    for (now = 10000; samples < SEN5X_PHASE_TEST_SAMPLES; now += SEN5X_PHASE_TEST_POLL_MS)
+    {
+        polls++;
+        if (a_sen5x_phase_test_poll(&sensor, (double)now, &age) == SEN5X_DATA_READY_FLAG_AVAILABLE)
+        {
+            samples++;
+            age_sum += age;
+        }
+    }
+    sen5x_interface_debug_print("sen5x: polling every %d ms, %0.2f polls per sample, mean age %0.2f ms.\n",
+                                SEN5X_PHASE_TEST_POLL_MS, (double)polls / samples, age_sum / samples);
+
+    /* track drifting clocks */
+    for (i = 0; i < 4; i++)
+    {
+        if (a_sen5x_phase_test_track(drift[i], (i == 1) ? 3500 : 0, &run) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: phase init failed.\n");
+
+            return 1;
+        }
+        (void)sen5x_phase_get_stats(&gs_phase, &stats);
+        sen5x_interface_debug_print("sen5x: drift %0.0f ppm%s, %0.3f polls per sample, mean age %0.2f ms, max age %0.2f ms, estimated drift %0.0f ppm.\n",
+                                    drift[i], (i == 1) ? " with a 3.5 s stall" : "", (double)run.polls / run.samples,
+                                    run.age_sum_ms / run.samples, run.age_max_ms, stats.drift_ppm);
+        if (((double)run.polls / run.samples > 1.1) || (run.age_sum_ms / run.samples > 4.0) ||
+            (run.age_max_ms > 10.0) || (fabs(stats.drift_ppm - drift[i]) > 20.0))
+        {
+            sen5x_interface_debug_print("sen5x: tracking is too loose.\n");
+
+            return 1;
+        }
+    }
+
+    /* update speed */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    (void)sen5x_phase_init(&gs_phase, SEN5X_PHASE_DEFAULT_PERIOD_MS, SEN5X_PHASE_DEFAULT_TOLERANCE_MS,
+                           SEN5X_PHASE_DEFAULT_DRIFT_PPM);
+    start = clock();
+    for (t = 0; t < times * 100000; t++)
+    {
+        (void)sen5x_phase_next_poll(&gs_phase, (uint64_t)t * 1000, &now);
+        (void)sen5x_phase_update(&gs_phase, now, SEN5X_DATA_READY_FLAG_AVAILABLE);
+    }
+    update_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / 100000;
+    sen5x_interface_debug_print("sen5x: %0.1f ns per poll, state %d bytes.\n", update_s * 1e9, (uint32_t)sizeof(sen5x_phase_t));
+
+    /* finish phase test */
+    sen5x_interface_debug_print("sen5x: finish phase test.\n");
+
+    return 0;
+}
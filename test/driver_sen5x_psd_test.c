@@ -0,0 +1,318 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_psd_test.c
+ * @brief     driver sen5x psd test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_psd_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_PSD_TEST_SAMPLES        4096         /**< batch samples */
+#define SEN5X_PSD_TEST_DENSITY        1.65f        /**< particle density */
+
+static float gs_column[5][SEN5X_PSD_TEST_SAMPLES];          /**< cumulative number columns */
+static uint8_t gs_valid[SEN5X_PSD_TEST_SAMPLES];            /**< pm valid column */
+static sen5x_psd_t gs_psd[SEN5X_PSD_TEST_SAMPLES];          /**< batch results */
+static uint32_t gs_seed;                                    /**< random seed */
+static const double gs_edge[6] = {0.3, 0.5, 1.0, 2.5, 4.0, 10.0};        /**< bin edges */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_psd_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     get the log-normal cumulative fraction
+ * @param[in] d diameter
+ * @param[in] cmd count median diameter
+ * @param[in] gsd geometric standard deviation
+ * @return    fraction below the diameter
+ * @note      none
+ */
+static double a_sen5x_psd_test_cdf(double d, double cmd, double gsd)
+{
+    return 0.5 * erfc(-log(d / cmd) / log(gsd) / sqrt(2.0));
+}
+
+/**
+ * @brief      make the cumulative counts of a log-normal distribution
+ * @param[in]  cmd count median diameter
+ * @param[in]  gsd geometric standard deviation
+ * @param[in]  total counted particles from 0.3 um to 10 um
+ * @param[out] *pm pointer to a sen5x pm structure
+ * @note       none
+ */
+static void a_sen5x_psd_test_make(double cmd, double gsd, double total, sen5x_pm_t *pm)
+{
+    double lo;
+    double all;
+
+    lo = a_sen5x_psd_test_cdf(gs_edge[0], cmd, gsd);
+    all = a_sen5x_psd_test_cdf(gs_edge[5], cmd, gsd) - lo;
+    memset(pm, 0, sizeof(sen5x_pm_t));
+    pm->pm_valid = 1;
+    pm->pm0p5_cm3 = (float)(total * (a_sen5x_psd_test_cdf(gs_edge[1], cmd, gsd) - lo) / all);
+    pm->pm1p0_cm3 = (float)(total * (a_sen5x_psd_test_cdf(gs_edge[2], cmd, gsd) - lo) / all);
+    pm->pm2p5_cm3 = (float)(total * (a_sen5x_psd_test_cdf(gs_edge[3], cmd, gsd) - lo) / all);
+    pm->pm4p0_cm3 = (float)(total * (a_sen5x_psd_test_cdf(gs_edge[4], cmd, gsd) - lo) / all);
+    pm->pm10_cm3 = (float)total;
+}
+
+/**
+ * @brief     get the exact mass of a log-normal bin
+ * @param[in] cmd count median diameter
+ * @param[in] gsd geometric standard deviation
+ * @param[in] number particles in the bin
+ * @param[in] k bin index
+ * @return    mass in μg/m3
+ * @note      none
+ */
+static double a_sen5x_psd_test_mass(double cmd, double gsd, double number, uint32_t k)
+{
+    double s;
+    double p;
+    double q;
+
+    s = log(gsd);
+    p = a_sen5x_psd_test_cdf(gs_edge[k + 1], cmd, gsd) - a_sen5x_psd_test_cdf(gs_edge[k], cmd, gsd);
+    q = a_sen5x_psd_test_cdf(gs_edge[k + 1], cmd * exp(3.0 * s * s), gsd) -
+        a_sen5x_psd_test_cdf(gs_edge[k], cmd * exp(3.0 * s * s), gsd);
+
+    return number * SEN5X_PSD_TEST_DENSITY * 3.14159265358979 / 6.0 * pow(cmd, 3.0) * exp(4.5 * s * s) * q / p;
+}
+
+/**
+ * @brief     psd test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_psd_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+    uint32_t t;
+    uint32_t resolved;
+    uint32_t unresolved;
+    double above;
+    double cmd_err;
+    double gsd_err;
+    double mass_err;
+    double err;
+    double sink;
+    clock_t start;
+    double batch_s;
+    double single_s;
+    sen5x_pm_t pm;
+    sen5x_psd_t psd;
+    sen5x_batch_pm_t columns;
+    static const double cmd[] = {0.1, 0.2, 0.3, 0.5, 1.0, 2.0};
+    static const double gsd[] = {1.3, 1.6, 2.0, 2.5, 3.0};
+
+    /* start psd test */
+    sen5x_interface_debug_print("sen5x: start psd test.\n");
+
+    /* check the params */
+    memset(&pm, 0, sizeof(pm));
+    if ((sen5x_psd_calculate(NULL, SEN5X_PSD_TEST_DENSITY, &psd) != 2) ||
+        (sen5x_psd_calculate(&pm, 0.0f, &psd) != 4))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+    (void)sen5x_psd_calculate(&pm, SEN5X_PSD_TEST_DENSITY, &psd);
+    if ((psd.valid != 0) || (isnan(psd.cmd_um) == 0))
+    {
+        sen5x_interface_debug_print("sen5x: invalid sample not rejected.\n");
+
+        return 1;
+    }
+
+    /* fit known log-normal distributions */
+    resolved = 0;
+    unresolved = 0;
+    cmd_err = 0.0;
+    gsd_err = 0.0;
+    mass_err = 0.0;
+    for (i = 0; i < sizeof(cmd) / sizeof(cmd[0]); i++)
+    {
+        for (j = 0; j < sizeof(gsd) / sizeof(gsd[0]); j++)
+        {
+            a_sen5x_psd_test_make(cmd[i], gsd[j], 1000.0, &pm);
+            res = sen5x_psd_calculate(&pm, SEN5X_PSD_TEST_DENSITY, &psd);
+            if ((res != 0) || (psd.valid != 1))
+            {
+                sen5x_interface_debug_print("sen5x: psd calculate failed.\n");
+
+                return 1;
+            }
+            if (fabsf(psd.total_number_cm3 - 1000.0f) > 0.01f)
+            {
+                sen5x_interface_debug_print("sen5x: bins don't add up to the total.\n");
+
+                return 1;
+            }
+            above = 1.0 - pm.pm0p5_cm3 / 1000.0;
+            if (above < 0.1)
+            {
+                unresolved++;
+
+                continue;
+            }
+            resolved++;
+            err = fabs(psd.cmd_um / cmd[i] - 1.0);
+            cmd_err = (err > cmd_err) ? err : cmd_err;
+            err = fabs(psd.gsd / gsd[j] - 1.0);
+            gsd_err = (err > gsd_err) ? err : gsd_err;
+            for (k = 0; k < SEN5X_PSD_BINS; k++)
+            {
+                err = fabs(psd.mass_ug_m3[k] / a_sen5x_psd_test_mass(cmd[i], gsd[j], psd.number_cm3[k], k) - 1.0);
+                err = (psd.number_cm3[k] > 1e-3f) ? err : 0.0;
+                mass_err = (err > mass_err) ? err : mass_err;
+            }
+        }
+    }
+    sen5x_interface_debug_print("sen5x: %d resolved distributions, cmd error %0.3f percent, gsd error %0.3f percent, bin mass error %0.3f percent.\n",
+                                resolved, cmd_err * 100.0, gsd_err * 100.0, mass_err * 100.0);
+    sen5x_interface_debug_print("sen5x: %d distributions with less than 10 percent above 0.5 um skipped.\n", unresolved);
+    if ((cmd_err > 0.01) || (gsd_err > 0.01) || (mass_err > 0.01))
+    {
+        sen5x_interface_debug_print("sen5x: fit error too large.\n");
+
+        return 1;
+    }
+    a_sen5x_psd_test_make(0.4, 1.8, 50.0, &pm);
+    (void)sen5x_psd_calculate(&pm, SEN5X_PSD_TEST_DENSITY, &psd);
+    sen5x_interface_debug_print("sen5x: cmd 0.40 um gsd 1.80 fitted as cmd %0.3f um gsd %0.3f, mass %0.2f ug/m3, residual %0.5f.\n",
+                                psd.cmd_um, psd.gsd, psd.total_mass_ug_m3, psd.fit_residual);
+
+    /* batch against the sample api */
+    gs_seed = 0x95D;
+    for (i = 0; i < SEN5X_PSD_TEST_SAMPLES; i++)
+    {
+        a_sen5x_psd_test_make(0.2 + (a_sen5x_psd_test_random() % 1000) / 1000.0,
+                              1.4 + (a_sen5x_psd_test_random() % 1000) / 1000.0,
+                              1.0 + (a_sen5x_psd_test_random() % 5000) / 10.0, &pm);
+        gs_column[0][i] = pm.pm0p5_cm3 + (float)(a_sen5x_psd_test_random() % 100) / 100.0f;
+        gs_column[1][i] = pm.pm1p0_cm3;
+        gs_column[2][i] = pm.pm2p5_cm3;
+        gs_column[3][i] = pm.pm4p0_cm3;
+        gs_column[4][i] = pm.pm10_cm3;
+        gs_valid[i] = ((a_sen5x_psd_test_random() % 50) != 0) ? 1 : 0;
+    }
+    memset(&columns, 0, sizeof(columns));
+    columns.pm0p5_cm3 = gs_column[0];
+    columns.pm1p0_cm3 = gs_column[1];
+    columns.pm2p5_cm3 = gs_column[2];
+    columns.pm4p0_cm3 = gs_column[3];
+    columns.pm10_cm3 = gs_column[4];
+    columns.pm_valid = gs_valid;
+    res = sen5x_psd_calculate_batch(&columns, SEN5X_PSD_TEST_SAMPLES, SEN5X_PSD_TEST_DENSITY, gs_psd);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: psd calculate batch failed.\n");
+
+        return 1;
+    }
+    for (i = 0; i < SEN5X_PSD_TEST_SAMPLES; i++)
+    {
+        pm.pm_valid = gs_valid[i];
+        pm.pm0p5_cm3 = gs_column[0][i];
+        pm.pm1p0_cm3 = gs_column[1][i];
+        pm.pm2p5_cm3 = gs_column[2][i];
+        pm.pm4p0_cm3 = gs_column[3][i];
+        pm.pm10_cm3 = gs_column[4][i];
+        memset(&psd, 0, sizeof(psd));
+        (void)sen5x_psd_calculate(&pm, SEN5X_PSD_TEST_DENSITY, &psd);
+        if ((psd.valid != gs_psd[i].valid) ||
+            ((psd.valid != 0) && (memcmp(&psd, &gs_psd[i], sizeof(sen5x_psd_t)) != 0)))
+        {
+            sen5x_interface_debug_print("sen5x: batch sample %d differs from the sample api.\n", i);
+
+            return 1;
+        }
+    }
+    sen5x_interface_debug_print("sen5x: %d batch samples match the sample api.\n", SEN5X_PSD_TEST_SAMPLES);
+
+    /* speed of the batch against the sample api */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    sink = 0.0;
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        (void)sen5x_psd_calculate_batch(&columns, SEN5X_PSD_TEST_SAMPLES, SEN5X_PSD_TEST_DENSITY, gs_psd);
+        sink += (gs_psd[t].valid != 0) ? gs_psd[t].gsd : 0.0f;
+    }
+    batch_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / SEN5X_PSD_TEST_SAMPLES;
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        for (i = 0; i < SEN5X_PSD_TEST_SAMPLES; i++)
+        {
+            pm.pm_valid = gs_valid[i];
+            pm.pm0p5_cm3 = gs_column[0][i];
+            pm.pm1p0_cm3 = gs_column[1][i];
+            pm.pm2p5_cm3 = gs_column[2][i];
+            pm.pm4p0_cm3 = gs_column[3][i];
+            pm.pm10_cm3 = gs_column[4][i];
+            (void)sen5x_psd_calculate(&pm, SEN5X_PSD_TEST_DENSITY, &psd);
+            sink += (psd.valid != 0) ? psd.gsd : 0.0f;
+        }
+    }
+    single_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / SEN5X_PSD_TEST_SAMPLES;
+    sen5x_interface_debug_print("sen5x: batch %0.1f ns per sample, sample api %0.1f ns per sample, checksum %0.1f.\n",
+                                batch_s * 1e9, single_s * 1e9, sink);
+
+    /* finish psd test */
+    sen5x_interface_debug_print("sen5x: finish psd test.\n");
+
+    return 0;
+}
@@ -0,0 +1,237 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_psychro_test.c
+ * @brief     driver sen5x psychro test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_psychro_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_PSYCHRO_TEST_T_STEPS        441          /**< -40 °C - 70 °C in 0.25 °C */
+#define SEN5X_PSYCHRO_TEST_RH_STEPS       200          /**< 0.5 % - 100 % in 0.5 % */
+#define SEN5X_PSYCHRO_TEST_SAMPLES        (SEN5X_PSYCHRO_TEST_T_STEPS * SEN5X_PSYCHRO_TEST_RH_STEPS)        /**< test samples */
+
+static float gs_t[SEN5X_PSYCHRO_TEST_SAMPLES];          /**< temperature samples */
+static float gs_rh[SEN5X_PSYCHRO_TEST_SAMPLES];         /**< humidity samples */
+static float gs_dp[SEN5X_PSYCHRO_TEST_SAMPLES];         /**< dew point outputs */
+static float gs_ah[SEN5X_PSYCHRO_TEST_SAMPLES];         /**< absolute humidity outputs */
+static float gs_hi[SEN5X_PSYCHRO_TEST_SAMPLES];         /**< heat index outputs */
+
+/**
+ * @brief      calculate the derived metrics with the math library
+ * @param[in]  t temperature in degree
+ * @param[in]  rh humidity in percentage
+ * @param[out] *dp pointer to a dew point buffer
+ * @param[out] *ah pointer to an absolute humidity buffer
+ * @param[out] *hi pointer to a heat index buffer
+ * @note       none
+ */
+static void a_sen5x_psychro_test_reference(double t, double rh, double *dp, double *ah, double *hi)
+{
+    double a;
+    double g;
+    double f;
+    double h;
+
+    a = 17.62 * t / (243.12 + t);
+    g = log(rh / 100.0) + a;
+    *dp = 243.12 * g / (17.62 - g);
+    *ah = 6.112 * exp(a) * rh / 100.0 * 216.74 / (t + 273.15);
+    f = t * 1.8 + 32.0;
+    h = 0.5 * (f + 61.0 + (f - 68.0) * 1.2 + rh * 0.094);
+    if ((h + f) / 2.0 >= 80.0)
+    {
+        h = -42.379 + 2.04901523 * f + 10.14333127 * rh - 0.22475541 * f * rh -
+            6.83783e-3 * f * f - 5.481717e-2 * rh * rh + 1.22874e-3 * f * f * rh +
+            8.5282e-4 * f * rh * rh - 1.99e-6 * f * f * rh * rh;
+        if ((rh < 13.0) && (f >= 80.0) && (f <= 112.0))
+        {
+            h -= (13.0 - rh) / 4.0 * sqrt((17.0 - fabs(f - 95.0)) / 17.0);
+        }
+        else if ((rh > 85.0) && (f >= 80.0) && (f <= 87.0))
+        {
+            h += (rh - 85.0) / 10.0 * (87.0 - f) / 5.0;
+        }
+    }
+    *hi = (h - 32.0) / 1.8;
+}
+
+/**
+ * @brief     psychro test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_psychro_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t t;
+    float x;
+    double dp;
+    double ah;
+    double hi;
+    double err;
+    double exp_err;
+    double log_err;
+    double dp_err;
+    double ah_err;
+    double hi_err;
+    double sink;
+    clock_t start;
+    double fast_s;
+    double libm_s;
+    sen5x_psychro_t psychro;
+
+    /* start psychro test */
+    sen5x_interface_debug_print("sen5x: start psychro test.\n");
+
+    /* check the fast exponential and logarithm */
+    exp_err = 0.0;
+    for (x = -20.0f; x <= 20.0f; x += 0.001f)
+    {
+        err = fabs((double)sen5x_psychro_fast_exp(x) / exp((double)x) - 1.0);
+        exp_err = (err > exp_err) ? err : exp_err;
+    }
+    log_err = 0.0;
+    for (x = 0.001f; x <= 1.0f; x += 0.0001f)
+    {
+        err = fabs((double)sen5x_psychro_fast_log(x) - log((double)x));
+        log_err = (err > log_err) ? err : log_err;
+    }
+    sen5x_interface_debug_print("sen5x: fast exp relative error %0.2e, fast log absolute error %0.2e.\n", exp_err, log_err);
+    if ((exp_err > 3e-7) || (log_err > 3e-7))
+    {
+        sen5x_interface_debug_print("sen5x: fast math out of range.\n");
+
+        return 1;
+    }
+
+    /* check the batch against the math library */
+    for (i = 0; i < SEN5X_PSYCHRO_TEST_SAMPLES; i++)
+    {
+        gs_t[i] = -40.0f + 0.25f * (float)(i / SEN5X_PSYCHRO_TEST_RH_STEPS);
+        gs_rh[i] = 0.5f + 0.5f * (float)(i % SEN5X_PSYCHRO_TEST_RH_STEPS);
+    }
+    res = sen5x_psychro_calculate_batch(gs_t, gs_rh, SEN5X_PSYCHRO_TEST_SAMPLES, gs_dp, gs_ah, gs_hi);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: calculate batch failed.\n");
+
+        return 1;
+    }
+    dp_err = 0.0;
+    ah_err = 0.0;
+    hi_err = 0.0;
+    for (i = 0; i < SEN5X_PSYCHRO_TEST_SAMPLES; i++)
+    {
+        a_sen5x_psychro_test_reference(gs_t[i], gs_rh[i], &dp, &ah, &hi);
+        err = fabs(gs_dp[i] - dp);
+        dp_err = (err > dp_err) ? err : dp_err;
+        err = fabs(gs_ah[i] / ah - 1.0) * 100.0;
+        ah_err = (err > ah_err) ? err : ah_err;
+        err = fabs(gs_hi[i] - hi);
+        hi_err = (err > hi_err) ? err : hi_err;
+    }
+    sen5x_interface_debug_print("sen5x: %d samples, dew point error %0.5f C, absolute humidity error %0.5f percent, heat index error %0.5f C.\n",
+                                SEN5X_PSYCHRO_TEST_SAMPLES, dp_err, ah_err, hi_err);
+    if ((dp_err > 0.001) || (ah_err > 0.001) || (hi_err > 0.001))
+    {
+        sen5x_interface_debug_print("sen5x: batch out of the documented bounds.\n");
+
+        return 1;
+    }
+
+    /* check the single sample api */
+    res = sen5x_psychro_calculate(30.0f, 70.0f, &psychro);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: calculate failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: 30.0 C and 70.0 percent gives dew point %0.2f C, absolute humidity %0.2f g/m3, heat index %0.2f C.\n",
+                                psychro.dew_point_degree, psychro.absolute_humidity_g_m3, psychro.heat_index_degree);
+    if (sen5x_psychro_calculate(NAN, 50.0f, &psychro) != 4)
+    {
+        sen5x_interface_debug_print("sen5x: nan sample not rejected.\n");
+
+        return 1;
+    }
+    gs_t[0] = NAN;
+    (void)sen5x_psychro_calculate_batch(gs_t, gs_rh, 1, gs_dp, NULL, NULL);
+    if (isnan(gs_dp[0]) == 0)
+    {
+        sen5x_interface_debug_print("sen5x: nan sample not propagated.\n");
+
+        return 1;
+    }
+    gs_t[0] = -40.0f;
+
+    /* speed against the math library */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    sink = 0.0;
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        (void)sen5x_psychro_calculate_batch(gs_t, gs_rh, SEN5X_PSYCHRO_TEST_SAMPLES, gs_dp, gs_ah, gs_hi);
+        sink += gs_dp[t] + gs_ah[t] + gs_hi[t];
+    }
+    fast_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / SEN5X_PSYCHRO_TEST_SAMPLES;
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        for (i = 0; i < SEN5X_PSYCHRO_TEST_SAMPLES; i++)
+        {
+            a_sen5x_psychro_test_reference(gs_t[i], gs_rh[i], &dp, &ah, &hi);
+            sink += dp + ah + hi;
+        }
+    }
+    libm_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / SEN5X_PSYCHRO_TEST_SAMPLES;
+    sen5x_interface_debug_print("sen5x: batch %0.1f ns per sample (%0.1f M samples/s), math library %0.1f ns per sample.\n",
+                                fast_s * 1e9, 1e-6 / fast_s, libm_s * 1e9);
+    sen5x_interface_debug_print("sen5x: checksum %0.1f.\n", sink);
+
+    /* finish psychro test */
+    sen5x_interface_debug_print("sen5x: finish psychro test.\n");
+
+    return 0;
+}
@@ -0,0 +1,588 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_query_test.c
+ * @brief     driver sen5x query test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_query_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_QUERY_TEST_SAMPLES            43200                    /**< half a day at 1 Hz */
+#define SEN5X_QUERY_TEST_ARCHIVE_SIZE       (1024 * 1024)            /**< archive buffer size */
+#define SEN5X_QUERY_TEST_MAX_BLOCKS         (SEN5X_QUERY_TEST_ARCHIVE_SIZE / SEN5X_ARCHIVE_BLOCK_SIZE)        /**< max blocks */
+#define SEN5X_QUERY_TEST_START_MS           1760000000000ULL         /**< first timestamp */
+
+static uint16_t gs_word[SEN5X_QUERY_TEST_SAMPLES][SEN5X_ARCHIVE_MAX_CHANNELS];        /**< input words */
+static uint64_t gs_timestamp[SEN5X_QUERY_TEST_SAMPLES];                               /**< input timestamps */
+static uint8_t gs_archive[SEN5X_QUERY_TEST_ARCHIVE_SIZE];                             /**< archive buffer */
+static uint8_t gs_index[SEN5X_QUERY_INDEX_SIZE(SEN5X_QUERY_TEST_MAX_BLOCKS)];         /**< index buffer */
+static uint8_t gs_block[SEN5X_ARCHIVE_BLOCK_SIZE];                                    /**< block buffer */
+static uint64_t gs_first_ms[SEN5X_QUERY_TEST_MAX_BLOCKS];                             /**< first timestamp of the blocks */
+static uint64_t gs_last_ms[SEN5X_QUERY_TEST_MAX_BLOCKS];                              /**< last timestamp of the blocks */
+static uint32_t gs_archive_len;                                                       /**< archive length */
+static uint32_t gs_seed;                                                              /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_query_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     emit block callback
+ * @param[in] *block pointer to a block buffer
+ * @param[in] len block length
+ * @return    status code
+ *            - 0 success
+ *            - 1 archive is full
+ * @note      none
+ */
+static uint8_t a_sen5x_query_test_emit(const uint8_t *block, uint32_t len)
+{
+    if ((gs_archive_len + len) > SEN5X_QUERY_TEST_ARCHIVE_SIZE)
+    {
+        return 1;
+    }
+    memcpy(&gs_archive[gs_archive_len], block, len);
+    gs_archive_len += len;
+
+    return 0;
+}
+
+/**
+ * @brief      count the samples of a range by decoding every valid block
+ * @param[in]  start_ms first timestamp
+ * @param[in]  end_ms last timestamp
+ * @param[in]  *filter pointer to a filter structure, NULL to count every sample
+ * @param[out] *count pointer to a sample count buffer
+ * @param[out] *first_ms pointer to a first timestamp buffer
+ * @note       the reference doesn't use the index or the search
+ */
+static void a_sen5x_query_test_scan(uint64_t start_ms, uint64_t end_ms, const sen5x_query_filter_t *filter,
+                                    uint32_t *count, uint64_t *first_ms)
+{
+    uint32_t i;
+    int32_t value;
+    uint64_t ms;
+    uint16_t word[SEN5X_ARCHIVE_MAX_CHANNELS];
+    sen5x_archive_decoder_t decoder;
+
+    *count = 0;
+    *first_ms = 0;
+    for (i = 0; i < gs_archive_len; i += SEN5X_ARCHIVE_BLOCK_SIZE)
+    {
+        if (sen5x_archive_decoder_init(&decoder, &gs_archive[i], SEN5X_ARCHIVE_BLOCK_SIZE) != 0)
+        {
+            continue;
+        }
+        while (sen5x_archive_decode(&decoder, &ms, word) == 0)
+        {
+            if ((ms < start_ms) || (ms > end_ms))
+            {
+                continue;
+            }
+            if ((filter != NULL) &&
+                ((sen5x_archive_get_value(SEN5X_ARCHIVE_LAYOUT_MEASURED, filter->channel, word[filter->channel], &value) != 0) ||
+                 (value < filter->min) || (value > filter->max)))
+            {
+                continue;
+            }
+            if ((*count) == 0)
+            {
+                *first_ms = ms;
+            }
+            (*count)++;
+        }
+    }
+}
+
+/**
+ * @brief      run a range query
+ * @param[in]  *query pointer to a query structure
+ * @param[in]  start_ms first timestamp
+ * @param[in]  end_ms last timestamp
+ * @param[in]  *filter pointer to a filter structure, NULL to return every sample
+ * @param[out] *iterator pointer to an iterator structure
+ * @param[out] *count pointer to a sample count buffer
+ * @param[out] *first_ms pointer to a first timestamp buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 query failed
+ * @note       the timestamps must rise
+ */
+static uint8_t a_sen5x_query_test_run(sen5x_query_t *query, uint64_t start_ms, uint64_t end_ms,
+                                      const sen5x_query_filter_t *filter, sen5x_query_iterator_t *iterator,
+                                      uint32_t *count, uint64_t *first_ms)
+{
+    uint64_t ms;
+    uint64_t prev;
+    uint16_t word[SEN5X_ARCHIVE_MAX_CHANNELS];
+
+    if (sen5x_query_begin(query, start_ms, end_ms, filter, iterator) != 0)
+    {
+        return 1;
+    }
+    *count = 0;
+    *first_ms = 0;
+    prev = 0;
+    while (sen5x_query_next(query, iterator, &ms, word) == 0)
+    {
+        if (((*count) != 0) && (ms <= prev))
+        {
+            return 1;
+        }
+        if ((*count) == 0)
+        {
+            *first_ms = ms;
+        }
+        prev = ms;
+        (*count)++;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     check a range query against the expected samples
+ * @param[in] *query pointer to a query structure
+ * @param[in] start_ms first timestamp
+ * @param[in] end_ms last timestamp
+ * @param[in] *filter pointer to a filter structure, NULL to return every sample
+ * @param[in] count expected sample count
+ * @param[in] first_ms expected first timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_sen5x_query_test_check(sen5x_query_t *query, uint64_t start_ms, uint64_t end_ms,
+                                        const sen5x_query_filter_t *filter, uint32_t count, uint64_t first_ms)
+{
+    uint32_t n;
+    uint64_t ms;
+    sen5x_query_iterator_t iterator;
+
+    if (a_sen5x_query_test_run(query, start_ms, end_ms, filter, &iterator, &n, &ms) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: query failed.\n");
+
+        return 1;
+    }
+    if ((n != count) || ((count != 0) && (ms != first_ms)))
+    {
+        sen5x_interface_debug_print("sen5x: range %lld - %lld returned %d samples from %lld, expect %d from %lld.\n",
+                                    (long long)(start_ms - SEN5X_QUERY_TEST_START_MS),
+                                    (long long)(end_ms - SEN5X_QUERY_TEST_START_MS), n,
+                                    (long long)(ms - SEN5X_QUERY_TEST_START_MS), count,
+                                    (long long)(first_ms - SEN5X_QUERY_TEST_START_MS));
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     check the range boundaries of every block against the input samples
+ * @param[in] *query pointer to a query structure
+ * @param[in] blocks block count
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_sen5x_query_test_bounds(sen5x_query_t *query, uint32_t blocks)
+{
+    uint32_t b;
+    uint32_t k;
+    uint32_t m;
+    uint64_t last;
+
+    last = gs_timestamp[SEN5X_QUERY_TEST_SAMPLES - 1];
+    if (a_sen5x_query_test_check(query, gs_timestamp[0], last, NULL, SEN5X_QUERY_TEST_SAMPLES, gs_timestamp[0]) != 0)
+    {
+        return 1;
+    }
+    for (b = 0; b < blocks; b++)
+    {
+        k = (uint32_t)((gs_first_ms[b] - SEN5X_QUERY_TEST_START_MS) / 1000);
+        m = (uint32_t)((gs_last_ms[b] - SEN5X_QUERY_TEST_START_MS) / 1000);
+        if ((a_sen5x_query_test_check(query, gs_first_ms[b], gs_first_ms[b], NULL, 1, gs_first_ms[b]) != 0) ||
+            (a_sen5x_query_test_check(query, gs_last_ms[b], gs_last_ms[b], NULL, 1, gs_last_ms[b]) != 0) ||
+            (a_sen5x_query_test_check(query, gs_first_ms[b], gs_last_ms[b], NULL, m - k + 1, gs_first_ms[b]) != 0) ||
+            (a_sen5x_query_test_check(query, gs_last_ms[b], last, NULL, SEN5X_QUERY_TEST_SAMPLES - m,
+                                      gs_last_ms[b]) != 0) ||
+            ((b + 1 < blocks) &&
+             (a_sen5x_query_test_check(query, gs_last_ms[b] + 1, last, NULL, SEN5X_QUERY_TEST_SAMPLES - m - 1,
+                                       gs_last_ms[b] + 1000) != 0)))
+        {
+            sen5x_interface_debug_print("sen5x: block %d boundary failed.\n", b);
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     check empty ranges
+ * @param[in] *query pointer to a query structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_sen5x_query_test_empty(sen5x_query_t *query)
+{
+    uint64_t last;
+
+    last = gs_timestamp[SEN5X_QUERY_TEST_SAMPLES - 1];
+    if ((a_sen5x_query_test_check(query, 0, gs_timestamp[0] - 1, NULL, 0, 0) != 0) ||
+        (a_sen5x_query_test_check(query, last + 1, 0xFFFFFFFFFFFFFFFFULL, NULL, 0, 0) != 0) ||
+        (a_sen5x_query_test_check(query, gs_timestamp[100] + 1, gs_timestamp[101] - 1, NULL, 0, 0) != 0) ||
+        (a_sen5x_query_test_check(query, gs_last_ms[0] + 1, gs_last_ms[0] + 999, NULL, 0, 0) != 0))
+    {
+        sen5x_interface_debug_print("sen5x: empty range failed.\n");
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     check the query from every block against the reference scan
+ * @param[in] *query pointer to a query structure
+ * @param[in] blocks block count
+ * @param[in] *filter pointer to a filter structure, NULL to return every sample
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_sen5x_query_test_reference(sen5x_query_t *query, uint32_t blocks, const sen5x_query_filter_t *filter)
+{
+    uint32_t b;
+    uint32_t count;
+    uint64_t first_ms;
+    uint64_t last;
+
+    last = gs_timestamp[SEN5X_QUERY_TEST_SAMPLES - 1];
+    for (b = 0; b < blocks; b++)
+    {
+        a_sen5x_query_test_scan(gs_first_ms[b], last, filter, &count, &first_ms);
+        if (a_sen5x_query_test_check(query, gs_first_ms[b], last, filter, count, first_ms) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: query from block %d failed.\n", b);
+
+            return 1;
+        }
+        a_sen5x_query_test_scan(gs_first_ms[b] + 1000, gs_last_ms[b], filter, &count, &first_ms);
+        if (a_sen5x_query_test_check(query, gs_first_ms[b] + 1000, gs_last_ms[b], filter, count, first_ms) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: query inside block %d failed.\n", b);
+
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     query test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_query_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t t;
+    uint32_t blocks;
+    uint32_t corrupt;
+    uint32_t count;
+    uint64_t first_ms;
+    int32_t pm;
+    clock_t start;
+    double query_s;
+    sen5x_archive_encoder_t encoder;
+    sen5x_archive_header_t header;
+    sen5x_query_t query;
+    sen5x_query_t indexed;
+    sen5x_query_iterator_t iterator;
+    sen5x_query_filter_t filter = {1, 200, 10000};
+
+    /* start query test */
+    sen5x_interface_debug_print("sen5x: start query test.\n");
+
+    /* make half a day of 1 Hz samples with pm episodes */
+    gs_seed = 0x5EA5;
+    pm = 80;
+    for (i = 0; i < SEN5X_QUERY_TEST_SAMPLES; i++)
+    {
+        pm += (int32_t)(a_sen5x_query_test_random() % 7) - 3;
+        pm = (pm < 20) ? 20 : ((pm > 150) ? 150 : pm);
+        gs_timestamp[i] = SEN5X_QUERY_TEST_START_MS + (uint64_t)i * 1000;
+        gs_word[i][0] = (uint16_t)(pm * 8 / 10);
+        gs_word[i][1] = (uint16_t)(((i % 7200) < 600) ? pm + 1000 : pm);
+        gs_word[i][2] = (uint16_t)(pm + pm / 10);
+        gs_word[i][3] = (uint16_t)(pm + pm / 8);
+        gs_word[i][4] = (uint16_t)(4500 + (i % 100));
+        gs_word[i][5] = (uint16_t)(4600 + (i % 50));
+        gs_word[i][6] = 1000;
+        gs_word[i][7] = 10;
+    }
+    gs_archive_len = 0;
+    res = sen5x_archive_encoder_init(&encoder, SEN5X_ARCHIVE_LAYOUT_MEASURED, gs_block, SEN5X_ARCHIVE_BLOCK_SIZE,
+                                     a_sen5x_query_test_emit);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: encoder init failed.\n");
+
+        return 1;
+    }
+    for (i = 0; i < SEN5X_QUERY_TEST_SAMPLES; i++)
+    {
+        if (sen5x_archive_encode(&encoder, gs_timestamp[i], gs_word[i]) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: encode failed.\n");
+
+            return 1;
+        }
+    }
+    if (sen5x_archive_flush(&encoder) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: flush failed.\n");
+
+        return 1;
+    }
+    blocks = gs_archive_len / SEN5X_ARCHIVE_BLOCK_SIZE;
+    for (i = 0; i < blocks; i++)
+    {
+        if (sen5x_archive_parse_header(&gs_archive[i * SEN5X_ARCHIVE_BLOCK_SIZE], SEN5X_ARCHIVE_BLOCK_SIZE, &header) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: parse header failed.\n");
+
+            return 1;
+        }
+        gs_first_ms[i] = header.first_ms;
+        gs_last_ms[i] = header.last_ms;
+    }
+    sen5x_interface_debug_print("sen5x: archive has %d samples in %d blocks.\n", SEN5X_QUERY_TEST_SAMPLES, blocks);
+
+    /* check the params */
+    memset(&query, 0, sizeof(sen5x_query_t));
+    if (sen5x_query_begin(&query, 0, 1, NULL, &iterator) != 3)
+    {
+        sen5x_interface_debug_print("sen5x: check not inited failed.\n");
+
+        return 1;
+    }
+    if ((sen5x_query_init(&query, gs_archive, gs_archive_len, 64, NULL, 0) != 4) ||
+        (sen5x_query_build_index(gs_archive, gs_archive_len, SEN5X_ARCHIVE_BLOCK_SIZE, gs_index,
+                                 SEN5X_QUERY_INDEX_SIZE(blocks) - 1) != 5))
+    {
+        sen5x_interface_debug_print("sen5x: check invalid size failed.\n");
+
+        return 1;
+    }
+    res = sen5x_query_init(&query, gs_archive, gs_archive_len, SEN5X_ARCHIVE_BLOCK_SIZE, NULL, 0);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: query init failed.\n");
+
+        return 1;
+    }
+    if ((sen5x_query_begin(NULL, 0, 1, NULL, &iterator) != 2) || (sen5x_query_begin(&query, 0, 1, NULL, NULL) != 2) ||
+        (sen5x_query_begin(&query, 2, 1, NULL, &iterator) != 4))
+    {
+        sen5x_interface_debug_print("sen5x: check params failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check params ok.\n");
+
+    /* range boundaries without and with the index */
+    res = sen5x_query_build_index(gs_archive, gs_archive_len, SEN5X_ARCHIVE_BLOCK_SIZE, gs_index, SEN5X_QUERY_INDEX_SIZE(blocks));
+    res |= sen5x_query_init(&indexed, gs_archive, gs_archive_len, SEN5X_ARCHIVE_BLOCK_SIZE, gs_index,
+                            SEN5X_QUERY_INDEX_SIZE(blocks));
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: index init failed.\n");
+
+        return 1;
+    }
+    if ((a_sen5x_query_test_bounds(&query, blocks) != 0) || (a_sen5x_query_test_bounds(&indexed, blocks) != 0))
+    {
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check range boundaries ok.\n");
+
+    /* empty ranges */
+    if ((a_sen5x_query_test_empty(&query) != 0) || (a_sen5x_query_test_empty(&indexed) != 0))
+    {
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check empty ranges ok.\n");
+
+    /* filtered ranges */
+    if ((a_sen5x_query_test_reference(&query, blocks, &filter) != 0) ||
+        (a_sen5x_query_test_reference(&indexed, blocks, &filter) != 0))
+    {
+        return 1;
+    }
+    if (a_sen5x_query_test_run(&indexed, gs_timestamp[0], gs_timestamp[SEN5X_QUERY_TEST_SAMPLES - 1], &filter,
+                               &iterator, &count, &first_ms) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: filtered query failed.\n");
+
+        return 1;
+    }
+    if ((iterator.blocks_skipped == 0) || (iterator.blocks_skipped + iterator.blocks_read != blocks))
+    {
+        sen5x_interface_debug_print("sen5x: filter skipped %d of %d blocks.\n", iterator.blocks_skipped, blocks);
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check filter ok, %d of %d blocks skipped.\n", iterator.blocks_skipped, blocks);
+
+    /* a corrupt block in the middle */
+    corrupt = blocks / 2;
+    gs_archive[corrupt * SEN5X_ARCHIVE_BLOCK_SIZE] ^= 0xFF;
+    res = sen5x_query_build_index(gs_archive, gs_archive_len, SEN5X_ARCHIVE_BLOCK_SIZE, gs_index, SEN5X_QUERY_INDEX_SIZE(blocks));
+    res |= sen5x_query_init(&indexed, gs_archive, gs_archive_len, SEN5X_ARCHIVE_BLOCK_SIZE, gs_index,
+                            SEN5X_QUERY_INDEX_SIZE(blocks));
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: index init failed.\n");
+
+        return 1;
+    }
+    if ((a_sen5x_query_test_reference(&query, blocks, NULL) != 0) ||
+        (a_sen5x_query_test_reference(&indexed, blocks, NULL) != 0) ||
+        (a_sen5x_query_test_reference(&query, blocks, &filter) != 0) ||
+        (a_sen5x_query_test_reference(&indexed, blocks, &filter) != 0))
+    {
+        sen5x_interface_debug_print("sen5x: check corrupt block %d failed.\n", corrupt);
+
+        return 1;
+    }
+    a_sen5x_query_test_scan(gs_timestamp[0], gs_timestamp[SEN5X_QUERY_TEST_SAMPLES - 1], NULL, &count, &first_ms);
+    if (count != SEN5X_QUERY_TEST_SAMPLES - (uint32_t)((gs_last_ms[corrupt] - gs_first_ms[corrupt]) / 1000) - 1)
+    {
+        sen5x_interface_debug_print("sen5x: reference scan returned %d samples.\n", count);
+
+        return 1;
+    }
+    for (i = 0; i < 2; i++)
+    {
+        if (a_sen5x_query_test_run((i == 0) ? &query : &indexed, gs_timestamp[0], gs_timestamp[SEN5X_QUERY_TEST_SAMPLES - 1],
+                                   NULL, &iterator, &t, &first_ms) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: query failed.\n");
+
+            return 1;
+        }
+        if ((t != count) || (iterator.blocks_corrupt != 1) || (iterator.blocks_read != blocks - 1))
+        {
+            sen5x_interface_debug_print("sen5x: %s query returned %d samples, %d corrupt blocks.\n",
+                                        (i == 0) ? "unindexed" : "indexed", t, iterator.blocks_corrupt);
+
+            return 1;
+        }
+    }
+    if ((a_sen5x_query_test_check(&query, gs_first_ms[corrupt], gs_last_ms[corrupt], NULL, 0, 0) != 0) ||
+        (a_sen5x_query_test_check(&indexed, gs_first_ms[corrupt], gs_last_ms[corrupt], NULL, 0, 0) != 0))
+    {
+        sen5x_interface_debug_print("sen5x: check range of the corrupt block failed.\n");
+
+        return 1;
+    }
+    gs_archive[corrupt * SEN5X_ARCHIVE_BLOCK_SIZE] ^= 0xFF;
+    sen5x_interface_debug_print("sen5x: check corrupt block %d of %d ok.\n", corrupt, blocks);
+
+    /* benchmark an hour query */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    res = sen5x_query_build_index(gs_archive, gs_archive_len, SEN5X_ARCHIVE_BLOCK_SIZE, gs_index, SEN5X_QUERY_INDEX_SIZE(blocks));
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: build index failed.\n");
+
+        return 1;
+    }
+    count = 0;
+    start = clock();
+    for (t = 0; t < times * 100; t++)
+    {
+        i = (t * 7919U) % (SEN5X_QUERY_TEST_SAMPLES - 3600);
+        if (a_sen5x_query_test_run(&indexed, gs_timestamp[i], gs_timestamp[i + 3599], NULL, &iterator, &blocks,
+                                   &first_ms) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: query failed.\n");
+
+            return 1;
+        }
+        count += blocks;
+    }
+    query_s = (double)(clock() - start) / CLOCKS_PER_SEC / (times * 100);
+    if (count != times * 100 * 3600)
+    {
+        sen5x_interface_debug_print("sen5x: hour queries returned %d samples.\n", count);
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: hour query %0.1fus, %d bytes of state.\n", query_s * 1e6,
+                                (int)(sizeof(sen5x_query_t) + sizeof(sen5x_query_iterator_t)));
+
+    /* finish query test */
+    sen5x_interface_debug_print("sen5x: finish query test.\n");
+
+    return 0;
+}
@@ -52,6 +52,7 @@ uint8_t sen5x_read_test(sen5x_type_t type, uint32_t times)
     uint8_t res;
     uint32_t i;
     sen5x_info_t info;
+    sen5x_sequence_t sequence;
     
     /* link functions */
     DRIVER_SEN5X_LINK_INIT(&gs_handle, sen5x_handle_t);
@@ -61,6 +62,7 @@ uint8_t sen5x_read_test(sen5x_type_t type, uint32_t times)
     DRIVER_SEN5X_LINK_IIC_READ_COMMAND(&gs_handle, sen5x_interface_iic_read_cmd);
     DRIVER_SEN5X_LINK_DELAY_MS(&gs_handle, sen5x_interface_delay_ms);
     DRIVER_SEN5X_LINK_DEBUG_PRINT(&gs_handle, sen5x_interface_debug_print);
+    DRIVER_SEN5X_LINK_TIMESTAMP_US(&gs_handle, sen5x_interface_timestamp_us);
     
     /* get information */
     res = sen5x_info(&info);
@@ -216,6 +218,18 @@ uint8_t sen5x_read_test(sen5x_type_t type, uint32_t times)
         sen5x_interface_delay_ms(2000);
     }
     
+    /* get the sequence */
+    res = sen5x_get_sequence(&gs_handle, &sequence);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: get sequence failed.\n");
+        (void)sen5x_deinit(&gs_handle);
+        
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: fresh %d, gap %d, missed %d, duplicate %d.\n",
+                                sequence.fresh, sequence.gap, sequence.missed, sequence.duplicate);
+    
     /* sen5x_read_pm_value test */
     sen5x_interface_debug_print("sen5x: sen5x_read_pm_value test.\n");
     for (i = 0; i < times; i++)
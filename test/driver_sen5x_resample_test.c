@@ -0,0 +1,374 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_resample_test.c
+ * @brief     driver sen5x resample test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_resample_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_RESAMPLE_TEST_STREAMS        8                  /**< streams of the alignment runs */
+#define SEN5X_RESAMPLE_TEST_CHANNELS       3                  /**< channels of the alignment runs */
+#define SEN5X_RESAMPLE_TEST_SAMPLES        3600               /**< samples per stream */
+#define SEN5X_RESAMPLE_TEST_START_MS       1760000000000ULL   /**< first tick */
+#define SEN5X_RESAMPLE_TEST_GAP_MS         2500               /**< max sample spacing bridged */
+#define SEN5X_RESAMPLE_TEST_DELAY_MS       5000               /**< max wait for a late stream */
+#define SEN5X_RESAMPLE_TEST_SILENT         7                  /**< stream going silent */
+#define SEN5X_RESAMPLE_TEST_SILENT_FIRST   1000               /**< first sample the silent stream loses */
+#define SEN5X_RESAMPLE_TEST_SILENT_LEN     20                 /**< samples the silent stream loses */
+
+static sen5x_resample_t gs_resample;                                       /**< resample */
+static uint64_t gs_phase[SEN5X_RESAMPLE_MAX_STREAMS];                      /**< first sample per stream */
+static uint64_t gs_period[SEN5X_RESAMPLE_MAX_STREAMS];                     /**< sample period per stream */
+static uint64_t gs_newest;                                                 /**< newest pushed time */
+static uint64_t gs_first;                                                  /**< first tick all streams cover */
+static uint64_t gs_last;                                                   /**< last tick all streams cover */
+static uint64_t gs_lag_max;                                                /**< max row lag behind the newest time */
+static uint32_t gs_rows;                                                   /**< emitted rows */
+static uint32_t gs_wrong;                                                  /**< wrong values */
+static uint32_t gs_missing[SEN5X_RESAMPLE_MAX_STREAMS];                    /**< missing values per stream */
+static uint8_t gs_check;                                                   /**< check flag */
+static sen5x_resample_mode_t gs_mode;                                      /**< mode under test */
+static uint32_t gs_seed;                                                   /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_resample_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     get the time of a sample
+ * @param[in] s stream index
+ * @param[in] k sample index
+ * @return    sample time in ms
+ * @note      none
+ */
+static uint64_t a_sen5x_resample_test_time(uint8_t s, uint32_t k)
+{
+    return gs_phase[s] + (uint64_t)k * gs_period[s];
+}
+
+/**
+ * @brief     get the true signal of a stream
+ * @param[in] s stream index
+ * @param[in] c channel index
+ * @param[in] t time in ms
+ * @return    signal value
+ * @note      linear in time so linear interpolation is exact
+ */
+static float a_sen5x_resample_test_signal(uint8_t s, uint8_t c, uint64_t t)
+{
+    return (float)s + (float)c + 0.0001f * (float)(c + 1) * (float)(int64_t)(t - SEN5X_RESAMPLE_TEST_START_MS);
+}
+
+/**
+ * @brief     row emit callback
+ * @param[in] *row pointer to a row structure
+ * @return    status code
+ *            - 0 success
+ * @note      checks every value against the true signal, missing values are only counted
+ *            while all streams are running
+ */
+static uint8_t a_sen5x_resample_test_emit(const sen5x_resample_row_t *row)
+{
+    uint8_t s;
+    uint8_t c;
+    int64_t k;
+    uint64_t t;
+    float expect;
+
+    gs_rows++;
+    if (gs_check == 0)
+    {
+        return 0;
+    }
+    gs_lag_max = (gs_newest - row->tick_ms > gs_lag_max) ? gs_newest - row->tick_ms : gs_lag_max;
+    for (s = 0; s < row->streams; s++)
+    {
+        if ((row->valid & (1UL << s)) == 0)
+        {
+            gs_missing[s] += ((row->tick_ms >= gs_first) && (row->tick_ms <= gs_last)) ? 1 : 0;
+            if (isnan(row->value[0][s]) == 0)
+            {
+                gs_wrong++;
+            }
+            continue;
+        }
+        t = row->tick_ms;
+        if (gs_mode == SEN5X_RESAMPLE_MODE_LAST)
+        {
+            k = (int64_t)((t - gs_phase[s]) / gs_period[s]);
+            k = (k < SEN5X_RESAMPLE_TEST_SAMPLES) ? k : SEN5X_RESAMPLE_TEST_SAMPLES - 1;
+            if ((s == SEN5X_RESAMPLE_TEST_SILENT) && (k >= SEN5X_RESAMPLE_TEST_SILENT_FIRST) &&
+                (k < SEN5X_RESAMPLE_TEST_SILENT_FIRST + SEN5X_RESAMPLE_TEST_SILENT_LEN))
+            {
+                k = SEN5X_RESAMPLE_TEST_SILENT_FIRST - 1;
+            }
+            t = a_sen5x_resample_test_time(s, (uint32_t)k);
+        }
+        for (c = 0; c < row->channels; c++)
+        {
+            expect = a_sen5x_resample_test_signal(s, c, t);
+            if (!(fabsf(row->value[c][s] - expect) < 0.01f))
+            {
+                gs_wrong++;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     run an alignment against simulated streams
+ * @param[in] mode resample mode
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the streams have random phases and small rate differences, stream 0 is read in
+ *            bursts of three samples and the others arrive 0 - 40 ms late
+ */
+static uint8_t a_sen5x_resample_test_run(sen5x_resample_mode_t mode)
+{
+    uint8_t s;
+    uint8_t c;
+    uint8_t best;
+    uint32_t k[SEN5X_RESAMPLE_TEST_STREAMS];
+    uint64_t arrive[SEN5X_RESAMPLE_TEST_STREAMS];
+    uint64_t t;
+    float value[SEN5X_RESAMPLE_TEST_CHANNELS];
+
+    if (sen5x_resample_init(&gs_resample, SEN5X_RESAMPLE_TEST_STREAMS, SEN5X_RESAMPLE_TEST_CHANNELS, mode,
+                            1000, SEN5X_RESAMPLE_TEST_GAP_MS, SEN5X_RESAMPLE_TEST_DELAY_MS, a_sen5x_resample_test_emit) != 0)
+    {
+        return 1;
+    }
+    gs_mode = mode;
+    gs_check = 1;
+    gs_rows = 0;
+    gs_wrong = 0;
+    gs_newest = 0;
+    gs_lag_max = 0;
+    gs_first = 0;
+    gs_last = 0xFFFFFFFFFFFFFFFFULL;
+    memset(gs_missing, 0, sizeof(gs_missing));
+    for (s = 0; s < SEN5X_RESAMPLE_TEST_STREAMS; s++)
+    {
+        gs_phase[s] = SEN5X_RESAMPLE_TEST_START_MS + a_sen5x_resample_test_random() % 1000;
+        gs_period[s] = 998 + a_sen5x_resample_test_random() % 5;
+        k[s] = 0;
+        t = a_sen5x_resample_test_time(s, SEN5X_RESAMPLE_TEST_SAMPLES - 1);
+        gs_first = (gs_phase[s] > gs_first) ? gs_phase[s] : gs_first;
+        gs_last = (t < gs_last) ? t : gs_last;
+        arrive[s] = gs_phase[s] + ((s == 0) ? 2 * gs_period[s] : a_sen5x_resample_test_random() % 40);
+    }
+    while (1)
+    {
+        best = SEN5X_RESAMPLE_TEST_STREAMS;
+        for (s = 0; s < SEN5X_RESAMPLE_TEST_STREAMS; s++)
+        {
+            if ((k[s] < SEN5X_RESAMPLE_TEST_SAMPLES) &&
+                ((best == SEN5X_RESAMPLE_TEST_STREAMS) || (arrive[s] < arrive[best])))
+            {
+                best = s;
+            }
+        }
+        if (best == SEN5X_RESAMPLE_TEST_STREAMS)
+        {
+            break;
+        }
+        s = best;
+        t = a_sen5x_resample_test_time(s, k[s]);
+        if ((s != SEN5X_RESAMPLE_TEST_SILENT) || (k[s] < SEN5X_RESAMPLE_TEST_SILENT_FIRST) ||
+            (k[s] >= SEN5X_RESAMPLE_TEST_SILENT_FIRST + SEN5X_RESAMPLE_TEST_SILENT_LEN))
+        {
+            for (c = 0; c < SEN5X_RESAMPLE_TEST_CHANNELS; c++)
+            {
+                value[c] = a_sen5x_resample_test_signal(s, c, t);
+            }
+            gs_newest = (t > gs_newest) ? t : gs_newest;
+            if (sen5x_resample_push(&gs_resample, s, t, value) != 0)
+            {
+                return 1;
+            }
+        }
+        k[s]++;
+        if (s == 0)
+        {
+            arrive[s] = ((k[s] % 3) == 0) ? a_sen5x_resample_test_time(s, k[s] + 2) : arrive[s];
+        }
+        else
+        {
+            arrive[s] = a_sen5x_resample_test_time(s, k[s]) + a_sen5x_resample_test_random() % 40;
+        }
+    }
+    if (sen5x_resample_flush(&gs_resample) != 0)
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     resample test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_resample_test(uint32_t times)
+{
+    uint8_t s;
+    uint8_t i;
+    uint32_t t;
+    uint32_t others;
+    uint64_t now;
+    clock_t start;
+    double push_s;
+    float value[SEN5X_RESAMPLE_MAX_CHANNELS];
+    sen5x_resample_stats_t stats;
+    const sen5x_resample_mode_t mode[2] = {SEN5X_RESAMPLE_MODE_LINEAR, SEN5X_RESAMPLE_MODE_LAST};
+    const char *name[2] = {"linear", "last value"};
+
+    /* start resample test */
+    sen5x_interface_debug_print("sen5x: start resample test.\n");
+
+    /* check the params */
+    memset(value, 0, sizeof(value));
+    if ((sen5x_resample_init(&gs_resample, 0, 3, SEN5X_RESAMPLE_MODE_LINEAR, 1000, 2500, 5000, a_sen5x_resample_test_emit) != 4) ||
+        (sen5x_resample_init(&gs_resample, 4, 11, SEN5X_RESAMPLE_MODE_LINEAR, 1000, 2500, 5000, a_sen5x_resample_test_emit) != 4) ||
+        (sen5x_resample_init(&gs_resample, 4, 3, (sen5x_resample_mode_t)2, 1000, 2500, 5000, a_sen5x_resample_test_emit) != 5) ||
+        (sen5x_resample_init(&gs_resample, 4, 3, SEN5X_RESAMPLE_MODE_LINEAR, 1000, 500, 5000, a_sen5x_resample_test_emit) != 6))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+    gs_check = 0;
+    (void)sen5x_resample_init(&gs_resample, 4, 3, SEN5X_RESAMPLE_MODE_LINEAR, 1000, 2500, 5000, a_sen5x_resample_test_emit);
+    (void)sen5x_resample_push(&gs_resample, 0, 5000, value);
+    if ((sen5x_resample_push(&gs_resample, 4, 5000, value) != 4) ||
+        (sen5x_resample_push(&gs_resample, 0, 4000, value) != 5))
+    {
+        sen5x_interface_debug_print("sen5x: invalid push not rejected.\n");
+
+        return 1;
+    }
+
+    /* align jittery streams */
+    gs_seed = 0x5253;
+    for (i = 0; i < 2; i++)
+    {
+        if (a_sen5x_resample_test_run(mode[i]) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: resample run failed.\n");
+
+            return 1;
+        }
+        (void)sen5x_resample_get_stats(&gs_resample, &stats);
+        others = 0;
+        for (s = 0; s < SEN5X_RESAMPLE_TEST_STREAMS; s++)
+        {
+            others += (s != SEN5X_RESAMPLE_TEST_SILENT) ? gs_missing[s] : 0;
+        }
+        sen5x_interface_debug_print("sen5x: %s mode %d streams, %d rows, %d wrong values, max row lag %d ms.\n",
+                                    name[i], SEN5X_RESAMPLE_TEST_STREAMS, gs_rows, gs_wrong, (uint32_t)gs_lag_max);
+        sen5x_interface_debug_print("sen5x: %d missing values of the stream silent for %d s, %d missing values of the others.\n",
+                                    gs_missing[SEN5X_RESAMPLE_TEST_SILENT], SEN5X_RESAMPLE_TEST_SILENT_LEN, others);
+        if ((gs_wrong != 0) || (gs_rows < SEN5X_RESAMPLE_TEST_SAMPLES - 10) || (gs_rows > SEN5X_RESAMPLE_TEST_SAMPLES + 10) ||
+            (gs_lag_max > SEN5X_RESAMPLE_TEST_DELAY_MS + 1000) ||
+            (gs_missing[SEN5X_RESAMPLE_TEST_SILENT] < SEN5X_RESAMPLE_TEST_SILENT_LEN - 3) ||
+            (gs_missing[SEN5X_RESAMPLE_TEST_SILENT] > SEN5X_RESAMPLE_TEST_SILENT_LEN + 3) || (others != 0))
+        {
+            sen5x_interface_debug_print("sen5x: rows are wrong.\n");
+
+            return 1;
+        }
+    }
+
+    /* bounded buffering */
+    gs_check = 0;
+    gs_rows = 0;
+    (void)sen5x_resample_init(&gs_resample, 2, 3, SEN5X_RESAMPLE_MODE_LINEAR, 1000, 60000, 60000, a_sen5x_resample_test_emit);
+    (void)sen5x_resample_push(&gs_resample, 1, 1000, value);
+    for (t = 0; t < 30; t++)
+    {
+        (void)sen5x_resample_push(&gs_resample, 0, 1000 + (uint64_t)t * 1000, value);
+    }
+    (void)sen5x_resample_get_stats(&gs_resample, &stats);
+    sen5x_interface_debug_print("sen5x: a stream 30 s ahead forced %d rows with %d samples buffered per stream.\n",
+                                (uint32_t)stats.forced, SEN5X_RESAMPLE_DEPTH);
+    if ((stats.forced == 0) || (gs_rows < 30 - SEN5X_RESAMPLE_DEPTH))
+    {
+        sen5x_interface_debug_print("sen5x: buffer is not bounded.\n");
+
+        return 1;
+    }
+
+    /* push speed */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    (void)sen5x_resample_init(&gs_resample, 10, 10, SEN5X_RESAMPLE_MODE_LINEAR, 1000, 2500, 5000, a_sen5x_resample_test_emit);
+    start = clock();
+    for (t = 0; t < times * 10000; t++)
+    {
+        for (s = 0; s < 10; s++)
+        {
+            now = (uint64_t)t * 1000 + s * 97;
+            value[0] = (float)t;
+            (void)sen5x_resample_push(&gs_resample, s, now, value);
+        }
+    }
+    push_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / 10000;
+    sen5x_interface_debug_print("sen5x: 10 streams of 10 channels take %0.1f ns per aligned row, state %d bytes.\n",
+                                push_s * 1e9, (uint32_t)sizeof(sen5x_resample_t));
+
+    /* finish resample test */
+    sen5x_interface_debug_print("sen5x: finish resample test.\n");
+
+    return 0;
+}
@@ -0,0 +1,327 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_rollup_test.c
+ * @brief     driver sen5x rollup test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_rollup_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_ROLLUP_TEST_SAMPLES        (3 * 86400)          /**< three days at 1 Hz */
+#define SEN5X_ROLLUP_TEST_START_MS       1760000012345ULL     /**< unaligned first timestamp */
+
+static float gs_value[SEN5X_ROLLUP_TEST_SAMPLES][8];               /**< input values */
+static uint8_t gs_pm_valid[SEN5X_ROLLUP_TEST_SAMPLES];             /**< input pm valid flags */
+static uint32_t gs_emitted[SEN5X_ROLLUP_MAX_LEVELS];               /**< emitted buckets per level */
+static uint32_t gs_checked;                                        /**< checked buckets */
+static uint32_t gs_mismatch;                                       /**< mismatched buckets */
+static uint8_t gs_check;                                           /**< check flag */
+static uint8_t gs_block[SEN5X_ARCHIVE_BLOCK_SIZE];                 /**< archive block buffer */
+static uint8_t gs_archive[16 * SEN5X_ARCHIVE_BLOCK_SIZE];          /**< archive of the 15 min means */
+static uint32_t gs_archive_len;                                    /**< archive length */
+static sen5x_rollup_t gs_rollup;                                   /**< rollup */
+static sen5x_archive_encoder_t gs_encoder;                         /**< archive encoder */
+static uint32_t gs_seed;                                           /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_rollup_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     archive emit block callback
+ * @param[in] *block pointer to a block buffer
+ * @param[in] len block length
+ * @return    status code
+ *            - 0 success
+ *            - 1 archive is full
+ * @note      none
+ */
+static uint8_t a_sen5x_rollup_test_emit_block(const uint8_t *block, uint32_t len)
+{
+    if ((gs_archive_len + len) > sizeof(gs_archive))
+    {
+        return 1;
+    }
+    memcpy(&gs_archive[gs_archive_len], block, len);
+    gs_archive_len += len;
+
+    return 0;
+}
+
+/**
+ * @brief     check a bucket against the input samples
+ * @param[in] *bucket pointer to a bucket structure
+ * @return    1 if the bucket matches, else 0
+ * @note      none
+ */
+static uint8_t a_sen5x_rollup_test_check(const sen5x_rollup_bucket_t *bucket)
+{
+    uint8_t ch;
+    uint32_t i;
+    uint32_t first;
+    uint32_t last;
+    uint32_t count;
+    uint64_t end_ms;
+    double sum;
+    float min;
+    float max;
+    float value;
+
+    end_ms = bucket->start_ms + (uint64_t)bucket->period_s * 1000;
+    first = (bucket->start_ms > SEN5X_ROLLUP_TEST_START_MS) ?
+            (uint32_t)((bucket->start_ms - SEN5X_ROLLUP_TEST_START_MS + 999) / 1000) : 0;
+    last = (uint32_t)((end_ms - SEN5X_ROLLUP_TEST_START_MS + 999) / 1000);
+    if (last > SEN5X_ROLLUP_TEST_SAMPLES)
+    {
+        last = SEN5X_ROLLUP_TEST_SAMPLES;
+    }
+    if (bucket->samples != (last - first))
+    {
+        return 0;
+    }
+    for (ch = 0; ch < 8; ch++)
+    {
+        count = 0;
+        sum = 0.0;
+        min = 0.0f;
+        max = 0.0f;
+        value = 0.0f;
+        for (i = first; i < last; i++)
+        {
+            if (((ch < 4) && (gs_pm_valid[i] == 0)) || (isnan(gs_value[i][ch]) != 0))
+            {
+                continue;
+            }
+            value = gs_value[i][ch];
+            min = ((count == 0) || (value < min)) ? value : min;
+            max = ((count == 0) || (value > max)) ? value : max;
+            sum += value;
+            count++;
+        }
+        if ((count != bucket->count[ch]) || (fabs(sum - bucket->sum[ch]) > 1e-6 * (fabs(sum) + 1.0)) ||
+            ((count != 0) && ((min != bucket->min[ch]) || (max != bucket->max[ch]) || (value != bucket->last[ch]))))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief     rollup emit callback
+ * @param[in] level resolution level
+ * @param[in] *bucket pointer to a bucket structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 emit failed
+ * @note      none
+ */
+static uint8_t a_sen5x_rollup_test_emit(uint8_t level, const sen5x_rollup_bucket_t *bucket)
+{
+    uint16_t word[8];
+
+    gs_emitted[level]++;
+    if (gs_check == 0)
+    {
+        return 0;
+    }
+    if ((level != 0) || ((gs_emitted[0] % 97) == 0))
+    {
+        gs_checked++;
+        if (a_sen5x_rollup_test_check(bucket) == 0)
+        {
+            gs_mismatch++;
+        }
+    }
+    if (level == 1)
+    {
+        /* append the 15 min means to the archive */
+        if ((sen5x_rollup_get_words(&gs_rollup, bucket, SEN5X_ROLLUP_STAT_MEAN, word) != 0) ||
+            (sen5x_archive_encode(&gs_encoder, bucket->start_ms, word) != 0))
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     rollup test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_rollup_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t t;
+    uint32_t rows;
+    uint64_t ms;
+    uint16_t word[SEN5X_ARCHIVE_MAX_CHANNELS];
+    float pm;
+    clock_t start;
+    double push_s;
+    sen5x_archive_decoder_t decoder;
+
+    /* start rollup test */
+    sen5x_interface_debug_print("sen5x: start rollup test.\n");
+
+    /* make three days of 1 Hz samples with startup and dropout gaps */
+    gs_seed = 0x5EA5;
+    pm = 8.0f;
+    for (i = 0; i < SEN5X_ROLLUP_TEST_SAMPLES; i++)
+    {
+        pm += (float)((int32_t)(a_sen5x_rollup_test_random() % 7) - 3) / 10.0f;
+        pm = (pm < 0.0f) ? 0.0f : pm;
+        gs_pm_valid[i] = (i < 30) ? 0 : 1;
+        gs_value[i][0] = pm * 0.8f;
+        gs_value[i][1] = pm;
+        gs_value[i][2] = pm * 1.1f;
+        gs_value[i][3] = pm * 1.2f;
+        gs_value[i][4] = 45.0f + (float)(a_sen5x_rollup_test_random() % 100) / 100.0f;
+        gs_value[i][5] = 23.0f + (float)(a_sen5x_rollup_test_random() % 200) / 200.0f;
+        gs_value[i][6] = (i < 60) ? NAN : (float)(100 + a_sen5x_rollup_test_random() % 50);
+        gs_value[i][7] = ((i < 300) || ((i >= 90000) && (i < 97200))) ? NAN : 1.0f;
+    }
+    if (times == 0)
+    {
+        times = 1;
+    }
+
+    /* check every closed 1 h and 1 day bucket and every 97th 1 min bucket */
+    gs_check = 1;
+    memset(gs_emitted, 0, sizeof(gs_emitted));
+    gs_checked = 0;
+    gs_mismatch = 0;
+    gs_archive_len = 0;
+    res = sen5x_rollup_init(&gs_rollup, SEN5X_ARCHIVE_LAYOUT_MEASURED, NULL, 0, a_sen5x_rollup_test_emit);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: rollup init failed.\n");
+
+        return 1;
+    }
+    res = sen5x_archive_encoder_init(&gs_encoder, SEN5X_ARCHIVE_LAYOUT_MEASURED, gs_block, SEN5X_ARCHIVE_BLOCK_SIZE,
+                                     a_sen5x_rollup_test_emit_block);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: encoder init failed.\n");
+
+        return 1;
+    }
+    for (i = 0; i < SEN5X_ROLLUP_TEST_SAMPLES; i++)
+    {
+        res = sen5x_rollup_push(&gs_rollup, SEN5X_ROLLUP_TEST_START_MS + (uint64_t)i * 1000, gs_value[i], gs_pm_valid[i]);
+        if (res != 0)
+        {
+            sen5x_interface_debug_print("sen5x: push failed.\n");
+
+            return 1;
+        }
+    }
+    if ((sen5x_rollup_flush(&gs_rollup) != 0) || (sen5x_archive_flush(&gs_encoder) != 0))
+    {
+        sen5x_interface_debug_print("sen5x: flush failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: emitted %d 1 min, %d 15 min, %d 1 h and %d 1 day buckets.\n",
+                                gs_emitted[0], gs_emitted[1], gs_emitted[2], gs_emitted[3]);
+    if ((gs_mismatch != 0) || (gs_emitted[0] != 4321) || (gs_emitted[1] != 289) ||
+        (gs_emitted[2] != 73) || (gs_emitted[3] != 4))
+    {
+        sen5x_interface_debug_print("sen5x: %d of %d buckets mismatch.\n", gs_mismatch, gs_checked);
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check %d buckets ok.\n", gs_checked);
+
+    /* read back the 15 min means from the archive */
+    rows = 0;
+    for (i = 0; i < gs_archive_len; i += SEN5X_ARCHIVE_BLOCK_SIZE)
+    {
+        if (sen5x_archive_decoder_init(&decoder, &gs_archive[i], SEN5X_ARCHIVE_BLOCK_SIZE) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: archive block is invalid.\n");
+
+            return 1;
+        }
+        while (sen5x_archive_decode(&decoder, &ms, word) == 0)
+        {
+            rows++;
+        }
+    }
+    if (rows != gs_emitted[1])
+    {
+        sen5x_interface_debug_print("sen5x: archive has %d rows.\n", rows);
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: archive holds %d 15 min rows in %d bytes.\n", rows, gs_archive_len);
+
+    /* push speed */
+    gs_check = 0;
+    start = clock();
+    for (t = 0; t < times; t++)
+    {
+        (void)sen5x_rollup_init(&gs_rollup, SEN5X_ARCHIVE_LAYOUT_MEASURED, NULL, 0, a_sen5x_rollup_test_emit);
+        for (i = 0; i < SEN5X_ROLLUP_TEST_SAMPLES; i++)
+        {
+            (void)sen5x_rollup_push(&gs_rollup, SEN5X_ROLLUP_TEST_START_MS + (uint64_t)i * 1000, gs_value[i], gs_pm_valid[i]);
+        }
+        (void)sen5x_rollup_flush(&gs_rollup);
+    }
+    push_s = (double)(clock() - start) / CLOCKS_PER_SEC / times;
+    sen5x_interface_debug_print("sen5x: push %0.1f ns/sample.\n", push_s * 1e9 / SEN5X_ROLLUP_TEST_SAMPLES);
+
+    /* finish rollup test */
+    sen5x_interface_debug_print("sen5x: finish rollup test.\n");
+
+    return 0;
+}
@@ -0,0 +1,596 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_sequence_test.c
+ * @brief     driver sen5x sequence test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+#include "driver_sen5x_sequence_test.h"
+#include "driver_sen5x_stamp.h"
+#include <stdarg.h>
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_SEQUENCE_TEST_SAMPLES        3600        /**< sensor samples per run */
+#define SEN5X_SEQUENCE_TEST_STALL_EVERY    250         /**< samples between the host stalls */
+#define SEN5X_SEQUENCE_TEST_REPEAT_EVERY   5           /**< samples between the repeated reads */
+#define SEN5X_SEQUENCE_TEST_BUS_US         300         /**< bus time per transaction */
+
+/**
+ * @brief sequence test sensor structure definition
+ */
+typedef struct sen5x_sequence_test_sensor_s
+{
+    uint8_t running;             /**< measurement running */
+    uint8_t ready;               /**< data ready flag */
+    uint16_t command;            /**< last command */
+    double first_us;             /**< first sample instant */
+    double period_us;            /**< true sample period */
+    int64_t produced;            /**< latest sample, -1 before the first */
+    int64_t read;                /**< last sample sent to the host */
+} sen5x_sequence_test_sensor_t;
+
+/**
+ * @brief sequence test run structure definition
+ */
+typedef struct sen5x_sequence_test_run_s
+{
+    sen5x_sequence_t expect;     /**< counters expected from the script */
+    uint32_t stalls;             /**< host stalls */
+    uint32_t wrong;              /**< reads tagged differently from the script */
+} sen5x_sequence_test_run_t;
+
+static sen5x_handle_t gs_handle;                         /**< sen5x handle */
+static sen5x_stamp_t gs_stamp;                           /**< sample timestamping */
+static sen5x_sequence_test_sensor_t gs_sensor;           /**< simulated sensor */
+static uint64_t gs_now_us;                               /**< simulated host time */
+static const uint32_t gs_stall[6] = {1, 2, 5, 11, 3, 12};   /**< samples lost by the stalls */
+
+/**
+ * @brief     generate the crc
+ * @param[in] *data pointer to a data buffer
+ * @return    crc
+ * @note      none
+ */
+static uint8_t a_sen5x_sequence_test_crc(uint8_t *data)
+{
+    uint8_t i;
+    uint8_t bit;
+    uint8_t crc = 0xFF;
+
+    for (i = 0; i < 2; i++)
+    {
+        crc ^= data[i];
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = ((crc & 0x80) != 0) ? (uint8_t)((crc << 1) ^ 0x31) : (uint8_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief     get the instant of a sample
+ * @param[in] k sample index
+ * @return    instant in us
+ * @note      +- 2 ms of jitter as a fixed function of the index
+ */
+static double a_sen5x_sequence_test_edge(int64_t k)
+{
+    uint32_t h;
+
+    h = (uint32_t)((uint64_t)k * 2654435761U);
+    h ^= h >> 15;
+
+    return gs_sensor.first_us + (double)k * gs_sensor.period_us + (double)(h % 4001) - 2000.0;
+}
+
+/**
+ * @brief advance the simulated sensor to the host time
+ * @note  none
+ */
+static void a_sen5x_sequence_test_update(void)
+{
+    while ((gs_sensor.running != 0) && ((double)gs_now_us >= a_sen5x_sequence_test_edge(gs_sensor.produced + 1)))
+    {
+        gs_sensor.produced++;
+        gs_sensor.ready = 1;
+    }
+}
+
+/**
+ * @brief  simulated iic bus init
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_sen5x_sequence_test_iic_init(void)
+{
+    return 0;
+}
+
+/**
+ * @brief  simulated iic bus deinit
+ * @return status code
+ *         - 0 success
+ * @note   none
+ */
+static uint8_t a_sen5x_sequence_test_iic_deinit(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     simulated iic bus write
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      start measurement begins a new sample grid one period later, stop and reset end it
+ */
+static uint8_t a_sen5x_sequence_test_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    (void)addr;
+    if (len < 2)
+    {
+        return 1;
+    }
+    gs_now_us += SEN5X_SEQUENCE_TEST_BUS_US;
+    a_sen5x_sequence_test_update();
+    gs_sensor.command = (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]);
+    if ((gs_sensor.command == 0x0021) || (gs_sensor.command == 0x0037))
+    {
+        gs_sensor.running = 1;
+        gs_sensor.ready = 0;
+        gs_sensor.produced = -1;
+        gs_sensor.read = -1;
+        gs_sensor.first_us = (double)gs_now_us + gs_sensor.period_us;
+    }
+    else if ((gs_sensor.command == 0x0104) || (gs_sensor.command == 0xD304))
+    {
+        gs_sensor.running = 0;
+        gs_sensor.ready = 0;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      simulated iic bus read
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ * @note       reading the measured values clears the flag
+ */
+static uint8_t a_sen5x_sequence_test_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint16_t i;
+    uint16_t word;
+
+    (void)addr;
+    gs_now_us += SEN5X_SEQUENCE_TEST_BUS_US;
+    a_sen5x_sequence_test_update();
+    for (i = 0; i + 3 <= len; i += 3)
+    {
+        if (gs_sensor.command == 0x0202)
+        {
+            word = gs_sensor.ready;
+        }
+        else if ((i == 0) && (gs_sensor.command == 0x03C4))
+        {
+            word = (uint16_t)(gs_sensor.produced & 0x7FFF);
+        }
+        else
+        {
+            word = 0;
+        }
+        buf[i] = (uint8_t)(word >> 8);
+        buf[i + 1] = (uint8_t)(word & 0xFF);
+        buf[i + 2] = a_sen5x_sequence_test_crc(&buf[i]);
+    }
+    if (gs_sensor.command == 0x03C4)
+    {
+        gs_sensor.read = gs_sensor.produced;
+        gs_sensor.ready = 0;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     simulated delay ms
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_sen5x_sequence_test_delay_ms(uint32_t ms)
+{
+    gs_now_us += (uint64_t)ms * 1000;
+}
+
+/**
+ * @brief  simulated timestamp
+ * @return host time in us
+ * @note   none
+ */
+static uint64_t a_sen5x_sequence_test_timestamp_us(void)
+{
+    return gs_now_us;
+}
+
+/**
+ * @brief  stopped timestamp
+ * @return always 0
+ * @note   like the interface template
+ */
+static uint64_t a_sen5x_sequence_test_timestamp_zero(void)
+{
+    return 0;
+}
+
+/**
+ * @brief     quiet print
+ * @param[in] fmt format data
+ * @note      the driver reports every not ready read
+ */
+static void a_sen5x_sequence_test_print(const char *const fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * @brief  link and init the handle
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   none
+ */
+static uint8_t a_sen5x_sequence_test_init(void)
+{
+    DRIVER_SEN5X_LINK_INIT(&gs_handle, sen5x_handle_t);
+    DRIVER_SEN5X_LINK_IIC_INIT(&gs_handle, a_sen5x_sequence_test_iic_init);
+    DRIVER_SEN5X_LINK_IIC_DEINIT(&gs_handle, a_sen5x_sequence_test_iic_deinit);
+    DRIVER_SEN5X_LINK_IIC_WRITE_COMMAND(&gs_handle, a_sen5x_sequence_test_iic_write_cmd);
+    DRIVER_SEN5X_LINK_IIC_READ_COMMAND(&gs_handle, a_sen5x_sequence_test_iic_read_cmd);
+    DRIVER_SEN5X_LINK_DELAY_MS(&gs_handle, a_sen5x_sequence_test_delay_ms);
+    DRIVER_SEN5X_LINK_DEBUG_PRINT(&gs_handle, a_sen5x_sequence_test_print);
+    DRIVER_SEN5X_LINK_TIMESTAMP_US(&gs_handle, a_sen5x_sequence_test_timestamp_us);
+    if (sen5x_set_type(&gs_handle, SEN55) != 0)
+    {
+        return 1;
+    }
+    if (sen5x_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief         read once and check the tag against the script
+ * @param[in]     stamped 1 feeds the gaps of the stamp to the driver
+ * @param[in,out] *last pointer to the last sample read
+ * @param[in,out] *run pointer to a run structure
+ * @return        status code
+ *                - 0 success
+ *                - 1 read failed
+ * @note          none
+ */
+static uint8_t a_sen5x_sequence_test_read(uint8_t stamped, int64_t *last, sen5x_sequence_test_run_t *run)
+{
+    uint8_t res;
+    uint32_t gap;
+    uint32_t got_gap;
+    uint64_t before;
+    sen5x_sample_tag_t tag;
+    sen5x_sample_tag_t got;
+    sen5x_stamp_result_t result;
+    sen55_data_t output;
+
+    before = gs_now_us;
+    res = sen55_read(&gs_handle, &output);
+    gap = 0;
+    if ((res != 0) || (gs_sensor.read == *last))
+    {
+        tag = SEN5X_SAMPLE_TAG_DUPLICATE;
+        run->expect.duplicate++;
+    }
+    else
+    {
+        gap = (*last >= 0) ? (uint32_t)(gs_sensor.read - *last - 1) : 0;
+        tag = (gap == 0) ? SEN5X_SAMPLE_TAG_FRESH : SEN5X_SAMPLE_TAG_GAP;
+        *last = gs_sensor.read;
+        if (gap == 0)
+        {
+            run->expect.fresh++;
+        }
+        else
+        {
+            run->expect.gap++;
+            run->expect.missed += gap;
+            run->expect.max_gap = (gap > run->expect.max_gap) ? gap : run->expect.max_gap;
+        }
+    }
+    if (stamped != 0)
+    {
+        if (sen5x_stamp_push(&gs_stamp, before, gs_now_us, (res == 0) ? SEN5X_DATA_READY_FLAG_AVAILABLE :
+                             SEN5X_DATA_READY_FLAG_NOT_READY, &result) != 0)
+        {
+            return 1;
+        }
+        if ((res == 0) && (sen5x_set_sample_gap(&gs_handle, result.skipped) != 0))
+        {
+            return 1;
+        }
+    }
+    if (sen5x_get_sample_tag(&gs_handle, &got, &got_gap) != 0)
+    {
+        return 1;
+    }
+    if ((got != tag) || (got_gap != gap))
+    {
+        run->wrong++;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief      run a scripted host loop against the simulated sensor
+ * @param[in]  stamped 1 feeds the gaps of the stamp to the driver
+ * @param[in]  skew_ppm true sensor clock skew in ppm
+ * @param[out] *run pointer to a run structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       every sample is read 100 - 599 ms after its instant, every 5th sample is read again 100 ms
+ *             later, and every 250 samples the host stalls over 1, 2, 5, 11, 3 or 12 samples
+ */
+static uint8_t a_sen5x_sequence_test_run(uint8_t stamped, double skew_ppm, sen5x_sequence_test_run_t *run)
+{
+    int64_t s;
+    int64_t last;
+    double t;
+
+    memset(run, 0, sizeof(sen5x_sequence_test_run_t));
+    memset(&gs_sensor, 0, sizeof(sen5x_sequence_test_sensor_t));
+    gs_sensor.period_us = 1e6 * (1.0 + skew_ppm * 1e-6);
+    gs_now_us = 1000000;
+    if ((sen5x_stamp_init(&gs_stamp, SEN5X_STAMP_DEFAULT_PERIOD_MS, SEN5X_STAMP_DEFAULT_WINDOW_S,
+                          SEN5X_STAMP_DEFAULT_DRIFT_PPM) != 0) || (a_sen5x_sequence_test_init() != 0))
+    {
+        return 1;
+    }
+    if (sen5x_start_measurement(&gs_handle) != 0)
+    {
+        (void)sen5x_deinit(&gs_handle);
+
+        return 1;
+    }
+    last = -1;
+    for (s = 0; s < SEN5X_SEQUENCE_TEST_SAMPLES; s++)
+    {
+        if ((s != 0) && ((s % SEN5X_SEQUENCE_TEST_STALL_EVERY) == 0))
+        {
+            s += gs_stall[run->stalls % 6];
+            run->stalls++;
+        }
+        t = a_sen5x_sequence_test_edge(s) + 100000.0 + (double)((s * 37) % 500) * 1000.0;
+        gs_now_us = (uint64_t)t;
+        if (a_sen5x_sequence_test_read(stamped, &last, run) != 0)
+        {
+            (void)sen5x_deinit(&gs_handle);
+
+            return 1;
+        }
+        if ((s % SEN5X_SEQUENCE_TEST_REPEAT_EVERY) == 0)
+        {
+            gs_now_us += 100000;
+            if (a_sen5x_sequence_test_read(stamped, &last, run) != 0)
+            {
+                (void)sen5x_deinit(&gs_handle);
+
+                return 1;
+            }
+        }
+    }
+    (void)sen5x_stop_measurement(&gs_handle);
+
+    return 0;
+}
+
+/**
+ * @brief     sequence test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_sequence_test(uint32_t times)
+{
+    sen5x_sequence_test_run_t run;
+    sen5x_sequence_t sequence;
+    sen5x_sample_tag_t tag;
+    sen55_data_t output;
+    uint32_t gap;
+    uint32_t i;
+    uint32_t reads;
+    clock_t start;
+    double us;
+    const double skew[3] = {0.0, 8000.0, -12000.0};
+
+    sen5x_interface_debug_print("sen5x: start sequence test.\n");
+    if (times == 0)
+    {
+        times = 1;
+    }
+
+    /* check the params */
+    memset(&gs_handle, 0, sizeof(sen5x_handle_t));
+    if ((sen5x_get_sequence(NULL, &sequence) != 2) || (sen5x_get_sample_tag(&gs_handle, NULL, &gap) != 2) ||
+        (sen5x_get_sequence(&gs_handle, &sequence) != 3) || (sen5x_get_sample_tag(&gs_handle, &tag, &gap) != 3) ||
+        (sen5x_clear_sequence(NULL) != 2) || (sen5x_clear_sequence(&gs_handle) != 3) ||
+        (sen5x_set_sample_gap(NULL, 1) != 2) || (sen5x_set_sample_gap(&gs_handle, 1) != 3))
+    {
+        sen5x_interface_debug_print("sen5x: sequence param check failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: param check passed.\n");
+
+    /* init clears the whole sequence and drops a stopped clock */
+    gs_now_us = 1000000;
+    memset(&gs_handle.sequence, 0xA5, sizeof(sen5x_sequence_t));
+    if ((a_sen5x_sequence_test_init() != 0) || (gs_handle.timestamp_us == NULL) ||
+        (sen5x_get_sequence(&gs_handle, &sequence) != 0) || (sequence.fresh != 0) || (sequence.gap != 0) ||
+        (sequence.missed != 0) || (sequence.duplicate != 0) || (sequence.max_gap != 0) ||
+        (sequence.last_gap != 0) || (sequence.last_tag != 0) || (sen5x_set_sample_gap(&gs_handle, 1) != 4))
+    {
+        sen5x_interface_debug_print("sen5x: init didn't clear the sequence.\n");
+
+        return 1;
+    }
+    (void)sen5x_deinit(&gs_handle);
+    DRIVER_SEN5X_LINK_TIMESTAMP_US(&gs_handle, a_sen5x_sequence_test_timestamp_zero);
+    if ((sen5x_init(&gs_handle) != 0) || (gs_handle.timestamp_us != NULL))
+    {
+        sen5x_interface_debug_print("sen5x: stopped clock was kept.\n");
+
+        return 1;
+    }
+    (void)sen5x_deinit(&gs_handle);
+    sen5x_interface_debug_print("sen5x: check init passed.\n");
+
+    /* the flag finds the duplicates, the read timing or the stamp finds the gaps */
+    for (i = 0; i < 6; i++)
+    {
+        if (a_sen5x_sequence_test_run((i < 3) ? 1 : 0, skew[i % 3], &run) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: sequence run failed.\n");
+
+            return 1;
+        }
+        (void)sen5x_get_sequence(&gs_handle, &sequence);
+        (void)sen5x_deinit(&gs_handle);
+        sen5x_interface_debug_print("sen5x: %s skew %d ppm fresh %d gap %d missed %d duplicate %d max gap %d, wrong tags %d.\n",
+                                    (i < 3) ? "stamp" : "timing", (int)skew[i % 3], sequence.fresh, sequence.gap,
+                                    sequence.missed, sequence.duplicate, sequence.max_gap, run.wrong);
+        if ((run.wrong != 0) || (sequence.fresh != run.expect.fresh) || (sequence.gap != run.expect.gap) ||
+            (sequence.missed != run.expect.missed) || (sequence.duplicate != run.expect.duplicate) ||
+            (sequence.max_gap != run.expect.max_gap) || (sequence.gap != run.stalls))
+        {
+            sen5x_interface_debug_print("sen5x: expect fresh %d gap %d missed %d duplicate %d max gap %d.\n",
+                                        run.expect.fresh, run.expect.gap, run.expect.missed,
+                                        run.expect.duplicate, run.expect.max_gap);
+            sen5x_interface_debug_print("sen5x: sequence tags are wrong.\n");
+
+            return 1;
+        }
+    }
+
+    /* the timing finds a gap, the stamp gap overrides it, clear */
+    if ((a_sen5x_sequence_test_init() != 0) || (sen5x_start_measurement(&gs_handle) != 0))
+    {
+        return 1;
+    }
+    gs_now_us += 1500000;
+    if ((sen55_read(&gs_handle, &output) != 0) || (sen5x_get_sample_tag(&gs_handle, &tag, &gap) != 0) ||
+        (tag != SEN5X_SAMPLE_TAG_FRESH))
+    {
+        sen5x_interface_debug_print("sen5x: first read after the start is not fresh.\n");
+        (void)sen5x_deinit(&gs_handle);
+
+        return 1;
+    }
+    gs_now_us += 3000000;
+    if ((sen55_read(&gs_handle, &output) != 0) || (sen5x_get_sample_tag(&gs_handle, &tag, &gap) != 0) ||
+        (tag != SEN5X_SAMPLE_TAG_GAP) || (gap != 2))
+    {
+        sen5x_interface_debug_print("sen5x: read timing missed the gap.\n");
+        (void)sen5x_deinit(&gs_handle);
+
+        return 1;
+    }
+    if ((sen5x_set_sample_gap(&gs_handle, 3) != 0) || (sen5x_get_sequence(&gs_handle, &sequence) != 0) ||
+        (sequence.fresh != 1) || (sequence.gap != 1) || (sequence.missed != 3) || (sequence.max_gap != 3) ||
+        (sen5x_set_sample_gap(&gs_handle, 0) != 0) || (sen5x_get_sequence(&gs_handle, &sequence) != 0) ||
+        (sequence.fresh != 2) || (sequence.gap != 0) || (sequence.missed != 0) || (sequence.max_gap != 0) ||
+        (sequence.last_tag != SEN5X_SAMPLE_TAG_FRESH))
+    {
+        sen5x_interface_debug_print("sen5x: set sample gap didn't override the read timing.\n");
+        (void)sen5x_deinit(&gs_handle);
+
+        return 1;
+    }
+    gs_now_us += 100000;
+    if ((sen55_read(&gs_handle, &output) == 0) || (sen5x_set_sample_gap(&gs_handle, 2) != 4) ||
+        (sen5x_clear_sequence(&gs_handle) != 0) || (sen5x_get_sequence(&gs_handle, &sequence) != 0) ||
+        (sequence.fresh != 0) || (sequence.gap != 0) || (sequence.missed != 0) || (sequence.duplicate != 0))
+    {
+        sen5x_interface_debug_print("sen5x: clear sequence failed.\n");
+        (void)sen5x_deinit(&gs_handle);
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: override and clear sequence passed.\n");
+
+    /* benchmark the read path */
+    reads = 0;
+    start = clock();
+    for (i = 0; i < times * 100000U; i++)
+    {
+        gs_now_us += 250000;
+        if (sen55_read(&gs_handle, &output) == 0)
+        {
+            reads++;
+        }
+    }
+    us = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC / (double)(times * 100000U);
+    (void)sen5x_deinit(&gs_handle);
+    if (reads == 0)
+    {
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: read path %0.3f us per call.\n", us);
+    sen5x_interface_debug_print("sen5x: handle size %d bytes.\n", (uint32_t)sizeof(sen5x_handle_t));
+
+    sen5x_interface_debug_print("sen5x: finish sequence test.\n");
+
+    return 0;
+}
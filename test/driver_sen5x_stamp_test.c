@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_stamp_test.c
+ * @brief     driver sen5x stamp test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_stamp_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_STAMP_TEST_SAMPLES          3600          /**< one hour of samples per sensor */
+#define SEN5X_STAMP_TEST_SETTLE           300           /**< samples left out of the error checks */
+#define SEN5X_STAMP_TEST_STALL            1800          /**< sample before the loop stall */
+
+/**
+ * @brief stamp test sensor structure definition
+ */
+typedef struct sen5x_stamp_test_sensor_s
+{
+    double first_us;                 /**< first sample instant */
+    double period_us;                /**< true sample period */
+    int64_t read;                    /**< last sample read, -1 before the first */
+} sen5x_stamp_test_sensor_t;
+
+/**
+ * @brief stamp test run structure definition
+ */
+typedef struct sen5x_stamp_test_run_s
+{
+    uint32_t samples;                /**< checked samples */
+    uint32_t outside;                /**< true instants outside the bound */
+    uint32_t skipped;                /**< skipped samples reported after the stall */
+    double err_sum_us;               /**< corrected error sum */
+    double err_max_us;               /**< max corrected error */
+    double naive_sum_us;             /**< read time error sum */
+    double unc_sum_us;               /**< uncertainty sum */
+    float skew_ppm;                  /**< final skew estimate */
+} sen5x_stamp_test_run_t;
+
+static sen5x_stamp_t gs_stamp;        /**< stamp */
+static uint32_t gs_seed;              /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_stamp_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     get the true instant of a sample
+ * @param[in] *sensor pointer to a sensor structure
+ * @param[in] k sample index
+ * @return    instant in us
+ * @note      20 us of jitter
+ */
+static double a_sen5x_stamp_test_instant(const sen5x_stamp_test_sensor_t *sensor, int64_t k)
+{
+    uint32_t h;
+
+    h = (uint32_t)((uint64_t)k * 2654435761U);
+    h ^= h >> 15;
+
+    return sensor->first_us + (double)k * sensor->period_us + (double)(h % 41) - 20.0;
+}
+
+/**
+ * @brief     run the timestamping against a simulated sensor
+ * @param[in] skew_ppm true sensor clock skew in ppm
+ * @param[out] *run pointer to a run structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      the loop polls every 50 - 70 ms, a transaction takes 1 - 40 ms and the sensor
+ *            answers at a random point inside it
+ */
+static uint8_t a_sen5x_stamp_test_track(double skew_ppm, sen5x_stamp_test_run_t *run)
+{
+    sen5x_stamp_test_sensor_t sensor;
+    sen5x_stamp_result_t result;
+    sen5x_data_ready_flag_t flag;
+    uint64_t now;
+    uint64_t before;
+    uint64_t after;
+    uint32_t samples;
+    int64_t k;
+    int64_t first;
+    double at;
+    double err;
+
+    sensor.first_us = 5e6 + (double)(a_sen5x_stamp_test_random() % 1000000);
+    sensor.period_us = 1e6 * (1.0 + skew_ppm * 1e-6);
+    sensor.read = -1;
+    first = 0;
+    if (sen5x_stamp_init(&gs_stamp, SEN5X_STAMP_DEFAULT_PERIOD_MS, SEN5X_STAMP_DEFAULT_WINDOW_S,
+                         SEN5X_STAMP_DEFAULT_DRIFT_PPM) != 0)
+    {
+        return 1;
+    }
+    memset(run, 0, sizeof(sen5x_stamp_test_run_t));
+    now = 5000000 + a_sen5x_stamp_test_random() % 1000000;
+    samples = 0;
+    while (samples < SEN5X_STAMP_TEST_SAMPLES)
+    {
+        before = now;
+        after = before + 1000 + a_sen5x_stamp_test_random() % 39000;
+        at = (double)before + (double)(a_sen5x_stamp_test_random() % (uint32_t)(after - before + 1));
+        k = (int64_t)floor((at - sensor.first_us) / sensor.period_us) + 1;
+        while ((k >= 0) && (a_sen5x_stamp_test_instant(&sensor, k) > at))
+        {
+            k--;
+        }
+        flag = (k > sensor.read) ? SEN5X_DATA_READY_FLAG_AVAILABLE : SEN5X_DATA_READY_FLAG_NOT_READY;
+        if (sen5x_stamp_push(&gs_stamp, before, after, flag, &result) != 0)
+        {
+            return 1;
+        }
+        if (flag == SEN5X_DATA_READY_FLAG_AVAILABLE)
+        {
+            first = (sensor.read < 0) ? k : first;
+            if (((int64_t)result.index != k - first) ||
+                ((sensor.read >= 0) && ((int64_t)result.skipped != k - sensor.read - 1)))
+            {
+                return 1;
+            }
+            sensor.read = k;
+            err = fabs((double)result.timestamp_us - a_sen5x_stamp_test_instant(&sensor, k));
+            if (samples >= SEN5X_STAMP_TEST_SETTLE)
+            {
+                run->samples++;
+                run->outside += (err > (double)result.uncertainty_us + 1.0) ? 1 : 0;
+                run->err_sum_us += err;
+                run->err_max_us = (err > run->err_max_us) ? err : run->err_max_us;
+                run->naive_sum_us += (double)after - a_sen5x_stamp_test_instant(&sensor, k);
+                run->unc_sum_us += result.uncertainty_us;
+            }
+            if (samples == SEN5X_STAMP_TEST_STALL)
+            {
+                run->skipped = result.skipped;
+            }
+            samples++;
+            run->skew_ppm = result.skew_ppm;
+        }
+        now = after + 50000 + a_sen5x_stamp_test_random() % 20000;
+        if ((samples == SEN5X_STAMP_TEST_STALL) && (flag == SEN5X_DATA_READY_FLAG_AVAILABLE))
+        {
+            now += 2500000;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     stamp test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_stamp_test(uint32_t times)
+{
+    uint32_t i;
+    uint32_t t;
+    uint64_t now;
+    clock_t start;
+    double push_s;
+    sen5x_stamp_result_t result;
+    sen5x_stamp_test_run_t run;
+    const double skew[3] = {150.0, -300.0, 0.0};
+
+    /* start stamp test */
+    sen5x_interface_debug_print("sen5x: start stamp test.\n");
+
+    /* check the params */
+    if ((sen5x_stamp_init(&gs_stamp, 0.0f, 3600.0f, 10.0f) != 4) ||
+        (sen5x_stamp_init(&gs_stamp, 1000.0f, 1.0f, 10.0f) != 5) ||
+        (sen5x_stamp_init(&gs_stamp, 1000.0f, 3600.0f, -1.0f) != 6))
+    {
+        sen5x_interface_debug_print("sen5x: invalid params not rejected.\n");
+
+        return 1;
+    }
+    (void)sen5x_stamp_init(&gs_stamp, 1000.0f, 3600.0f, 10.0f);
+    if (sen5x_stamp_push(&gs_stamp, 10, 5, SEN5X_DATA_READY_FLAG_AVAILABLE, &result) != 4)
+    {
+        sen5x_interface_debug_print("sen5x: reversed times not rejected.\n");
+
+        return 1;
+    }
+
+    /* sensors with different skews read by a jittery loop */
+    gs_seed = 0x5354;
+    for (i = 0; i < 3; i++)
+    {
+        if (a_sen5x_stamp_test_track(skew[i], &run) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: sample index lost.\n");
+
+            return 1;
+        }
+        sen5x_interface_debug_print("sen5x: skew %0.0f ppm estimated %0.1f ppm, read time error %0.2f ms, corrected error %0.3f ms mean %0.3f ms max.\n",
+                                    skew[i], run.skew_ppm, run.naive_sum_us / run.samples / 1000.0,
+                                    run.err_sum_us / run.samples / 1000.0, run.err_max_us / 1000.0);
+        sen5x_interface_debug_print("sen5x: mean bound +-%0.3f ms, %d of %d instants outside, %d samples skipped by the stall.\n",
+                                    run.unc_sum_us / run.samples / 1000.0, run.outside, run.samples, run.skipped);
+        if ((run.outside > run.samples / 100) || (run.err_sum_us / run.samples > 2000.0) ||
+            (fabs(run.skew_ppm - skew[i]) > 5.0) || (run.skipped == 0))
+        {
+            sen5x_interface_debug_print("sen5x: timestamps are too loose.\n");
+
+            return 1;
+        }
+    }
+
+    /* push speed */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    (void)sen5x_stamp_init(&gs_stamp, 1000.0f, 3600.0f, 10.0f);
+    start = clock();
+    for (t = 0; t < times * 100000; t++)
+    {
+        now = (uint64_t)t * 1000000;
+        (void)sen5x_stamp_push(&gs_stamp, now, now + 5000, SEN5X_DATA_READY_FLAG_AVAILABLE, &result);
+    }
+    push_s = (double)(clock() - start) / CLOCKS_PER_SEC / times / 100000;
+    sen5x_interface_debug_print("sen5x: %0.1f ns per sample, state %d bytes.\n", push_s * 1e9, (uint32_t)sizeof(sen5x_stamp_t));
+
+    /* finish stamp test */
+    sen5x_interface_debug_print("sen5x: finish stamp test.\n");
+
+    return 0;
+}
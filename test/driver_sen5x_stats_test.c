@@ -0,0 +1,280 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_stats_test.c
+ * @brief     driver sen5x stats test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_stats_test.h"
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_STATS_TEST_SAMPLES          20000          /**< check stream samples */
+#define SEN5X_STATS_TEST_WINDOW_MS        300000         /**< 5 min window */
+#define SEN5X_STATS_TEST_CAPACITY         320            /**< slots per 5 min window at 1 Hz */
+#define SEN5X_STATS_TEST_STREAMS          4096           /**< concurrent sensor streams */
+#define SEN5X_STATS_TEST_SECONDS          3600           /**< benchmark duration */
+#define SEN5X_STATS_TEST_NAIVE_STREAMS    8              /**< streams of the recompute baseline */
+
+static float gs_value[SEN5X_STATS_TEST_SAMPLES];                                           /**< check values */
+static uint64_t gs_timestamp[SEN5X_STATS_TEST_SAMPLES];                                    /**< check timestamps */
+static float gs_sorted[SEN5X_STATS_TEST_CAPACITY];                                         /**< sorted window */
+static sen5x_stats_slot_t gs_slot[SEN5X_STATS_TEST_STREAMS][SEN5X_STATS_TEST_CAPACITY];    /**< window slots */
+static sen5x_stats_t gs_stats[SEN5X_STATS_TEST_STREAMS];                                   /**< window statistics */
+static float gs_level[SEN5X_STATS_TEST_STREAMS];                                           /**< stream levels */
+static float gs_history[SEN5X_STATS_TEST_NAIVE_STREAMS][SEN5X_STATS_TEST_CAPACITY];        /**< baseline windows */
+static uint32_t gs_seed;                                                                   /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_stats_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     compare two floats
+ * @param[in] *a pointer to the first float
+ * @param[in] *b pointer to the second float
+ * @return    compare result
+ * @note      none
+ */
+static int a_sen5x_stats_test_compare(const void *a, const void *b)
+{
+    float x = *(const float *)a;
+    float y = *(const float *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief     check a quantile against the exact value
+ * @param[in] got sketch value
+ * @param[in] exact exact value
+ * @return    1 if the value is within the sketch accuracy, else 0
+ * @note      none
+ */
+static uint8_t a_sen5x_stats_test_quantile_ok(float got, float exact)
+{
+    if (fabsf(exact) <= SEN5X_STATS_SKETCH_MIN)
+    {
+        return (fabsf(got) <= SEN5X_STATS_SKETCH_MIN * (1.0f + SEN5X_STATS_SKETCH_ALPHA)) ? 1 : 0;
+    }
+
+    return (fabsf(got - exact) <= fabsf(exact) * SEN5X_STATS_SKETCH_ALPHA * 1.001f) ? 1 : 0;
+}
+
+/**
+ * @brief     stats test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_stats_test(uint32_t times)
+{
+    uint8_t res;
+    uint32_t i;
+    uint32_t j;
+    uint32_t s;
+    uint32_t t;
+    uint32_t n;
+    uint32_t checked;
+    uint32_t queries;
+    uint64_t ms;
+    double sum;
+    double m2;
+    double mean;
+    float level;
+    float sink;
+    clock_t start;
+    double push_s;
+    double naive_s;
+    sen5x_stats_result_t result;
+
+    /* start stats test */
+    sen5x_interface_debug_print("sen5x: start stats test.\n");
+
+    /* make a jittered 1 Hz stream crossing zero with dropouts */
+    gs_seed = 0x57A7;
+    ms = 1760000000000ULL;
+    level = 2.0f;
+    for (i = 0; i < SEN5X_STATS_TEST_SAMPLES; i++)
+    {
+        ms += 900 + a_sen5x_stats_test_random() % 200;
+        if ((i % 5000) == 4000)
+        {
+            ms += 400000;
+        }
+        level += (float)((int32_t)(a_sen5x_stats_test_random() % 201) - 100) / 200.0f;
+        gs_timestamp[i] = ms;
+        gs_value[i] = ((a_sen5x_stats_test_random() % 50) == 0) ? NAN : level;
+    }
+    if (times == 0)
+    {
+        times = 1;
+    }
+
+    /* check against a recompute of the window every 37 samples */
+    res = sen5x_stats_init(&gs_stats[0], SEN5X_STATS_TEST_WINDOW_MS, gs_slot[0], SEN5X_STATS_TEST_CAPACITY);
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: stats init failed.\n");
+
+        return 1;
+    }
+    checked = 0;
+    for (i = 0; i < SEN5X_STATS_TEST_SAMPLES; i++)
+    {
+        if (sen5x_stats_push(&gs_stats[0], gs_timestamp[i], gs_value[i]) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: push failed.\n");
+
+            return 1;
+        }
+        if ((i % 37) != 0)
+        {
+            continue;
+        }
+        n = 0;
+        sum = 0.0;
+        for (j = 0; j <= i; j++)
+        {
+            if ((gs_timestamp[i] - gs_timestamp[j] < SEN5X_STATS_TEST_WINDOW_MS) && (isnan(gs_value[j]) == 0))
+            {
+                gs_sorted[n++] = gs_value[j];
+                sum += gs_value[j];
+            }
+        }
+        res = sen5x_stats_get_result(&gs_stats[0], &result);
+        if (n == 0)
+        {
+            if (res != 5)
+            {
+                sen5x_interface_debug_print("sen5x: empty window is not reported.\n");
+
+                return 1;
+            }
+            continue;
+        }
+        mean = sum / n;
+        m2 = 0.0;
+        for (j = 0; j < n; j++)
+        {
+            m2 += (gs_sorted[j] - mean) * (gs_sorted[j] - mean);
+        }
+        qsort(gs_sorted, n, sizeof(float), a_sen5x_stats_test_compare);
+        if ((res != 0) || (result.count != n) ||
+            (fabs(result.mean - mean) > 1e-4 * (fabs(mean) + 1.0)) ||
+            ((n > 1) && (fabs(result.variance - m2 / (n - 1)) > 1e-3 * (m2 / (n - 1) + 1e-3))) ||
+            (result.min != gs_sorted[0]) || (result.max != gs_sorted[n - 1]) ||
+            (a_sen5x_stats_test_quantile_ok(result.p50, gs_sorted[(uint32_t)(0.50f * (n - 1) + 0.5f)]) == 0) ||
+            (a_sen5x_stats_test_quantile_ok(result.p95, gs_sorted[(uint32_t)(0.95f * (n - 1) + 0.5f)]) == 0))
+        {
+            sen5x_interface_debug_print("sen5x: window at sample %d mismatch.\n", i);
+
+            return 1;
+        }
+        checked++;
+    }
+    sen5x_interface_debug_print("sen5x: check %d windows ok.\n", checked);
+
+    /* push one hour of 1 Hz samples into every stream and query each stream every minute */
+    start = clock();
+    queries = 0;
+    sink = 0.0f;
+    for (t = 0; t < times; t++)
+    {
+        for (s = 0; s < SEN5X_STATS_TEST_STREAMS; s++)
+        {
+            (void)sen5x_stats_init(&gs_stats[s], SEN5X_STATS_TEST_WINDOW_MS, gs_slot[s], SEN5X_STATS_TEST_CAPACITY);
+            gs_level[s] = (float)(s % 100);
+        }
+        for (i = 0; i < SEN5X_STATS_TEST_SECONDS; i++)
+        {
+            ms = 1760000000000ULL + (uint64_t)i * 1000;
+            for (s = 0; s < SEN5X_STATS_TEST_STREAMS; s++)
+            {
+                gs_level[s] += (float)((int32_t)(a_sen5x_stats_test_random() % 21) - 10) / 10.0f;
+                (void)sen5x_stats_push(&gs_stats[s], ms, gs_level[s]);
+                if ((i % 60) == (s % 60))
+                {
+                    (void)sen5x_stats_get_result(&gs_stats[s], &result);
+                    sink += result.p95;
+                    queries++;
+                }
+            }
+        }
+    }
+    push_s = (double)(clock() - start) / CLOCKS_PER_SEC / times;
+    sen5x_interface_debug_print("sen5x: %d streams, %0.1f ns per sample with a query per stream minute.\n",
+                                SEN5X_STATS_TEST_STREAMS,
+                                push_s * 1e9 / ((double)SEN5X_STATS_TEST_STREAMS * SEN5X_STATS_TEST_SECONDS));
+
+    /* baseline recomputing a full 5 min window every second */
+    start = clock();
+    for (i = 0; i < SEN5X_STATS_TEST_SECONDS; i++)
+    {
+        for (s = 0; s < SEN5X_STATS_TEST_NAIVE_STREAMS; s++)
+        {
+            gs_history[s][i % 300] = gs_level[s] + (float)(a_sen5x_stats_test_random() % 21) / 10.0f;
+            n = (i < 300) ? (i + 1) : 300;
+            sum = 0.0;
+            for (j = 0; j < n; j++)
+            {
+                gs_sorted[j] = gs_history[s][j];
+                sum += gs_sorted[j];
+            }
+            qsort(gs_sorted, n, sizeof(float), a_sen5x_stats_test_compare);
+            sink += (float)(sum / n) + gs_sorted[(uint32_t)(0.95f * (n - 1) + 0.5f)];
+        }
+    }
+    naive_s = (double)(clock() - start) / CLOCKS_PER_SEC;
+    sen5x_interface_debug_print("sen5x: recompute baseline %0.1f ns per sample, %0.1fx slower.\n",
+                                naive_s * 1e9 / ((double)SEN5X_STATS_TEST_NAIVE_STREAMS * SEN5X_STATS_TEST_SECONDS),
+                                (naive_s / SEN5X_STATS_TEST_NAIVE_STREAMS) / (push_s / SEN5X_STATS_TEST_STREAMS));
+    sen5x_interface_debug_print("sen5x: %d queries, p95 checksum %0.1f.\n", queries, sink);
+
+    /* finish stats test */
+    sen5x_interface_debug_print("sen5x: finish stats test.\n");
+
+    return 0;
+}
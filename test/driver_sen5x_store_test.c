@@ -0,0 +1,461 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_sen5x_store_test.c
+ * @brief     driver sen5x store test source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-18
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/18  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_sen5x_store_test.h"
+#include <time.h>
+
+/**
+ * @brief test definition
+ */
+#define SEN5X_STORE_TEST_BLOCKS         8              /**< ring blocks */
+#define SEN5X_STORE_TEST_SAMPLES        3000           /**< appended samples */
+#define SEN5X_STORE_TEST_RECORDS        10000          /**< packed records */
+#define SEN5X_STORE_TEST_START_MS       1760000000000ULL        /**< first timestamp */
+
+static uint64_t gs_buffer[(SEN5X_STORE_BUFFER_SIZE(SEN5X_STORE_TEST_BLOCKS) + 7) / 8];        /**< 8 bytes aligned store buffer */
+static sen5x_store_sample_t gs_sample[SEN5X_STORE_TEST_SAMPLES];                             /**< appended samples */
+static uint32_t gs_block_start[SEN5X_STORE_TEST_SAMPLES];                                    /**< first sample of every block */
+static uint32_t gs_seed;                                                                     /**< random seed */
+
+/**
+ * @brief  get a pseudo random number
+ * @return number
+ * @note   none
+ */
+static uint32_t a_sen5x_store_test_random(void)
+{
+    gs_seed = gs_seed * 1664525U + 1013904223U;
+
+    return gs_seed >> 8;
+}
+
+/**
+ * @brief     make a sample
+ * @param[in] timestamp_ms timestamp in ms
+ * @param[in] *sample pointer to a sample structure
+ * @note      some samples have invalid words
+ */
+static void a_sen5x_store_test_make(uint64_t timestamp_ms, sen5x_store_sample_t *sample)
+{
+    uint8_t i;
+
+    sample->timestamp_ms = timestamp_ms;
+    for (i = 0; i < 8; i++)
+    {
+        sample->word[i] = (uint16_t)(a_sen5x_store_test_random() & 0x3FFF);
+    }
+    if ((a_sen5x_store_test_random() % 10) == 0)
+    {
+        sample->word[SEN5X_STORE_WORD_PM2P5] = 0xFFFFU;
+    }
+    if ((a_sen5x_store_test_random() % 10) == 0)
+    {
+        sample->word[SEN5X_STORE_WORD_NOX] = 0x7FFFU;
+    }
+}
+
+/**
+ * @brief     check a range scan against the appended samples
+ * @param[in] *store pointer to a store structure
+ * @param[in] oldest first retained sample
+ * @param[in] newest samples appended so far
+ * @param[in] start_ms first timestamp
+ * @param[in] end_ms last timestamp
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_sen5x_store_test_scan(sen5x_store_t *store, uint32_t oldest, uint32_t newest,
+                                       uint64_t start_ms, uint64_t end_ms)
+{
+    uint8_t i;
+    uint32_t j;
+    uint32_t n;
+    sen5x_store_iterator_t iterator;
+    sen5x_store_span_t span;
+
+    if (sen5x_store_scan_begin(store, start_ms, end_ms, &iterator) != 0)
+    {
+        sen5x_interface_debug_print("sen5x: scan begin failed.\n");
+
+        return 1;
+    }
+    n = oldest;
+    while ((n < newest) && (gs_sample[n].timestamp_ms < start_ms))
+    {
+        n++;
+    }
+    while (sen5x_store_scan_next(store, &iterator, &span) == 0)
+    {
+        for (j = 0; j < span.count; j++)
+        {
+            if ((n >= newest) || (gs_sample[n].timestamp_ms > end_ms) ||
+                (span.anchor_ms + span.offset_ms[j] != gs_sample[n].timestamp_ms))
+            {
+                sen5x_interface_debug_print("sen5x: scan returned a wrong sample %d.\n", n);
+
+                return 1;
+            }
+            for (i = 0; i < 8; i++)
+            {
+                if (span.word[i][j] != gs_sample[n].word[i])
+                {
+                    sen5x_interface_debug_print("sen5x: scan returned a wrong word of sample %d.\n", n);
+
+                    return 1;
+                }
+            }
+            n++;
+        }
+    }
+    if ((n < newest) && (gs_sample[n].timestamp_ms <= end_ms))
+    {
+        sen5x_interface_debug_print("sen5x: scan missed sample %d.\n", n);
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief     store test
+ * @param[in] times test times
+ * @return    status code
+ *            - 0 success
+ *            - 1 test failed
+ * @note      runs on the host without a chip
+ */
+uint8_t sen5x_store_test(uint32_t times)
+{
+    uint8_t res;
+    uint8_t flag;
+    uint8_t want;
+    uint8_t record[SEN5X_STORE_RECORD_LENGTH];
+    uint32_t i;
+    uint32_t t;
+    uint32_t k;
+    uint32_t blocks;
+    uint32_t oldest;
+    uint32_t count;
+    uint32_t wraps;
+    uint64_t ms;
+    uint64_t pack_ms;
+    uint64_t unpack_ms;
+    uint64_t error_ms;
+    uint64_t diff;
+    uint64_t gap_ms[] = {0, 1, 999, 1000, 65535, 65536, 65999, 70500, 1500, 65535999ULL, 65536000ULL, 259200000ULL, 7};
+    clock_t start;
+    double append_s;
+    double scan_s;
+    sen5x_store_t store;
+    sen5x_store_sample_t sample;
+    sen5x_store_sample_t unpacked;
+    sen5x_store_iterator_t iterator;
+    sen5x_store_span_t span;
+
+    /* start store test */
+    sen5x_interface_debug_print("sen5x: start store test.\n");
+
+    /* check the params */
+    memset(&store, 0, sizeof(sen5x_store_t));
+    if ((sen5x_store_init(NULL, gs_buffer, sizeof(gs_buffer)) != 2) ||
+        (sen5x_store_init(&store, (uint8_t *)gs_buffer + 1, sizeof(gs_buffer) - 1) != 4) ||
+        (sen5x_store_init(&store, gs_buffer, SEN5X_STORE_BLOCK_SIZE - 1) != 4) ||
+        (sen5x_store_append(&store, &sample) != 3))
+    {
+        sen5x_interface_debug_print("sen5x: check params failed.\n");
+
+        return 1;
+    }
+    res = sen5x_store_init(&store, gs_buffer, sizeof(gs_buffer));
+    if (res != 0)
+    {
+        sen5x_interface_debug_print("sen5x: store init failed.\n");
+
+        return 1;
+    }
+    if ((store.blocks != SEN5X_STORE_TEST_BLOCKS) || (sen5x_store_latest(&store, &sample) != 4))
+    {
+        sen5x_interface_debug_print("sen5x: check empty store failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check params ok.\n");
+
+    /* equal timestamps from the last slot of a block over two whole blocks */
+    gs_seed = 0xE0A1;
+    for (i = 0; i < 4 * SEN5X_STORE_BLOCK_SLOTS; i++)
+    {
+        k = ((i >= SEN5X_STORE_BLOCK_SLOTS - 1) && (i < 3 * SEN5X_STORE_BLOCK_SLOTS)) ? (SEN5X_STORE_BLOCK_SLOTS - 1) : i;
+        a_sen5x_store_test_make(SEN5X_STORE_TEST_START_MS + 1000ULL * k, &gs_sample[i]);
+        if (sen5x_store_append(&store, &gs_sample[i]) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: append of an equal timestamp failed.\n");
+
+            return 1;
+        }
+    }
+    ms = gs_sample[SEN5X_STORE_BLOCK_SLOTS - 1].timestamp_ms;
+    if ((store.filled != 4) ||
+        (a_sen5x_store_test_scan(&store, 0, 4 * SEN5X_STORE_BLOCK_SLOTS, ms, ms) != 0) ||
+        (a_sen5x_store_test_scan(&store, 0, 4 * SEN5X_STORE_BLOCK_SLOTS, ms, UINT64_MAX) != 0) ||
+        (a_sen5x_store_test_scan(&store, 0, 4 * SEN5X_STORE_BLOCK_SLOTS, ms - 1, ms + 1) != 0) ||
+        (a_sen5x_store_test_scan(&store, 0, 4 * SEN5X_STORE_BLOCK_SLOTS, 0, ms) != 0))
+    {
+        sen5x_interface_debug_print("sen5x: check equal timestamps across blocks failed.\n");
+
+        return 1;
+    }
+    (void)sen5x_store_init(&store, gs_buffer, sizeof(gs_buffer));
+    sen5x_interface_debug_print("sen5x: check equal timestamps across blocks ok.\n");
+
+    /* ring wraparound with blocks closed by slots and by gaps */
+    gs_seed = 0x5EA5;
+    ms = SEN5X_STORE_TEST_START_MS;
+    blocks = 0;
+    oldest = 0;
+    wraps = 0;
+    for (i = 0; i < SEN5X_STORE_TEST_SAMPLES; i++)
+    {
+        ms += ((i % 211) == 210) ? 90000 : 1000 + (a_sen5x_store_test_random() % 64);
+        a_sen5x_store_test_make(ms, &gs_sample[i]);
+        if ((i == 0) || ((i - gs_block_start[blocks - 1]) == SEN5X_STORE_BLOCK_SLOTS) ||
+            ((ms - gs_sample[gs_block_start[blocks - 1]].timestamp_ms) > 0xFFFFU))
+        {
+            gs_block_start[blocks] = i;
+            blocks++;
+            if (blocks > SEN5X_STORE_TEST_BLOCKS)
+            {
+                oldest = gs_block_start[blocks - SEN5X_STORE_TEST_BLOCKS];
+            }
+        }
+        if (sen5x_store_append(&store, &gs_sample[i]) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: append failed.\n");
+
+            return 1;
+        }
+        if ((sen5x_store_count(&store, &count) != 0) || (count != i + 1 - oldest) ||
+            (sen5x_store_latest(&store, &sample) != 0) || (memcmp(&sample, &gs_sample[i], sizeof(sample)) != 0))
+        {
+            sen5x_interface_debug_print("sen5x: sample %d has count %d, expect %d.\n", i, count, i + 1 - oldest);
+
+            return 1;
+        }
+
+        /* scan whenever the oldest block isn't the first physical block */
+        if ((blocks > SEN5X_STORE_TEST_BLOCKS) && (store.head != SEN5X_STORE_TEST_BLOCKS - 1) &&
+            ((i % 37) == 0))
+        {
+            wraps++;
+            k = oldest + a_sen5x_store_test_random() % (i + 1 - oldest);
+            if ((a_sen5x_store_test_scan(&store, oldest, i + 1, 0, UINT64_MAX) != 0) ||
+                (a_sen5x_store_test_scan(&store, oldest, i + 1, gs_sample[k].timestamp_ms, UINT64_MAX) != 0) ||
+                (a_sen5x_store_test_scan(&store, oldest, i + 1, gs_sample[oldest].timestamp_ms,
+                                         gs_sample[i].timestamp_ms) != 0) ||
+                (a_sen5x_store_test_scan(&store, oldest, i + 1, gs_sample[oldest].timestamp_ms + 1,
+                                         gs_sample[i].timestamp_ms - 1) != 0) ||
+                (a_sen5x_store_test_scan(&store, oldest, i + 1, gs_sample[k].timestamp_ms,
+                                         gs_sample[k].timestamp_ms) != 0) ||
+                (a_sen5x_store_test_scan(&store, oldest, i + 1, gs_sample[k].timestamp_ms - 30000,
+                                         gs_sample[k].timestamp_ms + 30000) != 0))
+            {
+                sen5x_interface_debug_print("sen5x: scan across the wrap failed at sample %d.\n", i);
+
+                return 1;
+            }
+        }
+    }
+    if (wraps == 0)
+    {
+        sen5x_interface_debug_print("sen5x: ring didn't wrap.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check %d blocks over %d ring blocks ok.\n", blocks, SEN5X_STORE_TEST_BLOCKS);
+    sen5x_interface_debug_print("sen5x: check %d scans across the wrap ok.\n", wraps);
+
+    /* empty ranges */
+    if ((sen5x_store_scan_begin(&store, 0, gs_sample[oldest].timestamp_ms - 1, &iterator) != 0) ||
+        (sen5x_store_scan_next(&store, &iterator, &span) != 4) ||
+        (sen5x_store_scan_begin(&store, gs_sample[SEN5X_STORE_TEST_SAMPLES - 1].timestamp_ms + 1, UINT64_MAX,
+                                &iterator) != 0) ||
+        (sen5x_store_scan_next(&store, &iterator, &span) != 4) ||
+        (sen5x_store_append(&store, &gs_sample[oldest]) != 4))
+    {
+        sen5x_interface_debug_print("sen5x: check empty ranges failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check empty ranges ok.\n");
+
+    /* pack and unpack every delta unit */
+    pack_ms = SEN5X_STORE_TEST_START_MS;
+    unpack_ms = SEN5X_STORE_TEST_START_MS;
+    ms = SEN5X_STORE_TEST_START_MS;
+    for (i = 0; i < sizeof(gap_ms) / sizeof(gap_ms[0]); i++)
+    {
+        ms += gap_ms[i];
+        diff = ms - pack_ms;
+        a_sen5x_store_test_make(ms, &sample);
+        if (sen5x_store_pack_record(&sample, &pack_ms, record) != 0)
+        {
+            sen5x_interface_debug_print("sen5x: pack failed.\n");
+
+            return 1;
+        }
+        (void)sen5x_store_sample_get_flag(&sample, &want);
+        if ((sen5x_store_unpack_record(record, &unpack_ms, &unpacked, &flag) != 0) ||
+            (unpack_ms != pack_ms) || (memcmp(unpacked.word, sample.word, sizeof(sample.word)) != 0) ||
+            ((flag & 0x3F) != want))
+        {
+            sen5x_interface_debug_print("sen5x: unpack of gap %d failed.\n", (uint32_t)gap_ms[i]);
+
+            return 1;
+        }
+        if ((flag & SEN5X_STORE_FLAG_RESYNC) != 0)
+        {
+            if (((diff / 1000) <= 0xFFFFU) || (unpack_ms > ms))
+            {
+                sen5x_interface_debug_print("sen5x: resync of gap %d failed.\n", (uint32_t)gap_ms[i]);
+
+                return 1;
+            }
+            unpack_ms = ms;
+            pack_ms = ms;
+        }
+        else if ((flag & SEN5X_STORE_FLAG_DELTA_SECOND) != 0)
+        {
+            if ((diff <= 0xFFFFU) || (unpack_ms > ms) || ((ms - unpack_ms) >= 1000))
+            {
+                sen5x_interface_debug_print("sen5x: seconds delta of gap %d failed.\n", (uint32_t)gap_ms[i]);
+
+                return 1;
+            }
+        }
+        else if ((diff > 0xFFFFU) || (unpack_ms != ms))
+        {
+            sen5x_interface_debug_print("sen5x: ms delta of gap %d failed.\n", (uint32_t)gap_ms[i]);
+
+            return 1;
+        }
+    }
+    pack_ms = ms + 1;
+    if ((sen5x_store_pack_record(&sample, NULL, record) != 2) ||
+        (sen5x_store_pack_record(&sample, &pack_ms, NULL) != 2) ||
+        (sen5x_store_pack_record(&sample, &pack_ms, record) != 4))
+    {
+        sen5x_interface_debug_print("sen5x: check pack params failed.\n");
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check pack round trip ok.\n");
+
+    /* the dropped ms of seconds deltas don't accumulate */
+    pack_ms = SEN5X_STORE_TEST_START_MS;
+    unpack_ms = SEN5X_STORE_TEST_START_MS;
+    ms = SEN5X_STORE_TEST_START_MS;
+    error_ms = 0;
+    for (i = 0; i < SEN5X_STORE_TEST_RECORDS; i++)
+    {
+        ms += 70000 + (a_sen5x_store_test_random() % 1000);
+        a_sen5x_store_test_make(ms, &sample);
+        if ((sen5x_store_pack_record(&sample, &pack_ms, record) != 0) ||
+            (sen5x_store_unpack_record(record, &unpack_ms, &unpacked, &flag) != 0) ||
+            ((flag & SEN5X_STORE_FLAG_DELTA_SECOND) == 0) || (unpack_ms > ms))
+        {
+            sen5x_interface_debug_print("sen5x: record %d failed.\n", i);
+
+            return 1;
+        }
+        if ((ms - unpack_ms) > error_ms)
+        {
+            error_ms = ms - unpack_ms;
+        }
+    }
+    if (error_ms >= 1000)
+    {
+        sen5x_interface_debug_print("sen5x: seconds delta error grew to %d ms.\n", (uint32_t)error_ms);
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: check %d seconds deltas ok, max error %d ms.\n",
+                                SEN5X_STORE_TEST_RECORDS, (uint32_t)error_ms);
+
+    /* benchmark */
+    if (times == 0)
+    {
+        times = 1;
+    }
+    start = clock();
+    for (t = 0; t < times * 100; t++)
+    {
+        (void)sen5x_store_init(&store, gs_buffer, sizeof(gs_buffer));
+        for (i = 0; i < SEN5X_STORE_TEST_SAMPLES; i++)
+        {
+            (void)sen5x_store_append(&store, &gs_sample[i]);
+        }
+    }
+    append_s = (double)(clock() - start) / CLOCKS_PER_SEC / (times * 100) / SEN5X_STORE_TEST_SAMPLES;
+    count = 0;
+    start = clock();
+    for (t = 0; t < times * 1000; t++)
+    {
+        (void)sen5x_store_scan_begin(&store, 0, UINT64_MAX, &iterator);
+        while (sen5x_store_scan_next(&store, &iterator, &span) == 0)
+        {
+            count += span.count;
+        }
+    }
+    scan_s = (double)(clock() - start) / CLOCKS_PER_SEC / (times * 1000);
+    (void)sen5x_store_count(&store, &k);
+    if (count != times * 1000 * k)
+    {
+        sen5x_interface_debug_print("sen5x: benchmark scan returned %d samples.\n", count);
+
+        return 1;
+    }
+    sen5x_interface_debug_print("sen5x: append %0.1fns, scan of %d samples %0.2fus.\n", append_s * 1e9, k, scan_s * 1e6);
+    sen5x_interface_debug_print("sen5x: %d bytes of state, %d bytes of buffer.\n", (int)sizeof(sen5x_store_t),
+                                (int)SEN5X_STORE_BUFFER_SIZE(SEN5X_STORE_TEST_BLOCKS));
+
+    /* finish store test */
+    sen5x_interface_debug_print("sen5x: finish store test.\n");
+
+    return 0;
+}